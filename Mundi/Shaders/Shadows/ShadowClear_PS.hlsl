@@ -0,0 +1,14 @@
+// 섀도우 아틀라스의 특정 영역만 초기화하는 PS
+// 캐시된 섀도우 뷰가 남아 있는 아틀라스에서 다시 그릴 영역만 지우기 위해 사용합니다.
+// (깊이는 뷰포트 MinDepth = MaxDepth = 1 로 기록, VSM 모멘트는 ClearRenderTargetView와 동일한 값으로 기록)
+
+struct PS_INPUT
+{
+    float4 Position : SV_POSITION;
+    float2 TexCoord : TEXCOORD0;
+};
+
+float2 mainPS(PS_INPUT Input) : SV_TARGET
+{
+    return float2(1.0f, 1.0f);
+}
@@ -658,7 +658,8 @@ bool FObjImporter::LoadObjModel(const FString& InFileName, FObjInfo* const OutOb
 			std::stringstream wss(Face);
 			FString VertexDef;
 
-			TArray<FFaceVertex> LineFaceVertices;
+			// 면 하나의 정점은 대부분 3~4개이므로 인라인 배열로 줄마다 생기는 힙 할당을 피한다
+			TInlineArray<FFaceVertex, 8> LineFaceVertices;
 			while (wss >> VertexDef)
 			{
 				// '#'을 만나면 주석 처리 (이후 데이터 무시)
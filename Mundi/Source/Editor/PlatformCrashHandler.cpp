@@ -82,6 +82,9 @@ void FPlatformCrashHandler::TickCrashMode()
 
 LONG WINAPI FPlatformCrashHandler::UnhandledExceptionFilter(EXCEPTION_POINTERS* ExceptionInfo)
 {
+    // 링 버퍼에 남은 로그를 파일로 (드레인 중 크래시했다면 건너뜀)
+    FLogManager::GetInstance().Flush(false);
+
     // 크래시 발생 시 자동으로 MiniDump 생성
     wchar_t dumpPath[MAX_PATH];
     GetDumpFilePath(dumpPath, MAX_PATH);
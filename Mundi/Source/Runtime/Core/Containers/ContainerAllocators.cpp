@@ -0,0 +1,258 @@
+﻿#include "pch.h"
+#include "ContainerAllocators.h"
+
+namespace
+{
+    SIZE_T AlignUp(SIZE_T Value, SIZE_T Alignment)
+    {
+        return (Value + Alignment - 1) & ~(Alignment - 1);
+    }
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// FFrameStack
+// ────────────────────────────────────────────────────────────────────────────
+
+FFrameStack& FFrameStack::Get()
+{
+    thread_local FFrameStack Stack;
+    return Stack;
+}
+
+FFrameStack::~FFrameStack()
+{
+    for (FPage& Page : Pages)
+    {
+        ::operator delete(Page.Data, std::align_val_t(alignof(std::max_align_t)));
+    }
+    Pages.Empty();
+}
+
+void* FFrameStack::Allocate(SIZE_T Size, SIZE_T Alignment)
+{
+    if (Size == 0)
+    {
+        Size = 1;
+    }
+
+    // 마크 밖에서는 회수 시점이 없으므로 힙을 쓴다
+    if (NumMarks == 0 || Alignment > alignof(std::max_align_t))
+    {
+        return ::operator new(Size, std::align_val_t(Alignment));
+    }
+
+    if (CurrentPage >= 0)
+    {
+        FPage& Page = Pages[CurrentPage];
+        const SIZE_T Start = AlignUp(Offset, Alignment);
+        if (Start + Size <= Page.Size)
+        {
+            Offset = Start + Size;
+            return Page.Data + Start;
+        }
+    }
+
+    // 다음 페이지로 넘어간다. 재사용할 페이지가 작으면 그 자리에 새 페이지를 끼워 넣는다
+    const int32 NextPage = CurrentPage + 1;
+    if (NextPage >= Pages.Num() || Pages[NextPage].Size < Size)
+    {
+        FPage NewPage;
+        NewPage.Size = std::max(DefaultPageSize, AlignUp(Size, DefaultPageSize));
+        NewPage.Data = static_cast<uint8*>(::operator new(NewPage.Size, std::align_val_t(alignof(std::max_align_t))));
+        Pages.Insert(NewPage, NextPage);
+    }
+
+    CurrentPage = NextPage;
+    Offset = Size;
+    return Pages[CurrentPage].Data;
+}
+
+void FFrameStack::Free(void* Ptr, SIZE_T Size, SIZE_T Alignment)
+{
+    if (!Ptr)
+    {
+        return;
+    }
+
+    if (!Owns(Ptr))
+    {
+        ::operator delete(Ptr, std::align_val_t(Alignment));
+        return;
+    }
+
+    // 가장 최근 할당이면 바로 되돌린다 (배열이 커지면서 버린 버퍼는 마크가 풀릴 때 회수)
+    if (CurrentPage >= 0)
+    {
+        uint8* PageData = Pages[CurrentPage].Data;
+        uint8* Bytes = static_cast<uint8*>(Ptr);
+        if (Bytes >= PageData && Bytes + Size == PageData + Offset)
+        {
+            Offset = static_cast<SIZE_T>(Bytes - PageData);
+        }
+    }
+}
+
+bool FFrameStack::Owns(const void* Ptr) const
+{
+    const uint8* Bytes = static_cast<const uint8*>(Ptr);
+    for (const FPage& Page : Pages)
+    {
+        if (Bytes >= Page.Data && Bytes < Page.Data + Page.Size)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+SIZE_T FFrameStack::GetBytesUsed() const
+{
+    SIZE_T Used = 0;
+    for (int32 i = 0; i < CurrentPage; ++i)
+    {
+        Used += Pages[i].Size;
+    }
+    return Used + (CurrentPage >= 0 ? Offset : 0);
+}
+
+SIZE_T FFrameStack::GetBytesReserved() const
+{
+    SIZE_T Reserved = 0;
+    for (const FPage& Page : Pages)
+    {
+        Reserved += Page.Size;
+    }
+    return Reserved;
+}
+
+FFrameStackMark::FFrameStackMark()
+    : Stack(FFrameStack::Get())
+    , SavedPage(Stack.CurrentPage)
+    , SavedOffset(Stack.Offset)
+{
+    ++Stack.NumMarks;
+}
+
+FFrameStackMark::~FFrameStackMark()
+{
+    Stack.CurrentPage = SavedPage;
+    Stack.Offset = SavedOffset;
+    --Stack.NumMarks;
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// Self test
+// ────────────────────────────────────────────────────────────────────────────
+
+int32 RunContainerAllocatorSelfTest(TArray<FString>& OutFailures)
+{
+    int32 NumChecks = 0;
+    auto Check = [&](bool bCondition, const char* Description)
+    {
+        ++NumChecks;
+        if (!bCondition)
+        {
+            OutFailures.Add(Description);
+        }
+    };
+
+    // 인라인 용량 안에서는 힙으로 나가지 않는다
+    {
+        TInlineArray<int32, 8> Array;
+        for (int32 i = 0; i < 8; ++i)
+        {
+            Array.Add(i);
+        }
+        Check(Array.IsUsingInlineStorage(), "inline: 8 elements stay inline");
+
+        // 넘치면 힙으로 옮겨가고 내용은 보존된다
+        for (int32 i = 8; i < 100; ++i)
+        {
+            Array.Add(i);
+        }
+        bool bOrdered = Array.Num() == 100;
+        for (int32 i = 0; bOrdered && i < 100; ++i)
+        {
+            bOrdered = Array[i] == i;
+        }
+        Check(!Array.IsUsingInlineStorage(), "inline: growth past capacity spills to heap");
+        Check(bOrdered, "inline: contents preserved across growth");
+
+        // 줄이면 다시 인라인 버퍼로 돌아온다
+        Array.SetNum(5);
+        Array.Shrink();
+        Check(Array.IsUsingInlineStorage() && Array.Num() == 5 && Array[4] == 4, "inline: shrink returns to inline storage");
+
+        // 인라인 버퍼로 돌아온 뒤 다시 키워도 안전해야 한다
+        for (int32 i = 5; i < 20; ++i)
+        {
+            Array.Add(i);
+        }
+        Check(Array.Num() == 20 && Array[19] == 19 && Array[0] == 0, "inline: regrow after shrink");
+    }
+
+    // 복사/이동은 각자의 버퍼를 쓴다
+    {
+        TInlineArray<FString, 4> Source;
+        Source.Add("A");
+        Source.Add("B");
+
+        TInlineArray<FString, 4> Copy(Source);
+        Check(Copy.IsUsingInlineStorage() && Copy.GetData() != Source.GetData() && Copy.Num() == 2 && Copy[1] == "B", "inline: copy uses its own buffer");
+
+        TInlineArray<FString, 4> Moved(std::move(Source));
+        Check(Moved.IsUsingInlineStorage() && Moved.Num() == 2 && Moved[0] == "A" && Source.IsEmpty(), "inline: move transfers elements");
+
+        TInlineArray<FString, 4> Spilled;
+        for (int32 i = 0; i < 16; ++i)
+        {
+            Spilled.Add(std::to_string(i));
+        }
+        Moved = std::move(Spilled);
+        Check(Moved.Num() == 16 && Moved[15] == "15" && Spilled.IsEmpty(), "inline: move-assign from heap storage");
+
+        Copy = Moved;
+        Check(Copy.Num() == 16 && Copy[7] == "7", "inline: copy-assign grows to heap");
+
+        // 힙 배열로 복사된 배열은 원본의 인라인 버퍼를 공유하지 않는다
+        TInlineArray<FString, 4> Small;
+        Small.Add("S");
+        TArray<FString, TInlineAllocator<FString>> Sliced(Small);
+        Check(Sliced.GetData() != Small.GetData() && Sliced.Num() == 1 && Sliced[0] == "S", "inline: sliced copy does not share inline buffer");
+
+        TArray<int32> Plain = { 1, 2, 3 };
+        TInlineArray<int32, 4> FromPlain(Plain);
+        Check(FromPlain.IsUsingInlineStorage() && FromPlain.Num() == 3 && FromPlain[2] == 3, "inline: construct from TArray");
+
+        TConstArrayView<int32> View(FromPlain);
+        Check(View.Num() == 3 && View[0] == 1 && View.GetData() == FromPlain.GetData(), "view: wraps inline array without copy");
+    }
+
+    // 프레임 스택: 마크 안에서는 스택에서, 마크가 풀리면 회수
+    {
+        FFrameStack& Stack = FFrameStack::Get();
+        const SIZE_T UsedBefore = Stack.GetBytesUsed();
+        {
+            FFrameStackMark Mark;
+            TFrameArray<int32> Array;
+            for (int32 i = 0; i < 1000; ++i)
+            {
+                Array.Add(i);
+            }
+            Check(Stack.Owns(Array.GetData()), "frame: allocation comes from the stack inside a mark");
+            Check(Array[999] == 999, "frame: contents preserved across growth");
+
+            // 페이지보다 큰 할당
+            TFrameArray<uint8> Large;
+            Large.SetNum(static_cast<int32>(FFrameStack::DefaultPageSize * 2));
+            Check(Stack.Owns(Large.GetData()), "frame: oversized allocation gets its own page");
+        }
+        Check(Stack.GetBytesUsed() == UsedBefore, "frame: mark releases everything");
+
+        TFrameArray<int32> Outside;
+        Outside.Add(1);
+        Check(!Stack.Owns(Outside.GetData()), "frame: allocation outside a mark uses the heap");
+    }
+
+    return NumChecks;
+}
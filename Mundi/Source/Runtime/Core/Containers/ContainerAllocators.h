@@ -0,0 +1,308 @@
+﻿#pragma once
+
+/**
+ * TArray 할당자 정책
+ * - TInlineArray<T, N>: 요소 N개까지는 객체 안의 버퍼를 쓰고, 넘치면 힙으로 옮겨간다 (핫 패스의 짧은 임시 배열용).
+ * - TFrameArray<T>: 스레드별 프레임 스택(선형 할당)에서 메모리를 받는다. FFrameStackMark 범위를 벗어나면 한꺼번에 회수된다.
+ * 둘 다 TArray의 API(Add/Emplace/RemoveAtSwap/Num ...)를 그대로 쓰며, 다른 할당자의 배열을 받아야 하는 함수는 TConstArrayView를 쓴다.
+ */
+
+// ────────────────────────────────────────────────────────────────────────────
+// Inline allocator
+// ────────────────────────────────────────────────────────────────────────────
+
+/** TInlineArray가 소유하는 인라인 버퍼 정보. 할당자는 이 포인터만 들고 다닌다. */
+struct FInlineAllocatorArena
+{
+    void* Buffer = nullptr;
+    SIZE_T Capacity = 0;            // 바이트
+    const void* TypeTag = nullptr;  // 요소 타입 (MSVC 디버그의 rebind 할당이 버퍼를 가져가지 않도록)
+    bool bInUse = false;
+};
+
+template<typename T>
+inline const void* GetInlineAllocatorTypeTag()
+{
+    static const char Tag = 0;
+    return &Tag;
+}
+
+template<typename T>
+class TInlineAllocator
+{
+public:
+    using value_type = T;
+
+    // 컨테이너끼리 할당자(= 버퍼)를 주고받지 않는다. 대입/이동은 요소 단위로 이루어진다.
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::false_type;
+    using propagate_on_container_swap = std::false_type;
+    using is_always_equal = std::false_type;
+
+    TInlineAllocator() noexcept = default;
+    explicit TInlineAllocator(FInlineAllocatorArena* InArena) noexcept : Arena(InArena) {}
+
+    template<typename U>
+    TInlineAllocator(const TInlineAllocator<U>& Other) noexcept : Arena(Other.Arena) {}
+
+    T* allocate(SIZE_T Count)
+    {
+        if (Arena && !Arena->bInUse && Arena->TypeTag == GetInlineAllocatorTypeTag<T>() && Count * sizeof(T) <= Arena->Capacity)
+        {
+            Arena->bInUse = true;
+            return static_cast<T*>(Arena->Buffer);
+        }
+        return std::allocator<T>().allocate(Count);
+    }
+
+    void deallocate(T* Ptr, SIZE_T Count)
+    {
+        if (Arena && Ptr == Arena->Buffer)
+        {
+            Arena->bInUse = false;
+            return;
+        }
+        std::allocator<T>().deallocate(Ptr, Count);
+    }
+
+    /** 복사로 만들어진 배열은 원본의 인라인 버퍼를 공유하지 않고 힙을 쓴다 */
+    TInlineAllocator select_on_container_copy_construction() const noexcept
+    {
+        return TInlineAllocator();
+    }
+
+    template<typename U>
+    bool operator==(const TInlineAllocator<U>& Other) const noexcept { return Arena == Other.Arena; }
+    template<typename U>
+    bool operator!=(const TInlineAllocator<U>& Other) const noexcept { return Arena != Other.Arena; }
+
+private:
+    template<typename U>
+    friend class TInlineAllocator;
+
+    FInlineAllocatorArena* Arena = nullptr;
+};
+
+template<typename T, int32 NumInline>
+struct TInlineArrayStorage
+{
+    TInlineArrayStorage() noexcept
+    {
+        InlineArena.Buffer = InlineBytes;
+        InlineArena.Capacity = sizeof(InlineBytes);
+        InlineArena.TypeTag = GetInlineAllocatorTypeTag<T>();
+    }
+
+    // 배열 객체마다 고유한 버퍼이므로 복사/이동 시 새 버퍼를 쓴다
+    TInlineArrayStorage(const TInlineArrayStorage&) noexcept : TInlineArrayStorage() {}
+    TInlineArrayStorage& operator=(const TInlineArrayStorage&) noexcept { return *this; }
+
+    alignas(T) unsigned char InlineBytes[sizeof(T) * NumInline];
+    FInlineAllocatorArena InlineArena;
+};
+
+/**
+ * TInlineArray - 요소 NumInline개까지 힙 할당이 없는 TArray
+ * @note 이동은 요소 단위로 이루어진다 (버퍼를 훔칠 수 없음). swap 멤버는 막아두었다.
+ */
+template<typename T, int32 NumInline>
+class TInlineArray : private TInlineArrayStorage<T, NumInline>, public TArray<T, TInlineAllocator<T>>
+{
+    using Storage = TInlineArrayStorage<T, NumInline>;
+    using Super = TArray<T, TInlineAllocator<T>>;
+
+public:
+    TInlineArray()
+        : Storage(), Super(TInlineAllocator<T>(&this->InlineArena))
+    {
+        this->reserve(NumInline);
+    }
+
+    TInlineArray(std::initializer_list<T> InitList)
+        : TInlineArray()
+    {
+        this->assign(InitList);
+    }
+
+    TInlineArray(const TInlineArray& Other)
+        : TInlineArray()
+    {
+        this->assign(Other.begin(), Other.end());
+    }
+
+    TInlineArray(TInlineArray&& Other)
+        : TInlineArray()
+    {
+        MoveElementsFrom(Other);
+    }
+
+    /** 다른 할당자의 배열에서 복사 */
+    template<typename OtherAllocator>
+    TInlineArray(const TArray<T, OtherAllocator>& Other)
+        : TInlineArray()
+    {
+        this->assign(Other.begin(), Other.end());
+    }
+
+    TInlineArray& operator=(const TInlineArray& Other)
+    {
+        if (this != &Other)
+        {
+            this->assign(Other.begin(), Other.end());
+        }
+        return *this;
+    }
+
+    TInlineArray& operator=(TInlineArray&& Other)
+    {
+        if (this != &Other)
+        {
+            this->clear();
+            MoveElementsFrom(Other);
+        }
+        return *this;
+    }
+
+    template<typename OtherAllocator>
+    TInlineArray& operator=(const TArray<T, OtherAllocator>& Other)
+    {
+        this->assign(Other.begin(), Other.end());
+        return *this;
+    }
+
+    void swap(TInlineArray&) = delete;
+
+    /** 현재 인라인 버퍼를 쓰고 있는지 */
+    bool IsUsingInlineStorage() const
+    {
+        return static_cast<const void*>(this->data()) == static_cast<const void*>(this->InlineBytes);
+    }
+
+    /** 용량을 줄인다. 요소가 NumInline개 이하이면 인라인 버퍼로 되돌아간다 */
+    void Shrink()
+    {
+        if (this->capacity() <= static_cast<SIZE_T>(NumInline))
+        {
+            return;
+        }
+        if (this->size() > static_cast<SIZE_T>(NumInline))
+        {
+            this->shrink_to_fit();
+            return;
+        }
+
+        Super Temp(std::make_move_iterator(this->begin()), std::make_move_iterator(this->end()), TInlineAllocator<T>());
+        this->clear();
+        this->shrink_to_fit();
+        this->reserve(NumInline);
+        MoveElementsFrom(Temp);
+    }
+
+private:
+    template<typename ArrayType>
+    void MoveElementsFrom(ArrayType& Other)
+    {
+        for (T& Element : Other)
+        {
+            this->emplace_back(std::move(Element));
+        }
+        Other.clear();
+    }
+};
+
+// ────────────────────────────────────────────────────────────────────────────
+// Frame stack allocator
+// ────────────────────────────────────────────────────────────────────────────
+
+/**
+ * 스레드별 선형 할당 스택 (UE의 FMemStack과 같은 용도)
+ * - FFrameStackMark가 하나라도 살아있을 때만 스택에서 할당한다. 마크 밖의 할당은 힙으로 보낸다.
+ * - 해제는 스택 꼭대기일 때만 되돌리고, 나머지는 마크가 풀릴 때 한꺼번에 회수된다.
+ * - 페이지는 반환하지 않고 다음 프레임에 재사용한다.
+ * @note 할당과 해제는 같은 스레드에서 해야 하며, 배열이 자신을 감싼 마크보다 오래 살면 안 된다.
+ */
+class FFrameStack
+{
+public:
+    static FFrameStack& Get();
+
+    ~FFrameStack();
+
+    void* Allocate(SIZE_T Size, SIZE_T Alignment);
+    void Free(void* Ptr, SIZE_T Size, SIZE_T Alignment);
+
+    bool Owns(const void* Ptr) const;
+    int32 GetNumMarks() const { return NumMarks; }
+    SIZE_T GetBytesUsed() const;
+    SIZE_T GetBytesReserved() const;
+
+    static constexpr SIZE_T DefaultPageSize = 64 * 1024;
+
+private:
+    friend class FFrameStackMark;
+
+    FFrameStack() = default;
+    FFrameStack(const FFrameStack&) = delete;
+    FFrameStack& operator=(const FFrameStack&) = delete;
+
+    struct FPage
+    {
+        uint8* Data = nullptr;
+        SIZE_T Size = 0;
+    };
+
+    TArray<FPage> Pages;
+    int32 CurrentPage = -1;
+    SIZE_T Offset = 0;      // CurrentPage 안의 사용량
+    int32 NumMarks = 0;
+};
+
+/** 생성 시점의 스택 위치를 기억했다가 소멸 시 되돌린다 */
+class FFrameStackMark
+{
+public:
+    FFrameStackMark();
+    ~FFrameStackMark();
+
+    FFrameStackMark(const FFrameStackMark&) = delete;
+    FFrameStackMark& operator=(const FFrameStackMark&) = delete;
+
+private:
+    FFrameStack& Stack;
+    int32 SavedPage;
+    SIZE_T SavedOffset;
+};
+
+template<typename T>
+class TFrameStackAllocator
+{
+public:
+    using value_type = T;
+    using is_always_equal = std::true_type;
+
+    TFrameStackAllocator() noexcept = default;
+
+    template<typename U>
+    TFrameStackAllocator(const TFrameStackAllocator<U>&) noexcept {}
+
+    T* allocate(SIZE_T Count)
+    {
+        return static_cast<T*>(FFrameStack::Get().Allocate(Count * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* Ptr, SIZE_T Count)
+    {
+        FFrameStack::Get().Free(Ptr, Count * sizeof(T), alignof(T));
+    }
+
+    template<typename U>
+    bool operator==(const TFrameStackAllocator<U>&) const noexcept { return true; }
+    template<typename U>
+    bool operator!=(const TFrameStackAllocator<U>&) const noexcept { return false; }
+};
+
+template<typename T>
+using TFrameArray = TArray<T, TFrameStackAllocator<T>>;
+
+/** 할당자 정책 자체 점검 (콘솔 CONTAINER SELFTEST). 실패한 항목 설명을 OutFailures에 담고, 검사 수를 반환 */
+int32 RunContainerAllocatorSelfTest(TArray<FString>& OutFailures);
@@ -0,0 +1,121 @@
+﻿#include "pch.h"
+#include "FlatHashMap.h"
+#include "PlatformTime.h"
+#include <random>
+
+namespace
+{
+    // 실제 사용처(컴포넌트 → 바운드)와 비슷한 크기의 값
+    struct FBenchValue
+    {
+        float Min[3];
+        float Max[3];
+    };
+
+    template<typename Func>
+    double MeasureMS(Func&& InFunc)
+    {
+        const uint64 Start = FPlatformTime::Cycles64();
+        InFunc();
+        return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+    }
+
+    template<typename MapType>
+    void RunMapBenchmark(const TArray<void*>& Keys, const TArray<void*>& MissKeys, int32 FindRounds,
+        double& OutInsertMS, double& OutFindHitMS, double& OutFindMissMS, double& OutIterateMS, double& OutRemoveMS)
+    {
+        MapType Map;
+        volatile float Sink = 0.0f;
+
+        OutInsertMS = MeasureMS([&]()
+        {
+            for (void* Key : Keys)
+            {
+                Map.Add(Key, FBenchValue{ { 1.0f, 2.0f, 3.0f }, { 4.0f, 5.0f, 6.0f } });
+            }
+        });
+
+        OutFindHitMS = MeasureMS([&]()
+        {
+            float Sum = 0.0f;
+            for (int32 Round = 0; Round < FindRounds; ++Round)
+            {
+                for (void* Key : Keys)
+                {
+                    if (const FBenchValue* Value = Map.Find(Key))
+                    {
+                        Sum += Value->Min[0];
+                    }
+                }
+            }
+            Sink = Sum;
+        });
+
+        OutFindMissMS = MeasureMS([&]()
+        {
+            int32 Found = 0;
+            for (int32 Round = 0; Round < FindRounds; ++Round)
+            {
+                for (void* Key : MissKeys)
+                {
+                    Found += Map.Contains(Key) ? 1 : 0;
+                }
+            }
+            Sink = static_cast<float>(Found);
+        });
+
+        OutIterateMS = MeasureMS([&]()
+        {
+            float Sum = 0.0f;
+            for (int32 Round = 0; Round < FindRounds; ++Round)
+            {
+                for (const auto& Pair : Map)
+                {
+                    Sum += Pair.second.Max[2];
+                }
+            }
+            Sink = Sum;
+        });
+
+        OutRemoveMS = MeasureMS([&]()
+        {
+            for (int32 i = 0; i < Keys.Num(); i += 2)
+            {
+                Map.Remove(Keys[i]);
+            }
+        });
+
+        (void)Sink;
+    }
+}
+
+FFlatHashBenchmarkResult RunFlatHashBenchmark(int32 NumKeys)
+{
+    FFlatHashBenchmarkResult Result;
+    Result.NumKeys = std::max(NumKeys, 1);
+
+    // 컴포넌트 포인터처럼 흩어진 주소를 흉내 낸다 (정렬된 힙 블록 내부 주소를 섞는다)
+    TArray<uint8> AddressSpace;
+    AddressSpace.SetNum(Result.NumKeys * 2 * 64);
+    TArray<void*> AllKeys;
+    AllKeys.Reserve(Result.NumKeys * 2);
+    for (int32 i = 0; i < Result.NumKeys * 2; ++i)
+    {
+        AllKeys.Add(AddressSpace.GetData() + i * 64);
+    }
+    std::mt19937 Rng(12345);
+    std::shuffle(AllKeys.begin(), AllKeys.end(), Rng);
+
+    TArray<void*> Keys(AllKeys.begin(), AllKeys.begin() + Result.NumKeys);
+    TArray<void*> MissKeys(AllKeys.begin() + Result.NumKeys, AllKeys.end());
+
+    // 작은 입력은 측정 가능한 시간이 나오도록 반복한다
+    const int32 FindRounds = std::max(1, 1000000 / Result.NumKeys);
+
+    RunMapBenchmark<TMap<void*, FBenchValue>>(Keys, MissKeys, FindRounds,
+        Result.StdInsertMS, Result.StdFindHitMS, Result.StdFindMissMS, Result.StdIterateMS, Result.StdRemoveMS);
+    RunMapBenchmark<TFlatMap<void*, FBenchValue>>(Keys, MissKeys, FindRounds,
+        Result.FlatInsertMS, Result.FlatFindHitMS, Result.FlatFindMissMS, Result.FlatIterateMS, Result.FlatRemoveMS);
+
+    return Result;
+}
@@ -0,0 +1,466 @@
+﻿#pragma once
+
+/**
+ * TFlatMap / TFlatSet - 오픈 어드레싱(Robin Hood) 해시 컨테이너
+ * - 요소는 TArray에 촘촘하게 저장하고, 해시 인덱스(슬롯 = 해시 + 요소 번호, 8바이트)만 오픈 어드레싱으로 관리한다.
+ *   삽입 시 노드 할당이 없고, 조회는 슬롯 배열을 선형으로 훑은 뒤 요소를 한 번만 비교한다.
+ * - 순회는 요소 배열 순서 그대로다. 키 값(포인터 주소 등)과 무관하게 같은 연산 순서면 항상 같은 순서가 나온다.
+ *   Remove는 마지막 요소를 빈자리로 옮기므로(O(1)) 삽입 순서가 바뀔 수 있고, bPreserveOrder = true이면 삽입 순서를 유지한다(O(N)).
+ * - TMap/TSet(std::unordered_*)과 달리 Add/Remove 뒤에는 Find로 얻은 포인터와 요소 참조가 무효화된다.
+ *   값의 주소를 오래 들고 있어야 하는 곳(ShaderVariantMap 등)은 계속 TMap을 쓴다.
+ * - 반복자는 인덱스 기반이라 순회 중 Add/Remove가 일어나도 깨지지 않는다 (OnRegister에서 컴포넌트를 추가하는 경우 등).
+ *   순회 중 추가된 요소는 이번 순회에서 빠지고, 제거 시 옮겨진 요소는 건너뛸 수 있다.
+ */
+namespace FlatHash
+{
+    struct FSlot
+    {
+        uint32 Hash = 0;
+        int32 ElementIndex = -1;    // -1이면 빈 슬롯
+    };
+
+    /** std::hash 결과(MSVC 포인터 해시 등)의 비트를 고르게 섞어 32비트로 줄인다 */
+    inline uint32 MixHash(uint64 Value)
+    {
+        Value ^= Value >> 33;
+        Value *= 0xff51afd7ed558ccdULL;
+        Value ^= Value >> 33;
+        Value *= 0xc4ceb9fe1a85ec53ULL;
+        Value ^= Value >> 33;
+        return static_cast<uint32>(Value);
+    }
+
+    template<typename KeyType>
+    inline uint32 HashKey(const KeyType& Key)
+    {
+        return MixHash(static_cast<uint64>(std::hash<KeyType>{}(Key)));
+    }
+}
+
+/** 요소 배열을 인덱스로 순회하는 반복자. 순회 중 배열이 재할당되거나 줄어들어도 안전하다. */
+template<typename ArrayType, typename ElementType>
+class TFlatHashIterator
+{
+public:
+    TFlatHashIterator(ArrayType& InElements, int32 InIndex)
+        : Elements(&InElements), Index(InIndex)
+    {
+    }
+
+    ElementType& operator*() const { return (*Elements)[Index]; }
+    ElementType* operator->() const { return &(*Elements)[Index]; }
+
+    TFlatHashIterator& operator++()
+    {
+        ++Index;
+        return *this;
+    }
+
+    // 순회 중 요소가 줄어도 범위를 벗어나지 않도록 현재 크기에 닿으면 끝낸다
+    bool operator!=(const TFlatHashIterator& Other) const { return Index != Other.Index && Index < Elements->Num(); }
+    bool operator==(const TFlatHashIterator& Other) const { return !(*this != Other); }
+
+private:
+    ArrayType* Elements;
+    int32 Index;
+};
+
+/** TFlatMap/TFlatSet 공용 해시 테이블. KeyFuncs::GetKey(Element)로 요소에서 키를 꺼낸다. */
+template<typename KeyType, typename ElementType, typename KeyFuncs, bool bPreserveOrder>
+class TFlatHashTable
+{
+public:
+    /** 크기 관련 */
+    int32 Num() const
+    {
+        return Elements.Num();
+    }
+
+    bool IsEmpty() const
+    {
+        return Elements.IsEmpty();
+    }
+
+    /** 요소를 모두 지운다. 슬롯 배열과 요소 용량은 유지 (매 프레임 비우는 집합용) */
+    void Empty()
+    {
+        Elements.Empty();
+        ElementHashes.Empty();
+        std::fill(Slots.begin(), Slots.end(), FlatHash::FSlot());
+    }
+
+    void Reserve(int32 Number)
+    {
+        Elements.Reserve(Number);
+        ElementHashes.Reserve(Number);
+
+        int32 NeededSlots = MinSlots;
+        while (NeededSlots * 4 < Number * 5)
+        {
+            NeededSlots <<= 1;
+        }
+        if (NeededSlots > Slots.Num())
+        {
+            Rehash(NeededSlots);
+        }
+    }
+
+    /** 요소 배열 바이트 + 슬롯 배열 바이트 (통계용) */
+    SIZE_T GetAllocatedSize() const
+    {
+        return Elements.capacity() * sizeof(ElementType) + ElementHashes.capacity() * sizeof(uint32)
+            + Slots.capacity() * sizeof(FlatHash::FSlot);
+    }
+
+protected:
+    static constexpr int32 MinSlots = 16;
+
+    int32 FindIndex(const KeyType& Key, uint32 Hash) const
+    {
+        const int32 SlotIndex = FindSlot(Key, Hash);
+        return SlotIndex >= 0 ? Slots[SlotIndex].ElementIndex : -1;
+    }
+
+    /** 키가 없는 것이 확인된 뒤에 호출한다 */
+    template<typename... Args>
+    int32 AddNew(uint32 Hash, Args&&... InArgs)
+    {
+        // 적재율 80%를 넘기 전에 슬롯을 두 배로 늘린다
+        if ((Elements.Num() + 1) * 5 > Slots.Num() * 4)
+        {
+            Rehash(Slots.IsEmpty() ? MinSlots : Slots.Num() * 2);
+        }
+
+        const int32 NewIndex = Elements.Emplace(std::forward<Args>(InArgs)...);
+        ElementHashes.Add(Hash);
+        InsertSlot(Hash, NewIndex);
+        return NewIndex;
+    }
+
+    bool RemoveKey(const KeyType& Key)
+    {
+        const int32 SlotIndex = FindSlot(Key, FlatHash::HashKey(Key));
+        if (SlotIndex < 0)
+        {
+            return false;
+        }
+
+        const int32 ElementIndex = Slots[SlotIndex].ElementIndex;
+        EraseSlot(SlotIndex);
+
+        const int32 LastIndex = Elements.Num() - 1;
+        if constexpr (bPreserveOrder)
+        {
+            // 뒤쪽 요소를 한 칸씩 당기고, 슬롯의 요소 번호도 함께 당긴다
+            Elements.RemoveAt(ElementIndex);
+            ElementHashes.RemoveAt(ElementIndex);
+            if (ElementIndex != LastIndex)
+            {
+                for (FlatHash::FSlot& Slot : Slots)
+                {
+                    if (Slot.ElementIndex > ElementIndex)
+                    {
+                        --Slot.ElementIndex;
+                    }
+                }
+            }
+        }
+        else
+        {
+            // 마지막 요소를 빈자리로 옮기고, 그 요소를 가리키던 슬롯을 고친다
+            if (ElementIndex != LastIndex)
+            {
+                Slots[FindSlotOfElement(LastIndex)].ElementIndex = ElementIndex;
+                Elements[ElementIndex] = std::move(Elements[LastIndex]);
+                ElementHashes[ElementIndex] = ElementHashes[LastIndex];
+            }
+            Elements.pop_back();
+            ElementHashes.pop_back();
+        }
+        return true;
+    }
+
+    TArray<ElementType> Elements;
+
+private:
+    /** 슬롯 위치와 그 슬롯 해시의 이상적 위치 사이 거리 */
+    uint32 ProbeDistance(uint32 SlotIndex, uint32 Hash) const
+    {
+        return (SlotIndex - Hash) & SlotMask;
+    }
+
+    int32 FindSlot(const KeyType& Key, uint32 Hash) const
+    {
+        if (Elements.IsEmpty())
+        {
+            return -1;
+        }
+
+        uint32 SlotIndex = Hash & SlotMask;
+        for (uint32 Distance = 0; ; ++Distance)
+        {
+            const FlatHash::FSlot& Slot = Slots[SlotIndex];
+
+            // Robin Hood 불변식: 자기보다 가까이 자리 잡은 슬롯을 만나면 키는 없다
+            if (Slot.ElementIndex < 0 || ProbeDistance(SlotIndex, Slot.Hash) < Distance)
+            {
+                return -1;
+            }
+            if (Slot.Hash == Hash && KeyFuncs::GetKey(Elements[Slot.ElementIndex]) == Key)
+            {
+                return static_cast<int32>(SlotIndex);
+            }
+            SlotIndex = (SlotIndex + 1) & SlotMask;
+        }
+    }
+
+    int32 FindSlotOfElement(int32 ElementIndex) const
+    {
+        uint32 SlotIndex = ElementHashes[ElementIndex] & SlotMask;
+        while (Slots[SlotIndex].ElementIndex != ElementIndex)
+        {
+            SlotIndex = (SlotIndex + 1) & SlotMask;
+        }
+        return static_cast<int32>(SlotIndex);
+    }
+
+    void InsertSlot(uint32 Hash, int32 ElementIndex)
+    {
+        FlatHash::FSlot Carry{ Hash, ElementIndex };
+        uint32 SlotIndex = Hash & SlotMask;
+        uint32 Distance = 0;
+        for (;;)
+        {
+            FlatHash::FSlot& Slot = Slots[SlotIndex];
+            if (Slot.ElementIndex < 0)
+            {
+                Slot = Carry;
+                return;
+            }
+
+            // 더 가까이 자리 잡은 슬롯의 자리를 빼앗고, 밀려난 슬롯을 이어서 삽입한다
+            const uint32 SlotDistance = ProbeDistance(SlotIndex, Slot.Hash);
+            if (SlotDistance < Distance)
+            {
+                std::swap(Slot, Carry);
+                Distance = SlotDistance;
+            }
+            SlotIndex = (SlotIndex + 1) & SlotMask;
+            ++Distance;
+        }
+    }
+
+    /** 삭제 후 뒤 슬롯들을 한 칸씩 당긴다 (툼스톤 없음) */
+    void EraseSlot(int32 InSlotIndex)
+    {
+        uint32 Hole = static_cast<uint32>(InSlotIndex);
+        for (;;)
+        {
+            const uint32 Next = (Hole + 1) & SlotMask;
+            const FlatHash::FSlot& NextSlot = Slots[Next];
+            if (NextSlot.ElementIndex < 0 || ProbeDistance(Next, NextSlot.Hash) == 0)
+            {
+                break;
+            }
+            Slots[Hole] = NextSlot;
+            Hole = Next;
+        }
+        Slots[Hole] = FlatHash::FSlot();
+    }
+
+    void Rehash(int32 NewNumSlots)
+    {
+        Slots.clear();
+        Slots.resize(static_cast<SIZE_T>(NewNumSlots));
+        SlotMask = static_cast<uint32>(NewNumSlots - 1);
+
+        for (int32 i = 0; i < Elements.Num(); ++i)
+        {
+            InsertSlot(ElementHashes[i], i);
+        }
+    }
+
+    TArray<uint32> ElementHashes;       // Elements와 같은 순서 (Rehash/Remove 시 재해시 방지)
+    TArray<FlatHash::FSlot> Slots;      // 크기는 항상 2의 거듭제곱
+    uint32 SlotMask = 0;
+};
+
+template<typename KeyType, typename ValueType>
+struct TFlatMapKeyFuncs
+{
+    static const KeyType& GetKey(const TPair<KeyType, ValueType>& Pair) { return Pair.first; }
+};
+
+template<typename T>
+struct TFlatSetKeyFuncs
+{
+    static const T& GetKey(const T& Element) { return Element; }
+};
+
+/** TFlatMap - 오픈 어드레싱 해시 맵 (API는 TMap과 같음). 순회 시 Pair.first는 수정하지 말 것 */
+template<typename KeyType, typename ValueType, bool bPreserveOrder = false>
+class TFlatMap : public TFlatHashTable<KeyType, TPair<KeyType, ValueType>, TFlatMapKeyFuncs<KeyType, ValueType>, bPreserveOrder>
+{
+public:
+    using ElementType = TPair<KeyType, ValueType>;
+    using iterator = TFlatHashIterator<TArray<ElementType>, ElementType>;
+    using const_iterator = TFlatHashIterator<const TArray<ElementType>, const ElementType>;
+
+    /** 요소 추가/수정 */
+    ValueType& Add(const KeyType& Key, const ValueType& Value)
+    {
+        const uint32 Hash = FlatHash::HashKey(Key);
+        const int32 Index = this->FindIndex(Key, Hash);
+        if (Index >= 0)
+        {
+            this->Elements[Index].second = Value;
+            return this->Elements[Index].second;
+        }
+        return this->Elements[this->AddNew(Hash, Key, Value)].second;
+    }
+
+    /** 키가 없을 때만 값을 생성해서 추가 (std::unordered_map::emplace와 같음) */
+    template<typename... Args>
+    ValueType& Emplace(const KeyType& Key, Args&&... args)
+    {
+        const uint32 Hash = FlatHash::HashKey(Key);
+        const int32 Index = this->FindIndex(Key, Hash);
+        if (Index >= 0)
+        {
+            return this->Elements[Index].second;
+        }
+        return this->Elements[this->AddNew(Hash, Key, ValueType(std::forward<Args>(args)...))].second;
+    }
+
+    ValueType& FindOrAdd(const KeyType& Key)
+    {
+        const uint32 Hash = FlatHash::HashKey(Key);
+        const int32 Index = this->FindIndex(Key, Hash);
+        if (Index >= 0)
+        {
+            return this->Elements[Index].second;
+        }
+        return this->Elements[this->AddNew(Hash, Key, ValueType{})].second;
+    }
+
+    ValueType& operator[](const KeyType& Key)
+    {
+        return FindOrAdd(Key);
+    }
+
+    /** 제거 */
+    bool Remove(const KeyType& Key)
+    {
+        return this->RemoveKey(Key);
+    }
+
+    /** 검색 */
+    bool Contains(const KeyType& Key) const
+    {
+        return this->FindIndex(Key, FlatHash::HashKey(Key)) >= 0;
+    }
+
+    ValueType* Find(const KeyType& Key)
+    {
+        const int32 Index = this->FindIndex(Key, FlatHash::HashKey(Key));
+        return Index >= 0 ? &this->Elements[Index].second : nullptr;
+    }
+
+    const ValueType* Find(const KeyType& Key) const
+    {
+        const int32 Index = this->FindIndex(Key, FlatHash::HashKey(Key));
+        return Index >= 0 ? &this->Elements[Index].second : nullptr;
+    }
+
+    /** 찾거나 기본값 반환 */
+    ValueType FindRef(const KeyType& Key) const
+    {
+        const ValueType* Value = Find(Key);
+        return Value ? *Value : ValueType{};
+    }
+
+    /** 키/값 배열 반환 (순회 순서와 같음) */
+    TArray<KeyType> GetKeys() const
+    {
+        TArray<KeyType> Keys;
+        Keys.Reserve(this->Elements.Num());
+        for (const ElementType& Pair : this->Elements)
+        {
+            Keys.Add(Pair.first);
+        }
+        return Keys;
+    }
+
+    TArray<ValueType> GetValues() const
+    {
+        TArray<ValueType> Values;
+        Values.Reserve(this->Elements.Num());
+        for (const ElementType& Pair : this->Elements)
+        {
+            Values.Add(Pair.second);
+        }
+        return Values;
+    }
+
+    /** 순회 */
+    iterator begin() { return iterator(this->Elements, 0); }
+    iterator end() { return iterator(this->Elements, this->Elements.Num()); }
+    const_iterator begin() const { return const_iterator(this->Elements, 0); }
+    const_iterator end() const { return const_iterator(this->Elements, this->Elements.Num()); }
+};
+
+/** TFlatSet - 오픈 어드레싱 해시 집합 (API는 TSet과 같음) */
+template<typename T, bool bPreserveOrder = false>
+class TFlatSet : public TFlatHashTable<T, T, TFlatSetKeyFuncs<T>, bPreserveOrder>
+{
+public:
+    using const_iterator = TFlatHashIterator<const TArray<T>, const T>;
+
+    /** 요소 추가. 새로 추가됐으면 true */
+    bool Add(const T& Item)
+    {
+        const uint32 Hash = FlatHash::HashKey(Item);
+        if (this->FindIndex(Item, Hash) >= 0)
+        {
+            return false;
+        }
+        this->AddNew(Hash, Item);
+        return true;
+    }
+
+    /** 제거 */
+    bool Remove(const T& Item)
+    {
+        return this->RemoveKey(Item);
+    }
+
+    /** 검색 */
+    bool Contains(const T& Item) const
+    {
+        return this->FindIndex(Item, FlatHash::HashKey(Item)) >= 0;
+    }
+
+    /** 배열로 변환 (순회 순서와 같음) */
+    TArray<T> Array() const
+    {
+        return this->Elements;
+    }
+
+    /** 순회 (요소는 키이므로 읽기 전용) */
+    const_iterator begin() const { return const_iterator(this->Elements, 0); }
+    const_iterator end() const { return const_iterator(this->Elements, this->Elements.Num()); }
+};
+
+/** TMap 대비 TFlatMap 성능 측정 결과 (밀리초, 포인터 키 기준) */
+struct FFlatHashBenchmarkResult
+{
+    int32 NumKeys = 0;
+    double StdInsertMS = 0.0, FlatInsertMS = 0.0;
+    double StdFindHitMS = 0.0, FlatFindHitMS = 0.0;
+    double StdFindMissMS = 0.0, FlatFindMissMS = 0.0;
+    double StdIterateMS = 0.0, FlatIterateMS = 0.0;
+    double StdRemoveMS = 0.0, FlatRemoveMS = 0.0;
+};
+
+/** NumKeys개의 포인터 키로 삽입/조회(적중, 실패)/순회/절반 제거를 측정한다 (콘솔 CONTAINER BENCH) */
+FFlatHashBenchmarkResult RunFlatHashBenchmark(int32 NumKeys);
@@ -33,12 +33,12 @@ using TPair = std::pair<T1, T2>;
 template<typename T, SIZE_T N>
 using TStaticArray = std::array<T, N>;
 
-/** TArray 구현 */
-template<typename T>
-class TArray : public std::vector<T>
+/** TArray 구현 (AllocatorType: 인라인/프레임 스택 할당자는 ContainerAllocators.h) */
+template<typename T, typename AllocatorType = std::allocator<T>>
+class TArray : public std::vector<T, AllocatorType>
 {
 public:
-    using std::vector<T>::vector; /** 생성자 상속 */
+    using std::vector<T, AllocatorType>::vector; /** 생성자 상속 */
 
     /** 요소 추가 */
     int32 Add(const T& Item)
@@ -66,7 +66,8 @@ public:
     }
 
     /** 배열 병합 */
-    void Append(const TArray<T>& Other)
+    template<typename OtherAllocator>
+    void Append(const TArray<T, OtherAllocator>& Other)
     {
         this->insert(this->end(), Other.begin(), Other.end());
     }
@@ -238,6 +239,60 @@ public:
     }
 };
 
+/**
+ * TArrayView - 연속된 요소에 대한 소유권 없는 뷰 (포인터 + 개수)
+ * 할당자가 다른 TArray, TInlineArray, std::array 등을 복사 없이 같은 함수에 넘길 때 사용한다.
+ */
+template<typename T>
+class TArrayView
+{
+public:
+    TArrayView() = default;
+
+    TArrayView(T* InData, int32 InNum)
+        : DataPtr(InData), ArrayNum(InNum)
+    {
+    }
+
+    template<typename ContainerType,
+        typename = std::enable_if_t<
+            !std::is_same_v<std::decay_t<ContainerType>, TArrayView> &&
+            std::is_convertible_v<decltype(std::declval<ContainerType&>().data()), T*>>>
+    TArrayView(ContainerType&& Container)
+        : DataPtr(Container.data()), ArrayNum(static_cast<int32>(Container.size()))
+    {
+    }
+
+    /** TArrayView<const T>는 TArrayView<T>에서 만들 수 있다 */
+    template<typename OtherT, typename = std::enable_if_t<std::is_convertible_v<OtherT*, T*>>>
+    TArrayView(const TArrayView<OtherT>& Other)
+        : DataPtr(Other.GetData()), ArrayNum(Other.Num())
+    {
+    }
+
+    T* GetData() const { return DataPtr; }
+    int32 Num() const { return ArrayNum; }
+    bool IsEmpty() const { return ArrayNum == 0; }
+
+    T& operator[](int32 Index) const { return DataPtr[Index]; }
+
+    T* begin() const { return DataPtr; }
+    T* end() const { return DataPtr + ArrayNum; }
+
+    /** 소유 배열로 복사 */
+    TArray<std::remove_const_t<T>> ToArray() const
+    {
+        return TArray<std::remove_const_t<T>>(begin(), end());
+    }
+
+private:
+    T* DataPtr = nullptr;
+    int32 ArrayNum = 0;
+};
+
+template<typename T>
+using TConstArrayView = TArrayView<const T>;
+
 /** TSet - 해시 기반 집합 */
 template<typename T>
 class TSet : public std::unordered_set<T>
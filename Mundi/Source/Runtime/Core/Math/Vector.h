@@ -463,6 +463,174 @@ inline void NormalizeQuat(float& x, float& y, float& z, float& w)
 	if (w < 0.0) { x = -x; y = -y; z = -z; w = -w; } // q와 -q 동치 → 표준화
 }
 
+// ─────────────────────────────
+// SIMD 헬퍼 (FQuat / FTransform 공용)
+// FQuat, FVector는 정렬되지 않으므로 unaligned load/store를 사용하며,
+// FVector는 12바이트라 배열 끝을 넘어 읽지 않도록 xy/z를 나눠 읽는다.
+// ─────────────────────────────
+
+// (X, Y, Z, 0)
+inline __m128 VectorLoadFloat3(const float* Ptr)
+{
+	const __m128 XY = _mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(Ptr)));
+	return _mm_movelh_ps(XY, _mm_load_ss(Ptr + 2));
+}
+
+inline void VectorStoreFloat3(const __m128& V, float* Ptr)
+{
+	_mm_storel_epi64(reinterpret_cast<__m128i*>(Ptr), _mm_castps_si128(V));
+	_mm_store_ss(Ptr + 2, _mm_movehl_ps(V, V));
+}
+
+template<int Index>
+inline __m128 VectorReplicate(const __m128& V)
+{
+	return _mm_shuffle_ps(V, V, _MM_SHUFFLE(Index, Index, Index, Index));
+}
+
+// 4성분 내적을 모든 성분에 복제해서 반환 (SSE2)
+inline __m128 VectorDot4(const __m128& A, const __m128& B)
+{
+	__m128 Mul = _mm_mul_ps(A, B);
+	__m128 Shuf = _mm_shuffle_ps(Mul, Mul, _MM_SHUFFLE(2, 3, 0, 1));	// (y, x, w, z)
+	__m128 Sum = _mm_add_ps(Mul, Shuf);									// (x+y, x+y, z+w, z+w)
+	Shuf = _mm_shuffle_ps(Sum, Sum, _MM_SHUFFLE(1, 0, 3, 2));			// (z+w, z+w, x+y, x+y)
+	return _mm_add_ps(Sum, Shuf);
+}
+
+// 3성분 외적 (W 성분은 0)
+inline __m128 VectorCross(const __m128& A, const __m128& B)
+{
+	const __m128 A_YZX = _mm_shuffle_ps(A, A, _MM_SHUFFLE(3, 0, 2, 1));
+	const __m128 B_YZX = _mm_shuffle_ps(B, B, _MM_SHUFFLE(3, 0, 2, 1));
+	const __m128 C = _mm_sub_ps(_mm_mul_ps(A, B_YZX), _mm_mul_ps(A_YZX, B));
+	return _mm_shuffle_ps(C, C, _MM_SHUFFLE(3, 0, 2, 1));
+}
+
+// 부호 비트만 켠 마스크 (XOR로 부호 반전)
+inline __m128 VectorSignMask(bool bX, bool bY, bool bZ, bool bW)
+{
+	return _mm_castsi128_ps(_mm_set_epi32(
+		bW ? static_cast<int>(0x80000000u) : 0,
+		bZ ? static_cast<int>(0x80000000u) : 0,
+		bY ? static_cast<int>(0x80000000u) : 0,
+		bX ? static_cast<int>(0x80000000u) : 0));
+}
+
+// A * B (FQuat::operator*와 같은 순서: B를 먼저 적용한 뒤 A)
+inline __m128 VectorQuaternionMultiply(const __m128& A, const __m128& B)
+{
+	const __m128 SignYW = VectorSignMask(false, true, false, true);	// (+, -, +, -)
+	const __m128 SignZW = VectorSignMask(false, false, true, true);	// (+, +, -, -)
+	const __m128 SignXW = VectorSignMask(true, false, false, true);	// (-, +, +, -)
+
+	__m128 Result = _mm_mul_ps(VectorReplicate<3>(A), B);
+	Result = _mm_add_ps(Result, _mm_mul_ps(VectorReplicate<0>(A),
+		_mm_xor_ps(_mm_shuffle_ps(B, B, _MM_SHUFFLE(0, 1, 2, 3)), SignYW)));	// (Bw, -Bz, By, -Bx)
+	Result = _mm_add_ps(Result, _mm_mul_ps(VectorReplicate<1>(A),
+		_mm_xor_ps(_mm_shuffle_ps(B, B, _MM_SHUFFLE(1, 0, 3, 2)), SignZW)));	// (Bz, Bw, -Bx, -By)
+	Result = _mm_add_ps(Result, _mm_mul_ps(VectorReplicate<2>(A),
+		_mm_xor_ps(_mm_shuffle_ps(B, B, _MM_SHUFFLE(2, 3, 0, 1)), SignXW)));	// (-By, Bx, Bw, -Bz)
+	return Result;
+}
+
+// v' = v + w * t + cross(q.xyz, t), t = 2 * cross(q.xyz, v)
+inline __m128 VectorQuaternionRotateVector(const __m128& Q, const __m128& V)
+{
+	const __m128 T = VectorCross(Q, V);
+	const __m128 T2 = _mm_add_ps(T, T);
+	const __m128 Result = _mm_add_ps(V, _mm_mul_ps(VectorReplicate<3>(Q), T2));
+	return _mm_add_ps(Result, VectorCross(Q, T2));
+}
+
+// 켤레 (-x, -y, -z, w)
+inline __m128 VectorQuaternionConjugate(const __m128& Q)
+{
+	return _mm_xor_ps(Q, VectorSignMask(true, true, true, false));
+}
+
+// 길이가 0에 가까우면 항등 쿼터니언 (FQuat::Normalize와 동일한 기준)
+inline __m128 VectorQuaternionNormalize(const __m128& Q)
+{
+	const __m128 SizeSq = VectorDot4(Q, Q);
+	const __m128 Size = _mm_sqrt_ps(SizeSq);
+	if (_mm_cvtss_f32(Size) <= KINDA_SMALL_NUMBER)
+	{
+		return _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f);
+	}
+	return _mm_div_ps(Q, Size);
+}
+
+// 최단 호 방향으로 선형 보간 후 정규화
+inline __m128 VectorQuaternionNlerp(const __m128& A, const __m128& B, float T)
+{
+	// Dot < 0이면 B의 부호를 뒤집는다 (부호 비트만 떼어 XOR)
+	const __m128 SignFlip = _mm_and_ps(VectorDot4(A, B), VectorSignMask(true, true, true, true));
+	const __m128 End = _mm_xor_ps(B, SignFlip);
+	const __m128 Lerped = _mm_add_ps(A, _mm_mul_ps(_mm_sub_ps(End, A), _mm_set1_ps(T)));
+	return VectorQuaternionNormalize(Lerped);
+}
+
+inline __m128 VectorQuaternionSlerp(const __m128& A, const __m128& B, float T)
+{
+	float CosTheta = _mm_cvtss_f32(VectorDot4(A, B));
+	__m128 End = B;
+
+	// 가장 짧은 호
+	if (CosTheta < 0.0f)
+	{
+		End = _mm_xor_ps(B, VectorSignMask(true, true, true, true));
+		CosTheta = -CosTheta;
+	}
+
+	// 근접하면 Nlerp
+	const float SLERP_EPS = 1e-3f;
+	if (CosTheta > 1.0f - SLERP_EPS)
+	{
+		return VectorQuaternionNormalize(_mm_add_ps(A, _mm_mul_ps(_mm_sub_ps(End, A), _mm_set1_ps(T))));
+	}
+
+	const float Theta = std::acos(CosTheta);
+	const float InvSinTheta = 1.0f / std::sin(Theta);
+	const float W1 = std::sin((1.0f - T) * Theta) * InvSinTheta;
+	const float W2 = std::sin(T * Theta) * InvSinTheta;
+
+	const __m128 Result = _mm_add_ps(_mm_mul_ps(A, _mm_set1_ps(W1)), _mm_mul_ps(End, _mm_set1_ps(W2)));
+	return VectorQuaternionNormalize(Result);
+}
+
+// 회전 행렬의 세 행 (row-vector 규약, W 성분 0)
+inline void VectorQuaternionToMatrixRows(const __m128& Q, __m128& OutRow0, __m128& OutRow1, __m128& OutRow2)
+{
+	const __m128 MaskXYZ = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+
+	const __m128 Q2 = _mm_add_ps(Q, Q);				// (2x, 2y, 2z, 2w)
+	const __m128 QQ2 = _mm_mul_ps(Q, Q2);			// (2xx, 2yy, 2zz, 2ww)
+
+	// R0 = (1 - 2(yy+zz), 1 - 2(xx+zz), 1 - 2(xx+yy), 0)
+	__m128 V0 = _mm_shuffle_ps(QQ2, QQ2, _MM_SHUFFLE(3, 0, 0, 1));	// (2yy, 2xx, 2xx, _)
+	__m128 V1 = _mm_shuffle_ps(QQ2, QQ2, _MM_SHUFFLE(3, 1, 2, 2));	// (2zz, 2zz, 2yy, _)
+	const __m128 R0 = _mm_and_ps(_mm_sub_ps(_mm_sub_ps(_mm_set1_ps(1.0f), V0), V1), MaskXYZ);
+
+	// R1 = (2(xz+wy), 2(xy+wz), 2(yz+wx)), R2 = (2(xz-wy), 2(xy-wz), 2(yz-wx))
+	V0 = _mm_mul_ps(_mm_shuffle_ps(Q, Q, _MM_SHUFFLE(3, 1, 0, 0)),
+		_mm_shuffle_ps(Q2, Q2, _MM_SHUFFLE(3, 2, 1, 2)));					// (2xz, 2xy, 2yz, _)
+	V1 = _mm_mul_ps(VectorReplicate<3>(Q),
+		_mm_shuffle_ps(Q2, Q2, _MM_SHUFFLE(3, 0, 2, 1)));					// (2wy, 2wz, 2wx, _)
+	const __m128 R1 = _mm_add_ps(V0, V1);
+	const __m128 R2 = _mm_sub_ps(V0, V1);
+
+	// Row0 = (R0.x, R1.y, R2.x, 0)
+	OutRow0 = _mm_shuffle_ps(_mm_shuffle_ps(R0, R1, _MM_SHUFFLE(1, 1, 0, 0)),
+		_mm_shuffle_ps(R2, R0, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+	// Row1 = (R2.y, R0.y, R1.z, 0)
+	OutRow1 = _mm_shuffle_ps(_mm_shuffle_ps(R2, R0, _MM_SHUFFLE(1, 1, 1, 1)),
+		_mm_shuffle_ps(R1, R0, _MM_SHUFFLE(3, 3, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+	// Row2 = (R1.x, R2.z, R0.z, 0)
+	OutRow2 = _mm_shuffle_ps(_mm_shuffle_ps(R1, R2, _MM_SHUFFLE(2, 2, 0, 0)),
+		_mm_shuffle_ps(R0, R0, _MM_SHUFFLE(3, 3, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+}
+
 // ─────────────────────────────
 // FQuat (Quaternion)
 // ─────────────────────────────
@@ -478,15 +646,17 @@ struct FQuat
 
 	static FQuat Identity() { return FQuat(0, 0, 0, 1); }
 
+	// SIMD 레지스터 변환 (X, Y, Z, W 순서)
+	__m128 ToRegister() const { return _mm_loadu_ps(&X); }
+	static FQuat FromRegister(const __m128& V)
+	{
+		FQuat Quat; _mm_storeu_ps(&Quat.X, V); return Quat;
+	}
+
 	// 곱 (회전 누적)
 	FQuat operator*(const FQuat& Q) const
 	{
-		return FQuat(
-			W * Q.X + X * Q.W + Y * Q.Z - Z * Q.Y,
-			W * Q.Y - X * Q.Z + Y * Q.W + Z * Q.X,
-			W * Q.Z + X * Q.Y - Y * Q.X + Z * Q.W,
-			W * Q.W - X * Q.X - Y * Q.Y - Z * Q.Z
-		);
+		return FromRegister(VectorQuaternionMultiply(ToRegister(), Q.ToRegister()));
 	}
 
 	static float Dot(const FQuat& A, const FQuat& B)
@@ -499,9 +669,7 @@ struct FQuat
 
 	void Normalize()
 	{
-		float S = Size();
-		if (S > KINDA_SMALL_NUMBER) { X /= S; Y /= S; Z /= S; W /= S; }
-		else { *this = Identity(); }
+		_mm_storeu_ps(&X, VectorQuaternionNormalize(ToRegister()));
 	}
 
 	FQuat GetNormalized() const
@@ -640,49 +808,16 @@ struct FQuat
 		return RotateVector(FVector(0, 0, 1));
 	}
 
-	// Slerp
+	// Slerp (가장 짧은 호, 근접하면 Nlerp로 대체)
 	static FQuat Slerp(const FQuat& A, const FQuat& B, float T)
 	{
-		float CosTheta = Dot(A, B);
-		FQuat End = B;
-
-		// 가장 짧은 호
-		if (CosTheta < 0.0f) { End = FQuat(-B.X, -B.Y, -B.Z, -B.W); CosTheta = -CosTheta; }
-
-		// 근접하면 Nlerp
-		const float SLERP_EPS = 1e-3f;
-		if (CosTheta > 1.0f - SLERP_EPS)
-		{
-			FQuat r = FQuat(
-				A.X + (End.X - A.X) * T,
-				A.Y + (End.Y - A.Y) * T,
-				A.Z + (End.Z - A.Z) * T,
-				A.W + (End.W - A.W) * T
-			);
-			r.Normalize();
-			return r;
-		}
-
-		float Theta = std::acos(CosTheta);
-		float SinTheta = std::sin(Theta);
-		float W1 = std::sin((1.0f - T) * Theta) / SinTheta;
-		float W2 = std::sin(T * Theta) / SinTheta;
-
-		FQuat Quat = A * W1 + End * W2;
-		Quat.Normalize();
-		return Quat;
+		return FromRegister(VectorQuaternionSlerp(A.ToRegister(), B.ToRegister(), T));
 	}
 
 	// 보조: 선형 보간 후 정규화
 	static FQuat Nlerp(const FQuat& A, const FQuat& B, float T)
 	{
-		FQuat End = (Dot(A, B) < 0.0f) ? FQuat(-B.X, -B.Y, -B.Z, -B.W) : B;
-		FQuat Quat(A.X + (End.X - A.X) * T,
-			A.Y + (End.Y - A.Y) * T,
-			A.Z + (End.Z - A.Z) * T,
-			A.W + (End.W - A.W) * T);
-		Quat.Normalize();
-		return Quat;
+		return FromRegister(VectorQuaternionNlerp(A.ToRegister(), B.ToRegister(), T));
 	}
 
 	// 비교 연산자
@@ -1275,30 +1410,25 @@ struct FTransform
 	// Child 로컬 좌표계의 점을 부모 좌표계 변환과 합성. 호출하는 Transform의 결과 좌표계로 변환
 	FTransform GetWorldTransform(const FTransform& ChildTransform) const
 	{
-		FTransform Result;
-
-		// 회전 결합
-		// Child 회전 후 부모 회전해야 로컬회전하므로 자식 먼저 곱해져야함
-		Result.Rotation = Rotation * ChildTransform.Rotation;
-		Result.Rotation.Normalize();
-
-		// 스케일 결합 (component-wise)
-		Result.Scale3D = FVector(
-			Scale3D.X * ChildTransform.Scale3D.X,
-			Scale3D.Y * ChildTransform.Scale3D.Y,
-			Scale3D.Z * ChildTransform.Scale3D.Z
-		);
-
 		//
 		// 부모 로컬 To World -> SRT, 자식 로컬 To 부모 -> Other.SRT
 		// 자식 로컬 To World -> Other.SRT * SRT 
 		// 자식 로컬 To World Translation -> Other.T * SRT = Translation(Rotation(Scale(Other.T)))
-		FVector Scaled(ChildTransform.Translation.X * Scale3D.X,
-			ChildTransform.Translation.Y * Scale3D.Y,
-			ChildTransform.Translation.Z * Scale3D.Z);
-		FVector Rotated = Rotation.RotateVector(Scaled);
-		Result.Translation = Translation + Rotated;
+		// 회전은 Child 회전 후 부모 회전해야 로컬회전하므로 자식 먼저 곱해져야함
+		const __m128 ParentRotation = Rotation.ToRegister();
+		const __m128 ParentScale = VectorLoadFloat3(&Scale3D.X);
+
+		const __m128 OutRotation = VectorQuaternionNormalize(
+			VectorQuaternionMultiply(ParentRotation, ChildTransform.Rotation.ToRegister()));
+		const __m128 OutScale = _mm_mul_ps(ParentScale, VectorLoadFloat3(&ChildTransform.Scale3D.X));
+		const __m128 Scaled = _mm_mul_ps(VectorLoadFloat3(&ChildTransform.Translation.X), ParentScale);
+		const __m128 OutTranslation = _mm_add_ps(VectorLoadFloat3(&Translation.X),
+			VectorQuaternionRotateVector(ParentRotation, Scaled));
 
+		FTransform Result;
+		_mm_storeu_ps(&Result.Rotation.X, OutRotation);
+		VectorStoreFloat3(OutScale, &Result.Scale3D.X);
+		VectorStoreFloat3(OutTranslation, &Result.Translation.X);
 		return Result;
 	}
 	//부모 로컬 좌표계로 자식 월드 Transform을 변환.
@@ -1306,29 +1436,24 @@ struct FTransform
 	FTransform GetRelativeTransform(const FTransform& ChildTransform) const
 	{
 		const FTransform& Inverse = this->Inverse();
+		const __m128 InvRotation = Inverse.Rotation.ToRegister();
+		const __m128 InvScale = VectorLoadFloat3(&Inverse.Scale3D.X);
 
-		FTransform Result;
-
-		Result.Rotation = Inverse.Rotation * ChildTransform.Rotation;
-		Result.Rotation.Normalize();
-
-		Result.Scale3D = FVector(
-			Inverse.Scale3D.X * ChildTransform.Scale3D.X,
-			Inverse.Scale3D.Y * ChildTransform.Scale3D.Y,
-			Inverse.Scale3D.Z * ChildTransform.Scale3D.Z
-		);
+		const __m128 OutRotation = VectorQuaternionNormalize(
+			VectorQuaternionMultiply(InvRotation, ChildTransform.Rotation.ToRegister()));
+		const __m128 OutScale = _mm_mul_ps(InvScale, VectorLoadFloat3(&ChildTransform.Scale3D.X));
 
 		//(자식 To 부모 T) * (부모 To World SRT) = (자식 To World T)
 		//(자식 To 부모 T) = InvScale(InvRotation(InvTranslation((자식 To World T))))
 		//(자식 To 부모 T) = InvScale(InvRotation((ChildTransform.T - this->T) ))
 		//주의할 점 : this->T랑 Inverse.T는 다름. Inverse.T는 역행렬의 Translation임.
-		FVector ResultT = ChildTransform.Translation - this->Translation;
-		ResultT = Inverse.Rotation.RotateVector(ResultT);
-		Result.Translation = FVector(
-			ResultT.X * Inverse.Scale3D.X, 
-			ResultT.Y * Inverse.Scale3D.Y, 
-			ResultT.Z * Inverse.Scale3D.Z );
+		const __m128 Delta = _mm_sub_ps(VectorLoadFloat3(&ChildTransform.Translation.X), VectorLoadFloat3(&Translation.X));
+		const __m128 OutTranslation = _mm_mul_ps(VectorQuaternionRotateVector(InvRotation, Delta), InvScale);
 
+		FTransform Result;
+		_mm_storeu_ps(&Result.Rotation.X, OutRotation);
+		VectorStoreFloat3(OutScale, &Result.Scale3D.X);
+		VectorStoreFloat3(OutTranslation, &Result.Translation.X);
 		return Result;
 	}
 
@@ -1339,15 +1464,19 @@ struct FTransform
 	FVector TransformPosition(const FVector& P) const
 	{
 		// (R*S)*P + T
-		FVector SP = FVector(P.X * Scale3D.X, P.Y * Scale3D.Y, P.Z * Scale3D.Z);
-		FVector RP = Rotation.RotateVector(SP);
-		return Translation + RP;
+		const __m128 SP = _mm_mul_ps(VectorLoadFloat3(&P.X), VectorLoadFloat3(&Scale3D.X));
+		const __m128 RP = VectorQuaternionRotateVector(Rotation.ToRegister(), SP);
+		FVector Result;
+		VectorStoreFloat3(_mm_add_ps(VectorLoadFloat3(&Translation.X), RP), &Result.X);
+		return Result;
 	}
 	FVector TransformVector(const FVector& V) const
 	{
 		// R*(S*V) (translation 없음)
-		FVector SV = FVector(V.X * Scale3D.X, V.Y * Scale3D.Y, V.Z * Scale3D.Z);
-		return Rotation.RotateVector(SV);
+		const __m128 SV = _mm_mul_ps(VectorLoadFloat3(&V.X), VectorLoadFloat3(&Scale3D.X));
+		FVector Result;
+		VectorStoreFloat3(VectorQuaternionRotateVector(Rotation.ToRegister(), SV), &Result.X);
+		return Result;
 	}
 
 	static FTransform Lerp(const FTransform& A, const FTransform& B, float T)
@@ -1380,35 +1509,21 @@ struct FTransform
 // v' = v + 2 * cross(q.xyz, cross(q.xyz, v) + q.w * v)
 inline FVector FQuat::RotateVector(const FVector& V) const
 {
-	float n = X * X + Y * Y + Z * Z + W * W;
-	if (n <= KINDA_SMALL_NUMBER) return V;
-
-	const FVector U(X, Y, Z);
-	const FVector T(
-		2.0f * (U.Y * V.Z - U.Z * V.Y),
-		2.0f * (U.Z * V.X - U.X * V.Z),
-		2.0f * (U.X * V.Y - U.Y * V.X)
-	);
-	return FVector(
-		V.X + W * T.X + (U.Y * T.Z - U.Z * T.Y),
-		V.Y + W * T.Y + (U.Z * T.X - U.X * T.Z),
-		V.Z + W * T.Z + (U.X * T.Y - U.Y * T.X)
-	);
+	const __m128 Q = ToRegister();
+	if (_mm_cvtss_f32(VectorDot4(Q, Q)) <= KINDA_SMALL_NUMBER) return V;
+
+	FVector Result;
+	VectorStoreFloat3(VectorQuaternionRotateVector(Q, VectorLoadFloat3(&V.X)), &Result.X);
+	return Result;
 }
 
 // FQuat → Matrix
 inline FMatrix FQuat::ToMatrix() const
 {
-	float XX = X * X, YY = Y * Y, ZZ = Z * Z;
-	float XY = X * Y, XZ = X * Z, YZ = Y * Z;
-	float WX = W * X, WY = W * Y, WZ = W * Z;
-
-	return FMatrix(
-		1.0f - 2.0f * (YY + ZZ), 2.0f * (XY - WZ), 2.0f * (XZ + WY), 0.0f,
-		2.0f * (XY + WZ), 1.0f - 2.0f * (XX + ZZ), 2.0f * (YZ - WX), 0.0f,
-		2.0f * (XZ - WY), 2.0f * (YZ + WX), 1.0f - 2.0f * (XX + YY), 0.0f,
-		0.0f, 0.0f, 0.0f, 1.0f
-	).Transpose();
+	FMatrix Result;
+	VectorQuaternionToMatrixRows(ToRegister(), Result.Rows[0], Result.Rows[1], Result.Rows[2]);
+	Result.Rows[3] = _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f);
+	return Result;
 }
 
 // Row-major + 행벡터(p' = p * M), Left-Handed: X=Forward, Y=Right, Z=Up
@@ -1506,45 +1621,42 @@ inline FMatrix FMatrix::OrthoLH_XForward(float Width, float Height, float Xn, fl
 // FTransform을 FMatrix로 변환 S * R * T (row-major + 행벡터 규약)
 inline FMatrix FTransform::ToMatrix() const
 {
-	FMatrix R = Rotation.ToMatrix();
+	FMatrix R;
+	VectorQuaternionToMatrixRows(Rotation.ToRegister(), R.Rows[0], R.Rows[1], R.Rows[2]);
 
 	// Scale the rotation part using SIMD
-	R.Rows[0] = _mm_mul_ps(R.Rows[0], _mm_set1_ps(Scale3D.X));
-	R.Rows[1] = _mm_mul_ps(R.Rows[1], _mm_set1_ps(Scale3D.Y));
-	R.Rows[2] = _mm_mul_ps(R.Rows[2], _mm_set1_ps(Scale3D.Z));
+	const __m128 Scale = VectorLoadFloat3(&Scale3D.X);
+	R.Rows[0] = _mm_mul_ps(R.Rows[0], VectorReplicate<0>(Scale));
+	R.Rows[1] = _mm_mul_ps(R.Rows[1], VectorReplicate<1>(Scale));
+	R.Rows[2] = _mm_mul_ps(R.Rows[2], VectorReplicate<2>(Scale));
 
-	// Set the translation part using SIMD
-	R.Rows[3] = _mm_set_ps(1.0f, Translation.Z, Translation.Y, Translation.X);
-
-	// The multiplication will use the SIMD-optimized operator*
+	// Translation 행 (W = 1)
+	R.Rows[3] = _mm_or_ps(VectorLoadFloat3(&Translation.X), _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f));
 	return R;
 }
 
 // FTransform 역변환
 inline FTransform FTransform::Inverse() const
 {
-	// InvScale
-	FVector InvScale(
-		(std::fabs(Scale3D.X) > KINDA_SMALL_NUMBER) ? 1.0f / Scale3D.X : 0.0f,
-		(std::fabs(Scale3D.Y) > KINDA_SMALL_NUMBER) ? 1.0f / Scale3D.Y : 0.0f,
-		(std::fabs(Scale3D.Z) > KINDA_SMALL_NUMBER) ? 1.0f / Scale3D.Z : 0.0f
-	);
+	// InvScale (|S| <= KINDA_SMALL_NUMBER인 축은 0)
+	const __m128 Scale = VectorLoadFloat3(&Scale3D.X);
+	const __m128 AbsScale = _mm_andnot_ps(VectorSignMask(true, true, true, true), Scale);
+	const __m128 ValidMask = _mm_cmpgt_ps(AbsScale, _mm_set1_ps(KINDA_SMALL_NUMBER));
+	const __m128 SafeScale = _mm_or_ps(_mm_and_ps(ValidMask, Scale), _mm_andnot_ps(ValidMask, _mm_set1_ps(1.0f)));
+	const __m128 InvScale = _mm_and_ps(ValidMask, _mm_div_ps(_mm_set1_ps(1.0f), SafeScale));
 
 	// InvRot = conjugate (단위 가정)
-	FQuat InvRot(-Rotation.X, -Rotation.Y, -Rotation.Z, Rotation.W);
+	const __m128 InvRot = VectorQuaternionConjugate(Rotation.ToRegister());
 
 	//(SRT)^(-1) = T^(-1)R^(-1)S^(-1). Translation Factor : (0,0,0,1)*T^(-1)R^(-1)S^(-1)
 	//InvTrans = -InvScale(InvRotation(Translation))
-	FVector Rotated = InvRot.RotateVector(Translation);
-	FVector Scaled(Rotated.X * InvScale.X,
-		Rotated.Y * InvScale.Y,
-		Rotated.Z * InvScale.Z);
-	FVector InvTrans(-Scaled);
+	const __m128 Rotated = VectorQuaternionRotateVector(InvRot, VectorLoadFloat3(&Translation.X));
+	const __m128 InvTrans = _mm_xor_ps(_mm_mul_ps(Rotated, InvScale), VectorSignMask(true, true, true, false));
 
 	FTransform Out;
-	Out.Rotation = InvRot;
-	Out.Scale3D = InvScale;
-	Out.Translation = InvTrans;
+	_mm_storeu_ps(&Out.Rotation.X, InvRot);
+	VectorStoreFloat3(InvScale, &Out.Scale3D.X);
+	VectorStoreFloat3(InvTrans, &Out.Translation.X);
 	return Out;
 }
 
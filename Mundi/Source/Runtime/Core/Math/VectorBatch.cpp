@@ -0,0 +1,587 @@
+﻿#include "pch.h"
+#include "VectorBatch.h"
+#include "PlatformTime.h"
+#include <random>
+
+static_assert(sizeof(FVector) == sizeof(float) * 3, "FVectorBatch는 FVector 배열을 float 3개 간격으로 읽는다");
+static_assert(sizeof(FQuat) == sizeof(float) * 4, "FQuat는 X, Y, Z, W가 연속이어야 한다");
+
+namespace
+{
+	// 4개의 FVector (float 12개)를 SoA로 푼다
+	inline void LoadFloat3x4(const float* Ptr, __m128& OutX, __m128& OutY, __m128& OutZ)
+	{
+		const __m128 A = _mm_loadu_ps(Ptr);		// x0 y0 z0 x1
+		const __m128 B = _mm_loadu_ps(Ptr + 4);	// y1 z1 x2 y2
+		const __m128 C = _mm_loadu_ps(Ptr + 8);	// z2 x3 y3 z3
+
+		OutX = _mm_shuffle_ps(A, _mm_shuffle_ps(B, C, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+		OutY = _mm_shuffle_ps(_mm_shuffle_ps(A, B, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(B, C, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+		OutZ = _mm_shuffle_ps(_mm_shuffle_ps(A, B, _MM_SHUFFLE(1, 1, 2, 2)), C, _MM_SHUFFLE(3, 0, 2, 0));
+	}
+
+	// SoA를 다시 FVector 4개로 묶어 쓴다
+	inline void StoreFloat3x4(const __m128& X, const __m128& Y, const __m128& Z, float* Ptr)
+	{
+		const __m128 A = _mm_shuffle_ps(_mm_shuffle_ps(X, Y, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(Z, X, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+		const __m128 B = _mm_shuffle_ps(_mm_shuffle_ps(Y, Z, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(X, Y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+		const __m128 C = _mm_shuffle_ps(_mm_shuffle_ps(Z, X, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(Y, Z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+		_mm_storeu_ps(Ptr, A);
+		_mm_storeu_ps(Ptr + 4, B);
+		_mm_storeu_ps(Ptr + 8, C);
+	}
+
+	// 4개씩 SoA로 처리하고 나머지는 한 개씩 처리한다. bWithTranslation이면 M의 4번째 행을 더한다
+	template<bool bWithTranslation>
+	void TransformFloat3Array(const FMatrix& M, const FVector* In, FVector* Out, int32 Count)
+	{
+		const __m128 M00 = _mm_set1_ps(M.M[0][0]), M01 = _mm_set1_ps(M.M[0][1]), M02 = _mm_set1_ps(M.M[0][2]);
+		const __m128 M10 = _mm_set1_ps(M.M[1][0]), M11 = _mm_set1_ps(M.M[1][1]), M12 = _mm_set1_ps(M.M[1][2]);
+		const __m128 M20 = _mm_set1_ps(M.M[2][0]), M21 = _mm_set1_ps(M.M[2][1]), M22 = _mm_set1_ps(M.M[2][2]);
+		const __m128 M30 = _mm_set1_ps(M.M[3][0]), M31 = _mm_set1_ps(M.M[3][1]), M32 = _mm_set1_ps(M.M[3][2]);
+
+		int32 Index = 0;
+		for (; Index + 4 <= Count; Index += 4)
+		{
+			__m128 X, Y, Z;
+			LoadFloat3x4(&In[Index].X, X, Y, Z);
+
+			// FMatrix::TransformPosition과 같은 덧셈 순서 (x*M0 + y*M1 + z*M2 + M3)
+			__m128 OutX = _mm_add_ps(_mm_add_ps(_mm_mul_ps(X, M00), _mm_mul_ps(Y, M10)), _mm_mul_ps(Z, M20));
+			__m128 OutY = _mm_add_ps(_mm_add_ps(_mm_mul_ps(X, M01), _mm_mul_ps(Y, M11)), _mm_mul_ps(Z, M21));
+			__m128 OutZ = _mm_add_ps(_mm_add_ps(_mm_mul_ps(X, M02), _mm_mul_ps(Y, M12)), _mm_mul_ps(Z, M22));
+			if (bWithTranslation)
+			{
+				OutX = _mm_add_ps(OutX, M30);
+				OutY = _mm_add_ps(OutY, M31);
+				OutZ = _mm_add_ps(OutZ, M32);
+			}
+
+			StoreFloat3x4(OutX, OutY, OutZ, &Out[Index].X);
+		}
+
+		for (; Index < Count; ++Index)
+		{
+			const __m128 V = VectorLoadFloat3(&In[Index].X);
+			__m128 Result = _mm_add_ps(_mm_add_ps(
+				_mm_mul_ps(VectorReplicate<0>(V), M.Rows[0]),
+				_mm_mul_ps(VectorReplicate<1>(V), M.Rows[1])),
+				_mm_mul_ps(VectorReplicate<2>(V), M.Rows[2]));
+			if (bWithTranslation)
+			{
+				Result = _mm_add_ps(Result, M.Rows[3]);
+			}
+			VectorStoreFloat3(Result, &Out[Index].X);
+		}
+	}
+
+	// Parent(회전/스케일/이동 레지스터) ∘ Child → Out (FTransform::GetWorldTransform과 같은 식)
+	inline void ComposeWithParentRegisters(const __m128& ParentRotation, const __m128& ParentScale, const __m128& ParentTranslation,
+		const FTransform& Child, FTransform& Out)
+	{
+		const __m128 ChildRotation = Child.Rotation.ToRegister();
+		const __m128 ChildScale = VectorLoadFloat3(&Child.Scale3D.X);
+		const __m128 ChildTranslation = VectorLoadFloat3(&Child.Translation.X);
+
+		const __m128 OutRotation = VectorQuaternionNormalize(VectorQuaternionMultiply(ParentRotation, ChildRotation));
+		const __m128 OutScale = _mm_mul_ps(ParentScale, ChildScale);
+		const __m128 OutTranslation = _mm_add_ps(ParentTranslation,
+			VectorQuaternionRotateVector(ParentRotation, _mm_mul_ps(ChildTranslation, ParentScale)));
+
+		_mm_storeu_ps(&Out.Rotation.X, OutRotation);
+		VectorStoreFloat3(OutScale, &Out.Scale3D.X);
+		VectorStoreFloat3(OutTranslation, &Out.Translation.X);
+	}
+}
+
+void FVectorBatch::TransformPositions(const FMatrix& M, const FVector* In, FVector* Out, int32 Count)
+{
+	TransformFloat3Array<true>(M, In, Out, Count);
+}
+
+void FVectorBatch::TransformVectors(const FMatrix& M, const FVector* In, FVector* Out, int32 Count)
+{
+	TransformFloat3Array<false>(M, In, Out, Count);
+}
+
+void FVectorBatch::ComposeTransforms(const FTransform* Parents, const FTransform* Children, FTransform* Out, int32 Count)
+{
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		const FTransform& Parent = Parents[Index];
+		ComposeWithParentRegisters(Parent.Rotation.ToRegister(), VectorLoadFloat3(&Parent.Scale3D.X), VectorLoadFloat3(&Parent.Translation.X),
+			Children[Index], Out[Index]);
+	}
+}
+
+void FVectorBatch::ComposeTransforms(const FTransform& Parent, const FTransform* Children, FTransform* Out, int32 Count)
+{
+	// Out이 Parent를 가리킬 수도 있으므로 부모는 먼저 레지스터로 읽어 둔다
+	const __m128 ParentRotation = Parent.Rotation.ToRegister();
+	const __m128 ParentScale = VectorLoadFloat3(&Parent.Scale3D.X);
+	const __m128 ParentTranslation = VectorLoadFloat3(&Parent.Translation.X);
+
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		ComposeWithParentRegisters(ParentRotation, ParentScale, ParentTranslation, Children[Index], Out[Index]);
+	}
+}
+
+void FVectorBatch::TransformsToMatrices(const FTransform* In, FMatrix* Out, int32 Count)
+{
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		Out[Index] = In[Index].ToMatrix();
+	}
+}
+
+void FVectorBatch::BlendTransforms(const FTransform* A, const FTransform* B, float Alpha, FTransform* Out, int32 Count)
+{
+	const __m128 AlphaV = _mm_set1_ps(Alpha);
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		const FTransform& From = A[Index];
+		const FTransform& To = B[Index];
+
+		const __m128 FromTranslation = VectorLoadFloat3(&From.Translation.X);
+		const __m128 FromScale = VectorLoadFloat3(&From.Scale3D.X);
+		const __m128 OutTranslation = _mm_add_ps(FromTranslation, _mm_mul_ps(_mm_sub_ps(VectorLoadFloat3(&To.Translation.X), FromTranslation), AlphaV));
+		const __m128 OutScale = _mm_add_ps(FromScale, _mm_mul_ps(_mm_sub_ps(VectorLoadFloat3(&To.Scale3D.X), FromScale), AlphaV));
+		const __m128 OutRotation = VectorQuaternionSlerp(From.Rotation.ToRegister(), To.Rotation.ToRegister(), Alpha);
+
+		FTransform& Result = Out[Index];
+		_mm_storeu_ps(&Result.Rotation.X, OutRotation);
+		VectorStoreFloat3(OutScale, &Result.Scale3D.X);
+		VectorStoreFloat3(OutTranslation, &Result.Translation.X);
+	}
+}
+
+// ─────────────────────────────
+// 스칼라 기준 구현 (SIMD 전환 이전 코드, 검증/측정 전용)
+// ─────────────────────────────
+namespace
+{
+	FQuat ScalarQuatMultiply(const FQuat& A, const FQuat& Q)
+	{
+		return FQuat(
+			A.W * Q.X + A.X * Q.W + A.Y * Q.Z - A.Z * Q.Y,
+			A.W * Q.Y - A.X * Q.Z + A.Y * Q.W + A.Z * Q.X,
+			A.W * Q.Z + A.X * Q.Y - A.Y * Q.X + A.Z * Q.W,
+			A.W * Q.W - A.X * Q.X - A.Y * Q.Y - A.Z * Q.Z
+		);
+	}
+
+	FQuat ScalarQuatNormalize(const FQuat& Q)
+	{
+		const float S = std::sqrt(Q.X * Q.X + Q.Y * Q.Y + Q.Z * Q.Z + Q.W * Q.W);
+		if (S > KINDA_SMALL_NUMBER)
+		{
+			return FQuat(Q.X / S, Q.Y / S, Q.Z / S, Q.W / S);
+		}
+		return FQuat::Identity();
+	}
+
+	FVector ScalarRotateVector(const FQuat& Q, const FVector& V)
+	{
+		const float N = Q.X * Q.X + Q.Y * Q.Y + Q.Z * Q.Z + Q.W * Q.W;
+		if (N <= KINDA_SMALL_NUMBER) return V;
+
+		const FVector U(Q.X, Q.Y, Q.Z);
+		const FVector T(
+			2.0f * (U.Y * V.Z - U.Z * V.Y),
+			2.0f * (U.Z * V.X - U.X * V.Z),
+			2.0f * (U.X * V.Y - U.Y * V.X)
+		);
+		return FVector(
+			V.X + Q.W * T.X + (U.Y * T.Z - U.Z * T.Y),
+			V.Y + Q.W * T.Y + (U.Z * T.X - U.X * T.Z),
+			V.Z + Q.W * T.Z + (U.X * T.Y - U.Y * T.X)
+		);
+	}
+
+	FQuat ScalarNlerp(const FQuat& A, const FQuat& B, float T)
+	{
+		const FQuat End = (FQuat::Dot(A, B) < 0.0f) ? FQuat(-B.X, -B.Y, -B.Z, -B.W) : B;
+		return ScalarQuatNormalize(FQuat(
+			A.X + (End.X - A.X) * T,
+			A.Y + (End.Y - A.Y) * T,
+			A.Z + (End.Z - A.Z) * T,
+			A.W + (End.W - A.W) * T));
+	}
+
+	FQuat ScalarSlerp(const FQuat& A, const FQuat& B, float T)
+	{
+		float CosTheta = FQuat::Dot(A, B);
+		FQuat End = B;
+		if (CosTheta < 0.0f) { End = FQuat(-B.X, -B.Y, -B.Z, -B.W); CosTheta = -CosTheta; }
+
+		if (CosTheta > 1.0f - 1e-3f)
+		{
+			return ScalarNlerp(A, End, T);
+		}
+
+		const float Theta = std::acos(CosTheta);
+		const float SinTheta = std::sin(Theta);
+		const float W1 = std::sin((1.0f - T) * Theta) / SinTheta;
+		const float W2 = std::sin(T * Theta) / SinTheta;
+		return ScalarQuatNormalize(FQuat(
+			A.X * W1 + End.X * W2,
+			A.Y * W1 + End.Y * W2,
+			A.Z * W1 + End.Z * W2,
+			A.W * W1 + End.W * W2));
+	}
+
+	FMatrix ScalarToMatrix(const FTransform& InTransform)
+	{
+		const FQuat& Q = InTransform.Rotation;
+		const FVector& S = InTransform.Scale3D;
+		const float XX = Q.X * Q.X, YY = Q.Y * Q.Y, ZZ = Q.Z * Q.Z;
+		const float XY = Q.X * Q.Y, XZ = Q.X * Q.Z, YZ = Q.Y * Q.Z;
+		const float WX = Q.W * Q.X, WY = Q.W * Q.Y, WZ = Q.W * Q.Z;
+
+		return FMatrix(
+			(1.0f - 2.0f * (YY + ZZ)) * S.X, 2.0f * (XY + WZ) * S.X, 2.0f * (XZ - WY) * S.X, 0.0f,
+			2.0f * (XY - WZ) * S.Y, (1.0f - 2.0f * (XX + ZZ)) * S.Y, 2.0f * (YZ + WX) * S.Y, 0.0f,
+			2.0f * (XZ + WY) * S.Z, 2.0f * (YZ - WX) * S.Z, (1.0f - 2.0f * (XX + YY)) * S.Z, 0.0f,
+			InTransform.Translation.X, InTransform.Translation.Y, InTransform.Translation.Z, 1.0f
+		);
+	}
+
+	FTransform ScalarCompose(const FTransform& Parent, const FTransform& Child)
+	{
+		FTransform Result;
+		Result.Rotation = ScalarQuatNormalize(ScalarQuatMultiply(Parent.Rotation, Child.Rotation));
+		Result.Scale3D = FVector(Parent.Scale3D.X * Child.Scale3D.X, Parent.Scale3D.Y * Child.Scale3D.Y, Parent.Scale3D.Z * Child.Scale3D.Z);
+		const FVector Scaled(Child.Translation.X * Parent.Scale3D.X, Child.Translation.Y * Parent.Scale3D.Y, Child.Translation.Z * Parent.Scale3D.Z);
+		Result.Translation = Parent.Translation + ScalarRotateVector(Parent.Rotation, Scaled);
+		return Result;
+	}
+
+	FTransform ScalarInverse(const FTransform& InTransform)
+	{
+		const FVector& S = InTransform.Scale3D;
+		const FVector InvScale(
+			(std::fabs(S.X) > KINDA_SMALL_NUMBER) ? 1.0f / S.X : 0.0f,
+			(std::fabs(S.Y) > KINDA_SMALL_NUMBER) ? 1.0f / S.Y : 0.0f,
+			(std::fabs(S.Z) > KINDA_SMALL_NUMBER) ? 1.0f / S.Z : 0.0f
+		);
+		const FQuat InvRot(-InTransform.Rotation.X, -InTransform.Rotation.Y, -InTransform.Rotation.Z, InTransform.Rotation.W);
+		const FVector Rotated = ScalarRotateVector(InvRot, InTransform.Translation);
+
+		FTransform Out;
+		Out.Rotation = InvRot;
+		Out.Scale3D = InvScale;
+		Out.Translation = FVector(-Rotated.X * InvScale.X, -Rotated.Y * InvScale.Y, -Rotated.Z * InvScale.Z);
+		return Out;
+	}
+
+	// 검증/측정용 무작위 입력 (고정 시드)
+	struct FRandomMathInputs
+	{
+		TArray<FQuat> Quats;
+		TArray<FVector> Vectors;
+		TArray<FTransform> Transforms;
+		TArray<float> Alphas;
+
+		FRandomMathInputs(int32 Count, uint32 Seed)
+		{
+			std::mt19937 Rng(Seed);
+			std::uniform_real_distribution<float> Unit(-1.0f, 1.0f);
+			std::uniform_real_distribution<float> Position(-500.0f, 500.0f);
+			std::uniform_real_distribution<float> ScaleDist(0.25f, 4.0f);
+			std::uniform_real_distribution<float> AlphaDist(0.0f, 1.0f);
+
+			Quats.SetNum(Count);
+			Vectors.SetNum(Count);
+			Transforms.SetNum(Count);
+			Alphas.SetNum(Count);
+			for (int32 i = 0; i < Count; ++i)
+			{
+				Quats[i] = ScalarQuatNormalize(FQuat(Unit(Rng), Unit(Rng), Unit(Rng), Unit(Rng)));
+				Vectors[i] = FVector(Position(Rng), Position(Rng), Position(Rng));
+				Transforms[i] = FTransform(
+					FVector(Position(Rng), Position(Rng), Position(Rng)),
+					ScalarQuatNormalize(FQuat(Unit(Rng), Unit(Rng), Unit(Rng), Unit(Rng))),
+					FVector(ScaleDist(Rng), ScaleDist(Rng), ScaleDist(Rng)));
+				Alphas[i] = AlphaDist(Rng);
+			}
+		}
+	};
+
+	// 크기에 비례한 허용 오차 (위치 값이 수백 단위라 절대 오차만으로는 부족하다)
+	bool IsNearlyEqual(float A, float B, float Tolerance)
+	{
+		return std::fabs(A - B) <= Tolerance * std::max(1.0f, std::max(std::fabs(A), std::fabs(B)));
+	}
+
+	bool IsNearlyEqual(const FVector& A, const FVector& B, float Tolerance)
+	{
+		return IsNearlyEqual(A.X, B.X, Tolerance) && IsNearlyEqual(A.Y, B.Y, Tolerance) && IsNearlyEqual(A.Z, B.Z, Tolerance);
+	}
+
+	bool IsNearlyEqual(const FQuat& A, const FQuat& B, float Tolerance)
+	{
+		return IsNearlyEqual(A.X, B.X, Tolerance) && IsNearlyEqual(A.Y, B.Y, Tolerance)
+			&& IsNearlyEqual(A.Z, B.Z, Tolerance) && IsNearlyEqual(A.W, B.W, Tolerance);
+	}
+
+	bool IsNearlyEqual(const FTransform& A, const FTransform& B, float Tolerance)
+	{
+		return IsNearlyEqual(A.Translation, B.Translation, Tolerance)
+			&& IsNearlyEqual(A.Rotation, B.Rotation, Tolerance)
+			&& IsNearlyEqual(A.Scale3D, B.Scale3D, Tolerance);
+	}
+
+	bool IsNearlyEqual(const FMatrix& A, const FMatrix& B, float Tolerance)
+	{
+		for (int32 Row = 0; Row < 4; ++Row)
+		{
+			for (int32 Col = 0; Col < 4; ++Col)
+			{
+				if (!IsNearlyEqual(A.M[Row][Col], B.M[Row][Col], Tolerance))
+				{
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	template<typename Func>
+	double MeasureMS(Func&& InFunc)
+	{
+		const uint64 Start = FPlatformTime::Cycles64();
+		InFunc();
+		return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+	}
+}
+
+int32 RunVectorMathSelfTest(TArray<FString>& OutFailures)
+{
+	int32 NumChecks = 0;
+	auto Check = [&](bool bCondition, const char* Description)
+	{
+		++NumChecks;
+		if (!bCondition)
+		{
+			OutFailures.Add(Description);
+		}
+	};
+
+	// SIMD는 덧셈 순서가 달라 스칼라와 몇 ULP 차이가 날 수 있다
+	constexpr float Tolerance = 1e-5f;
+	constexpr int32 Count = 257;	// 4개 단위 커널의 나머지 경로까지 검사
+	const FRandomMathInputs Inputs(Count, 1234u);
+
+	bool bMultiply = true, bRotate = true, bSlerp = true, bNlerp = true;
+	bool bToMatrix = true, bQuatToMatrix = true, bCompose = true, bInverse = true;
+	bool bRelative = true, bPosition = true, bRoundTrip = true;
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const FQuat& A = Inputs.Quats[i];
+		const FQuat& B = Inputs.Quats[(i + 1) % Count];
+		const FVector& V = Inputs.Vectors[i];
+		const FTransform& Parent = Inputs.Transforms[i];
+		const FTransform& Child = Inputs.Transforms[(i + 7) % Count];
+		const float Alpha = Inputs.Alphas[i];
+
+		bMultiply &= IsNearlyEqual(A * B, ScalarQuatMultiply(A, B), Tolerance);
+		bRotate &= IsNearlyEqual(A.RotateVector(V), ScalarRotateVector(A, V), Tolerance);
+		bSlerp &= IsNearlyEqual(FQuat::Slerp(A, B, Alpha), ScalarSlerp(A, B, Alpha), Tolerance);
+		bNlerp &= IsNearlyEqual(FQuat::Nlerp(A, B, Alpha), ScalarNlerp(A, B, Alpha), Tolerance);
+		bToMatrix &= IsNearlyEqual(Parent.ToMatrix(), ScalarToMatrix(Parent), Tolerance);
+		bQuatToMatrix &= IsNearlyEqual(A.ToMatrix(), ScalarToMatrix(FTransform(FVector(), A, FVector(1, 1, 1))), Tolerance);
+		bCompose &= IsNearlyEqual(Parent.GetWorldTransform(Child), ScalarCompose(Parent, Child), Tolerance);
+		bInverse &= IsNearlyEqual(Parent.Inverse(), ScalarInverse(Parent), Tolerance);
+		bRelative &= IsNearlyEqual(Parent.GetRelativeTransform(ScalarCompose(Parent, Child)).Translation, Child.Translation, 1e-3f);
+		bPosition &= IsNearlyEqual(Parent.TransformPosition(V), Parent.ToMatrix().TransformPosition(V), 1e-4f);
+
+		// 균일 스케일이면 역변환과 합성하면 항등이어야 한다
+		const FTransform Uniform(Parent.Translation, Parent.Rotation, FVector(Parent.Scale3D.X, Parent.Scale3D.X, Parent.Scale3D.X));
+		const FTransform Identity = Uniform.Inverse().GetWorldTransform(Uniform);
+		bRoundTrip &= IsNearlyEqual(Identity.Translation, FVector(0, 0, 0), 1e-3f)
+			&& std::fabs(std::fabs(Identity.Rotation.W) - 1.0f) < 1e-4f
+			&& IsNearlyEqual(Identity.Scale3D, FVector(1, 1, 1), Tolerance);
+	}
+	Check(bMultiply, "quat: multiply matches scalar");
+	Check(bRotate, "quat: rotate vector matches scalar");
+	Check(bSlerp, "quat: slerp matches scalar");
+	Check(bNlerp, "quat: nlerp matches scalar");
+	Check(bQuatToMatrix, "quat: to matrix matches scalar");
+	Check(bToMatrix, "transform: to matrix matches scalar");
+	Check(bCompose, "transform: compose matches scalar");
+	Check(bInverse, "transform: inverse matches scalar");
+	Check(bRelative, "transform: relative transform undoes compose");
+	Check(bPosition, "transform: transform position matches matrix path");
+	Check(bRoundTrip, "transform: inverse * transform is identity");
+
+	// 경계 조건
+	{
+		const FQuat A = Inputs.Quats[0];
+		const FQuat NegA(-A.X, -A.Y, -A.Z, -A.W);
+		Check(IsNearlyEqual(FQuat::Slerp(A, NegA, 0.5f), A, Tolerance), "quat: slerp takes the shortest arc for antipodal inputs");
+		Check(IsNearlyEqual(FQuat::Slerp(A, A, 0.3f), A, Tolerance), "quat: slerp of identical inputs is stable");
+
+		FQuat Zero(0, 0, 0, 0);
+		Zero.Normalize();
+		Check(Zero.IsIdentity(), "quat: normalizing zero quat yields identity");
+
+		const FTransform Flat(FVector(10, 20, 30), A, FVector(2.0f, 0.0f, 4.0f));
+		Check(IsNearlyEqual(Flat.Inverse(), ScalarInverse(Flat), Tolerance) && Flat.Inverse().Scale3D.Y == 0.0f,
+			"transform: inverse of zero scale axis is zero");
+	}
+
+	// 배열 커널 (일반 경로와 비교, in-place 포함)
+	{
+		const FMatrix M = Inputs.Transforms[3].ToMatrix();
+
+		TArray<FVector> Positions(Inputs.Vectors.begin(), Inputs.Vectors.end());
+		TArray<FVector> Directions(Inputs.Vectors.begin(), Inputs.Vectors.end());
+		FVectorBatch::TransformPositions(M, Positions.GetData(), Positions.GetData(), Count);
+		FVectorBatch::TransformVectors(M, Directions.GetData(), Directions.GetData(), Count);
+
+		bool bPositions = true, bDirections = true;
+		for (int32 i = 0; i < Count; ++i)
+		{
+			bPositions &= IsNearlyEqual(Positions[i], M.TransformPosition(Inputs.Vectors[i]), Tolerance);
+			bDirections &= IsNearlyEqual(Directions[i], M.TransformVector(Inputs.Vectors[i]), Tolerance);
+		}
+		Check(bPositions, "batch: transform positions matches FMatrix::TransformPosition");
+		Check(bDirections, "batch: transform vectors matches FMatrix::TransformVector");
+
+		TArray<FTransform> Children(Inputs.Transforms.begin(), Inputs.Transforms.end());
+		TArray<FTransform> Composed;
+		Composed.SetNum(Count);
+		TArray<FTransform> Parents(Inputs.Transforms.rbegin(), Inputs.Transforms.rend());
+		FVectorBatch::ComposeTransforms(Parents.GetData(), Children.GetData(), Composed.GetData(), Count);
+
+		const FTransform& SharedParent = Inputs.Transforms[5];
+		TArray<FTransform> SharedComposed(Children.begin(), Children.end());
+		FVectorBatch::ComposeTransforms(SharedParent, SharedComposed.GetData(), SharedComposed.GetData(), Count);
+
+		TArray<FMatrix> Matrices;
+		Matrices.SetNum(Count);
+		FVectorBatch::TransformsToMatrices(Children.GetData(), Matrices.GetData(), Count);
+
+		TArray<FTransform> Blended;
+		Blended.SetNum(Count);
+		FVectorBatch::BlendTransforms(Parents.GetData(), Children.GetData(), 0.35f, Blended.GetData(), Count);
+
+		bool bCompose = true, bShared = true, bMatrices = true, bBlend = true;
+		for (int32 i = 0; i < Count; ++i)
+		{
+			bCompose &= IsNearlyEqual(Composed[i], ScalarCompose(Parents[i], Children[i]), Tolerance);
+			bShared &= IsNearlyEqual(SharedComposed[i], ScalarCompose(SharedParent, Children[i]), Tolerance);
+			bMatrices &= IsNearlyEqual(Matrices[i], ScalarToMatrix(Children[i]), Tolerance);
+
+			const FVector T = FVector::Lerp(Parents[i].Translation, Children[i].Translation, 0.35f);
+			const FVector S = FVector::Lerp(Parents[i].Scale3D, Children[i].Scale3D, 0.35f);
+			bBlend &= IsNearlyEqual(Blended[i], FTransform(T, ScalarSlerp(Parents[i].Rotation, Children[i].Rotation, 0.35f), S), Tolerance);
+		}
+		Check(bCompose, "batch: compose transforms matches scalar");
+		Check(bShared, "batch: compose with shared parent matches scalar (in-place)");
+		Check(bMatrices, "batch: transforms to matrices matches scalar");
+		Check(bBlend, "batch: blend transforms matches scalar lerp/slerp");
+	}
+
+	return NumChecks;
+}
+
+FVectorMathBenchmarkResult RunVectorMathBenchmark(int32 Count)
+{
+	FVectorMathBenchmarkResult Result;
+	Result.Count = std::max(Count, 4);
+	const FRandomMathInputs Inputs(Result.Count, 4321u);
+	const int32 N = Result.Count;
+
+	// 최적화로 계산이 사라지지 않도록 결과를 모아 둔다
+	volatile float Sink = 0.0f;
+	TArray<FQuat> OutQuats;
+	OutQuats.SetNum(N);
+	TArray<FVector> OutVectors;
+	OutVectors.SetNum(N);
+	TArray<FTransform> OutTransforms;
+	OutTransforms.SetNum(N);
+	TArray<FMatrix> OutMatrices;
+	OutMatrices.SetNum(N);
+
+	Result.ScalarQuatMultiplyMS = MeasureMS([&]()
+	{
+		for (int32 i = 0; i < N; ++i) OutQuats[i] = ScalarQuatMultiply(Inputs.Quats[i], Inputs.Quats[N - 1 - i]);
+	});
+	Sink = Sink + OutQuats[N / 2].X;
+	Result.SimdQuatMultiplyMS = MeasureMS([&]()
+	{
+		for (int32 i = 0; i < N; ++i) OutQuats[i] = Inputs.Quats[i] * Inputs.Quats[N - 1 - i];
+	});
+	Sink = Sink + OutQuats[N / 2].X;
+
+	Result.ScalarRotateVectorMS = MeasureMS([&]()
+	{
+		for (int32 i = 0; i < N; ++i) OutVectors[i] = ScalarRotateVector(Inputs.Quats[i], Inputs.Vectors[i]);
+	});
+	Sink = Sink + OutVectors[N / 2].X;
+	Result.SimdRotateVectorMS = MeasureMS([&]()
+	{
+		for (int32 i = 0; i < N; ++i) OutVectors[i] = Inputs.Quats[i].RotateVector(Inputs.Vectors[i]);
+	});
+	Sink = Sink + OutVectors[N / 2].X;
+
+	Result.ScalarSlerpMS = MeasureMS([&]()
+	{
+		for (int32 i = 0; i < N; ++i) OutQuats[i] = ScalarSlerp(Inputs.Quats[i], Inputs.Quats[N - 1 - i], Inputs.Alphas[i]);
+	});
+	Sink = Sink + OutQuats[N / 2].X;
+	Result.SimdSlerpMS = MeasureMS([&]()
+	{
+		for (int32 i = 0; i < N; ++i) OutQuats[i] = FQuat::Slerp(Inputs.Quats[i], Inputs.Quats[N - 1 - i], Inputs.Alphas[i]);
+	});
+	Sink = Sink + OutQuats[N / 2].X;
+
+	Result.ScalarComposeMS = MeasureMS([&]()
+	{
+		for (int32 i = 0; i < N; ++i) OutTransforms[i] = ScalarCompose(Inputs.Transforms[i], Inputs.Transforms[N - 1 - i]);
+	});
+	Sink = Sink + OutTransforms[N / 2].Translation.X;
+	Result.SimdComposeMS = MeasureMS([&]()
+	{
+		FVectorBatch::ComposeTransforms(Inputs.Transforms.GetData(), Inputs.Transforms.GetData(), OutTransforms.GetData(), N);
+	});
+	Sink = Sink + OutTransforms[N / 2].Translation.X;
+
+	Result.ScalarInverseMS = MeasureMS([&]()
+	{
+		for (int32 i = 0; i < N; ++i) OutTransforms[i] = ScalarInverse(Inputs.Transforms[i]);
+	});
+	Sink = Sink + OutTransforms[N / 2].Translation.X;
+	Result.SimdInverseMS = MeasureMS([&]()
+	{
+		for (int32 i = 0; i < N; ++i) OutTransforms[i] = Inputs.Transforms[i].Inverse();
+	});
+	Sink = Sink + OutTransforms[N / 2].Translation.X;
+
+	Result.ScalarToMatrixMS = MeasureMS([&]()
+	{
+		for (int32 i = 0; i < N; ++i) OutMatrices[i] = ScalarToMatrix(Inputs.Transforms[i]);
+	});
+	Sink = Sink + OutMatrices[N / 2].M[0][0];
+	Result.SimdToMatrixMS = MeasureMS([&]()
+	{
+		FVectorBatch::TransformsToMatrices(Inputs.Transforms.GetData(), OutMatrices.GetData(), N);
+	});
+	Sink = Sink + OutMatrices[N / 2].M[0][0];
+
+	const FMatrix M = Inputs.Transforms[0].ToMatrix();
+	Result.ScalarTransformPositionsMS = MeasureMS([&]()
+	{
+		for (int32 i = 0; i < N; ++i) OutVectors[i] = M.TransformPosition(Inputs.Vectors[i]);
+	});
+	Sink = Sink + OutVectors[N / 2].X;
+	Result.SimdTransformPositionsMS = MeasureMS([&]()
+	{
+		FVectorBatch::TransformPositions(M, Inputs.Vectors.GetData(), OutVectors.GetData(), N);
+	});
+	Sink = Sink + OutVectors[N / 2].X;
+
+	return Result;
+}
@@ -0,0 +1,46 @@
+﻿#pragma once
+#include "Vector.h"
+
+/**
+ * FVector / FTransform 배열 단위 SIMD 커널
+ * 출력 포인터는 입력 포인터와 같아도 된다 (in-place). Count가 0 이하면 아무 것도 하지 않는다.
+ */
+struct FVectorBatch
+{
+	/** Out[i] = In[i] * M (W = 1, 원근 나눗셈 없음. FMatrix::TransformPosition과 같다) */
+	static void TransformPositions(const FMatrix& M, const FVector* In, FVector* Out, int32 Count);
+
+	/** Out[i] = In[i] * M의 3x3 부분 (이동 없음. FMatrix::TransformVector와 같다) */
+	static void TransformVectors(const FMatrix& M, const FVector* In, FVector* Out, int32 Count);
+
+	/** Out[i] = Parents[i].GetWorldTransform(Children[i]) */
+	static void ComposeTransforms(const FTransform* Parents, const FTransform* Children, FTransform* Out, int32 Count);
+
+	/** Out[i] = Parent.GetWorldTransform(Children[i]) (부모 하나에 자식 여럿) */
+	static void ComposeTransforms(const FTransform& Parent, const FTransform* Children, FTransform* Out, int32 Count);
+
+	/** Out[i] = In[i].ToMatrix() */
+	static void TransformsToMatrices(const FTransform* In, FMatrix* Out, int32 Count);
+
+	/** Out[i] = FTransform::Lerp(A[i], B[i], Alpha) */
+	static void BlendTransforms(const FTransform* A, const FTransform* B, float Alpha, FTransform* Out, int32 Count);
+};
+
+/** 스칼라 구현 대비 SIMD 구현 측정 결과 (밀리초) */
+struct FVectorMathBenchmarkResult
+{
+	int32 Count = 0;
+	double ScalarQuatMultiplyMS = 0.0, SimdQuatMultiplyMS = 0.0;
+	double ScalarRotateVectorMS = 0.0, SimdRotateVectorMS = 0.0;
+	double ScalarSlerpMS = 0.0, SimdSlerpMS = 0.0;
+	double ScalarComposeMS = 0.0, SimdComposeMS = 0.0;
+	double ScalarInverseMS = 0.0, SimdInverseMS = 0.0;
+	double ScalarToMatrixMS = 0.0, SimdToMatrixMS = 0.0;
+	double ScalarTransformPositionsMS = 0.0, SimdTransformPositionsMS = 0.0;
+};
+
+/** SIMD 쿼터니언/트랜스폼 연산과 배열 커널을 스칼라 구현과 비교한다 (콘솔 MATH SELFTEST). 실패 항목을 OutFailures에 담고 검사 수를 반환 */
+int32 RunVectorMathSelfTest(TArray<FString>& OutFailures);
+
+/** Count개의 무작위 입력으로 스칼라/SIMD 구현을 측정한다 (콘솔 MATH BENCH) */
+FVectorMathBenchmarkResult RunVectorMathBenchmark(int32 Count);
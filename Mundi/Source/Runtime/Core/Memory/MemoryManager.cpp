@@ -3,14 +3,98 @@
 #include <cstddef>
 #include <malloc.h>
 #include <algorithm>
+#include <thread>
 
-uint32 FMemoryManager::TotalAllocationBytes = 0;
-uint32 FMemoryManager::TotalAllocationCount = 0;
+std::atomic<uint64> FMemoryManager::FrameNumber{ 0 };
 
-void* FMemoryManager::Allocate(SIZE_T Size, SIZE_T Alignment)
+namespace
 {
-	SIZE_T TotalSize = Size + sizeof(SIZE_T);
-	SIZE_T FinalAlignment = std::max(Alignment, alignof(SIZE_T));
+	// 사용자 포인터 바로 앞에 놓이는 할당 헤더
+	struct FAllocationHeader
+	{
+		SIZE_T Size;
+		uint32 HeaderBytes;		// Raw → 사용자 포인터 거리 (정렬에 따라 달라짐)
+		EMemoryTag Tag;
+	};
+
+	struct FTagCounters
+	{
+		std::atomic<int64> LiveBytes{ 0 };
+		std::atomic<int64> LiveCount{ 0 };
+		std::atomic<int64> PeakBytes{ 0 };
+		std::atomic<uint64> TotalAllocations{ 0 };
+	};
+
+	FTagCounters GTagCounters[static_cast<int32>(EMemoryTag::Count)];
+
+	SIZE_T AlignUp(SIZE_T Value, SIZE_T Alignment)
+	{
+		return (Value + Alignment - 1) & ~(Alignment - 1);
+	}
+
+	void UpdatePeak(std::atomic<int64>& Peak, int64 Value)
+	{
+		int64 Current = Peak.load(std::memory_order_relaxed);
+		while (Value > Current && !Peak.compare_exchange_weak(Current, Value, std::memory_order_relaxed))
+		{
+		}
+	}
+
+	// 스레드별 프레임 선형 할당자. 다른 스레드(리포트)는 atomic 통계만 읽는다.
+	struct FThreadFrameAllocator
+	{
+		FLinearAllocator Allocator{ EMemoryTag::FrameLinear };
+		uint64 FrameNumber = 0;
+		uint32 ThreadId = 0;
+		std::atomic<SIZE_T> LastFrameBytes{ 0 };
+		std::atomic<SIZE_T> PeakFrameBytes{ 0 };
+
+		FThreadFrameAllocator();
+		~FThreadFrameAllocator();
+	};
+
+	std::mutex& GetRegistryMutex()
+	{
+		static std::mutex Mutex;
+		return Mutex;
+	}
+
+	TArray<FThreadFrameAllocator*>& GetFrameAllocatorRegistry()
+	{
+		static TArray<FThreadFrameAllocator*> Registry;
+		return Registry;
+	}
+
+	TArray<FMemoryPool*>& GetPoolRegistry()
+	{
+		static TArray<FMemoryPool*> Registry;
+		return Registry;
+	}
+
+	FThreadFrameAllocator::FThreadFrameAllocator()
+	{
+		ThreadId = static_cast<uint32>(std::hash<std::thread::id>()(std::this_thread::get_id()));
+		std::lock_guard<std::mutex> Lock(GetRegistryMutex());
+		GetFrameAllocatorRegistry().Add(this);
+	}
+
+	FThreadFrameAllocator::~FThreadFrameAllocator()
+	{
+		std::lock_guard<std::mutex> Lock(GetRegistryMutex());
+		GetFrameAllocatorRegistry().Remove(this);
+	}
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// FMemoryManager
+// ────────────────────────────────────────────────────────────────────────────
+
+void* FMemoryManager::Allocate(SIZE_T Size, SIZE_T Alignment, EMemoryTag Tag)
+{
+	// 헤더 영역을 정렬 단위로 올려서 사용자 포인터가 요청한 정렬을 유지하도록 한다
+	const SIZE_T FinalAlignment = std::max(Alignment, alignof(FAllocationHeader));
+	const SIZE_T HeaderBytes = AlignUp(sizeof(FAllocationHeader), FinalAlignment);
+	const SIZE_T TotalSize = HeaderBytes + Size;
 
 #if defined(_MSC_VER) && defined(_DEBUG)
 	void* Raw = _aligned_malloc_dbg(TotalSize, FinalAlignment, nullptr, 0);
@@ -20,11 +104,19 @@ void* FMemoryManager::Allocate(SIZE_T Size, SIZE_T Alignment)
 	if (!Raw)
 		return nullptr;
 
-	*reinterpret_cast<SIZE_T*>(Raw) = Size;
-	TotalAllocationBytes += static_cast<uint32>(Size);
-	TotalAllocationCount++;
+	unsigned char* UserPtr = static_cast<unsigned char*>(Raw) + HeaderBytes;
+	FAllocationHeader* Header = reinterpret_cast<FAllocationHeader*>(UserPtr - sizeof(FAllocationHeader));
+	Header->Size = Size;
+	Header->HeaderBytes = static_cast<uint32>(HeaderBytes);
+	Header->Tag = Tag;
+
+	FTagCounters& Counters = GTagCounters[static_cast<int32>(Tag)];
+	const int64 LiveBytes = Counters.LiveBytes.fetch_add(static_cast<int64>(Size), std::memory_order_relaxed) + static_cast<int64>(Size);
+	Counters.LiveCount.fetch_add(1, std::memory_order_relaxed);
+	Counters.TotalAllocations.fetch_add(1, std::memory_order_relaxed);
+	UpdatePeak(Counters.PeakBytes, LiveBytes);
 
-	return static_cast<void*>(static_cast<unsigned char*>(Raw) + sizeof(SIZE_T));
+	return UserPtr;
 }
 
 void FMemoryManager::Deallocate(void* Ptr)
@@ -33,15 +125,324 @@ void FMemoryManager::Deallocate(void* Ptr)
 		return;
 
 	unsigned char* UserPtr = static_cast<unsigned char*>(Ptr);
-	unsigned char* Raw = UserPtr - sizeof(SIZE_T);
-	SIZE_T Size = *reinterpret_cast<SIZE_T*>(Raw);
+	const FAllocationHeader* Header = reinterpret_cast<const FAllocationHeader*>(UserPtr - sizeof(FAllocationHeader));
+	unsigned char* Raw = UserPtr - Header->HeaderBytes;
 
-	TotalAllocationBytes -= static_cast<uint32>(Size);
-	TotalAllocationCount--;
+	FTagCounters& Counters = GTagCounters[static_cast<int32>(Header->Tag)];
+	Counters.LiveBytes.fetch_sub(static_cast<int64>(Header->Size), std::memory_order_relaxed);
+	Counters.LiveCount.fetch_sub(1, std::memory_order_relaxed);
 
 #if defined(_MSC_VER) && defined(_DEBUG)
 	_aligned_free_dbg(Raw);
 #else
 	_aligned_free(Raw);
 #endif
-}
\ No newline at end of file
+}
+
+void FMemoryManager::BeginFrame()
+{
+	FrameNumber.fetch_add(1, std::memory_order_relaxed);
+}
+
+void* FMemoryManager::AllocateFrame(SIZE_T Size, SIZE_T Alignment)
+{
+	thread_local FThreadFrameAllocator ThreadAllocator;
+
+	// 이 스레드가 새 프레임에서 처음 할당하면 지난 프레임 데이터를 한꺼번에 회수
+	const uint64 CurrentFrame = GetFrameNumber();
+	if (ThreadAllocator.FrameNumber != CurrentFrame)
+	{
+		const SIZE_T UsedBytes = ThreadAllocator.Allocator.GetBytesUsed();
+		ThreadAllocator.LastFrameBytes.store(UsedBytes, std::memory_order_relaxed);
+		if (UsedBytes > ThreadAllocator.PeakFrameBytes.load(std::memory_order_relaxed))
+		{
+			ThreadAllocator.PeakFrameBytes.store(UsedBytes, std::memory_order_relaxed);
+		}
+		ThreadAllocator.Allocator.Reset();
+		ThreadAllocator.FrameNumber = CurrentFrame;
+	}
+
+	return ThreadAllocator.Allocator.Allocate(Size, Alignment);
+}
+
+FMemoryTagStats FMemoryManager::GetTagStats(EMemoryTag Tag)
+{
+	const FTagCounters& Counters = GTagCounters[static_cast<int32>(Tag)];
+	FMemoryTagStats Stats;
+	Stats.LiveBytes = Counters.LiveBytes.load(std::memory_order_relaxed);
+	Stats.LiveCount = Counters.LiveCount.load(std::memory_order_relaxed);
+	Stats.PeakBytes = Counters.PeakBytes.load(std::memory_order_relaxed);
+	Stats.TotalAllocations = Counters.TotalAllocations.load(std::memory_order_relaxed);
+	return Stats;
+}
+
+uint64 FMemoryManager::GetTotalAllocationBytes()
+{
+	int64 Total = 0;
+	for (const FTagCounters& Counters : GTagCounters)
+	{
+		Total += Counters.LiveBytes.load(std::memory_order_relaxed);
+	}
+	return static_cast<uint64>(std::max<int64>(Total, 0));
+}
+
+uint64 FMemoryManager::GetTotalAllocationCount()
+{
+	int64 Total = 0;
+	for (const FTagCounters& Counters : GTagCounters)
+	{
+		Total += Counters.LiveCount.load(std::memory_order_relaxed);
+	}
+	return static_cast<uint64>(std::max<int64>(Total, 0));
+}
+
+const char* FMemoryManager::GetTagName(EMemoryTag Tag)
+{
+	switch (Tag)
+	{
+	case EMemoryTag::Default:		return "Default";
+	case EMemoryTag::Object:		return "Object";
+	case EMemoryTag::Rendering:		return "Rendering";
+	case EMemoryTag::Physics:		return "Physics";
+	case EMemoryTag::Particles:		return "Particles";
+	case EMemoryTag::Spatial:		return "Spatial";
+	case EMemoryTag::Scripting:		return "Scripting";
+	case EMemoryTag::FrameLinear:	return "FrameLinear";
+	default:						return "Unknown";
+	}
+}
+
+void FMemoryManager::BuildReport(TArray<FString>& OutLines)
+{
+	char Line[256];
+	const double ToKB = 1.0 / 1024.0;
+
+	std::snprintf(Line, sizeof(Line), "Memory report (frame %llu): %.1f KB live in %llu allocations",
+		static_cast<unsigned long long>(GetFrameNumber()), GetTotalAllocationBytes() * ToKB, static_cast<unsigned long long>(GetTotalAllocationCount()));
+	OutLines.Add(Line);
+	OutLines.Add("  Tag              Live KB     Live #     Peak KB      Allocs");
+	for (int32 TagIndex = 0; TagIndex < static_cast<int32>(EMemoryTag::Count); ++TagIndex)
+	{
+		const EMemoryTag Tag = static_cast<EMemoryTag>(TagIndex);
+		const FMemoryTagStats Stats = GetTagStats(Tag);
+		if (Stats.TotalAllocations == 0)
+		{
+			continue;
+		}
+		std::snprintf(Line, sizeof(Line), "  %-12s %11.1f %10lld %11.1f %11llu",
+			GetTagName(Tag), Stats.LiveBytes * ToKB, static_cast<long long>(Stats.LiveCount), Stats.PeakBytes * ToKB,
+			static_cast<unsigned long long>(Stats.TotalAllocations));
+		OutLines.Add(Line);
+	}
+
+	std::lock_guard<std::mutex> Lock(GetRegistryMutex());
+
+	const TArray<FMemoryPool*>& Pools = GetPoolRegistry();
+	if (!Pools.IsEmpty())
+	{
+		OutLines.Add("  Pool                          Block   Live/Capacity     Peak      Allocs");
+		for (const FMemoryPool* Pool : Pools)
+		{
+			const FMemoryPoolStats Stats = Pool->GetStats();
+			std::snprintf(Line, sizeof(Line), "  %-28s %6zu %7d/%-7d %8d %11llu",
+				Stats.Name, Stats.BlockSize, Stats.LiveBlocks, Stats.CapacityBlocks, Stats.PeakBlocks,
+				static_cast<unsigned long long>(Stats.TotalAllocations));
+			OutLines.Add(Line);
+		}
+	}
+
+	const TArray<FThreadFrameAllocator*>& FrameAllocators = GetFrameAllocatorRegistry();
+	if (!FrameAllocators.IsEmpty())
+	{
+		OutLines.Add("  Frame allocator (thread)      Last frame KB     Peak KB");
+		for (const FThreadFrameAllocator* FrameAllocator : FrameAllocators)
+		{
+			std::snprintf(Line, sizeof(Line), "  %08x %30.1f %11.1f", FrameAllocator->ThreadId,
+				FrameAllocator->LastFrameBytes.load(std::memory_order_relaxed) * ToKB,
+				FrameAllocator->PeakFrameBytes.load(std::memory_order_relaxed) * ToKB);
+			OutLines.Add(Line);
+		}
+	}
+}
+
+void FMemoryManager::RegisterPool(FMemoryPool* Pool)
+{
+	std::lock_guard<std::mutex> Lock(GetRegistryMutex());
+	GetPoolRegistry().Add(Pool);
+}
+
+void FMemoryManager::UnregisterPool(FMemoryPool* Pool)
+{
+	std::lock_guard<std::mutex> Lock(GetRegistryMutex());
+	GetPoolRegistry().Remove(Pool);
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// FLinearAllocator
+// ────────────────────────────────────────────────────────────────────────────
+
+FLinearAllocator::FLinearAllocator(EMemoryTag InTag, SIZE_T InPageSize)
+	: Tag(InTag)
+	, PageSize(InPageSize)
+{
+}
+
+FLinearAllocator::~FLinearAllocator()
+{
+	for (FPage& Page : Pages)
+	{
+		FMemoryManager::Deallocate(Page.Data);
+	}
+	Pages.Empty();
+}
+
+void* FLinearAllocator::Allocate(SIZE_T Size, SIZE_T Alignment)
+{
+	if (Size == 0)
+	{
+		Size = 1;
+	}
+
+	if (CurrentPage >= 0)
+	{
+		const FPage& Page = Pages[CurrentPage];
+		const SIZE_T Start = AlignUp(Offset, Alignment);
+		if (Start + Size <= Page.Size)
+		{
+			Offset = Start + Size;
+			return Page.Data + Start;
+		}
+		UsedInPreviousPages += Offset;
+	}
+
+	// 다음 페이지로 넘어간다. 재사용할 페이지가 작으면 그 자리에 새 페이지를 끼워 넣는다
+	// (페이지 시작은 64바이트 정렬이므로 그 이하의 정렬은 페이지 첫 위치에서 항상 만족)
+	const int32 NextPage = CurrentPage + 1;
+	if (NextPage >= Pages.Num() || Pages[NextPage].Size < Size || Alignment > 64)
+	{
+		FPage NewPage;
+		NewPage.Size = std::max(PageSize, AlignUp(Size, PageSize));
+		NewPage.Data = static_cast<uint8*>(FMemoryManager::Allocate(NewPage.Size, std::max<SIZE_T>(Alignment, 64), Tag));
+		Pages.Insert(NewPage, NextPage);
+	}
+
+	CurrentPage = NextPage;
+	Offset = Size;
+	return Pages[CurrentPage].Data;
+}
+
+void FLinearAllocator::Reset()
+{
+	CurrentPage = Pages.IsEmpty() ? -1 : 0;
+	Offset = 0;
+	UsedInPreviousPages = 0;
+}
+
+SIZE_T FLinearAllocator::GetBytesReserved() const
+{
+	SIZE_T Reserved = 0;
+	for (const FPage& Page : Pages)
+	{
+		Reserved += Page.Size;
+	}
+	return Reserved;
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// FMemoryPool
+// ────────────────────────────────────────────────────────────────────────────
+
+FMemoryPool::FMemoryPool(const char* InName, SIZE_T InBlockSize, SIZE_T InAlignment, EMemoryTag InTag, int32 InBlocksPerChunk)
+	: Name(InName)
+	, Alignment(std::max(InAlignment, alignof(FFreeBlock)))
+	, Tag(InTag)
+	, BlocksPerChunk(std::max(InBlocksPerChunk, 1))
+{
+	BlockSize = AlignUp(std::max(InBlockSize, sizeof(FFreeBlock)), Alignment);
+	FMemoryManager::RegisterPool(this);
+}
+
+FMemoryPool::~FMemoryPool()
+{
+	FMemoryManager::UnregisterPool(this);
+
+	// 종료 시점까지 살아있는 블록이 있으면 (정적 소멸 순서 문제) 청크를 남겨둔다
+	if (LiveBlocks == 0)
+	{
+		for (void* Chunk : Chunks)
+		{
+			FMemoryManager::Deallocate(Chunk);
+		}
+	}
+	Chunks.Empty();
+}
+
+void* FMemoryPool::Allocate()
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+
+	if (!FreeList)
+	{
+		AllocateChunk();
+		if (!FreeList)
+		{
+			return nullptr;
+		}
+	}
+
+	FFreeBlock* Block = FreeList;
+	FreeList = Block->Next;
+
+	++LiveBlocks;
+	++TotalAllocations;
+	PeakBlocks = std::max(PeakBlocks, LiveBlocks);
+	return Block;
+}
+
+void FMemoryPool::Free(void* Ptr)
+{
+	if (!Ptr)
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> Lock(Mutex);
+
+	FFreeBlock* Block = static_cast<FFreeBlock*>(Ptr);
+	Block->Next = FreeList;
+	FreeList = Block;
+	--LiveBlocks;
+}
+
+FMemoryPoolStats FMemoryPool::GetStats() const
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+
+	FMemoryPoolStats Stats;
+	Stats.Name = Name;
+	Stats.Tag = Tag;
+	Stats.BlockSize = BlockSize;
+	Stats.LiveBlocks = LiveBlocks;
+	Stats.PeakBlocks = PeakBlocks;
+	Stats.CapacityBlocks = Chunks.Num() * BlocksPerChunk;
+	Stats.TotalAllocations = TotalAllocations;
+	return Stats;
+}
+
+void FMemoryPool::AllocateChunk()
+{
+	uint8* Chunk = static_cast<uint8*>(FMemoryManager::Allocate(BlockSize * BlocksPerChunk, Alignment, Tag));
+	if (!Chunk)
+	{
+		return;
+	}
+	Chunks.Add(Chunk);
+
+	// 주소 순서대로 꺼내지도록 뒤에서부터 프리 리스트에 연결
+	for (int32 i = BlocksPerChunk - 1; i >= 0; --i)
+	{
+		FFreeBlock* Block = reinterpret_cast<FFreeBlock*>(Chunk + i * BlockSize);
+		Block->Next = FreeList;
+		FreeList = Block;
+	}
+}
@@ -1,15 +1,179 @@
 ﻿#pragma once
 #include <cstddef>
+#include <atomic>
+#include <mutex>
 #include "UEContainer.h"
 
+/** 할당 용도 태그. 태그별로 바이트/개수를 추적해 메모리 리포트(MEMREPORT)에 표시한다 */
+enum class EMemoryTag : uint8
+{
+	Default,
+	Object,			// UObject
+	Rendering,
+	Physics,
+	Particles,
+	Spatial,		// 옥트리/BVH 등 공간 분할
+	Scripting,
+	FrameLinear,	// 프레임 선형 할당자 페이지
+	Count
+};
+
+struct FMemoryTagStats
+{
+	int64 LiveBytes = 0;
+	int64 LiveCount = 0;
+	int64 PeakBytes = 0;
+	uint64 TotalAllocations = 0;	// 누적 할당 횟수 (해제 포함)
+};
+
+/**
+ * FLinearAllocator - 페이지 단위 선형(bump) 할당자
+ * 개별 해제는 없고 Reset()으로 한꺼번에 되돌린다. 페이지는 반환하지 않고 재사용한다.
+ * @note 스레드 안전하지 않다. 스레드마다 하나씩 쓴다.
+ */
+class FLinearAllocator
+{
+public:
+	explicit FLinearAllocator(EMemoryTag InTag, SIZE_T InPageSize = 256 * 1024);
+	~FLinearAllocator();
+
+	FLinearAllocator(const FLinearAllocator&) = delete;
+	FLinearAllocator& operator=(const FLinearAllocator&) = delete;
+
+	void* Allocate(SIZE_T Size, SIZE_T Alignment);
+	void Reset();
+
+	SIZE_T GetBytesUsed() const { return UsedInPreviousPages + Offset; }
+	SIZE_T GetBytesReserved() const;
+
+private:
+	struct FPage
+	{
+		uint8* Data = nullptr;
+		SIZE_T Size = 0;
+	};
+
+	TArray<FPage> Pages;
+	int32 CurrentPage = -1;
+	SIZE_T Offset = 0;
+	SIZE_T UsedInPreviousPages = 0;
+	EMemoryTag Tag;
+	SIZE_T PageSize;
+};
+
+struct FMemoryPoolStats
+{
+	const char* Name = nullptr;
+	EMemoryTag Tag = EMemoryTag::Default;
+	SIZE_T BlockSize = 0;
+	int32 LiveBlocks = 0;
+	int32 PeakBlocks = 0;
+	int32 CapacityBlocks = 0;
+	uint64 TotalAllocations = 0;
+};
+
+/**
+ * FMemoryPool - 고정 크기 블록 풀
+ * 자주 생성/삭제되는 객체(이미터 인스턴스, 프레임마다 만드는 렌더 데이터, 트리 노드 등)를 청크 단위로 할당하고
+ * 해제된 블록은 프리 리스트로 재사용한다. 생성 시 전역 목록에 등록되어 메모리 리포트에 표시된다.
+ * @note 스레드 안전 (뮤텍스)
+ */
+class FMemoryPool
+{
+public:
+	FMemoryPool(const char* InName, SIZE_T InBlockSize, SIZE_T InAlignment, EMemoryTag InTag, int32 InBlocksPerChunk = 64);
+	~FMemoryPool();
+
+	FMemoryPool(const FMemoryPool&) = delete;
+	FMemoryPool& operator=(const FMemoryPool&) = delete;
+
+	void* Allocate();
+	void Free(void* Ptr);
+
+	FMemoryPoolStats GetStats() const;
+
+private:
+	struct FFreeBlock
+	{
+		FFreeBlock* Next;
+	};
+
+	void AllocateChunk();
+
+	const char* Name;
+	SIZE_T BlockSize;
+	SIZE_T Alignment;
+	EMemoryTag Tag;
+	int32 BlocksPerChunk;
+
+	mutable std::mutex Mutex;
+	FFreeBlock* FreeList = nullptr;
+	TArray<void*> Chunks;
+	int32 LiveBlocks = 0;
+	int32 PeakBlocks = 0;
+	uint64 TotalAllocations = 0;
+};
+
 class FMemoryManager
 {
 public:
 	// 인자 변수를 PascalCase로 변경
-	static void* Allocate(SIZE_T Size, SIZE_T Alignment);
+	static void* Allocate(SIZE_T Size, SIZE_T Alignment, EMemoryTag Tag = EMemoryTag::Default);
 	static void  Deallocate(void* Ptr);
 
-public:
-	static uint32 TotalAllocationBytes;
-	static uint32 TotalAllocationCount;
-};
\ No newline at end of file
+	/** 프레임 경계 (엔진 Tick 시작). 각 스레드의 프레임 선형 할당자는 다음 할당 시 리셋된다 */
+	static void BeginFrame();
+	static uint64 GetFrameNumber() { return FrameNumber.load(std::memory_order_relaxed); }
+
+	/**
+	 * 현재 스레드의 프레임 선형 할당자에서 할당한다. 다음 프레임에 자동으로 회수되므로 해제하지 않는다.
+	 * @note 프레임을 넘겨 보관하면 안 된다 (렌더 데이터처럼 다음 프레임까지 사는 데이터는 풀을 쓴다)
+	 */
+	static void* AllocateFrame(SIZE_T Size, SIZE_T Alignment = 16);
+
+	template<typename T>
+	static T* AllocateFrameArray(int32 Num)
+	{
+		static_assert(std::is_trivially_destructible_v<T>, "프레임 할당은 소멸자를 호출하지 않습니다");
+		return static_cast<T*>(AllocateFrame(sizeof(T) * static_cast<SIZE_T>(Num), alignof(T)));
+	}
+
+	static FMemoryTagStats GetTagStats(EMemoryTag Tag);
+	static uint64 GetTotalAllocationBytes();
+	static uint64 GetTotalAllocationCount();
+	static const char* GetTagName(EMemoryTag Tag);
+
+	/** 태그별 사용량, 풀, 프레임 할당자 현황을 사람이 읽을 수 있는 줄 목록으로 만든다 */
+	static void BuildReport(TArray<FString>& OutLines);
+
+private:
+	friend class FMemoryPool;
+
+	static void RegisterPool(FMemoryPool* Pool);
+	static void UnregisterPool(FMemoryPool* Pool);
+
+	static std::atomic<uint64> FrameNumber;
+};
+
+/**
+ * 클래스 전용 operator new/delete를 FMemoryPool로 연결한다.
+ * 파생 클래스(크기가 다른 객체)는 일반 할당으로 넘어가므로, 풀을 쓰려는 구체 클래스마다 선언한다.
+ * 가상 소멸자가 있으면 sized delete에 실제 객체 크기가 넘어온다.
+ */
+#define DECLARE_POOLED_ALLOCATION(ClassName, Tag) \
+public: \
+	static FMemoryPool& GetAllocationPool() \
+	{ \
+		static FMemoryPool Pool(#ClassName, sizeof(ClassName), alignof(ClassName), Tag); \
+		return Pool; \
+	} \
+	static void* operator new(SIZE_T Size) \
+	{ \
+		return Size == sizeof(ClassName) ? GetAllocationPool().Allocate() : FMemoryManager::Allocate(Size, alignof(ClassName), Tag); \
+	} \
+	static void operator delete(void* Ptr, SIZE_T Size) noexcept \
+	{ \
+		if (!Ptr) return; \
+		if (Size == sizeof(ClassName)) GetAllocationPool().Free(Ptr); \
+		else FMemoryManager::Deallocate(Ptr); \
+	}
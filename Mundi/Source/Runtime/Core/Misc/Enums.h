@@ -181,9 +181,11 @@ enum class EEngineShowFlags : uint64
 
     SF_DOF = 1ull << 23,
 
+    SF_ShadowCaching = 1ull << 24, // Reuse shadow views whose light and casters did not move
+
     // Default enabled flags
     SF_DefaultEnabled = SF_Primitives | SF_StaticMeshes | SF_SkeletalMeshes | SF_Grid | SF_Lighting | SF_Decals |
-    SF_DOF | SF_Fog | SF_FXAA | SF_Billboard | SF_EditorIcon | SF_Shadows | SF_ShadowAntiAliasing | SF_GPUSkinning | SF_Particles,
+    SF_DOF | SF_Fog | SF_FXAA | SF_Billboard | SF_EditorIcon | SF_Shadows | SF_ShadowAntiAliasing | SF_ShadowCaching | SF_GPUSkinning | SF_Particles,
 
     // All flags (for initialization/reset)
     SF_All = 0xFFFFFFFFFFFFFFFFull
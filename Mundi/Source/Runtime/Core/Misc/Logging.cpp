@@ -0,0 +1,351 @@
+﻿#include "pch.h"
+#include "Logging.h"
+#include "PlatformTime.h"
+#include <cstdio>
+
+DEFINE_LOG_CATEGORY(LogTemp)
+DEFINE_LOG_CATEGORY(LogPicking)
+DEFINE_LOG_CATEGORY(LogRender)
+DEFINE_LOG_CATEGORY(LogAnimation)
+
+namespace
+{
+	const char* const LogFilePath = "Logs/Mundi.log";
+
+	// 드레인 스레드가 깨어나는 주기 (에러는 즉시 깨움)
+	constexpr int32 DrainIntervalMS = 10;
+}
+
+// ──────────────────────────────────────────────
+// ELogVerbosity
+// ──────────────────────────────────────────────
+
+const char* ELogVerbosity::ToString(Type InVerbosity)
+{
+	switch (InVerbosity)
+	{
+	case NoLogging:   return "NoLogging";
+	case Error:       return "Error";
+	case Warning:     return "Warning";
+	case Display:     return "Display";
+	case Log:         return "Log";
+	case Verbose:     return "Verbose";
+	case VeryVerbose: return "VeryVerbose";
+	default:          return "Unknown";
+	}
+}
+
+bool ELogVerbosity::FromString(const char* InString, Type& OutVerbosity)
+{
+	for (uint8 Value = NoLogging; Value <= VeryVerbose; ++Value)
+	{
+		if (_stricmp(InString, ToString(static_cast<Type>(Value))) == 0)
+		{
+			OutVerbosity = static_cast<Type>(Value);
+			return true;
+		}
+	}
+	if (_stricmp(InString, "All") == 0)
+	{
+		OutVerbosity = All;
+		return true;
+	}
+	return false;
+}
+
+// ──────────────────────────────────────────────
+// FLogCategoryBase
+// ──────────────────────────────────────────────
+
+FLogCategoryBase::FLogCategoryBase(const char* InName, ELogVerbosity::Type InDefaultVerbosity)
+	: Name(InName)
+	, Verbosity(InDefaultVerbosity)
+{
+	GetRegisteredCategories().Add(this);
+}
+
+TArray<FLogCategoryBase*>& FLogCategoryBase::GetRegisteredCategories()
+{
+	static TArray<FLogCategoryBase*> Categories;
+	return Categories;
+}
+
+FLogCategoryBase* FLogCategoryBase::FindCategory(const char* InName)
+{
+	for (FLogCategoryBase* Category : GetRegisteredCategories())
+	{
+		if (_stricmp(Category->GetName(), InName) == 0)
+		{
+			return Category;
+		}
+	}
+	return nullptr;
+}
+
+// ──────────────────────────────────────────────
+// FLogManager
+// ──────────────────────────────────────────────
+
+FLogManager::FLogManager()
+{
+	static_assert((RingCapacity & (RingCapacity - 1)) == 0, "RingCapacity must be a power of two");
+
+	Records = std::make_unique<FLogRecord[]>(RingCapacity);
+	for (uint32 i = 0; i < RingCapacity; ++i)
+	{
+		Records[i].Sequence.store(i, std::memory_order_relaxed);
+	}
+
+	StartCycles = FPlatformTime::Cycles64();
+
+	std::error_code ErrorCode;
+	std::filesystem::create_directories(std::filesystem::path(LogFilePath).parent_path(), ErrorCode);
+	if (fopen_s(&LogFile, LogFilePath, "w") != 0)
+	{
+		LogFile = nullptr;
+	}
+
+	StartDrainThread();
+}
+
+FLogManager::~FLogManager()
+{
+	Shutdown();
+}
+
+void FLogManager::Log(const FLogCategoryBase& InCategory, ELogVerbosity::Type InVerbosity, const char* InFormat, ...)
+{
+	va_list Args;
+	va_start(Args, InFormat);
+	LogV(InCategory, InVerbosity, InFormat, Args);
+	va_end(Args);
+}
+
+void FLogManager::LogV(const FLogCategoryBase& InCategory, ELogVerbosity::Type InVerbosity, const char* InFormat, va_list InArgs)
+{
+	// 1. 슬롯 예약 (다중 생산자, bounded MPMC 큐의 생산자 측)
+	FLogRecord* Record = nullptr;
+	uint64 Pos = EnqueuePos.load(std::memory_order_relaxed);
+	while (true)
+	{
+		Record = &Records[Pos & (RingCapacity - 1)];
+		const uint64 Sequence = Record->Sequence.load(std::memory_order_acquire);
+		const int64 Diff = static_cast<int64>(Sequence) - static_cast<int64>(Pos);
+
+		if (Diff == 0)
+		{
+			if (EnqueuePos.compare_exchange_weak(Pos, Pos + 1, std::memory_order_relaxed))
+			{
+				break;
+			}
+		}
+		else if (Diff < 0)
+		{
+			// 소비자가 한 바퀴 뒤처짐 -> 호출 스레드를 막지 않고 버린다
+			DroppedCount.fetch_add(1, std::memory_order_relaxed);
+			WakeCondition.notify_one();
+			return;
+		}
+		else
+		{
+			Pos = EnqueuePos.load(std::memory_order_relaxed);
+		}
+	}
+
+	// 2. 예약한 슬롯에 바로 포맷팅
+	Record->Category = &InCategory;
+	Record->Verbosity = InVerbosity;
+	Record->ThreadId = GetCurrentThreadId();
+	Record->Cycles = FPlatformTime::Cycles64();
+	vsnprintf_s(Record->Text, MaxMessageLength, _TRUNCATE, InFormat, InArgs);
+
+	// 3. 게시
+	Record->Sequence.store(Pos + 1, std::memory_order_release);
+
+	if (InVerbosity <= ELogVerbosity::Error)
+	{
+		WakeCondition.notify_one();
+	}
+}
+
+void FLogManager::StartDrainThread()
+{
+	bStopping.store(false);
+	DrainThread = std::thread(&FLogManager::DrainLoop, this);
+}
+
+void FLogManager::DrainLoop()
+{
+	while (!bStopping.load(std::memory_order_acquire))
+	{
+		{
+			std::unique_lock<std::mutex> Lock(WakeMutex);
+			WakeCondition.wait_for(Lock, std::chrono::milliseconds(DrainIntervalMS));
+		}
+
+		std::lock_guard<std::mutex> Lock(DrainMutex);
+		if (DrainRecords_AssumesLocked() > 0 && LogFile)
+		{
+			fflush(LogFile);
+		}
+	}
+}
+
+uint32 FLogManager::DrainRecords_AssumesLocked()
+{
+	uint32 NumDrained = 0;
+	while (true)
+	{
+		FLogRecord& Record = Records[DequeuePos & (RingCapacity - 1)];
+		if (Record.Sequence.load(std::memory_order_acquire) != DequeuePos + 1)
+		{
+			break;   // 비었거나 생산자가 아직 쓰는 중
+		}
+
+		WriteRecord_AssumesLocked(Record);
+
+		// 한 바퀴 뒤 생산자에게 슬롯 반환
+		Record.Sequence.store(DequeuePos + RingCapacity, std::memory_order_release);
+		++DequeuePos;
+		++NumDrained;
+	}
+
+	const uint64 Dropped = DroppedCount.load(std::memory_order_relaxed);
+	if (Dropped != ReportedDropCount && LogFile)
+	{
+		fprintf(LogFile, "[Log] %llu messages dropped (ring buffer full)\n", Dropped - ReportedDropCount);
+		ReportedDropCount = Dropped;
+	}
+
+	return NumDrained;
+}
+
+void FLogManager::WriteRecord_AssumesLocked(const FLogRecord& InRecord)
+{
+	// 호출부 관례상 메시지 끝에 붙은 개행은 제거
+	size_t Length = strnlen(InRecord.Text, MaxMessageLength);
+	while (Length > 0 && (InRecord.Text[Length - 1] == '\n' || InRecord.Text[Length - 1] == '\r'))
+	{
+		--Length;
+	}
+
+	const bool bTemp = InRecord.Category == &LogTemp;
+	const double Seconds = static_cast<double>(InRecord.Cycles - StartCycles) * FPlatformTime::GetSecondsPerCycle();
+
+	// 파일: [시간][스레드] 카테고리: 상세도: 메시지
+	if (LogFile)
+	{
+		fprintf(LogFile, "[%10.4f][%5u] %s: %s: %.*s\n",
+			Seconds, InRecord.ThreadId, InRecord.Category->GetName(), ELogVerbosity::ToString(InRecord.Verbosity),
+			static_cast<int>(Length), InRecord.Text);
+	}
+
+	// 콘솔: 기존 UE_LOG(LogTemp)는 메시지 그대로, 카테고리 로그는 "카테고리: 메시지"
+	FConsoleLogLine Line;
+	Line.Verbosity = InRecord.Verbosity;
+	if (!bTemp)
+	{
+		Line.Text = InRecord.Category->GetName();
+		Line.Text += ": ";
+	}
+	Line.Text.append(InRecord.Text, Length);
+
+#ifdef _DEBUG
+	OutputDebugStringA((Line.Text + "\n").c_str());
+#endif
+
+	{
+		std::lock_guard<std::mutex> Lock(ConsoleMutex);
+		if (bConsoleSinkEnabled)
+		{
+			if (PendingConsoleLines.Num() >= MaxPendingConsoleLines)
+			{
+				// 콘솔이 한동안 가져가지 않으면 오래된 절반을 버린다
+				PendingConsoleLines.erase(PendingConsoleLines.begin(), PendingConsoleLines.begin() + MaxPendingConsoleLines / 2);
+				ConsoleDroppedCount += MaxPendingConsoleLines / 2;
+			}
+			PendingConsoleLines.Add(std::move(Line));
+		}
+	}
+
+	WrittenCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+void FLogManager::Flush(bool bBlocking)
+{
+	std::unique_lock<std::mutex> Lock(DrainMutex, std::defer_lock);
+	if (bBlocking)
+	{
+		Lock.lock();
+	}
+	else if (!Lock.try_lock())
+	{
+		return;
+	}
+
+	DrainRecords_AssumesLocked();
+	if (LogFile)
+	{
+		fflush(LogFile);
+	}
+}
+
+void FLogManager::Shutdown()
+{
+	if (DrainThread.joinable())
+	{
+		bStopping.store(true, std::memory_order_release);
+		WakeCondition.notify_one();
+		DrainThread.join();
+	}
+
+	Flush();
+
+	std::lock_guard<std::mutex> Lock(DrainMutex);
+	if (LogFile)
+	{
+		fclose(LogFile);
+		LogFile = nullptr;
+	}
+}
+
+void FLogManager::SetConsoleSinkEnabled(bool bEnabled)
+{
+	std::lock_guard<std::mutex> Lock(ConsoleMutex);
+	bConsoleSinkEnabled = bEnabled;
+	if (!bEnabled)
+	{
+		PendingConsoleLines.Empty();
+	}
+}
+
+void FLogManager::PullConsoleLines(TArray<FConsoleLogLine>& OutLines)
+{
+	std::lock_guard<std::mutex> Lock(ConsoleMutex);
+	if (PendingConsoleLines.IsEmpty())
+	{
+		return;
+	}
+
+	if (OutLines.IsEmpty())
+	{
+		OutLines = std::move(PendingConsoleLines);
+	}
+	else
+	{
+		std::move(PendingConsoleLines.begin(), PendingConsoleLines.end(), std::back_inserter(OutLines));
+	}
+	PendingConsoleLines.Empty();
+}
+
+FLogStats FLogManager::GetStats() const
+{
+	FLogStats Stats;
+	Stats.Written = WrittenCount.load(std::memory_order_relaxed);
+	Stats.Dropped = DroppedCount.load(std::memory_order_relaxed);
+	{
+		std::lock_guard<std::mutex> Lock(ConsoleMutex);
+		Stats.ConsoleDropped = ConsoleDroppedCount;
+	}
+	return Stats;
+}
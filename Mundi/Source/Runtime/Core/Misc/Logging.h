@@ -0,0 +1,212 @@
+﻿#pragma once
+#include <atomic>
+#include <memory>
+#include <cstdarg>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <type_traits>
+#include "UEContainer.h"
+
+/**
+ * 로그 상세도 (값이 작을수록 중요)
+ * 카테고리의 현재 상세도보다 큰 메시지는 포맷팅 전에 버려진다.
+ */
+namespace ELogVerbosity
+{
+	enum Type : uint8
+	{
+		NoLogging = 0,
+		Error,
+		Warning,
+		Display,
+		Log,
+		Verbose,
+		VeryVerbose,
+
+		All = VeryVerbose
+	};
+
+	const char* ToString(Type InVerbosity);
+
+	/** 대소문자 무관 이름 -> 상세도 (실패 시 false) */
+	bool FromString(const char* InString, Type& OutVerbosity);
+}
+
+/**
+ * 컴파일 타임 최소 상세도. 이보다 상세한 UE_LOG_CATEGORY 호출은 코드에서 제거된다.
+ * 에디터 빌드는 전부 남겨두고 런타임 상세도로만 거른다.
+ */
+#ifndef LOG_COMPILED_MIN_VERBOSITY
+	#ifdef _EDITOR
+		#define LOG_COMPILED_MIN_VERBOSITY ELogVerbosity::All
+	#else
+		#define LOG_COMPILED_MIN_VERBOSITY ELogVerbosity::Log
+	#endif
+#endif
+
+/** 로그 카테고리 (런타임 상세도는 어느 스레드에서든 읽고 쓸 수 있음) */
+class FLogCategoryBase
+{
+public:
+	FLogCategoryBase(const char* InName, ELogVerbosity::Type InDefaultVerbosity);
+
+	const char* GetName() const { return Name; }
+
+	ELogVerbosity::Type GetVerbosity() const { return Verbosity.load(std::memory_order_relaxed); }
+	void SetVerbosity(ELogVerbosity::Type InVerbosity) { Verbosity.store(InVerbosity, std::memory_order_relaxed); }
+
+	bool IsSuppressed(ELogVerbosity::Type InVerbosity) const { return InVerbosity > GetVerbosity(); }
+
+	/** 등록된 모든 카테고리 (정적 초기화 순서와 무관) */
+	static TArray<FLogCategoryBase*>& GetRegisteredCategories();
+	static FLogCategoryBase* FindCategory(const char* InName);
+
+private:
+	const char* Name;
+	std::atomic<ELogVerbosity::Type> Verbosity;
+};
+
+template<ELogVerbosity::Type InCompileTimeVerbosity>
+class TLogCategory : public FLogCategoryBase
+{
+public:
+	static constexpr ELogVerbosity::Type CompileTimeVerbosity = InCompileTimeVerbosity;
+
+	TLogCategory(const char* InName, ELogVerbosity::Type InDefaultVerbosity)
+		: FLogCategoryBase(InName, InDefaultVerbosity)
+	{
+	}
+};
+
+#define DECLARE_LOG_CATEGORY_EXTERN(CategoryName, DefaultVerbosity, CompileTimeVerbosity) \
+	extern struct FLogCategory##CategoryName : public TLogCategory<ELogVerbosity::CompileTimeVerbosity> \
+	{ \
+		FLogCategory##CategoryName() : TLogCategory(#CategoryName, ELogVerbosity::DefaultVerbosity) {} \
+	} CategoryName;
+
+#define DEFINE_LOG_CATEGORY(CategoryName) FLogCategory##CategoryName CategoryName;
+
+/**
+ * 카테고리 로그. 컴파일 타임에 걸러지면 인자도 평가하지 않고, 런타임에 걸러지면 포맷팅하지 않는다.
+ * 예: UE_LOG_CATEGORY(LogPicking, Verbose, "Hit %d", Index);
+ */
+#define UE_LOG_CATEGORY(CategoryName, Verbosity, fmt, ...) \
+	do \
+	{ \
+		if constexpr (ELogVerbosity::Verbosity <= LOG_COMPILED_MIN_VERBOSITY && \
+			ELogVerbosity::Verbosity <= std::remove_reference_t<decltype(CategoryName)>::CompileTimeVerbosity) \
+		{ \
+			if (!CategoryName.IsSuppressed(ELogVerbosity::Verbosity)) \
+			{ \
+				FLogManager::GetInstance().Log(CategoryName, ELogVerbosity::Verbosity, fmt, ##__VA_ARGS__); \
+			} \
+		} \
+	} while (0)
+
+// 엔진 공용 카테고리 (LogTemp: 카테고리 없는 기존 UE_LOG)
+DECLARE_LOG_CATEGORY_EXTERN(LogTemp, Log, All)
+DECLARE_LOG_CATEGORY_EXTERN(LogPicking, Log, All)
+DECLARE_LOG_CATEGORY_EXTERN(LogRender, Log, All)
+DECLARE_LOG_CATEGORY_EXTERN(LogAnimation, Log, All)
+
+// 콘솔 위젯으로 전달되는 한 줄 (게임 스레드에서 가져감)
+struct FConsoleLogLine
+{
+	FString Text;
+	ELogVerbosity::Type Verbosity = ELogVerbosity::Log;
+};
+
+struct FLogStats
+{
+	uint64 Written = 0;         // 싱크까지 전달된 메시지
+	uint64 Dropped = 0;         // 링 버퍼가 가득 차 버린 메시지
+	uint64 ConsoleDropped = 0;  // 콘솔이 가져가기 전에 대기열 한도를 넘어 버린 줄
+};
+
+/**
+ * 비동기 로그 백엔드
+ *
+ * 호출 스레드는 고정 크기 링 버퍼 슬롯을 CAS로 예약해 그 안에 바로 포맷팅하고 끝난다. (락/할당 없음)
+ * 백그라운드 스레드가 슬롯을 순서대로 꺼내 파일(Logs/Mundi.log)과 디버거 출력에 쓰고,
+ * 콘솔 싱크가 켜져 있으면 콘솔 대기열에 넣는다. 링이 가득 차면 메시지를 버리고 개수만 센다.
+ */
+class FLogManager
+{
+public:
+	static FLogManager& GetInstance()
+	{
+		static FLogManager Instance;
+		return Instance;
+	}
+
+	void Log(const FLogCategoryBase& InCategory, ELogVerbosity::Type InVerbosity, const char* InFormat, ...);
+	void LogV(const FLogCategoryBase& InCategory, ELogVerbosity::Type InVerbosity, const char* InFormat, va_list InArgs);
+
+	/**
+	 * 링에 쌓인 메시지를 호출 스레드에서 즉시 싱크로 내보낸다. (종료/크래시 시)
+	 * @param bBlocking false면 드레인 중인 스레드가 있을 때 기다리지 않고 포기한다. (크래시 핸들러용)
+	 */
+	void Flush(bool bBlocking = true);
+
+	/** 드레인 스레드를 멈추고 남은 메시지를 쓴 뒤 파일을 닫는다. */
+	void Shutdown();
+
+	/** 콘솔 위젯이 연결되어 있을 때만 콘솔 대기열을 채운다. (게임 빌드에서 무한히 쌓이지 않도록) */
+	void SetConsoleSinkEnabled(bool bEnabled);
+
+	/** 콘솔 대기열을 비워 OutLines 뒤에 붙인다. (게임 스레드) */
+	void PullConsoleLines(TArray<FConsoleLogLine>& OutLines);
+
+	FLogStats GetStats() const;
+
+	static constexpr uint32 RingCapacity = 1024;        // 2의 거듭제곱
+	static constexpr uint32 MaxMessageLength = 1024;
+	static constexpr int32 MaxPendingConsoleLines = 4096;
+
+private:
+	FLogManager();
+	~FLogManager();
+	FLogManager(const FLogManager&) = delete;
+	FLogManager& operator=(const FLogManager&) = delete;
+
+	struct FLogRecord
+	{
+		std::atomic<uint64> Sequence;   // == 기록 위치: 비어 있음, == 기록 위치 + 1: 쓰기 완료
+		const FLogCategoryBase* Category = nullptr;
+		ELogVerbosity::Type Verbosity = ELogVerbosity::Log;
+		uint32 ThreadId = 0;
+		uint64 Cycles = 0;
+		char Text[MaxMessageLength];
+	};
+
+	void StartDrainThread();
+	void DrainLoop();
+
+	/** @note DrainMutex를 잡은 상태에서 호출 */
+	uint32 DrainRecords_AssumesLocked();
+	void WriteRecord_AssumesLocked(const FLogRecord& InRecord);
+
+	std::unique_ptr<FLogRecord[]> Records;
+	alignas(64) std::atomic<uint64> EnqueuePos{ 0 };
+	alignas(64) uint64 DequeuePos = 0;      // 소비자 전용 (DrainMutex)
+	std::atomic<uint64> DroppedCount{ 0 };
+	std::atomic<uint64> WrittenCount{ 0 };
+	uint64 StartCycles = 0;
+
+	// 소비자 측 (드레인 스레드 / Flush 호출자)
+	std::mutex DrainMutex;
+	FILE* LogFile = nullptr;
+	uint64 ReportedDropCount = 0;
+
+	std::thread DrainThread;
+	std::mutex WakeMutex;
+	std::condition_variable WakeCondition;
+	std::atomic<bool> bStopping{ false };
+
+	// 콘솔 대기열
+	mutable std::mutex ConsoleMutex;
+	TArray<FConsoleLogLine> PendingConsoleLines;
+	bool bConsoleSinkEnabled = false;
+	uint64 ConsoleDroppedCount = 0;
+};
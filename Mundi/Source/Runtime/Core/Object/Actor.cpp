@@ -208,12 +208,11 @@ void AActor::AddOwnedComponent(UActorComponent* Component)
 		return;
 	}
 
-	if (OwnedComponents.count(Component))
+	if (!OwnedComponents.Add(Component))
 	{
 		return;
 	}
 
-	OwnedComponents.insert(Component);
 	Component->SetOwner(this);
 	if (USceneComponent* SC = Cast<USceneComponent>(Component))
 	{
@@ -234,7 +233,7 @@ void AActor::RemoveOwnedComponent(UActorComponent* Component)
 		return;
 	}
 
-	if (!OwnedComponents.count(Component) || RootComponent == Component)
+	if (!OwnedComponents.Contains(Component) || RootComponent == Component)
 	{
 		return;
 	}
@@ -264,7 +263,7 @@ void AActor::RemoveOwnedComponent(UActorComponent* Component)
 	}
 
 	// OwnedComponents에서 제거
-	OwnedComponents.erase(Component);
+	OwnedComponents.Remove(Component);
 
 	Component->DestroyComponent();
 }
@@ -298,11 +297,7 @@ void AActor::RegisterAllComponents(UWorld* InWorld)
 // 소유 중인 Component 전체 삭제
 void AActor::DestroyAllComponents()
 {
-	TArray<UActorComponent*> Temp;
-	Temp.reserve(OwnedComponents.size());
-
-	for (UActorComponent* C : OwnedComponents) 
-		Temp.push_back(C);
+	TArray<UActorComponent*> Temp = OwnedComponents.Array();
 
 	for (UActorComponent* C : Temp)
 	{
@@ -613,7 +608,7 @@ void AActor::DuplicateSubObjects()
 	// 1단계: 모든 컴포넌트 복제 및 '원본 -> 사본' 매핑 테이블 생성
 	// ========================================================================
 	TMap<UActorComponent*, UActorComponent*> OldToNewComponentMap;
-	TSet<UActorComponent*> NewOwnedComponents;
+	TFlatSet<UActorComponent*, true> NewOwnedComponents;
 
 	for (UActorComponent* OriginalComp : OwnedComponents)
 	{
@@ -634,7 +629,7 @@ void AActor::DuplicateSubObjects()
 		OldToNewComponentMap.insert({ OriginalComp, NewComp });
 
 		// 새로운 소유 컴포넌트 목록에 추가합니다.
-		NewOwnedComponents.insert(NewComp);
+		NewOwnedComponents.Add(NewComp);
 	}
 
 	// 복제된 컴포넌트 목록으로 교체합니다.
@@ -64,7 +64,7 @@ public:
 
     // 씬 컴포넌트(트리/렌더용)
     const TArray<USceneComponent*>& GetSceneComponents() const { return SceneComponents; }
-    const TSet<UActorComponent*>& GetOwnedComponents() const { return OwnedComponents; }
+    const TFlatSet<UActorComponent*, true>& GetOwnedComponents() const { return OwnedComponents; }
     UActorComponent* GetComponent(UClass* ComponentClass);
     
     // 컴포넌트 생성 (템플릿)
@@ -193,7 +193,7 @@ public:
 protected:
     // NOTE: RootComponent, CollisionComponent 등 기본 보호 컴포넌트들도
     // OwnedComponents와 SceneComponents에 포함되어 관리됨.
-    TSet<UActorComponent*> OwnedComponents;   // 모든 컴포넌트 (씬/비씬)
+    TFlatSet<UActorComponent*, true> OwnedComponents;   // 모든 컴포넌트 (씬/비씬), 추가한 순서로 순회 (틱/직렬화 순서, 제거해도 유지)
     TArray<USceneComponent*> SceneComponents; // 씬 컴포넌트들만 별도 캐시(트리/렌더/ImGui용)
     
     bool bTickInEditor = true; // 에디터에서도 틱 허용 (기본값 true)
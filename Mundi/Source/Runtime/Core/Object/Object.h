@@ -267,11 +267,11 @@ public:
     // UObject-scoped allocation only
     static void* operator new(SIZE_T Size)
     {
-        return FMemoryManager::Allocate(Size, alignof(std::max_align_t));
+        return FMemoryManager::Allocate(Size, alignof(std::max_align_t), EMemoryTag::Object);
     }
     static void* operator new(SIZE_T Size, std::align_val_t Alignment)
     {
-        return FMemoryManager::Allocate(Size, static_cast<size_t>(Alignment));
+        return FMemoryManager::Allocate(Size, static_cast<size_t>(Alignment), EMemoryTag::Object);
     }
     static void operator delete(void* Ptr) noexcept
     {
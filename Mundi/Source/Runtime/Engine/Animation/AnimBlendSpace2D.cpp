@@ -132,9 +132,9 @@ void FAnimNode_BlendSpace2D::Evaluate(FPoseContext& Output)
             const float Len = Samples[Best].Sequence->GetPlayLength();
             const float Time = NormalizedTime * Len * std::max(0.f, Samples[Best].RateScale);
             Ctx.CurrentTime = (Ctx.bLooping && Len>0.f) ? std::fmod(Time, Len) : FMath::Clamp(Time, 0.f, Len);
-            TArray<FTransform> CompPose;
-            FAnimationRuntime::ExtractPoseFromSequence(Samples[Best].Sequence, Ctx, *Skeleton, CompPose);
-            FAnimationRuntime::ConvertComponentToLocalSpace(*Skeleton, CompPose, Output.LocalSpacePose);
+            FPoseHandle CompPose;
+            FAnimationRuntime::ExtractPoseFromSequence(Samples[Best].Sequence, Ctx, *Skeleton, *CompPose);
+            FAnimationRuntime::ConvertComponentToLocalSpace(*Skeleton, *CompPose, Output.LocalSpacePose);
             return;
         }
         Output.ResetToRefPose();
@@ -154,7 +154,7 @@ void FAnimNode_BlendSpace2D::Evaluate(FPoseContext& Output)
     const float w[3] = { Pick.U, Pick.V, Pick.W };
 
     // Evaluate three component poses
-    TArray<FTransform> CompA, CompB, CompC, CompOut;
+    FPoseHandle CompA, CompB, CompC, CompOut;
     for (int si = 0; si < 3; ++si)
     {
         const FBlendSample2D& S = Samples[idx[si]];
@@ -164,7 +164,7 @@ void FAnimNode_BlendSpace2D::Evaluate(FPoseContext& Output)
             FPoseContext Tmp; Tmp.Initialize(Output.GetComponent(), Skeleton, Output.GetDeltaSeconds());
             Tmp.ResetToRefPose();
             FAnimationRuntime::ConvertLocalToComponentSpace(*Skeleton, Tmp.LocalSpacePose,
-                (si==0)?CompA:((si==1)?CompB:CompC));
+                (si==0)?*CompA:((si==1)?*CompB:*CompC));
             continue;
         }
 
@@ -173,13 +173,13 @@ void FAnimNode_BlendSpace2D::Evaluate(FPoseContext& Output)
         const float Rate = std::max(0.f, S.RateScale);
         const float Time = NormalizedTime * Len * Rate;
         Ctx.CurrentTime = (Ctx.bLooping && Len>0.f) ? std::fmod(Time, Len) : FMath::Clamp(Time, 0.f, Len);
-        TArray<FTransform>& OutComp = (si==0)?CompA:((si==1)?CompB:CompC);
+        TArray<FTransform>& OutComp = (si==0)?*CompA:((si==1)?*CompB:*CompC);
         FAnimationRuntime::ExtractPoseFromSequence(S.Sequence, Ctx, *Skeleton, OutComp);
     }
 
     // Blend three component poses and convert to local
-    FAnimationRuntime::BlendThreePoses(*Skeleton, CompA, CompB, CompC, w[0], w[1], w[2], CompOut);
-    FAnimationRuntime::ConvertComponentToLocalSpace(*Skeleton, CompOut, Output.LocalSpacePose);
+    FAnimationRuntime::BlendThreePoses(*Skeleton, *CompA, *CompB, *CompC, w[0], w[1], w[2], *CompOut);
+    FAnimationRuntime::ConvertComponentToLocalSpace(*Skeleton, *CompOut, Output.LocalSpacePose);
 }
 
 bool FAnimNode_BlendSpace2D::SetSamplePosition(int32 Index, const FVector2D& NewPos)
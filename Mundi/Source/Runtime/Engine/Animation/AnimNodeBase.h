@@ -1,6 +1,7 @@
 #pragma once
 #include "Vector.h"
 #include "VertexData.h"
+#include "AnimPoseArena.h"
 
 class USkeletalMeshComponent;
 
@@ -31,9 +32,11 @@ struct FAnimationBaseContext
     float GetDeltaSeconds() const { return DeltaSeconds; }
 };
 
+// LocalSpacePose는 스레드별 포즈 아레나에서 빌린 버퍼 (컨텍스트가 소멸하면 반환, 복사 불가)
 struct FPoseContext : public FAnimationBaseContext
 {
-    TArray<FTransform> LocalSpacePose;
+    FPoseHandle PoseBuffer;
+    TArray<FTransform>& LocalSpacePose = PoseBuffer.Get();
 
     void Initialize(USkeletalMeshComponent* InComponent, const FSkeleton* InSkeleton, float InDeltaSeconds = 0.f)
     {
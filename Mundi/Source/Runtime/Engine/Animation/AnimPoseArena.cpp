@@ -0,0 +1,71 @@
+#include "pch.h"
+#include "AnimPoseArena.h"
+#include "SkinningStats.h"
+
+FAnimPoseArena& FAnimPoseArena::Get()
+{
+    thread_local FAnimPoseArena Arena;
+    return Arena;
+}
+
+int32 FAnimPoseArena::Acquire(int32 NumBones)
+{
+    if (Top == Slots.Num())
+    {
+        Slots.Emplace(std::make_unique<FPoseSlot>());
+        ++PendingAllocations;
+    }
+
+    FPoseSlot& PoseSlot = *Slots[Top];
+    const SIZE_T OldCapacity = PoseSlot.Pose.capacity();
+    PoseSlot.Pose.SetNum(std::max(NumBones, 0));
+    if (PoseSlot.Pose.capacity() != OldCapacity)
+    {
+        ++PendingAllocations;
+    }
+
+    PoseSlot.bInUse = true;
+    ++PendingAcquires;
+    return Top++;
+}
+
+void FAnimPoseArena::Release(int32 Slot)
+{
+    if (Slot < 0 || Slot >= Top)
+    {
+        return;
+    }
+
+    Slots[Slot]->bInUse = false;
+    while (Top > 0 && !Slots[Top - 1]->bInUse)
+    {
+        --Top;
+    }
+
+    if (Top == 0)
+    {
+        FlushStats();
+    }
+}
+
+SIZE_T FAnimPoseArena::GetCapacityBytes() const
+{
+    SIZE_T Bytes = 0;
+    for (const std::unique_ptr<FPoseSlot>& PoseSlot : Slots)
+    {
+        Bytes += PoseSlot->Pose.capacity() * sizeof(FTransform);
+    }
+    return Bytes;
+}
+
+void FAnimPoseArena::FlushStats()
+{
+    if (PendingAcquires == 0 && PendingAllocations == 0)
+    {
+        return;
+    }
+
+    FSkinningStatManager::GetInstance().AddPoseArenaCounters(PendingAcquires, PendingAllocations);
+    PendingAcquires = 0;
+    PendingAllocations = 0;
+}
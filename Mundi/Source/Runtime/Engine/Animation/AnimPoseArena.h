@@ -0,0 +1,77 @@
+#pragma once
+#include "Vector.h"
+
+/**
+ * 애니메이션 평가용 포즈 버퍼 아레나 (스레드별)
+ * - 그래프 평가 중 필요한 임시 포즈 버퍼를 스택처럼 빌려주고 돌려받는다 (선형 할당).
+ * - 버퍼는 반환 후에도 용량을 유지하므로, 한 번 예열된 뒤에는 평가 전체가 힙 할당 없이 돈다.
+ * - 버퍼 용량이 늘어난 경우만 힙 할당으로 세어 FSkinningStats::PoseAllocations에 보고한다.
+ * @note 가장 바깥 핸들이 반환될 때(평가 한 번이 끝날 때) 통계를 모아서 보고한다.
+ */
+class FAnimPoseArena
+{
+public:
+    /** 호출한 스레드의 아레나 */
+    static FAnimPoseArena& Get();
+
+    /** NumBones 크기의 버퍼를 빌린다. 반환값은 Release에 넘길 슬롯 번호 */
+    int32 Acquire(int32 NumBones);
+
+    /** 슬롯을 반환한다. 스택 꼭대기가 아니면 위의 슬롯들이 반환될 때 함께 정리된다. */
+    void Release(int32 Slot);
+
+    TArray<FTransform>& GetBuffer(int32 Slot) { return Slots[Slot]->Pose; }
+
+    int32 GetNumInUse() const { return Top; }
+    SIZE_T GetCapacityBytes() const;
+
+private:
+    FAnimPoseArena() = default;
+
+    struct FPoseSlot
+    {
+        TArray<FTransform> Pose;
+        bool bInUse = false;
+    };
+
+    void FlushStats();
+
+    // 슬롯 주소가 바뀌지 않도록 개별 할당 (핸들이 TArray 참조를 들고 있음)
+    TArray<std::unique_ptr<FPoseSlot>> Slots;
+    int32 Top = 0;
+
+    uint32 PendingAcquires = 0;
+    uint32 PendingAllocations = 0;
+};
+
+/**
+ * 스코프 포즈 핸들
+ * 생성 시 현재 스레드의 아레나에서 포즈 버퍼를 빌리고, 소멸 시 반환한다.
+ */
+class FPoseHandle
+{
+public:
+    explicit FPoseHandle(int32 NumBones = 0)
+        : Arena(&FAnimPoseArena::Get())
+        , Slot(Arena->Acquire(NumBones))
+        , Pose(&Arena->GetBuffer(Slot))
+    {
+    }
+
+    ~FPoseHandle()
+    {
+        Arena->Release(Slot);
+    }
+
+    FPoseHandle(const FPoseHandle&) = delete;
+    FPoseHandle& operator=(const FPoseHandle&) = delete;
+
+    TArray<FTransform>& Get() const { return *Pose; }
+    TArray<FTransform>& operator*() const { return *Pose; }
+    TArray<FTransform>* operator->() const { return Pose; }
+
+private:
+    FAnimPoseArena* Arena;
+    int32 Slot;
+    TArray<FTransform>* Pose;
+};
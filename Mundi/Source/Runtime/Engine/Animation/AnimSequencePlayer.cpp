@@ -20,8 +20,8 @@ void FAnimNode_SequencePlayer::Evaluate(FPoseContext& Output)
     }
 
     // Build component-space pose and convert to local-space for the output
-    TArray<FTransform> ComponentPose;
-    FAnimationRuntime::ExtractPoseFromSequence(Sequence, ExtractCtx, *Skeleton, ComponentPose);
-    FAnimationRuntime::ConvertComponentToLocalSpace(*Skeleton, ComponentPose, Output.LocalSpacePose);
+    FPoseHandle ComponentPose;
+    FAnimationRuntime::ExtractPoseFromSequence(Sequence, ExtractCtx, *Skeleton, *ComponentPose);
+    FAnimationRuntime::ConvertComponentToLocalSpace(*Skeleton, *ComponentPose, Output.LocalSpacePose);
 }
 
@@ -0,0 +1,143 @@
+#include "pch.h"
+#include "AnimSharingManager.h"
+#include "AnimSequenceBase.h"
+#include "AnimationRuntime.h"
+
+FAnimSharingManager& FAnimSharingManager::Get()
+{
+    static FAnimSharingManager Instance;
+    return Instance;
+}
+
+void FAnimSharingManager::BeginFrame()
+{
+    ++FrameCounter;
+
+    // 지난 프레임에도 쓰이지 않은 그룹은 버린다 (버퍼는 다음 그룹이 재사용)
+    for (auto It = EntryIndices.begin(); It != EntryIndices.end(); )
+    {
+        const int32 EntryIndex = It->second;
+        if (Entries[EntryIndex]->LastUsedFrame + 1 < FrameCounter)
+        {
+            FreeEntries.Add(EntryIndex);
+            It = EntryIndices.erase(It);
+        }
+        else
+        {
+            ++It;
+        }
+    }
+
+    Stats = FAnimSharingStats();
+    Stats.CachedGroups = static_cast<uint32>(EntryIndices.Num());
+}
+
+const FSharedAnimPose* FAnimSharingManager::GetOrEvaluate(const FSkeleton& Skeleton, const UAnimSequenceBase* Sequence, float Time,
+    bool bLooping, bool bInterpolate, uint32 InstanceId)
+{
+    if (!bEnabled || !Sequence || Skeleton.Bones.Num() <= 0)
+    {
+        return nullptr;
+    }
+
+    const float Length = Sequence->GetPlayLength();
+    float EvalTime = Time;
+
+    // 시간 오프셋 버킷 (루프 시퀀스만)
+    if (NumTimeBuckets > 1 && bLooping && Length > 0.f)
+    {
+        const int32 Bucket = static_cast<int32>(InstanceId % static_cast<uint32>(NumTimeBuckets));
+        EvalTime += Length * static_cast<float>(Bucket) / static_cast<float>(NumTimeBuckets);
+        EvalTime = std::fmod(EvalTime, Length);
+        if (EvalTime < 0.f) EvalTime += Length;
+    }
+
+    FSharedAnimPoseKey Key;
+    Key.Skeleton = &Skeleton;
+    Key.Sequence = Sequence;
+    Key.Flags = static_cast<uint8>((bLooping ? 1 : 0) | (bInterpolate ? 2 : 0));
+    if (SampleRate > 0.f)
+    {
+        Key.TimeTick = static_cast<int64>(std::floor(static_cast<double>(EvalTime) * SampleRate + 0.5));
+        EvalTime = static_cast<float>(static_cast<double>(Key.TimeTick) / SampleRate);
+    }
+    else
+    {
+        // 양자화 없음: float 비트 패턴이 같은 시간끼리만 공유
+        uint32 Bits = 0;
+        memcpy(&Bits, &EvalTime, sizeof(Bits));
+        Key.TimeTick = static_cast<int64>(Bits);
+    }
+
+    ++Stats.Instances;
+
+    if (const int32* Found = EntryIndices.Find(Key))
+    {
+        FSharedAnimPose& Shared = *Entries[*Found];
+        Shared.LastUsedFrame = FrameCounter;
+        return &Shared;
+    }
+
+    int32 EntryIndex;
+    if (!FreeEntries.IsEmpty())
+    {
+        EntryIndex = FreeEntries.back();
+        FreeEntries.pop_back();
+    }
+    else
+    {
+        EntryIndex = Entries.Emplace(std::make_unique<FSharedAnimPose>());
+    }
+
+    FSharedAnimPose& Shared = *Entries[EntryIndex];
+    EvaluateInto(Shared, Skeleton, Sequence, EvalTime, bLooping, bInterpolate);
+    Shared.LastUsedFrame = FrameCounter;
+    EntryIndices.Add(Key, EntryIndex);
+
+    ++Stats.UniqueEvaluations;
+    Stats.CachedGroups = static_cast<uint32>(EntryIndices.Num());
+    return &Shared;
+}
+
+void FAnimSharingManager::EvaluateInto(FSharedAnimPose& OutPose, const FSkeleton& Skeleton, const UAnimSequenceBase* Sequence,
+    float EvalTime, bool bLooping, bool bInterpolate) const
+{
+    const int32 NumBones = Skeleton.Bones.Num();
+
+    Sequence->ExtractBonePose(Skeleton, EvalTime, bLooping, bInterpolate, OutPose.LocalPose);
+    FAnimationRuntime::ConvertLocalToComponentSpace(Skeleton, OutPose.LocalPose, OutPose.ComponentPose);
+
+    OutPose.SkinningMatrices.SetNum(NumBones);
+    for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+    {
+        OutPose.SkinningMatrices[BoneIndex] = Skeleton.Bones[BoneIndex].InverseBindPose * OutPose.ComponentPose[BoneIndex].ToMatrix();
+    }
+}
+
+void FAnimSharingManager::SetEnabled(bool bInEnabled)
+{
+    bEnabled = bInEnabled;
+    if (!bEnabled)
+    {
+        Clear();
+    }
+}
+
+void FAnimSharingManager::SetSampleRate(float InSampleRate)
+{
+    SampleRate = std::max(0.f, InSampleRate);
+    Clear();
+}
+
+void FAnimSharingManager::SetNumTimeBuckets(int32 InNumBuckets)
+{
+    NumTimeBuckets = std::max(1, InNumBuckets);
+}
+
+void FAnimSharingManager::Clear()
+{
+    EntryIndices.Empty();
+    Entries.Empty();
+    FreeEntries.Empty();
+    Stats.CachedGroups = 0;
+}
@@ -0,0 +1,110 @@
+#pragma once
+#include "Vector.h"
+
+class UAnimSequenceBase;
+struct FSkeleton;
+
+// 같은 (스켈레톤, 시퀀스, 양자화된 시간)을 재생하는 인스턴스 그룹의 키
+struct FSharedAnimPoseKey
+{
+    const FSkeleton* Skeleton = nullptr;
+    const UAnimSequenceBase* Sequence = nullptr;
+    int64 TimeTick = 0;             // EvalTime * SampleRate (반올림)
+    uint8 Flags = 0;                // bit0: 루프, bit1: 보간
+
+    bool operator==(const FSharedAnimPoseKey& Other) const
+    {
+        return Skeleton == Other.Skeleton && Sequence == Other.Sequence && TimeTick == Other.TimeTick && Flags == Other.Flags;
+    }
+};
+
+namespace std
+{
+    template<>
+    struct hash<FSharedAnimPoseKey>
+    {
+        size_t operator()(const FSharedAnimPoseKey& Key) const
+        {
+            size_t Hash = hash<const void*>{}(Key.Skeleton);
+            Hash ^= hash<const void*>{}(Key.Sequence) + 0x9e3779b9 + (Hash << 6) + (Hash >> 2);
+            Hash ^= hash<int64>{}(Key.TimeTick) + 0x9e3779b9 + (Hash << 6) + (Hash >> 2);
+            Hash ^= static_cast<size_t>(Key.Flags) + 0x9e3779b9 + (Hash << 6) + (Hash >> 2);
+            return Hash;
+        }
+    };
+}
+
+// 그룹당 한 번 평가된 결과. 멤버 컴포넌트는 이 버퍼를 그대로 복사해 쓴다.
+struct FSharedAnimPose
+{
+    TArray<FTransform> LocalPose;
+    TArray<FTransform> ComponentPose;
+    TArray<FMatrix> SkinningMatrices;   // InverseBindPose * ComponentPose
+    uint64 LastUsedFrame = 0;
+};
+
+struct FAnimSharingStats
+{
+    uint32 Instances = 0;           // 공유 경로로 포즈를 얻은 컴포넌트 수
+    uint32 UniqueEvaluations = 0;   // 실제로 포즈를 평가한 횟수 (그룹 수)
+    uint32 CachedGroups = 0;        // 캐시에 살아있는 그룹 수
+};
+
+/**
+ * 군중 애니메이션 공유 매니저
+ * - 단일 시퀀스를 재생하는 스켈레탈 메시들을 (스켈레톤, 시퀀스, 양자화된 시간)으로 묶고,
+ *   그룹마다 한 프레임에 한 번만 로컬 → 컴포넌트 포즈와 스키닝 행렬을 계산한다.
+ * - 시간은 SampleRate 격자로 양자화한다. 같은 시점에 시작한 군중은 같은 그룹이 된다.
+ * - NumTimeBuckets > 1이면 컴포넌트 UUID로 버킷을 골라 재생 시간을 (버킷 / 버킷 수) * 길이만큼 밀어,
+ *   버킷 수만큼의 변형만 평가하면서 동작이 모두 똑같아 보이지 않게 한다 (루프 시퀀스만, 노티파이 시간은 그대로).
+ * - 포즈는 키의 순수 함수이므로, 최근 프레임에 쓰인 그룹은 다음 프레임에도 그대로 재사용된다.
+ * @note 게임 스레드 전용
+ */
+class FAnimSharingManager
+{
+public:
+    static FAnimSharingManager& Get();
+
+    /** 엔진 틱 시작 시 호출. 이번 프레임 통계를 초기화하고 오래 쓰이지 않은 그룹을 정리한다. */
+    void BeginFrame();
+
+    /**
+     * 공유 포즈를 찾고, 없으면 평가해서 캐시한다.
+     * @param Time 인스턴스의 현재 재생 시간 (버킷 오프셋, 양자화 전)
+     * @param InstanceId 시간 버킷을 고르기 위한 값 (컴포넌트 UUID)
+     */
+    const FSharedAnimPose* GetOrEvaluate(const FSkeleton& Skeleton, const UAnimSequenceBase* Sequence, float Time,
+        bool bLooping, bool bInterpolate, uint32 InstanceId);
+
+    void SetEnabled(bool bInEnabled);
+    bool IsEnabled() const { return bEnabled; }
+
+    /** 시간 양자화 격자 (Hz). 0 이하면 시간이 정확히 같은 인스턴스끼리만 공유 */
+    void SetSampleRate(float InSampleRate);
+    float GetSampleRate() const { return SampleRate; }
+
+    void SetNumTimeBuckets(int32 InNumBuckets);
+    int32 GetNumTimeBuckets() const { return NumTimeBuckets; }
+
+    /** 이번 프레임 통계 (월드 틱 이후 ~ 다음 BeginFrame 전까지 유효) */
+    const FAnimSharingStats& GetStats() const { return Stats; }
+
+    void Clear();
+
+private:
+    FAnimSharingManager() = default;
+
+    void EvaluateInto(FSharedAnimPose& OutPose, const FSkeleton& Skeleton, const UAnimSequenceBase* Sequence,
+        float EvalTime, bool bLooping, bool bInterpolate) const;
+
+    TMap<FSharedAnimPoseKey, int32> EntryIndices;
+    TArray<std::unique_ptr<FSharedAnimPose>> Entries;   // 주소 고정 (버퍼 재사용)
+    TArray<int32> FreeEntries;
+
+    uint64 FrameCounter = 1;
+    bool bEnabled = true;
+    float SampleRate = 60.0f;
+    int32 NumTimeBuckets = 1;
+
+    FAnimSharingStats Stats;
+};
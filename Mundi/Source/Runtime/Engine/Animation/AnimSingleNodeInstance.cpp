@@ -113,27 +113,27 @@ void UAnimSingleNodeInstance::EvaluateAnimation(FPoseContext& Output)
         FAnimExtractContext CurrCtx = Player.GetExtractContext();
         FAnimExtractContext RefCtx = CurrCtx;  RefCtx.CurrentTime = ReferenceTime;
 
-        TArray<FTransform> CurrComp, RefComp;
-        FAnimationRuntime::ExtractPoseFromSequence(Seq, CurrCtx, *Skeleton, CurrComp);
-        FAnimationRuntime::ExtractPoseFromSequence(Seq, RefCtx,  *Skeleton, RefComp);
+        FPoseHandle CurrComp, RefComp;
+        FAnimationRuntime::ExtractPoseFromSequence(Seq, CurrCtx, *Skeleton, *CurrComp);
+        FAnimationRuntime::ExtractPoseFromSequence(Seq, RefCtx,  *Skeleton, *RefComp);
 
         // 3) Convert to local-space
-        TArray<FTransform> CurrLocal, RefLocal;
-        FAnimationRuntime::ConvertComponentToLocalSpace(*Skeleton, CurrComp, CurrLocal);
-        FAnimationRuntime::ConvertComponentToLocalSpace(*Skeleton, RefComp,  RefLocal);
+        FPoseHandle CurrLocal, RefLocal;
+        FAnimationRuntime::ConvertComponentToLocalSpace(*Skeleton, *CurrComp, *CurrLocal);
+        FAnimationRuntime::ConvertComponentToLocalSpace(*Skeleton, *RefComp,  *RefLocal);
 
         // 4) Compute delta (local) per bone: Ref^-1 * Curr  (use relative helper)
         const int32 NumBones = static_cast<int32>(Skeleton->Bones.Num());
-        TArray<FTransform> AdditiveDeltaLocal; AdditiveDeltaLocal.SetNum(NumBones);
+        FPoseHandle AdditiveDeltaLocal(NumBones);
         for (int32 i = 0; i < NumBones; ++i)
         {
-            AdditiveDeltaLocal[i] = RefLocal[i].GetRelativeTransform(CurrLocal[i]);
+            (*AdditiveDeltaLocal)[i] = (*RefLocal)[i].GetRelativeTransform((*CurrLocal)[i]);
         }
 
         // 5) Accumulate onto base pose
-        TArray<FTransform> ResultLocal;
-        FAnimationRuntime::AccumulateAdditivePose(*Skeleton, Output.LocalSpacePose, AdditiveDeltaLocal, 1.f, ResultLocal);
-        Output.LocalSpacePose = ResultLocal;
+        FPoseHandle ResultLocal;
+        FAnimationRuntime::AccumulateAdditivePose(*Skeleton, Output.LocalSpacePose, *AdditiveDeltaLocal, 1.f, *ResultLocal);
+        Output.LocalSpacePose = *ResultLocal;
     }
 }
 
@@ -34,6 +34,10 @@ public:
     void SetAdditiveType(EAdditiveType InType) { AdditiveType = InType; }
     void SetReferenceTime(float InRefTime) { ReferenceTime = InRefTime; }
 
+    // Crowd sharing (FAnimSharingManager): plain playback of one sequence can reuse a shared pose
+    bool CanSharePose() const { return !bTreatAssetAsAdditive && Player.GetSequence() != nullptr; }
+    const FAnimNode_SequencePlayer& GetPlayer() const { return Player; }
+
 private:
     FAnimNode_SequencePlayer Player; // drives playback (time/loop/rate)
     bool bPlaying = false;
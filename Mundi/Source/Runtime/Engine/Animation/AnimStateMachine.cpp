@@ -239,12 +239,12 @@ void FAnimNode_StateMachine::Evaluate(FPoseContext& Output)
     if (Next)
     {
         Next->Player.Evaluate(PoseB);
-        TArray<FTransform> CompA, CompB, CompOut;
-        FAnimationRuntime::ConvertLocalToComponentSpace(*Skeleton, PoseA.LocalSpacePose, CompA);
-        FAnimationRuntime::ConvertLocalToComponentSpace(*Skeleton, PoseB.LocalSpacePose, CompB);
+        FPoseHandle CompA, CompB, CompOut;
+        FAnimationRuntime::ConvertLocalToComponentSpace(*Skeleton, PoseA.LocalSpacePose, *CompA);
+        FAnimationRuntime::ConvertLocalToComponentSpace(*Skeleton, PoseB.LocalSpacePose, *CompB);
         const float Alpha = std::clamp(Runtime.BlendAlpha, 0.f, 1.f);
-        FAnimationRuntime::BlendTwoPoses(*Skeleton, CompA, CompB, Alpha, CompOut);
-        FAnimationRuntime::ConvertComponentToLocalSpace(*Skeleton, CompOut, Output.LocalSpacePose);
+        FAnimationRuntime::BlendTwoPoses(*Skeleton, *CompA, *CompB, Alpha, *CompOut);
+        FAnimationRuntime::ConvertComponentToLocalSpace(*Skeleton, *CompOut, Output.LocalSpacePose);
     }
     else
     {
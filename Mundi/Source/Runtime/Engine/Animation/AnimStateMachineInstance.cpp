@@ -34,20 +34,21 @@ int32 UAnimStateMachineInstance::Lua_AddState(const FString& Name, const FString
     UAnimSequence* Seq = UResourceManager::GetInstance().Get<UAnimSequence>(AssetPath);
     if (!Seq)
     {
+        UE_LOG_CATEGORY(LogAnimation, Warning, "[AnimStateMachine] Animation '%s' not found", AssetPath.c_str());
         const auto& AllAnims = UResourceManager::GetInstance().GetAnimations();
         for (const UAnimSequence* Anim : AllAnims)
         {
             if (Anim)
             {
-                UE_LOG("[AnimStateMachine]   - %s\n", Anim->GetFilePath().c_str());
+                UE_LOG_CATEGORY(LogAnimation, Verbose, "[AnimStateMachine]   - %s", Anim->GetFilePath().c_str());
             }
         }
         return -1;
     }
-    UE_LOG("[AnimStateMachine] Adding state '%s' with asset '%s', PlayLength=%.2f\n", Name.c_str(), AssetPath.c_str(), Seq->GetPlayLength());
+    UE_LOG_CATEGORY(LogAnimation, Verbose, "[AnimStateMachine] Adding state '%s' with asset '%s', PlayLength=%.2f", Name.c_str(), AssetPath.c_str(), Seq->GetPlayLength());
     FAnimState StateDesc; StateDesc.Name = Name; StateDesc.PlayRate = Rate; StateDesc.bLooping = bLooping;
     int32 Index = AddState(StateDesc, Seq);
-    UE_LOG("[AnimStateMachine] State '%s' added at index %d\n", Name.c_str(), Index);
+    UE_LOG_CATEGORY(LogAnimation, Verbose, "[AnimStateMachine] State '%s' added at index %d", Name.c_str(), Index);
     return Index;
 }
 
@@ -65,12 +66,12 @@ void UAnimStateMachineInstance::Lua_SetState(const FString& Name, float BlendTim
     const int32 Idx = FindStateByName(Name);
     if (Idx >= 0)
     {
-        UE_LOG("[AnimStateMachine] Setting current state to '%s' (index %d) with blend time %.2f\n", Name.c_str(), Idx, BlendTime);
+        UE_LOG_CATEGORY(LogAnimation, Verbose, "[AnimStateMachine] Setting current state to '%s' (index %d) with blend time %.2f", Name.c_str(), Idx, BlendTime);
         SetCurrentState(Idx, BlendTime);
     }
     else
     {
-        UE_LOG("[AnimStateMachine] Failed to find state '%s'\n", Name.c_str());
+        UE_LOG_CATEGORY(LogAnimation, Warning, "[AnimStateMachine] Failed to find state '%s'", Name.c_str());
     }
 }
 
@@ -0,0 +1,120 @@
+#include "pch.h"
+#include "AnimUpdateRateManager.h"
+
+namespace
+{
+    // 에디터 멀티 뷰포트 + 프리뷰 창을 넘는 뷰는 무시한다
+    constexpr int32 MaxTrackedViews = 8;
+}
+
+FAnimUpdateRateManager& FAnimUpdateRateManager::Get()
+{
+    static FAnimUpdateRateManager Instance;
+    return Instance;
+}
+
+void FAnimUpdateRateManager::BeginFrame()
+{
+    ++FrameCounter;
+
+    // 렌더가 한 번도 돌지 않은 프레임(최소화 등)에는 이전 뷰를 유지한다
+    if (!PendingViews.IsEmpty())
+    {
+        std::swap(Views, PendingViews);
+        PendingViews.Empty();
+    }
+
+    Stats = FAnimUpdateRateStats();
+}
+
+void FAnimUpdateRateManager::RegisterView(const FVector& ViewLocation, float FieldOfView, bool bPerspective)
+{
+    if (PendingViews.Num() >= MaxTrackedViews)
+    {
+        return;
+    }
+
+    FViewInfo View;
+    View.Location = ViewLocation;
+    View.bPerspective = bPerspective;
+
+    const float HalfFovTan = std::tan(DegreesToRadians(std::clamp(FieldOfView, 1.0f, 170.0f)) * 0.5f);
+    View.ScreenScale = 1.0f / HalfFovTan;
+
+    PendingViews.Add(View);
+}
+
+EAnimUpdateLOD FAnimUpdateRateManager::ComputeLOD(const FVector& Location, float BoundsRadius, uint64 LastRenderFrame, bool bVisible) const
+{
+    if (!bVisible)
+    {
+        return EAnimUpdateLOD::Invisible;
+    }
+
+    // 지난 프레임(또는 이번 프레임)에 어떤 뷰에서도 그려지지 않았으면 화면 밖
+    if (LastRenderFrame + 1 < FrameCounter)
+    {
+        return EAnimUpdateLOD::Offscreen;
+    }
+
+    // 가장 크게 보이는 뷰 기준 화면 크기 (반경 / 화면 절반 높이)
+    float MaxScreenSize = 0.0f;
+    for (const FViewInfo& View : Views)
+    {
+        if (!View.bPerspective)
+        {
+            return EAnimUpdateLOD::Near;
+        }
+
+        const float Distance = (Location - View.Location).Size();
+        if (Distance <= BoundsRadius)
+        {
+            return EAnimUpdateLOD::Near;
+        }
+
+        MaxScreenSize = std::max(MaxScreenSize, BoundsRadius * View.ScreenScale / Distance);
+    }
+
+    if (Views.IsEmpty() || MaxScreenSize >= MidScreenSize)
+    {
+        return EAnimUpdateLOD::Near;
+    }
+    return MaxScreenSize >= FarScreenSize ? EAnimUpdateLOD::Mid : EAnimUpdateLOD::Far;
+}
+
+int32 FAnimUpdateRateManager::GetUpdateRate(EAnimUpdateLOD LOD) const
+{
+    if (LOD == EAnimUpdateLOD::Invisible)
+    {
+        return 0;
+    }
+    return bEnabled ? UpdateRates[static_cast<int32>(LOD)] : 1;
+}
+
+void FAnimUpdateRateManager::SetUpdateRate(EAnimUpdateLOD LOD, int32 InRate)
+{
+    if (LOD == EAnimUpdateLOD::Invisible || LOD == EAnimUpdateLOD::Count)
+    {
+        return;
+    }
+    UpdateRates[static_cast<int32>(LOD)] = std::clamp(InRate, 1, 30);
+}
+
+void FAnimUpdateRateManager::SetScreenSizeThresholds(float InMidThreshold, float InFarThreshold)
+{
+    MidScreenSize = std::max(InMidThreshold, 0.0f);
+    FarScreenSize = std::clamp(InFarThreshold, 0.0f, MidScreenSize);
+}
+
+const char* FAnimUpdateRateManager::GetLODName(EAnimUpdateLOD LOD)
+{
+    switch (LOD)
+    {
+    case EAnimUpdateLOD::Near:      return "Near";
+    case EAnimUpdateLOD::Mid:       return "Mid";
+    case EAnimUpdateLOD::Far:       return "Far";
+    case EAnimUpdateLOD::Offscreen: return "Offscreen";
+    case EAnimUpdateLOD::Invisible: return "Invisible";
+    default:                        return "Unknown";
+    }
+}
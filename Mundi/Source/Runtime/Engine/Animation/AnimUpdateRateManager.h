@@ -0,0 +1,93 @@
+#pragma once
+#include "Vector.h"
+
+// 업데이트 레이트 최적화(URO) 버킷. 가까운 순서이며 Offscreen/Invisible은 화면 크기와 무관하다.
+enum class EAnimUpdateLOD : uint8
+{
+    Near = 0,       // 매 프레임 평가
+    Mid,
+    Far,
+    Offscreen,      // 지난 프레임에 그려지지 않음 (컬링됨)
+    Invisible,      // 숨김 컴포넌트: 평가를 완전히 건너뛰고 시간/노티파이만 진행
+    Count
+};
+
+struct FAnimUpdateRateStats
+{
+    uint32 ComponentsPerLOD[static_cast<int32>(EAnimUpdateLOD::Count)] = {};
+    uint32 Evaluations = 0;         // 실제로 그래프를 평가한 컴포넌트 수
+    uint32 Interpolations = 0;      // 두 평가 결과 사이를 보간한 컴포넌트 수
+    uint32 SkippedEvaluations = 0;  // 포즈 갱신 없이 지나간 컴포넌트 수 (숨김 포함)
+};
+
+/**
+ * 스켈레탈 메시 애니메이션 업데이트 레이트 매니저
+ * - 지난 프레임에 렌더링된 뷰들 중 가장 가까운 뷰 기준으로 컴포넌트의 화면 크기를 추정해 LOD 버킷을 고른다.
+ * - 버킷마다 N 프레임에 한 번만 포즈를 평가하고, 컴포넌트는 그 사이를 보간한다 (USkeletalMeshComponent::TickAnimationPose).
+ * - 렌더러는 뷰를 RegisterView로 알리고, 스킨드 메시는 그려질 때 GetFrameCounter()를 기록한다.
+ * @note 게임 스레드 전용. 월드 틱이 렌더보다 먼저 돌므로 항상 한 프레임 전 가시성을 사용한다.
+ */
+class FAnimUpdateRateManager
+{
+public:
+    static FAnimUpdateRateManager& Get();
+
+    /** 엔진 틱 시작 시 호출. 지난 프레임의 뷰를 판단 기준으로 넘기고 통계를 초기화한다. */
+    void BeginFrame();
+
+    /** 렌더링된 뷰 등록 (FSceneRenderer::PrepareView). FOV는 도 단위, 직교 뷰는 항상 Near */
+    void RegisterView(const FVector& ViewLocation, float FieldOfView, bool bPerspective);
+
+    /**
+     * 컴포넌트의 이번 프레임 버킷을 결정한다.
+     * @param BoundsRadius 컴포넌트 원점 기준 포즈 반경 (월드 스케일 적용 후)
+     * @param LastRenderFrame 컴포넌트가 마지막으로 그려진 GetFrameCounter() 값
+     */
+    EAnimUpdateLOD ComputeLOD(const FVector& Location, float BoundsRadius, uint64 LastRenderFrame, bool bVisible) const;
+
+    /** 버킷의 평가 간격 (프레임). 꺼져 있으면 항상 1 (Invisible 제외) */
+    int32 GetUpdateRate(EAnimUpdateLOD LOD) const;
+
+    void SetEnabled(bool bInEnabled) { bEnabled = bInEnabled; }
+    bool IsEnabled() const { return bEnabled; }
+
+    void SetUpdateRate(EAnimUpdateLOD LOD, int32 InRate);
+
+    /** Near/Mid, Mid/Far 경계 화면 크기 (반경 / 화면 절반 높이) */
+    void SetScreenSizeThresholds(float InMidThreshold, float InFarThreshold);
+    float GetMidScreenSize() const { return MidScreenSize; }
+    float GetFarScreenSize() const { return FarScreenSize; }
+
+    uint64 GetFrameCounter() const { return FrameCounter; }
+
+    void RecordComponent(EAnimUpdateLOD LOD) { ++Stats.ComponentsPerLOD[static_cast<int32>(LOD)]; }
+    void RecordEvaluation() { ++Stats.Evaluations; }
+    void RecordInterpolation() { ++Stats.Interpolations; }
+    void RecordSkip() { ++Stats.SkippedEvaluations; }
+
+    /** 이번 프레임 통계 (월드 틱 이후 ~ 다음 BeginFrame 전까지 유효) */
+    const FAnimUpdateRateStats& GetStats() const { return Stats; }
+
+    static const char* GetLODName(EAnimUpdateLOD LOD);
+
+private:
+    FAnimUpdateRateManager() = default;
+
+    struct FViewInfo
+    {
+        FVector Location;
+        float ScreenScale = 1.0f;   // 1 / tan(FOV / 2)
+        bool bPerspective = true;
+    };
+
+    TArray<FViewInfo> PendingViews;     // 이번 프레임에 렌더링되는 뷰
+    TArray<FViewInfo> Views;            // 판단 기준 (지난 프레임의 뷰)
+
+    uint64 FrameCounter = 1;
+    bool bEnabled = true;
+    int32 UpdateRates[static_cast<int32>(EAnimUpdateLOD::Count)] = { 1, 2, 4, 8, 0 };
+    float MidScreenSize = 0.3f;
+    float FarScreenSize = 0.1f;
+
+    FAnimUpdateRateStats Stats;
+};
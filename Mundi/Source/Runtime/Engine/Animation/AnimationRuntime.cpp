@@ -1,7 +1,9 @@
 #include "pch.h"
 #include "AnimationRuntime.h"
 #include "AnimNodeBase.h"
+#include "AnimPoseArena.h"
 #include "Vector.h"
+#include "VectorBatch.h"
 #include "VertexData.h"
 
 // Helpers
@@ -77,9 +79,9 @@ void FAnimationRuntime::ExtractPoseFromSequence(const UAnimSequenceBase* Sequenc
         return;
     }
 
-    // 1) Extract local pose
-    TArray<FTransform> LocalPose;
-    LocalPose.SetNum(NumBones);
+    // 1) Extract local pose (scratch buffer from the per-thread pose arena)
+    FPoseHandle LocalPoseHandle(NumBones);
+    TArray<FTransform>& LocalPose = LocalPoseHandle.Get();
 
     if (Sequence)
     {
@@ -103,12 +105,8 @@ void FAnimationRuntime::BlendTwoPoses(const FSkeleton& Skeleton, const TArray<FT
 
     const float ClampedAlpha = std::clamp(Alpha, 0.f, 1.f);
 
-    for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
-    {
-        const FTransform& A = ComponentPoseA[BoneIndex];
-        const FTransform& B = ComponentPoseB[BoneIndex];
-        OutComponentPose[BoneIndex] = FTransform::Lerp(A, B, ClampedAlpha);
-    }
+    // 본 단위 FTransform::Lerp와 같은 결과 (SIMD 배열 커널)
+    FVectorBatch::BlendTransforms(ComponentPoseA.GetData(), ComponentPoseB.GetData(), ClampedAlpha, OutComponentPose.GetData(), NumBones);
 }
 
 void FAnimationRuntime::AccumulateAdditivePose(const FSkeleton& Skeleton, const TArray<FTransform>& BasePose,
@@ -151,15 +149,15 @@ void FAnimationRuntime::NormalizeRotations(TArray<FTransform>& InComponentPose)
 }
 
 void FAnimationRuntime::BlendMultiplePoses(const FSkeleton& Skeleton,
-    const TArray<TArray<FTransform>>& ComponentPoses,
-    const TArray<float>& Weights,
+    const TArray<FTransform>* const* ComponentPoses,
+    const float* Weights,
+    int32 NumPoses,
     TArray<FTransform>& OutComponentPose)
 {
     const int32 NumBones = Skeleton.Bones.Num();
     OutComponentPose.SetNum(NumBones);
 
-    const int32 NumPoses = static_cast<int32>(ComponentPoses.Num());
-    if (NumPoses == 0 || NumBones == 0)
+    if (NumPoses <= 0 || NumBones == 0)
     {
         OutComponentPose.Empty();
         return;
@@ -168,42 +166,36 @@ void FAnimationRuntime::BlendMultiplePoses(const FSkeleton& Skeleton,
     // Early cases
     if (NumPoses == 1)
     {
-        OutComponentPose = ComponentPoses[0];
+        OutComponentPose = *ComponentPoses[0];
         return;
     }
 
     // Compute total weight and guard against degenerate input
     float TotalW = 0.f;
-    const int32 NumWeights = static_cast<int32>(Weights.Num());
-    for (int32 i = 0; i < NumWeights && i < NumPoses; ++i)
+    for (int32 i = 0; i < NumPoses; ++i)
     {
         TotalW += std::max(0.f, Weights[i]);
     }
     if (TotalW <= 1e-6f)
     {
         // Fallback: copy first
-        OutComponentPose = ComponentPoses[0];
+        OutComponentPose = *ComponentPoses[0];
         return;
     }
 
-    // Normalize weights to sum to 1
-    TArray<float> NormW; NormW.SetNum(NumPoses);
+    // Normalized weight of pose i is max(0, Weights[i]) * InvTotalW (computed inline, no scratch array)
+    const float InvTotalW = 1.f / TotalW;
+
+    // Choose reference quaternion from first pose with non-zero weight
+    int32 RefIdx = 0;
     for (int32 i = 0; i < NumPoses; ++i)
     {
-        const float W = (i < NumWeights) ? std::max(0.f, Weights[i]) : 0.f;
-        NormW[i] = W / TotalW;
+        if (Weights[i] > 0.f) { RefIdx = i; break; }
     }
 
     for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
     {
-        // Choose reference quaternion from first pose (or first with non-zero weight)
-        int32 RefIdx = 0;
-        for (int32 i = 0; i < NumPoses; ++i)
-        {
-            if (NormW[i] > 0.f) { RefIdx = i; break; }
-        }
-
-        const FQuat& Qref = ComponentPoses[RefIdx][BoneIndex].Rotation;
+        const FQuat& Qref = (*ComponentPoses[RefIdx])[BoneIndex].Rotation;
 
         // Weighted quaternion sum with antipodal correction
         float AccX = 0.f, AccY = 0.f, AccZ = 0.f, AccW = 0.f;
@@ -212,10 +204,10 @@ void FAnimationRuntime::BlendMultiplePoses(const FSkeleton& Skeleton,
 
         for (int32 i = 0; i < NumPoses; ++i)
         {
-            const float w = NormW[i];
+            const float w = std::max(0.f, Weights[i]) * InvTotalW;
             if (w <= 0.f) continue;
 
-            const FTransform& Ti = ComponentPoses[i][BoneIndex];
+            const FTransform& Ti = (*ComponentPoses[i])[BoneIndex];
             FQuat Qi = Ti.Rotation;
             // Flip sign if needed to avoid averaging antipodal quaternions
             if (FQuat::Dot(Qi, Qref) < 0.f)
@@ -243,10 +235,7 @@ void FAnimationRuntime::BlendThreePoses(const FSkeleton& Skeleton,
     float WA, float WB, float WC,
     TArray<FTransform>& OutComponentPose)
 {
-    TArray<TArray<FTransform>> Poses;
-    Poses.SetNum(3);
-    Poses[0] = A; Poses[1] = B; Poses[2] = C;
-    TArray<float> Weights; Weights.SetNum(3);
-    Weights[0] = WA; Weights[1] = WB; Weights[2] = WC;
-    BlendMultiplePoses(Skeleton, Poses, Weights, OutComponentPose);
+    const TArray<FTransform>* Poses[3] = { &A, &B, &C };
+    const float Weights[3] = { WA, WB, WC };
+    BlendMultiplePoses(Skeleton, Poses, Weights, 3, OutComponentPose);
 }
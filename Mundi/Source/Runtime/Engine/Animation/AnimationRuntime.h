@@ -26,9 +26,11 @@ public:
 
     // Multi-pose blending (component space): blends N component-space poses with weights that should sum to 1.
     // Rotation uses weighted quaternion average with antipodal sign correction; translation/scale use weighted linear sum.
+    // Poses are passed by pointer so callers can blend pose arena buffers without copying them into a nested array.
     static void BlendMultiplePoses(const FSkeleton& Skeleton,
-        const TArray<TArray<FTransform>>& ComponentPoses,
-        const TArray<float>& Weights,
+        const TArray<FTransform>* const* ComponentPoses,
+        const float* Weights,
+        int32 NumPoses,
         TArray<FTransform>& OutComponentPose);
 
     // Convenience: blend exactly three component-space poses with explicit weights.
@@ -1,6 +1,8 @@
 ﻿#include "pch.h"
 #include "ClothManager.h"
 #include "ClothMesh.h"
+#include "ClothStats.h"
+#include "PlatformTime.h"
 
 UClothManager* UClothManager::Instance = nullptr;
 
@@ -11,6 +13,10 @@ UClothManager::UClothManager()
 UClothManager::~UClothManager()
 {
     Release();
+    if (Instance == this)
+    {
+        Instance = nullptr;
+    }
 }
 
 void UClothManager::InitClothManager(ID3D11Device* InDevice, ID3D11DeviceContext* InContext)
@@ -44,6 +50,7 @@ void UClothManager::InitClothManager(ID3D11Device* InDevice, ID3D11DeviceContext
     //Factory = NvClothCreateFactoryDX11(GraphicsContextManager);
     Factory = NvClothCreateFactoryCPU();
     Solver = Factory->createSolver();
+    StartWorkers();
 
     TestCloth = new FClothMesh();
 
@@ -130,7 +137,12 @@ void UClothManager::InitClothManager(ID3D11Device* InDevice, ID3D11DeviceContext
 
 void UClothManager::Release()
 {
+    // 워커가 솔버를 참조하지 않도록 시뮬레이션 완료 후 스레드부터 정리
+    WaitForSimulation();
+    StopWorkers();
+
     delete TestCloth;
+    TestCloth = nullptr;
 
     // Solver 정리
     if (Solver)
@@ -156,12 +168,214 @@ void UClothManager::Release()
     AssertHandler = nullptr;
 }
 
-void UClothManager::Tick(float deltaTime)
+void UClothManager::StartWorkers()
 {
-    Solver->beginSimulation(deltaTime);
-    for (int i = 0; i < Solver->getSimulationChunkCount(); i++)
+    // 게임 스레드와 렌더링, 셰이더 컴파일 워커 몫을 남겨둔다. 게임 스레드도 대기 중 청크를 처리한다.
+    const int32 HardwareThreads = static_cast<int32>(std::thread::hardware_concurrency());
+    const int32 NumWorkers = FMath::Clamp(HardwareThreads - 2, 1, 4);
+
+    bStopWorkers = false;
+    for (int32 i = 0; i < NumWorkers; ++i)
     {
-        Solver->simulateChunk(i);
+        Workers.Emplace(&UClothManager::WorkerLoop, this);
     }
+}
+
+void UClothManager::StopWorkers()
+{
+    {
+        std::lock_guard<std::mutex> Lock(WorkerMutex);
+        bStopWorkers = true;
+    }
+    WorkerCondition.notify_all();
+
+    for (std::thread& Worker : Workers)
+    {
+        if (Worker.joinable())
+        {
+            Worker.join();
+        }
+    }
+    Workers.Empty();
+}
+
+void UClothManager::WorkerLoop()
+{
+    uint64 LastGeneration = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> Lock(WorkerMutex);
+            WorkerCondition.wait(Lock, [&]() { return bStopWorkers || WorkGeneration != LastGeneration; });
+            if (bStopWorkers)
+            {
+                return;
+            }
+            LastGeneration = WorkGeneration;
+        }
+
+        RunPendingChunks();
+    }
+}
+
+void UClothManager::RunPendingChunks()
+{
+    while (true)
+    {
+        const int32 ChunkIndex = NextChunk.fetch_add(1);
+        if (ChunkIndex >= NumChunks.load())
+        {
+            return;
+        }
+
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        Solver->simulateChunk(ChunkIndex);
+        ChunkTimesMS[ChunkIndex] = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+        // 마지막 청크를 끝낸 스레드가 대기 중인 게임 스레드를 깨운다
+        if (RemainingChunks.fetch_sub(1) == 1)
+        {
+            std::lock_guard<std::mutex> Lock(WorkerMutex);
+            DoneCondition.notify_all();
+        }
+    }
+}
+
+void UClothManager::StartSimulation(float DeltaSeconds)
+{
+    WaitForSimulation();
+
+    FClothStatManager::GetInstance().CommitInstances();
+
+    FClothStats& Stats = FClothStatManager::GetInstance().GetMutableStats();
+    Stats.RegisteredClothCount = static_cast<uint32>(Solver->getNumCloths());
+    Stats.WorkerCount = static_cast<uint32>(Workers.Num());
+    Stats.SimulatedChunkCount = 0;
+
+    ClothSimulateTimesMS.Empty();
+
+    if (DeltaSeconds <= 0.0f || Solver->getNumCloths() == 0)
+    {
+        return;
+    }
+
+    SimulationStartCycles = FPlatformTime::Cycles64();
+    if (!Solver->beginSimulation(DeltaSeconds))
+    {
+        return;
+    }
+
+    // NextChunk가 닫혀 있는 동안 프레임 상태를 채우고, 마지막에 0으로 열어 워커에 공개한다
+    const int32 ChunkCount = Solver->getSimulationChunkCount();
+    NumChunks.store(ChunkCount);
+    ChunkTimesMS.assign(ChunkCount, 0.0);
+
+    // CPU 솔버는 깨어 있는 천마다 청크 하나를 등록 순서대로 만든다. 개수가 맞지 않으면 천별 시간은 기록하지 않는다.
+    ChunkCloths.Empty();
+    Cloth* const* ClothList = Solver->getClothList();
+    for (int32 i = 0; i < Solver->getNumCloths(); ++i)
+    {
+        if (!ClothList[i]->isAsleep())
+        {
+            ChunkCloths.Add(ClothList[i]);
+        }
+    }
+    if (ChunkCloths.Num() != ChunkCount)
+    {
+        ChunkCloths.Empty();
+    }
+
+    bSimulating = true;
+    RemainingChunks.store(ChunkCount);
+    NextChunk.store(0);
+
+    if (ChunkCount > 0)
+    {
+        {
+            std::lock_guard<std::mutex> Lock(WorkerMutex);
+            ++WorkGeneration;
+        }
+        WorkerCondition.notify_all();
+    }
+}
+
+void UClothManager::WaitForSimulation()
+{
+    if (!bSimulating)
+    {
+        return;
+    }
+
+    const uint64 WaitStartCycles = FPlatformTime::Cycles64();
+
+    // 워커가 아직 가져가지 않은 청크는 게임 스레드가 직접 처리
+    RunPendingChunks();
+    {
+        std::unique_lock<std::mutex> Lock(WorkerMutex);
+        DoneCondition.wait(Lock, [&]() { return RemainingChunks.load() <= 0; });
+    }
+    NextChunk.store(ClosedChunkIndex);
+
     Solver->endSimulation();
-}
\ No newline at end of file
+    bSimulating = false;
+    ++SimulationFrame;
+
+    const uint64 EndCycles = FPlatformTime::Cycles64();
+
+    FClothStats& Stats = FClothStatManager::GetInstance().GetMutableStats();
+    const int32 ChunkCount = NumChunks.load();
+    Stats.SimulatedChunkCount = static_cast<uint32>(ChunkCount);
+    Stats.SimulationWallTimeMS = FPlatformTime::ToMilliseconds(EndCycles - SimulationStartCycles);
+    Stats.WaitTimeMS = FPlatformTime::ToMilliseconds(EndCycles - WaitStartCycles);
+    Stats.TotalChunkTimeMS = 0.0;
+    Stats.MaxChunkTimeMS = 0.0;
+    for (int32 i = 0; i < ChunkCount; ++i)
+    {
+        Stats.TotalChunkTimeMS += ChunkTimesMS[i];
+        Stats.MaxChunkTimeMS = FMath::Max(Stats.MaxChunkTimeMS, ChunkTimesMS[i]);
+        if (!ChunkCloths.IsEmpty())
+        {
+            ClothSimulateTimesMS.Add(ChunkCloths[i], ChunkTimesMS[i]);
+        }
+    }
+
+    NumChunks.store(0);
+}
+
+double UClothManager::GetClothSimulateTimeMS(const Cloth* InCloth) const
+{
+    const double* TimeMS = ClothSimulateTimesMS.Find(InCloth);
+    return TimeMS ? *TimeMS : 0.0;
+}
+
+void UClothManager::RegisterCloth(Cloth* InCloth)
+{
+    WaitForSimulation();
+    if (!IsClothRegistered(InCloth))
+    {
+        Solver->addCloth(InCloth);
+    }
+}
+
+void UClothManager::UnRegisterCloth(Cloth* InCloth)
+{
+    WaitForSimulation();
+    if (IsClothRegistered(InCloth))
+    {
+        Solver->removeCloth(InCloth);
+    }
+    ClothSimulateTimesMS.Remove(InCloth);
+}
+
+bool UClothManager::IsClothRegistered(const Cloth* InCloth) const
+{
+    Cloth* const* ClothList = Solver->getClothList();
+    for (int32 i = 0; i < Solver->getNumCloths(); ++i)
+    {
+        if (ClothList[i] == InCloth)
+        {
+            return true;
+        }
+    }
+    return false;
+}
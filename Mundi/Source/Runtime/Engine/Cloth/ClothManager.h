@@ -1,4 +1,8 @@
 ﻿#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 #include "Object.h"
 #include "ClothUtil.h"
 #include "DxContextManagerCallbackImpl.h"
@@ -14,8 +18,27 @@ public:
     ~UClothManager();
     static UClothManager* Instance;
 	void InitClothManager(ID3D11Device* InDevice, ID3D11DeviceContext* InContext);
-	void Tick(float deltaTime);
     void Release();
+
+    /**
+     * 이번 프레임의 솔버 청크를 워커 스레드에 나눠 시뮬레이션을 시작한다.
+     * 게임 스레드는 렌더링을 준비하는 동안 시뮬레이션과 겹쳐 실행된다. (월드 Tick 이후 호출)
+     */
+    void StartSimulation(float DeltaSeconds);
+
+    /**
+     * 시뮬레이션이 끝날 때까지 기다린다. 게임 스레드도 남은 청크를 함께 처리한다.
+     * 진행 중인 시뮬레이션이 없으면 바로 반환하므로 천 데이터를 읽기 전에 언제든 호출해도 된다.
+     */
+    void WaitForSimulation();
+
+    bool IsSimulating() const { return bSimulating; }
+
+    /** 완료된 시뮬레이션 프레임 번호 (버텍스 버퍼를 프레임당 한 번만 갱신하기 위함) */
+    uint64 GetSimulationFrame() const { return SimulationFrame; }
+
+    /** 마지막 시뮬레이션에서 이 천의 청크가 걸린 시간 (밀리초, 시뮬레이션하지 않았으면 0) */
+    double GetClothSimulateTimeMS(const Cloth* InCloth) const;
     
     Factory* GetFactory() { return Factory; }
     Solver* GetSolver() { return Solver; }
@@ -26,10 +49,18 @@ public:
 
     FClothMesh* GetTestCloth() { return TestCloth; }
 
-    void RegisterCloth(Cloth* InCloth) { Solver->addCloth(InCloth); }
-    void UnRegisterCloth(Cloth* InCloth) { Solver->removeCloth(InCloth); }
+    /** @note 시뮬레이션 중에는 솔버를 수정할 수 없으므로 먼저 완료를 기다린다. */
+    void RegisterCloth(Cloth* InCloth);
+    void UnRegisterCloth(Cloth* InCloth);
+    bool IsClothRegistered(const Cloth* InCloth) const;
 
 private:
+    void StartWorkers();
+    void StopWorkers();
+    void WorkerLoop();
+
+    /** 아직 아무도 가져가지 않은 청크를 하나씩 가져와 처리한다. (워커/게임 스레드 공용) */
+    void RunPendingChunks();
 
     FClothMesh* TestCloth = nullptr;
 
@@ -45,6 +76,27 @@ private:
     NvClothErrorCallback* ErrorCallback = nullptr;
     NvClothAssertHandler* AssertHandler = nullptr;
 
+    // 청크 워커 스레드
+    TArray<std::thread> Workers;
+    std::mutex WorkerMutex;
+    std::condition_variable WorkerCondition;    // 새 프레임 시작 / 종료 알림
+    std::condition_variable DoneCondition;      // 마지막 청크 완료 알림
+    uint64 WorkGeneration = 0;
+    bool bStopWorkers = false;
+
+    // 프레임 청크 분배 상태
+    // 프레임 사이에는 NextChunk를 닫아 두어, 늦게 깨어난 워커가 다음 프레임 상태를 채우는 도중 청크를 가져가지 못하게 한다
+    static constexpr int32 ClosedChunkIndex = INT32_MAX / 2;
+    std::atomic<int32> NextChunk{ ClosedChunkIndex };
+    std::atomic<int32> RemainingChunks{ 0 };
+    std::atomic<int32> NumChunks{ 0 };
+    TArray<double> ChunkTimesMS;
+    TArray<Cloth*> ChunkCloths;                 // 청크 -> 천 (CPU 솔버는 깨어 있는 천마다 청크 하나)
+    TMap<const Cloth*, double> ClothSimulateTimesMS;
+
+    bool bSimulating = false;
+    uint64 SimulationFrame = 0;
+    uint64 SimulationStartCycles = 0;
 }; 
 inline Range<physx::PxVec4> GetRange(TArray<PxVec4>& Arr)
 {
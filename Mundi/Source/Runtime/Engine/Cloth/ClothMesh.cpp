@@ -13,6 +13,11 @@ FClothMesh::~FClothMesh()
 
 UClothMeshInstance::~UClothMeshInstance()
 {
+    // 워커 스레드가 시뮬레이션 중일 수 있으므로 솔버에서 먼저 제거
+    if (UClothManager::Instance && Cloth)
+    {
+        UClothManager::Instance->UnRegisterCloth(Cloth);
+    }
     VertexBuffer->Release();
     IndexBuffer->Release();
     NV_CLOTH_DELETE(Cloth);
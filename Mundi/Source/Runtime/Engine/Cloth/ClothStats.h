@@ -0,0 +1,87 @@
+﻿#pragma once
+
+#include <cstdint>
+
+/** 천 LOD 단계 (거리 기반) */
+enum class EClothLOD : uint8_t
+{
+	Full = 0,       // 원래 솔버 주파수
+	Half,           // 솔버 주파수 1/2
+	Quarter,        // 솔버 주파수 1/4
+	Frozen,         // 솔버에서 제외 (화면 밖이거나 너무 멂)
+	Count
+};
+
+/** 천 하나의 프레임 통계 */
+struct FClothInstanceStats
+{
+	uint32_t ParticleCount = 0;
+	EClothLOD LOD = EClothLOD::Full;
+	float SolverFrequency = 0.0f;
+	double SimulateTimeMS = 0.0;    // 워커에서 이 천의 청크를 시뮬레이션한 시간
+};
+
+/**
+ * 천 시뮬레이션 통계 구조체
+ * 솔버 청크는 워커 스레드에서 게임 스레드와 겹쳐 실행되므로, 벽시계 시간과 게임 스레드 대기 시간을 따로 기록합니다.
+ */
+struct FClothStats
+{
+	uint32_t RegisteredClothCount = 0;      // 솔버에 등록된 천 수
+	uint32_t SimulatedChunkCount = 0;       // 이번 프레임에 시뮬레이션한 청크 수 (CPU 솔버는 천 하나당 청크 하나)
+	uint32_t WorkerCount = 0;
+	uint32_t LODCounts[static_cast<int>(EClothLOD::Count)] = {};
+
+	double SimulationWallTimeMS = 0.0;      // 시작 ~ 완료까지 걸린 시간
+	double TotalChunkTimeMS = 0.0;          // 모든 청크 시뮬레이션 시간 합 (CPU 사용량)
+	double MaxChunkTimeMS = 0.0;            // 가장 오래 걸린 청크
+	double WaitTimeMS = 0.0;                // 게임 스레드가 결과를 기다리며 막힌 시간
+
+	TArray<FClothInstanceStats> Instances;  // 천별 통계 (ClothComponent가 매 프레임 추가)
+};
+
+/**
+ * 천 통계 전역 매니저 (싱글톤)
+ */
+class FClothStatManager
+{
+public:
+	static FClothStatManager& GetInstance()
+	{
+		static FClothStatManager Instance;
+		return Instance;
+	}
+
+	const FClothStats& GetStats() const { return CurrentStats; }
+	FClothStats& GetMutableStats() { return CurrentStats; }
+
+	/** 천 인스턴스 통계 추가 (ClothComponent::TickComponent에서 호출) */
+	void AddInstance(const FClothInstanceStats& InStats)
+	{
+		PendingInstances.Add(InStats);
+	}
+
+	/** 이번 프레임에 모은 천별 통계를 확정한다. (UClothManager::StartSimulation에서 호출) */
+	void CommitInstances()
+	{
+		for (uint32_t& Count : CurrentStats.LODCounts)
+		{
+			Count = 0;
+		}
+		for (const FClothInstanceStats& Instance : PendingInstances)
+		{
+			CurrentStats.LODCounts[static_cast<int>(Instance.LOD)]++;
+		}
+		CurrentStats.Instances = std::move(PendingInstances);
+		PendingInstances.Empty();
+	}
+
+private:
+	FClothStatManager() = default;
+	~FClothStatManager() = default;
+	FClothStatManager(const FClothStatManager&) = delete;
+	FClothStatManager& operator=(const FClothStatManager&) = delete;
+
+	FClothStats CurrentStats;
+	TArray<FClothInstanceStats> PendingInstances;
+};
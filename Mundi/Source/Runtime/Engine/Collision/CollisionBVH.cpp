@@ -60,7 +60,7 @@ FCollisionBVH::~FCollisionBVH()
 void FCollisionBVH::Clear()
 {
 	// NOTE: TMap, TArray를 clear로 비우면 capacity가 그대로이기 때문에 새 객체로 초기화
-	ShapeComponentBounds = TMap<UShapeComponent*, FAABB>();
+	ShapeComponentBounds = TFlatMap<UShapeComponent*, FAABB>();
 	ShapeComponentArray = TArray<UShapeComponent*>();
 	Nodes = TArray<FLBVHNode>();
 	Bounds = FAABB();
@@ -213,7 +213,7 @@ private:
 	FAABB Bounds;
 
 	/** 컴포넌트 -> AABB 매핑 */
-	TMap<UShapeComponent*, FAABB> ShapeComponentBounds;
+	TFlatMap<UShapeComponent*, FAABB> ShapeComponentBounds;
 
 	/** 컴포넌트 배열 (BuildLBVH에서 정렬됨) */
 	TArray<UShapeComponent*> ShapeComponentArray;
@@ -3,7 +3,11 @@
 #include "Vector.h"
 #include "Frustum.h"
 #include "CameraComponent.h"
+#include "PlatformTime.h"
 #include <immintrin.h> // For SSE, AVX, FMA instructions
+#include <cfloat>
+#include <thread>
+#include <random>
 
 
 
@@ -152,6 +156,51 @@ FFrustum CreateFrustumFromCamera(const UCameraComponent& Camera, float OverrideA
     return Result;
 }
 
+// ------------------------------------------------------------
+// VP(=View*Proj)에서 평면 추출
+//  - row-vector 규약(p' = p * M)에서 클립 좌표의 각 성분은 M의 "열"과의 내적
+//    => C_i = (M[0][i], M[1][i], M[2][i], M[3][i])
+//  - D3D 클립 공간: -w <= x, y <= w,  0 <= z <= w
+//    Left: C3 + C0,  Right: C3 - C0,  Bottom: C3 + C1,  Top: C3 - C1,  Near: C2,  Far: C3 - C2
+//  - 결합 결과 P=(a,b,c,d)에 대해 a*x + b*y + c*z + d >= 0 이 내부
+//    => 본 코드의 평면식 dot(N,X) - D >= 0 과 맞추기 위해 N=(a,b,c)/|N|, D=-d/|N|
+// ------------------------------------------------------------
+namespace
+{
+    FPlane MakePlaneFromClipCoefficients(float A, float B, float C, float D)
+    {
+        const float Length = std::sqrt(A * A + B * B + C * C);
+        if (Length <= KINDA_SMALL_NUMBER)
+        {
+            // 퇴화된 평면은 항상 통과하도록 처리
+            return FPlane{ FVector4(0.0f, 0.0f, 1.0f, 0.0f), -FLT_MAX };
+        }
+
+        const float InvLength = 1.0f / Length;
+        return FPlane{ FVector4(A * InvLength, B * InvLength, C * InvLength, 0.0f), -D * InvLength };
+    }
+}
+
+FFrustum CreateFrustumFromViewProjection(const FMatrix& ViewProjection)
+{
+    const auto& M = ViewProjection.M;
+
+    // 클립 좌표 성분별 열 벡터
+    const FVector4 C0(M[0][0], M[1][0], M[2][0], M[3][0]);
+    const FVector4 C1(M[0][1], M[1][1], M[2][1], M[3][1]);
+    const FVector4 C2(M[0][2], M[1][2], M[2][2], M[3][2]);
+    const FVector4 C3(M[0][3], M[1][3], M[2][3], M[3][3]);
+
+    FFrustum Result;
+    Result.LeftFace = MakePlaneFromClipCoefficients(C3.X + C0.X, C3.Y + C0.Y, C3.Z + C0.Z, C3.W + C0.W);
+    Result.RightFace = MakePlaneFromClipCoefficients(C3.X - C0.X, C3.Y - C0.Y, C3.Z - C0.Z, C3.W - C0.W);
+    Result.BottomFace = MakePlaneFromClipCoefficients(C3.X + C1.X, C3.Y + C1.Y, C3.Z + C1.Z, C3.W + C1.W);
+    Result.TopFace = MakePlaneFromClipCoefficients(C3.X - C1.X, C3.Y - C1.Y, C3.Z - C1.Z, C3.W - C1.W);
+    Result.NearFace = MakePlaneFromClipCoefficients(C2.X, C2.Y, C2.Z, C2.W);
+    Result.FarFace = MakePlaneFromClipCoefficients(C3.X - C2.X, C3.Y - C2.Y, C3.Z - C2.Z, C3.W - C2.W);
+    return Result;
+}
+
 // ------------------------------------------------------------
 // AABB vs 프러스텀 판정
 //  - 각 평면에 대해: 중심의 부호 + 박스의 "프로젝션 반경"으로 배제 테스트
@@ -425,4 +474,341 @@ uint8_t AreAABBsVisible_8_AVX(const FFrustum& Frustum, const FAABB Bounds[8])
     }
 
     return static_cast<uint8_t>(all_visible_mask);
-}
\ No newline at end of file
+}
+// ------------------------------------------------------------
+// SIMD 배치 컬링
+//  - 판정 규약은 IsAABBVisible/IsAABBIntersects와 같다 (Distance ± Radius >= 0)
+//  - AVX 빌드 옵션(/arch:AVX)을 쓰지 않으므로 SSE 4칸 단위로 처리한다
+// ------------------------------------------------------------
+
+namespace
+{
+    // 평면 쿼드별로 실제 평면이 있는 칸 (두 번째 쿼드는 Near/Far 두 장)
+    constexpr int32 FrustumQuadPlaneBits[2] = { 0xF, 0x3 };
+
+    // 스레드 하나가 맡을 최소 박스 수 (이보다 적으면 스레드 생성 비용이 더 크다)
+    constexpr int32 MinBoxesPerCullThread = 16384;
+
+    inline __m128 SplatLane(__m128 V, int32 Lane)
+    {
+        switch (Lane)
+        {
+        case 0: return _mm_shuffle_ps(V, V, _MM_SHUFFLE(0, 0, 0, 0));
+        case 1: return _mm_shuffle_ps(V, V, _MM_SHUFFLE(1, 1, 1, 1));
+        case 2: return _mm_shuffle_ps(V, V, _MM_SHUFFLE(2, 2, 2, 2));
+        default: return _mm_shuffle_ps(V, V, _MM_SHUFFLE(3, 3, 3, 3));
+        }
+    }
+
+    void CullAABBRange(const FFrustumSIMD& Frustum, const FAABBSoA& Bounds, EFrustumTestResult* OutResults, int32 Begin, int32 End)
+    {
+        __m128 CX, CY, CZ, EX, EY, EZ;
+        for (int32 Index = Begin; Index < End; Index += 4)
+        {
+            Bounds.Load4(Index, CX, CY, CZ, EX, EY, EZ);
+
+            int32 VisibleMask, InsideMask;
+            Frustum.TestAABB4(CX, CY, CZ, EX, EY, EZ, FRUSTUM_NO_PLANES_INSIDE, VisibleMask, InsideMask);
+
+            // Outside(0) + 보임(1) + 완전히 안쪽(1) = Intersecting(1) / Inside(2)
+            const int32 NumLanes = std::min(4, End - Index);
+            for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+            {
+                OutResults[Index + Lane] = static_cast<EFrustumTestResult>(((VisibleMask >> Lane) & 1) + ((InsideMask >> Lane) & 1));
+            }
+        }
+    }
+
+    template<typename Func>
+    double MeasureCullMS(Func&& InFunc)
+    {
+        const uint64 Start = FPlatformTime::Cycles64();
+        InFunc();
+        return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+    }
+}
+
+FFrustumSIMD::FFrustumSIMD(const FFrustum& InFrustum)
+{
+    const FPlane* Planes = &InFrustum.TopFace;
+    const __m128 SignMask = _mm_set1_ps(-0.0f);
+
+    alignas(16) float NX[8], NY[8], NZ[8], D[8];
+    for (int32 i = 0; i < 8; ++i)
+    {
+        // 패딩 평면: 법선 0, 거리 -1 → 모든 박스가 안쪽
+        NX[i] = i < 6 ? Planes[i].Normal.X : 0.0f;
+        NY[i] = i < 6 ? Planes[i].Normal.Y : 0.0f;
+        NZ[i] = i < 6 ? Planes[i].Normal.Z : 0.0f;
+        D[i] = i < 6 ? Planes[i].Distance : -1.0f;
+    }
+
+    for (int32 Quad = 0; Quad < 2; ++Quad)
+    {
+        PlaneNX[Quad] = _mm_load_ps(NX + Quad * 4);
+        PlaneNY[Quad] = _mm_load_ps(NY + Quad * 4);
+        PlaneNZ[Quad] = _mm_load_ps(NZ + Quad * 4);
+        PlaneAbsNX[Quad] = _mm_andnot_ps(SignMask, PlaneNX[Quad]);
+        PlaneAbsNY[Quad] = _mm_andnot_ps(SignMask, PlaneNY[Quad]);
+        PlaneAbsNZ[Quad] = _mm_andnot_ps(SignMask, PlaneNZ[Quad]);
+        PlaneD[Quad] = _mm_load_ps(D + Quad * 4);
+    }
+
+    for (int32 i = 0; i < 6; ++i)
+    {
+        const int32 Quad = i / 4;
+        const int32 Lane = i % 4;
+        SplatNX[i] = SplatLane(PlaneNX[Quad], Lane);
+        SplatNY[i] = SplatLane(PlaneNY[Quad], Lane);
+        SplatNZ[i] = SplatLane(PlaneNZ[Quad], Lane);
+        SplatAbsNX[i] = SplatLane(PlaneAbsNX[Quad], Lane);
+        SplatAbsNY[i] = SplatLane(PlaneAbsNY[Quad], Lane);
+        SplatAbsNZ[i] = SplatLane(PlaneAbsNZ[Quad], Lane);
+        SplatD[i] = SplatLane(PlaneD[Quad], Lane);
+    }
+}
+
+EFrustumTestResult FFrustumSIMD::TestAABB(const FAABB& Bound, uint8 ParentInsideMask, uint8& OutInsideMask) const
+{
+    OutInsideMask = ParentInsideMask & FRUSTUM_ALL_PLANES_INSIDE;
+    if (OutInsideMask == FRUSTUM_ALL_PLANES_INSIDE)
+    {
+        return EFrustumTestResult::Inside;
+    }
+
+    const __m128 Half = _mm_set1_ps(0.5f);
+    const __m128 Min = _mm_setr_ps(Bound.Min.X, Bound.Min.Y, Bound.Min.Z, 0.0f);
+    const __m128 Max = _mm_setr_ps(Bound.Max.X, Bound.Max.Y, Bound.Max.Z, 0.0f);
+    const __m128 Center = _mm_mul_ps(_mm_add_ps(Max, Min), Half);
+    const __m128 Extent = _mm_mul_ps(_mm_sub_ps(Max, Min), Half);
+
+    const __m128 CX = SplatLane(Center, 0), CY = SplatLane(Center, 1), CZ = SplatLane(Center, 2);
+    const __m128 EX = SplatLane(Extent, 0), EY = SplatLane(Extent, 1), EZ = SplatLane(Extent, 2);
+    const __m128 Zero = _mm_setzero_ps();
+
+    for (int32 Quad = 0; Quad < 2; ++Quad)
+    {
+        const int32 QuadBits = FrustumQuadPlaneBits[Quad];
+        const int32 AlreadyInside = (OutInsideMask >> (Quad * 4)) & QuadBits;
+        if (AlreadyInside == QuadBits)
+        {
+            continue;
+        }
+
+        const __m128 Distance = _mm_sub_ps(
+            _mm_add_ps(_mm_add_ps(_mm_mul_ps(PlaneNX[Quad], CX), _mm_mul_ps(PlaneNY[Quad], CY)), _mm_mul_ps(PlaneNZ[Quad], CZ)),
+            PlaneD[Quad]);
+        const __m128 Radius = _mm_add_ps(
+            _mm_add_ps(_mm_mul_ps(PlaneAbsNX[Quad], EX), _mm_mul_ps(PlaneAbsNY[Quad], EY)), _mm_mul_ps(PlaneAbsNZ[Quad], EZ));
+
+        // NaN 바운드는 IsAABBVisible과 마찬가지로 바깥으로 취급 (cmpnge)
+        const int32 OutsideBits = _mm_movemask_ps(_mm_cmpnge_ps(_mm_add_ps(Distance, Radius), Zero)) & QuadBits & ~AlreadyInside;
+        if (OutsideBits)
+        {
+            return EFrustumTestResult::Outside;
+        }
+
+        const int32 InsideBits = _mm_movemask_ps(_mm_cmpge_ps(_mm_sub_ps(Distance, Radius), Zero)) & QuadBits;
+        OutInsideMask |= static_cast<uint8>(InsideBits << (Quad * 4));
+    }
+
+    return OutInsideMask == FRUSTUM_ALL_PLANES_INSIDE ? EFrustumTestResult::Inside : EFrustumTestResult::Intersecting;
+}
+
+void FFrustumSIMD::TestAABB4(const __m128& CenterX, const __m128& CenterY, const __m128& CenterZ,
+    const __m128& ExtentX, const __m128& ExtentY, const __m128& ExtentZ,
+    uint8 SkipPlaneMask, int32& OutVisibleMask, int32& OutInsideMask) const
+{
+    const __m128 Zero = _mm_setzero_ps();
+    int32 VisibleMask = 0xF;
+    int32 InsideMask = 0xF;
+
+    for (int32 i = 0; i < 6; ++i)
+    {
+        if (SkipPlaneMask & (1 << i))
+        {
+            continue;
+        }
+
+        const __m128 Distance = _mm_sub_ps(
+            _mm_add_ps(_mm_add_ps(_mm_mul_ps(SplatNX[i], CenterX), _mm_mul_ps(SplatNY[i], CenterY)), _mm_mul_ps(SplatNZ[i], CenterZ)),
+            SplatD[i]);
+        const __m128 Radius = _mm_add_ps(
+            _mm_add_ps(_mm_mul_ps(SplatAbsNX[i], ExtentX), _mm_mul_ps(SplatAbsNY[i], ExtentY)), _mm_mul_ps(SplatAbsNZ[i], ExtentZ));
+
+        VisibleMask &= _mm_movemask_ps(_mm_cmpge_ps(_mm_add_ps(Distance, Radius), Zero));
+        if (VisibleMask == 0)
+        {
+            break;
+        }
+        InsideMask &= _mm_movemask_ps(_mm_cmpge_ps(_mm_sub_ps(Distance, Radius), Zero));
+    }
+
+    OutVisibleMask = VisibleMask;
+    OutInsideMask = InsideMask & VisibleMask;
+}
+
+void FAABBSoA::Reset(int32 ExpectedNum)
+{
+    Count = 0;
+    TArray<float>* Arrays[] = { &CenterX, &CenterY, &CenterZ, &ExtentX, &ExtentY, &ExtentZ };
+    for (TArray<float>* Array : Arrays)
+    {
+        Array->Empty();
+        Array->Reserve(std::max(ExpectedNum, 0) + 3);
+    }
+    Pad();
+}
+
+void FAABBSoA::Add(const FAABB& Bound)
+{
+    Pad();
+    CenterX[Count] = (Bound.Min.X + Bound.Max.X) * 0.5f;
+    CenterY[Count] = (Bound.Min.Y + Bound.Max.Y) * 0.5f;
+    CenterZ[Count] = (Bound.Min.Z + Bound.Max.Z) * 0.5f;
+    ExtentX[Count] = (Bound.Max.X - Bound.Min.X) * 0.5f;
+    ExtentY[Count] = (Bound.Max.Y - Bound.Min.Y) * 0.5f;
+    ExtentZ[Count] = (Bound.Max.Z - Bound.Min.Z) * 0.5f;
+    ++Count;
+    Pad();
+}
+
+void FAABBSoA::Load4(int32 Index, __m128& OutCX, __m128& OutCY, __m128& OutCZ, __m128& OutEX, __m128& OutEY, __m128& OutEZ) const
+{
+    OutCX = _mm_loadu_ps(CenterX.GetData() + Index);
+    OutCY = _mm_loadu_ps(CenterY.GetData() + Index);
+    OutCZ = _mm_loadu_ps(CenterZ.GetData() + Index);
+    OutEX = _mm_loadu_ps(ExtentX.GetData() + Index);
+    OutEY = _mm_loadu_ps(ExtentY.GetData() + Index);
+    OutEZ = _mm_loadu_ps(ExtentZ.GetData() + Index);
+}
+
+void FAABBSoA::Pad()
+{
+    // 마지막 박스부터 4개를 읽어도 배열 밖을 넘지 않도록 0 패딩 3칸을 유지한다
+    while (CenterX.Num() < Count + 3)
+    {
+        CenterX.Add(0.0f);
+        CenterY.Add(0.0f);
+        CenterZ.Add(0.0f);
+        ExtentX.Add(0.0f);
+        ExtentY.Add(0.0f);
+        ExtentZ.Add(0.0f);
+    }
+}
+
+void CullAABBs(const FFrustumSIMD& Frustum, const FAABBSoA& Bounds, TArray<EFrustumTestResult>& OutResults, int32 MaxThreads)
+{
+    const int32 NumBoxes = Bounds.Num();
+    OutResults.SetNum(NumBoxes);
+    if (NumBoxes == 0)
+    {
+        return;
+    }
+
+    const int32 NumThreads = std::clamp(std::min(MaxThreads, NumBoxes / MinBoxesPerCullThread), 1, 64);
+    if (NumThreads == 1)
+    {
+        CullAABBRange(Frustum, Bounds, OutResults.GetData(), 0, NumBoxes);
+        return;
+    }
+
+    // 4의 배수로 나눠 각 스레드가 서로 다른 결과 칸만 쓰도록 한다
+    const int32 ChunkSize = ((NumBoxes + NumThreads - 1) / NumThreads + 3) & ~3;
+    EFrustumTestResult* Results = OutResults.GetData();
+
+    TArray<std::thread> Workers;
+    Workers.Reserve(NumThreads - 1);
+    for (int32 Begin = ChunkSize; Begin < NumBoxes; Begin += ChunkSize)
+    {
+        const int32 End = std::min(Begin + ChunkSize, NumBoxes);
+        Workers.Emplace([&Frustum, &Bounds, Results, Begin, End]()
+        {
+            CullAABBRange(Frustum, Bounds, Results, Begin, End);
+        });
+    }
+
+    // 첫 청크는 호출 스레드가 처리
+    CullAABBRange(Frustum, Bounds, Results, 0, std::min(ChunkSize, NumBoxes));
+
+    for (std::thread& Worker : Workers)
+    {
+        Worker.join();
+    }
+}
+
+FFrustumCullBenchmarkResult RunFrustumCullBenchmark(int32 NumBoxes)
+{
+    FFrustumCullBenchmarkResult Result;
+    Result.NumBoxes = std::max(NumBoxes, 1);
+    Result.NumThreads = std::max(1, static_cast<int32>(std::thread::hardware_concurrency()));
+    const int32 N = Result.NumBoxes;
+
+    // +X를 바라보는 카메라 절두체, 박스는 카메라 주변 구 안에 흩뿌려 일부만 보이게 한다
+    const FMatrix View = FMatrix::LookAtLH(FVector(0.0f, 0.0f, 0.0f), FVector(1.0f, 0.0f, 0.0f), FVector(0.0f, 0.0f, 1.0f));
+    const FMatrix Projection = FMatrix::PerspectiveFovLH(DegreesToRadians(60.0f), 16.0f / 9.0f, 1.0f, 1000.0f);
+    const FFrustum Frustum = CreateFrustumFromViewProjection(View * Projection);
+
+    std::mt19937 Rng(2468u);
+    std::uniform_real_distribution<float> PositionDist(-1000.0f, 1000.0f);
+    std::uniform_real_distribution<float> ExtentDist(0.5f, 20.0f);
+
+    TArray<FAABB> Boxes;
+    Boxes.Reserve(N);
+    for (int32 i = 0; i < N; ++i)
+    {
+        const FVector Center(PositionDist(Rng), PositionDist(Rng), PositionDist(Rng));
+        const FVector Extent(ExtentDist(Rng), ExtentDist(Rng), ExtentDist(Rng));
+        Boxes.Add(FAABB(Center - Extent, Center + Extent));
+    }
+
+    TArray<uint8> ScalarVisible;
+    ScalarVisible.SetNum(N);
+    Result.ScalarMS = MeasureCullMS([&]()
+    {
+        for (int32 i = 0; i < N; ++i) ScalarVisible[i] = IsAABBVisible(Frustum, Boxes[i]) ? 1 : 0;
+    });
+
+    // 절두체 전치는 뷰마다 한 번이므로 측정 구간에 포함한다
+    TArray<uint8> SingleVisible;
+    SingleVisible.SetNum(N);
+    Result.SingleBoxSIMDMS = MeasureCullMS([&]()
+    {
+        const FFrustumSIMD FrustumSIMD(Frustum);
+        for (int32 i = 0; i < N; ++i) SingleVisible[i] = FrustumSIMD.IsVisible(Boxes[i]) ? 1 : 0;
+    });
+
+    // SoA 변환은 BVH 빌드 시점에 한 번 하는 비용이라 측정에서 뺀다
+    FAABBSoA SoA;
+    SoA.Reset(N);
+    for (const FAABB& Box : Boxes)
+    {
+        SoA.Add(Box);
+    }
+
+    TArray<EFrustumTestResult> BatchResults;
+    Result.BatchMS = MeasureCullMS([&]()
+    {
+        CullAABBs(FFrustumSIMD(Frustum), SoA, BatchResults, 1);
+    });
+
+    TArray<EFrustumTestResult> ParallelResults;
+    Result.ParallelMS = MeasureCullMS([&]()
+    {
+        CullAABBs(FFrustumSIMD(Frustum), SoA, ParallelResults, Result.NumThreads);
+    });
+
+    for (int32 i = 0; i < N; ++i)
+    {
+        const bool bScalar = ScalarVisible[i] != 0;
+        const bool bBatch = BatchResults[i] != EFrustumTestResult::Outside;
+        const bool bParallel = ParallelResults[i] != EFrustumTestResult::Outside;
+        Result.NumVisible += bScalar ? 1 : 0;
+        if (bScalar != (SingleVisible[i] != 0) || bScalar != bBatch || bScalar != bParallel)
+        {
+            ++Result.NumMismatches;
+        }
+    }
+
+    return Result;
+}
@@ -26,6 +26,8 @@ struct FFrustum
 };
 
 FFrustum CreateFrustumFromCamera(const UCameraComponent& Camera, float OverrideAspect = -1.0f);
+// View * Projection 행렬(row-vector, D3D 클립 공간 z ∈ [0, 1])에서 절두체 평면 추출 (섀도우 뷰 등 카메라 컴포넌트가 없는 뷰용)
+FFrustum CreateFrustumFromViewProjection(const FMatrix& ViewProjection);
 bool IsAABBVisible(const FFrustum& Frustum, const FAABB& Bound);
 bool IsAABBIntersects(const FFrustum& Frustum, const FAABB& Bound);
 
@@ -34,4 +36,108 @@ bool IsAABBIntersects(const FFrustum& Frustum, const FAABB& Bound);
 // Returns an 8-bit mask: bit i is set if box i is visible.
 uint8_t AreAABBsVisible_8_AVX(const FFrustum& Frustum, const FAABB Bounds[8]);
 
-bool Intersects(const FPlane& P, const FVector4& Center, const FVector4& Extents);
\ No newline at end of file
+bool Intersects(const FPlane& P, const FVector4& Center, const FVector4& Extents);
+
+// ------------------------------------------------------------
+// SIMD 배치 컬링
+// ------------------------------------------------------------
+
+/** 절두체 대 AABB 판정 결과 */
+enum class EFrustumTestResult : uint8
+{
+    Outside,
+    Intersecting,
+    Inside,
+};
+
+/**
+ * 평면 마스크: 비트 i가 켜져 있으면 FFrustum의 i번째 평면(Top, Bottom, Right, Left, Near, Far 순)에 대해 완전히 안쪽.
+ * 부모 노드가 어떤 평면 안쪽에 완전히 들어 있으면 자손도 그 평면은 검사할 필요가 없다.
+ */
+constexpr uint8 FRUSTUM_NO_PLANES_INSIDE = 0x00;
+constexpr uint8 FRUSTUM_ALL_PLANES_INSIDE = 0x3F;
+
+/**
+ * 평면 성분을 SoA로 전치한 절두체 (뷰마다 한 번 만들고 여러 박스 검사에 재사용)
+ * - TestAABB: 박스 하나를 평면 4개씩 동시에 검사
+ * - TestAABB4: 박스 4개를 평면마다 동시에 검사
+ */
+struct alignas(16) FFrustumSIMD
+{
+    explicit FFrustumSIMD(const FFrustum& InFrustum);
+
+    /**
+     * 박스 하나를 검사한다. ParentInsideMask에 켜진 평면은 건너뛰고, 이 박스가 완전히 안쪽인 평면을 더해 OutInsideMask로 돌려준다.
+     * 결과가 Outside면 OutInsideMask는 의미가 없다.
+     */
+    EFrustumTestResult TestAABB(const FAABB& Bound, uint8 ParentInsideMask, uint8& OutInsideMask) const;
+
+    /** 박스 하나의 가시성만 필요할 때 (IsAABBVisible과 같은 판정) */
+    bool IsVisible(const FAABB& Bound) const
+    {
+        uint8 InsideMask;
+        return TestAABB(Bound, FRUSTUM_NO_PLANES_INSIDE, InsideMask) != EFrustumTestResult::Outside;
+    }
+
+    /**
+     * 박스 4개(성분별 중심/반길이)를 검사한다. SkipPlaneMask에 켜진 평면은 네 박스 모두 안쪽으로 간주한다.
+     * OutVisibleMask: 비트 i = 박스 i가 절두체와 겹침, OutInsideMask: 비트 i = 박스 i가 완전히 안쪽
+     */
+    void TestAABB4(const __m128& CenterX, const __m128& CenterY, const __m128& CenterZ,
+        const __m128& ExtentX, const __m128& ExtentY, const __m128& ExtentZ,
+        uint8 SkipPlaneMask, int32& OutVisibleMask, int32& OutInsideMask) const;
+
+    // 평면 4개씩 전치 ([0] = 평면 0~3, [1] = 평면 4~5 + 항상 통과하는 패딩 2개)
+    __m128 PlaneNX[2], PlaneNY[2], PlaneNZ[2];
+    __m128 PlaneAbsNX[2], PlaneAbsNY[2], PlaneAbsNZ[2];
+    __m128 PlaneD[2];
+
+    // 평면별 성분을 네 칸에 복제 (박스 4개 동시 검사용)
+    __m128 SplatNX[6], SplatNY[6], SplatNZ[6];
+    __m128 SplatAbsNX[6], SplatAbsNY[6], SplatAbsNZ[6];
+    __m128 SplatD[6];
+};
+
+/**
+ * 중심/반길이를 성분별로 나눠 담은 AABB 배열
+ * 4개 단위로 읽을 수 있도록 배열 끝에 패딩을 둔다.
+ */
+struct FAABBSoA
+{
+    TArray<float> CenterX, CenterY, CenterZ;
+    TArray<float> ExtentX, ExtentY, ExtentZ;
+
+    int32 Num() const { return Count; }
+    void Reset(int32 ExpectedNum = 0);
+    void Add(const FAABB& Bound);
+
+    /** Index부터 4개를 읽는다 (Num()을 넘는 칸은 패딩) */
+    void Load4(int32 Index, __m128& OutCX, __m128& OutCY, __m128& OutCZ, __m128& OutEX, __m128& OutEY, __m128& OutEZ) const;
+
+private:
+    void Pad();
+
+    int32 Count = 0;
+};
+
+/**
+ * Bounds 전체를 절두체로 컬링해 OutResults[i]에 EFrustumTestResult를 기록한다.
+ * 박스가 많으면(MinBoxesPerThread 이상씩) 최대 MaxThreads개의 스레드로 나눠 처리한다.
+ */
+void CullAABBs(const FFrustumSIMD& Frustum, const FAABBSoA& Bounds, TArray<EFrustumTestResult>& OutResults, int32 MaxThreads = 1);
+
+/** 스칼라 IsAABBVisible 대비 배치 커널 측정 결과 (밀리초) */
+struct FFrustumCullBenchmarkResult
+{
+    int32 NumBoxes = 0;
+    int32 NumThreads = 0;
+    int32 NumVisible = 0;
+    int32 NumMismatches = 0;        // 스칼라 판정과 다른 박스 수 (0이어야 함)
+    double ScalarMS = 0.0;          // IsAABBVisible 반복
+    double SingleBoxSIMDMS = 0.0;   // FFrustumSIMD::TestAABB 반복
+    double BatchMS = 0.0;           // CullAABBs (단일 스레드)
+    double ParallelMS = 0.0;        // CullAABBs (NumThreads)
+};
+
+/** 무작위 박스 NumBoxes개로 컬링 경로를 측정한다 (콘솔 CULL BENCH) */
+FFrustumCullBenchmarkResult RunFrustumCullBenchmark(int32 NumBoxes);
\ No newline at end of file
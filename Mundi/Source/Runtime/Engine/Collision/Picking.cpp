@@ -528,14 +528,12 @@ AActor* CPickingSystem::PerformPicking(const TArray<AActor*>& Actors, ACameraAct
 
 	if (pickedIndex >= 0)
 	{
-		char buf[160];
-		sprintf_s(buf, "[Pick] Hit primitive %d at t=%.3f (Speed=NORMAL)\n", pickedIndex, pickedT);
-		UE_LOG(buf);
+		UE_LOG_CATEGORY(LogPicking, Verbose, "Hit primitive %d at t=%.3f (Speed=NORMAL)", pickedIndex, pickedT);
 		return Actors[pickedIndex];
 	}
 	else
 	{
-		UE_LOG("[Pick] No hit (Speed=FAST)\n");
+		UE_LOG_CATEGORY(LogPicking, Verbose, "No hit (Speed=FAST)");
 		return nullptr;
 	}
 }
@@ -585,14 +583,12 @@ AActor* CPickingSystem::PerformViewportPicking(const TArray<AActor*>& Actors,
 
 	if (pickedIndex >= 0)
 	{
-		char buf[160];
-		sprintf_s(buf, "[Viewport Pick] Hit primitive %d at t=%.3f\n", pickedIndex, pickedT);
-		UE_LOG(buf);
+		UE_LOG_CATEGORY(LogPicking, Verbose, "Viewport hit primitive %d at t=%.3f", pickedIndex, pickedT);
 		return Actors[pickedIndex];
 	}
 	else
 	{
-		UE_LOG("[Viewport Pick] No hit\n");
+		UE_LOG_CATEGORY(LogPicking, Verbose, "Viewport no hit");
 		return nullptr;
 	}
 }
@@ -644,17 +640,12 @@ AActor* CPickingSystem::PerformViewportPicking(const TArray<AActor*>& Actors,
 	if (PickedActor)
 	{
 		PickedIndex = 0;
-		char buf[160];
-		sprintf_s(buf, "[Pick] Hit primitive %d at t=%.3f | time=%.6lf ms\n",
-			PickedIndex, PickedT, Milliseconds);
-		UE_LOG(buf);
+		UE_LOG_CATEGORY(LogPicking, Verbose, "Hit primitive %d at t=%.3f | time=%.6lf ms", PickedIndex, PickedT, Milliseconds);
 		return PickedActor;
 	}
 	else
 	{
-		char buf[160];
-		sprintf_s(buf, "[Pick] No hit | time=%.6f ms\n", Milliseconds);
-		UE_LOG(buf);
+		UE_LOG_CATEGORY(LogPicking, Verbose, "No hit | time=%.6f ms", Milliseconds);
 		return nullptr;
 	}
 }
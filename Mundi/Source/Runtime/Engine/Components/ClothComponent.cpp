@@ -9,6 +9,7 @@
 UClothComponent::UClothComponent()
 {
 	bCanEverTick = true;
+	Mobility = EComponentMobility::Movable;
 	ClothInstance = NewObject<UClothMeshInstance>();
 	ClothInstance->Init(UClothManager::Instance->GetTestCloth());
 }
@@ -20,7 +21,13 @@ UClothComponent::~UClothComponent()
 
 void UClothComponent::BeginPlay()
 {
+	BaseSolverFrequency = ClothInstance->Cloth->getSolverFrequency();
+	CurrentLOD = EClothLOD::Full;
+	bViewedSinceLastTick = true;
+	ClosestViewDistanceSq = 0.0f;
+
 	UClothManager::Instance->RegisterCloth(ClothInstance->Cloth);
+	bClothRegistered = true;
 }
 void UClothComponent::TickComponent(float DeltaSeconds)
 {
@@ -29,7 +36,22 @@ void UClothComponent::TickComponent(float DeltaSeconds)
 
 	Super::TickComponent(DeltaSeconds);
 	ElapsedTime += DeltaSeconds;
-	ClothInstance->Sync();
+
+	// 시뮬레이션은 월드 Tick 이후 워커 스레드에서 실행되고, 결과는 CollectMeshBatches에서 버텍스 버퍼에 반영
+	UpdateClothLOD();
+
+	FClothInstanceStats InstanceStats;
+	InstanceStats.ParticleCount = static_cast<uint32_t>(ClothInstance->Cloth->getNumParticles());
+	InstanceStats.LOD = CurrentLOD;
+	InstanceStats.SolverFrequency = bClothRegistered ? ClothInstance->Cloth->getSolverFrequency() : 0.0f;
+	InstanceStats.SimulateTimeMS = UClothManager::Instance->GetClothSimulateTimeMS(ClothInstance->Cloth);
+	FClothStatManager::GetInstance().AddInstance(InstanceStats);
+
+	if (!bClothRegistered)
+	{
+		return;
+	}
+
 	ClothInstance->Cloth->setGravity(ToPxVec(GetWorldVector(FVector(0, 0, -1) * Gravity)));
 	FVector NoizeWind = Wind;
 	NoizeWind.X += InvWindFrequency.X < 0.1f ? 0 : cos(ElapsedTime / InvWindFrequency.X) * WindAmplitude.X;
@@ -59,6 +81,68 @@ void UClothComponent::TickComponent(float DeltaSeconds)
 void UClothComponent::EndPlay()
 {
 	UClothManager::Instance->UnRegisterCloth(ClothInstance->Cloth);
+	bClothRegistered = false;
+
+	if (BaseSolverFrequency > 0.0f)
+	{
+		ClothInstance->Cloth->setSolverFrequency(BaseSolverFrequency);
+	}
+	CurrentLOD = EClothLOD::Full;
+}
+
+void UClothComponent::UpdateClothLOD()
+{
+	if (!bClothRegistered && CurrentLOD != EClothLOD::Frozen)
+	{
+		// BeginPlay 전 (에디터 월드)
+		return;
+	}
+
+	EClothLOD NewLOD = EClothLOD::Full;
+	if (!bViewedSinceLastTick || ClosestViewDistanceSq > FreezeDistance * FreezeDistance)
+	{
+		NewLOD = EClothLOD::Frozen;
+	}
+	else if (ClosestViewDistanceSq > LOD2Distance * LOD2Distance)
+	{
+		NewLOD = EClothLOD::Quarter;
+	}
+	else if (ClosestViewDistanceSq > LOD1Distance * LOD1Distance)
+	{
+		NewLOD = EClothLOD::Half;
+	}
+
+	// 다음 프레임 뷰 수집을 위해 초기화
+	bViewedSinceLastTick = false;
+	ClosestViewDistanceSq = FLT_MAX;
+
+	if (NewLOD == CurrentLOD)
+	{
+		return;
+	}
+
+	Cloth* SimCloth = ClothInstance->Cloth;
+	if (NewLOD == EClothLOD::Frozen)
+	{
+		// 솔버에서 빼면 청크가 만들어지지 않아 비용이 0이 된다. 파티클 상태는 그대로 유지됨
+		UClothManager::Instance->UnRegisterCloth(SimCloth);
+		bClothRegistered = false;
+	}
+	else
+	{
+		if (CurrentLOD == EClothLOD::Frozen)
+		{
+			// 멈춰 있던 동안 움직인 액터 트랜스폼이 관성으로 튀지 않도록
+			SimCloth->clearInertia();
+			UClothManager::Instance->RegisterCloth(SimCloth);
+			bClothRegistered = true;
+		}
+
+		static const float FrequencyScale[] = { 1.0f, 0.5f, 0.25f };
+		SimCloth->setSolverFrequency(BaseSolverFrequency * FrequencyScale[static_cast<int>(NewLOD)]);
+	}
+
+	CurrentLOD = NewLOD;
 }
 void UClothComponent::DuplicateSubObjects()
 {
@@ -72,9 +156,22 @@ void UClothComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 }
 void UClothComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
 {
-	TArray<FShaderMacro> ShaderMacros = View->ViewShaderMacros;
+	// 렌더 데이터를 만들기 전에 워커 시뮬레이션과 합류하고, 시뮬레이션 프레임당 한 번만 버텍스 버퍼 갱신
+	UClothManager::Instance->WaitForSimulation();
+	const uint64 SimulationFrame = UClothManager::Instance->GetSimulationFrame();
+	if (bClothRegistered && LastSyncedSimulationFrame != SimulationFrame)
+	{
+		ClothInstance->Sync();
+		LastSyncedSimulationFrame = SimulationFrame;
+	}
+
+	// LOD 판단용 가장 가까운 뷰 거리 기록 (컬링을 통과한 뷰만 여기까지 들어옴)
+	const float ViewDistanceSq = (View->ViewLocation - GetWorldLocation()).SizeSquared();
+	ClosestViewDistanceSq = bViewedSinceLastTick ? FMath::Min(ClosestViewDistanceSq, ViewDistanceSq) : ViewDistanceSq;
+	bViewedSinceLastTick = true;
+
 	UShader* UberShader = UResourceManager::GetInstance().Load<UShader>("Shaders/Materials/UberLit.hlsl");
-	FShaderVariant* ShaderVariant = UberShader->GetOrCompileShaderVariant(ShaderMacros);
+	FShaderVariant* ShaderVariant = UberShader->GetOrCompileShaderVariant(View->ViewShaderMacros);
 
 	FMeshBatchElement BatchElement;
 	if (ShaderVariant)
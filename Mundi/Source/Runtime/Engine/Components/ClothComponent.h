@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "MeshComponent.h"
+#include "Source/Runtime/Engine/Cloth/ClothStats.h"
 #include "UClothComponent.generated.h"
 
 class UTexture;
@@ -42,6 +43,30 @@ public:
 
 	UPROPERTY(EditAnywhere, DisplayName = "Cloth", Range = "0.0, 1.0")
 	UTexture* Texture = nullptr;
+
+	// 카메라 거리 기반 LOD (가장 가까운 뷰 기준). 먼 천은 솔버 반복 횟수를 줄이고, 어느 뷰에도 보이지 않으면 시뮬레이션을 멈춘다.
+	UPROPERTY(EditAnywhere, Category = "Cloth LOD", Range = "0.0, 1000.0")
+	float LOD1Distance = 15.0f;
+
+	UPROPERTY(EditAnywhere, Category = "Cloth LOD", Range = "0.0, 1000.0")
+	float LOD2Distance = 30.0f;
+
+	UPROPERTY(EditAnywhere, Category = "Cloth LOD", Range = "0.0, 1000.0")
+	float FreezeDistance = 60.0f;
+
+	EClothLOD GetClothLOD() const { return CurrentLOD; }
+
 private:
+	/** 지난 프레임의 뷰 거리로 LOD를 정하고 솔버 주파수/등록 상태에 반영 */
+	void UpdateClothLOD();
+
 	float ElapsedTime = 0.0f;
+
+	// LOD 상태
+	EClothLOD CurrentLOD = EClothLOD::Full;
+	float BaseSolverFrequency = 0.0f;
+	bool bClothRegistered = false;             // 솔버에 등록되어 시뮬레이션 중인지 (멈춘 천은 제거됨)
+	bool bViewedSinceLastTick = true;          // 첫 프레임은 보인 것으로 간주
+	float ClosestViewDistanceSq = 0.0f;
+	uint64 LastSyncedSimulationFrame = 0;
 };
\ No newline at end of file
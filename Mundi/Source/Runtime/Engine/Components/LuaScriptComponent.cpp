@@ -56,6 +56,11 @@ void ULuaScriptComponent::BeginPlay()
 		sol::coroutine Coroutine(ThreadState.lua_state(), f);                // 스레드에 함수 올리기
 		return LuaVM->GetScheduler().Register(std::move(Thread), std::move(Coroutine), this);
 	};
+
+	// coroutine.yield("wait_event", Name)으로 기다리는 코루틴 재개
+	Env["TriggerEvent"] = [LuaVM](const FString& EventName) {
+		LuaVM->GetScheduler().TriggerEvent(EventName);
+	};
 	
 	if(ScriptFilePath.empty())
 	{
@@ -78,6 +83,14 @@ void ULuaScriptComponent::BeginPlay()
 	FuncOnBeginOverlap = FLuaManager::GetFunc(Env, "OnBeginOverlap");
 	FuncOnEndOverlap = FLuaManager::GetFunc(Env, "OnEndOverlap");
 	FuncEndPlay		  =	FLuaManager::GetFunc(Env, "EndPlay");
+
+	// Tick은 매니저가 일괄 호출 (스크립트 전역 TickInterval / TickEveryNFrames가 있으면 우선)
+	if (FuncTick.valid())
+	{
+		const float Interval = Env["TickInterval"].get_or<float>(TickInterval);
+		const int32 EveryNFrames = Env["TickEveryNFrames"].get_or<int32>(TickEveryNFrames);
+		TickHandle = LuaVM->GetTickManager().Register(ScriptFilePath, FuncTick, Interval, EveryNFrames);
+	}
 	
 	if (FuncBeginPlay.valid()) {
 		auto Result = FuncBeginPlay();
@@ -177,9 +190,10 @@ void ULuaScriptComponent::OnHit(UPrimitiveComponent* MyComp, UPrimitiveComponent
 
 void ULuaScriptComponent::TickComponent(float DeltaTime)
 {
-	if (FuncTick.valid()) {
-		auto Result = FuncTick(DeltaTime);
-		if (!Result.valid()) { sol::error Err = Result; UE_LOG("[Lua][error] %s\n", Err.what()); }
+	// Lua 호출은 FLuaManager::Tick에서 일괄 처리, 여기서는 간격 누적만 한다
+	if (TickHandle.IsValid())
+	{
+		GetWorld()->GetLuaManager()->GetTickManager().QueueTick(TickHandle, DeltaTime);
 	}
 }
 
@@ -224,8 +238,12 @@ void ULuaScriptComponent::CleanupLuaResources()
 		{
 			// 1. 코루틴 정리 (가장 중요. Use-After-Free 방지)
 			LuaVM->GetScheduler().CancelByOwner(this);
+
+			// 틱 디스패치 대상에서 제거
+			LuaVM->GetTickManager().Unregister(TickHandle);
 		}
 	}
+	TickHandle = FLuaTickHandle();
 
 	// 2. Lua 참조 해제
 	FuncBeginPlay = sol::nil;
@@ -3,6 +3,7 @@
 #include "ActorComponent.h"
 #include "Vector.h"
 #include "LuaCoroutineScheduler.h"
+#include "LuaTickManager.h"
 #include "ULuaScriptComponent.generated.h"
 
 namespace sol { class state; }
@@ -26,6 +27,13 @@ public:
 
 	UPROPERTY(EditAnywhere, Category="Script", Tooltip="Lua Script 파일 경로입니다")
 	FString ScriptFilePath{};
+
+	UPROPERTY(EditAnywhere, Category="Script", Range="0.0, 10.0", Tooltip="스크립트 Tick 간격(초)입니다. 0이면 매 프레임 호출합니다. 스크립트 전역 TickInterval이 있으면 그 값을 사용합니다.")
+	float TickInterval = 0.0f;
+
+	UPROPERTY(EditAnywhere, Category="Script", Range="1, 60", Tooltip="N 프레임마다 스크립트 Tick을 호출합니다. 스크립트 전역 TickEveryNFrames가 있으면 그 값을 사용합니다.")
+	int32 TickEveryNFrames = 1;
+
 	void BeginPlay() override;
 	void TickComponent(float DeltaTime) override;       // 매 프레임
 	void EndPlay() override;							// 파괴/월드 제거 시
@@ -51,6 +59,9 @@ protected:
 	sol::protected_function FuncOnHit{};
 	sol::protected_function FuncEndPlay{};
 
+	/* 틱은 FLuaTickManager가 일괄 디스패치 */
+	FLuaTickHandle TickHandle{};
+
 	FDelegateHandle BeginHandleLua{};
 	FDelegateHandle EndHandleLua{};
 	
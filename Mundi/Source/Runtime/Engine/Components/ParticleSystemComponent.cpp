@@ -80,10 +80,16 @@ UParticleSystemComponent::UParticleSystemComponent()
 	bAutoActivate = true;
 	bCanEverTick = true;   // Tick 활성화
 	bTickInEditor = true;  // 에디터에서도 파티클 미리보기 가능
+	Mobility = EComponentMobility::Movable;
 }
 
 UParticleSystemComponent::~UParticleSystemComponent()
 {
+	if (SignificanceState.Manager)
+	{
+		SignificanceState.Manager->UnregisterComponent(this);
+	}
+
 	// OnUnregister에서 이미 정리되었으므로, 안전 체크만 수행
 	// (만약 OnUnregister가 호출되지 않은 경우를 대비)
 	if (EmitterInstances.Num() > 0)
@@ -112,44 +118,6 @@ UParticleSystemComponent::~UParticleSystemComponent()
 		EmitterRenderData.Empty();
 	}
 
-	// 스프라이트 인스턴스 버퍼 해제
-	if (SpriteInstanceBuffer)
-	{
-		SpriteInstanceBuffer->Release();
-		SpriteInstanceBuffer = nullptr;
-	}
-
-	// 메시 인스턴스 버퍼 해제
-	if (MeshInstanceBuffer)
-	{
-		MeshInstanceBuffer->Release();
-		MeshInstanceBuffer = nullptr;
-	}
-
-	// 빔 버퍼 해제
-	if (BeamVertexBuffer)
-	{
-		BeamVertexBuffer->Release();
-		BeamVertexBuffer = nullptr;
-	}
-	if (BeamIndexBuffer)
-	{
-		BeamIndexBuffer->Release();
-		BeamIndexBuffer = nullptr;
-	}
-
-	// 리본 버퍼 해제
-	if (RibbonVertexBuffer)
-	{
-		RibbonVertexBuffer->Release();
-		RibbonVertexBuffer = nullptr;
-	}
-	if (RibbonIndexBuffer)
-	{
-		RibbonIndexBuffer->Release();
-		RibbonIndexBuffer = nullptr;
-	}
-
 	// 캐싱된 파티클용 Material 정리
 	ClearCachedMaterials();
 
@@ -194,6 +162,12 @@ void UParticleSystemComponent::OnRegister(UWorld* InWorld)
 {
 	Super::OnRegister(InWorld);
 
+	// 월드의 중요도/예산 관리 대상으로 등록 (중복 등록은 무시됨)
+	if (InWorld && InWorld->GetParticleSignificanceManager())
+	{
+		InWorld->GetParticleSignificanceManager()->RegisterComponent(this);
+	}
+
 	// 이미 초기화되어 있으면 스킵 (OnRegister는 여러 번 호출될 수 있음)
 	if (EmitterInstances.Num() > 0)
 	{
@@ -553,6 +527,11 @@ void UParticleSystemComponent::CreateDebugRibbonParticleSystem()
 
 void UParticleSystemComponent::OnUnregister()
 {
+	if (SignificanceState.Manager)
+	{
+		SignificanceState.Manager->UnregisterComponent(this);
+	}
+
 	// 이미터 인스턴스 정리
 	DeactivateSystem();
 
@@ -567,51 +546,6 @@ void UParticleSystemComponent::OnUnregister()
 	}
 	EmitterRenderData.Empty();
 
-	// 인스턴스 버퍼 정리
-	if (SpriteInstanceBuffer)
-	{
-		SpriteInstanceBuffer->Release();
-		SpriteInstanceBuffer = nullptr;
-	}
-	AllocatedSpriteInstanceCount = 0;
-
-	if (MeshInstanceBuffer)
-	{
-		MeshInstanceBuffer->Release();
-		MeshInstanceBuffer = nullptr;
-	}
-	AllocatedMeshInstanceCount = 0;
-
-	// 다이나믹 버퍼 정리
-	if (BeamVertexBuffer)
-	{
-		BeamVertexBuffer->Release();
-		BeamVertexBuffer = nullptr;
-	}
-	AllocatedBeamVertexCount = 0;
-
-	if (BeamIndexBuffer)
-	{
-		BeamIndexBuffer->Release();
-		BeamIndexBuffer = nullptr;
-	}
-	AllocatedBeamIndexCount = 0;
-
-	// 리본 버퍼 정리
-	if (RibbonVertexBuffer)
-	{
-		RibbonVertexBuffer->Release();
-		RibbonVertexBuffer = nullptr;
-	}
-	AllocatedRibbonVertexCount = 0;
-
-	if (RibbonIndexBuffer)
-	{
-		RibbonIndexBuffer->Release();
-		RibbonIndexBuffer = nullptr;
-	}
-	AllocatedRibbonIndexCount = 0;
-
 	// 캐싱된 파티클용 Material 정리
 	ClearCachedMaterials();
 
@@ -668,23 +602,44 @@ void UParticleSystemComponent::TickComponent(float DeltaTime)
 	const float MaxDeltaTime = 0.1f;
 	DeltaTime = FMath::Min(DeltaTime, MaxDeltaTime);
 
-	// 시뮬레이션 속도 적용 (에디터 타임스케일)
-	DeltaTime *= CustomTimeScale;
+	// 중요도에 따라 이번 프레임을 건너뛸 수 있음 (건너뛴 시간은 누적되어 다음 시뮬레이션에서 따라잡는다)
+	FParticleSignificanceManager* Significance = SignificanceState.Manager;
+	float SimulationTime = DeltaTime;
+	if (Significance && !Significance->ConsumeSimulationTime(SignificanceState, DeltaTime, SimulationTime))
+	{
+		// 렌더 데이터는 마지막 시뮬레이션 결과를 그대로 유지
+		return;
+	}
 
 	// 이벤트 클리어 (매 프레임 시작 시)
 	ClearEvents();
 
-	// 모든 이미터 인스턴스 틱
-	for (FParticleEmitterInstance* Instance : EmitterInstances)
+	// 누적 시간은 MaxDeltaTime 단위로 나눠 틱 (큰 DeltaTime 한 번으로 적분하면 궤적이 틀어짐)
+	const int32 NumSteps = FMath::Max(1, static_cast<int32>(std::ceil(SimulationTime / MaxDeltaTime - KINDA_SMALL_NUMBER)));
+	const float StepTime = SimulationTime / static_cast<float>(NumSteps);
+
+	// 시뮬레이션 속도 적용 (에디터 타임스케일)
+	const float ScaledStepTime = StepTime * CustomTimeScale;
+
+	// 모든 이미터 인스턴스 틱 (예산 초과 시 스폰만 막고 기존 파티클은 계속 진행)
+	for (int32 Step = 0; Step < NumSteps; ++Step)
 	{
-		if (Instance)
+		for (FParticleEmitterInstance* Instance : EmitterInstances)
 		{
-			Instance->Tick(DeltaTime, false);
+			if (Instance)
+			{
+				Instance->Tick(ScaledStepTime, SignificanceState.bSuppressSpawning);
+			}
 		}
 	}
+	if (Significance)
+	{
+		Significance->RecordCatchUpSteps(static_cast<uint32>(NumSteps - 1));
+	}
 
 	// 렌더 데이터 업데이트
 	UpdateRenderData();
+	UpdateParticleBounds();
 
 	// 내부 이벤트 디스패치 (같은 PSC 내의 다른 이미터들에게 이벤트 전달)
 	DispatchEventsToReceivers();
@@ -840,6 +795,60 @@ void UParticleSystemComponent::ResetParticles()
 	}
 }
 
+void UParticleSystemComponent::RewindSystem()
+{
+	if (EmitterInstances.Num() == 0)
+	{
+		ActivateSystem();
+	}
+	else
+	{
+		for (FParticleEmitterInstance* Instance : EmitterInstances)
+		{
+			if (Instance)
+			{
+				Instance->Rewind();
+			}
+		}
+	}
+
+	// 이전 재생의 렌더 데이터/이벤트/바운드 정리
+	for (int32 i = 0; i < EmitterRenderData.Num(); i++)
+	{
+		if (EmitterRenderData[i])
+		{
+			delete EmitterRenderData[i];
+			EmitterRenderData[i] = nullptr;
+		}
+	}
+	EmitterRenderData.Empty();
+	ClearEvents();
+	ParticleBounds = FAABB();
+
+	// 숨겨져 있던 동안 쌓인 시간은 버리고, 다음 판정 전까지 화면 안 시스템으로 취급
+	SignificanceState.PendingTime = 0.0f;
+	SignificanceState.FramesSinceSimulation = 0;
+	SignificanceState.TickInterval = 1;
+	SignificanceState.LastRenderFrame = SignificanceState.Manager ? SignificanceState.Manager->GetFrameCounter() : 0;
+}
+
+bool UParticleSystemComponent::IsSystemComplete() const
+{
+	if (EmitterInstances.Num() == 0)
+	{
+		return true;
+	}
+
+	for (const FParticleEmitterInstance* Instance : EmitterInstances)
+	{
+		if (Instance && !Instance->IsComplete())
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
 void UParticleSystemComponent::SetTemplate(UParticleSystem* NewTemplate)
 {
 	if (Template != NewTemplate)
@@ -949,23 +958,6 @@ void UParticleSystemComponent::RefreshEmitterInstances()
 	ClearEmitterInstances();
 	ClearCachedMaterials();  // Material 캐시도 클리어 (텍스처 변경 반영)
 
-	// 인스턴스 버퍼도 클리어 (TypeData 변경 시 stride 불일치 방지)
-	// 스프라이트 -> 메시 전환 시, 이전 프레임의 스프라이트 버퍼(48바이트 stride)가
-	// 메시 셰이더의 Input Layout(68바이트 기대)과 불일치하는 것을 방지
-	if (SpriteInstanceBuffer)
-	{
-		SpriteInstanceBuffer->Release();
-		SpriteInstanceBuffer = nullptr;
-	}
-	AllocatedSpriteInstanceCount = 0;
-
-	if (MeshInstanceBuffer)
-	{
-		MeshInstanceBuffer->Release();
-		MeshInstanceBuffer = nullptr;
-	}
-	AllocatedMeshInstanceCount = 0;
-
 	InitializeEmitterInstances();
 
 	// EmitterRenderData도 즉시 갱신 (이전 프레임의 오래된 데이터 사용 방지)
@@ -1071,6 +1063,69 @@ void UParticleSystemComponent::UpdateRenderData()
 	}
 }
 
+void UParticleSystemComponent::UpdateParticleBounds()
+{
+	// 빔/리본은 파티클 위치만으로 지오메트리 범위를 알 수 없으므로 바운드를 비워 컬링 대상에서 제외
+	FVector BoundsMin(FLT_MAX, FLT_MAX, FLT_MAX);
+	FVector BoundsMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+	bool bHasParticles = false;
+
+	for (FParticleEmitterInstance* Instance : EmitterInstances)
+	{
+		if (!Instance || !Instance->CurrentLODLevel || Instance->ActiveParticles <= 0)
+		{
+			continue;
+		}
+
+		UParticleModuleTypeDataBase* TypeData = Instance->CurrentLODLevel->TypeDataModule;
+		if (Cast<UParticleModuleTypeDataBeam>(TypeData) || Cast<UParticleModuleTypeDataRibbon>(TypeData))
+		{
+			ParticleBounds = FAABB();
+			return;
+		}
+
+		// 메시 파티클은 Size가 스케일이므로 메시 로컬 바운드의 최대 반경을 곱한다 (회전 고려)
+		float ExtentScale = 0.5f;
+		if (UParticleModuleTypeDataMesh* MeshTypeData = Cast<UParticleModuleTypeDataMesh>(TypeData))
+		{
+			if (MeshTypeData->Mesh)
+			{
+				const FAABB LocalBound = MeshTypeData->Mesh->GetLocalBound();
+				const FVector FarCorner(
+					FMath::Max(std::fabs(LocalBound.Min.X), std::fabs(LocalBound.Max.X)),
+					FMath::Max(std::fabs(LocalBound.Min.Y), std::fabs(LocalBound.Max.Y)),
+					FMath::Max(std::fabs(LocalBound.Min.Z), std::fabs(LocalBound.Max.Z)));
+				ExtentScale = FarCorner.Size();
+			}
+		}
+
+		for (int32 i = 0; i < Instance->ActiveParticles; i++)
+		{
+			const FBaseParticle* Particle = Instance->GetParticleAtIndex(i);
+			if (!Particle)
+			{
+				continue;
+			}
+
+			const float Extent = FMath::Max(FMath::Max(std::fabs(Particle->Size.X), std::fabs(Particle->Size.Y)), std::fabs(Particle->Size.Z)) * ExtentScale;
+			BoundsMin.X = FMath::Min(BoundsMin.X, Particle->Location.X - Extent);
+			BoundsMin.Y = FMath::Min(BoundsMin.Y, Particle->Location.Y - Extent);
+			BoundsMin.Z = FMath::Min(BoundsMin.Z, Particle->Location.Z - Extent);
+			BoundsMax.X = FMath::Max(BoundsMax.X, Particle->Location.X + Extent);
+			BoundsMax.Y = FMath::Max(BoundsMax.Y, Particle->Location.Y + Extent);
+			BoundsMax.Z = FMath::Max(BoundsMax.Z, Particle->Location.Z + Extent);
+			bHasParticles = true;
+		}
+	}
+
+	ParticleBounds = bHasParticles ? FAABB(BoundsMin, BoundsMax) : FAABB();
+}
+
+FAABB UParticleSystemComponent::GetWorldAABB() const
+{
+	return ParticleBounds;
+}
+
 // 언리얼 엔진 호환: 인스턴스 파라미터 시스템 구현
 void UParticleSystemComponent::SetFloatParameter(const FString& ParameterName, float Value)
 {
@@ -1184,23 +1239,17 @@ void UParticleSystemComponent::DuplicateSubObjects()
 	EmitterInstances.Empty();
 	EmitterRenderData.Empty();
 
-	// 인스턴스 버퍼도 원본 소유이므로 nullptr로 초기화
-	MeshInstanceBuffer = nullptr;
-	AllocatedMeshInstanceCount = 0;
-	SpriteInstanceBuffer = nullptr;
-	AllocatedSpriteInstanceCount = 0;
+	// 중요도 상태는 복사본이 등록될 때 새로 시작
+	SignificanceState = FParticleSignificanceState();
+	ParticleBounds = FAABB();
 
-	// 빔 버퍼도 원본 소유이므로 nullptr로 초기화
-	BeamVertexBuffer = nullptr;
-	BeamIndexBuffer = nullptr;
-	AllocatedBeamVertexCount = 0;
-	AllocatedBeamIndexCount = 0;
-
-	// 리본 버퍼도 원본 소유이므로 nullptr로 초기화
-	RibbonVertexBuffer = nullptr;
-	RibbonIndexBuffer = nullptr;
-	AllocatedRibbonVertexCount = 0;
-	AllocatedRibbonIndexCount = 0;
+	// 동적 버퍼 구간은 공유 할당기 소유이므로 비움 (매 패스 다시 할당)
+	SpriteInstanceRange = {};
+	MeshInstanceRange = {};
+	BeamVertexRange = {};
+	BeamIndexRange = {};
+	RibbonVertexRange = {};
+	RibbonIndexRange = {};
 
 	// 테스트용 리소스 포인터 초기화 (원본 소유, 복사본에서 삭제하면 안됨)
 	TestTemplate = nullptr;
@@ -1218,8 +1267,27 @@ void UParticleSystemComponent::CollectMeshBatches(TArray<FMeshBatchElement>& Out
 		UpdateLODLevels(View->ViewLocation);
 	}
 
+	// 이전 패스의 구간은 링 버퍼에서 이미 지나갔으므로 비운다
+	SpriteInstanceRange = {};
+	MeshInstanceRange = {};
+	BeamVertexRange = {};
+	BeamIndexRange = {};
+	RibbonVertexRange = {};
+	RibbonIndexRange = {};
+
 	// 1. 유효성 검사
-	if (!IsVisible() || EmitterRenderData.Num() == 0)
+	if (!IsVisible())
+	{
+		return;
+	}
+
+	// 뷰에 들어온 프레임 기록 (다음 프레임 중요도 판정에서 화면 밖 여부로 사용, 아직 파티클이 없어도 기록)
+	if (SignificanceState.Manager)
+	{
+		SignificanceState.LastRenderFrame = SignificanceState.Manager->GetFrameCounter();
+	}
+
+	if (EmitterRenderData.Num() == 0)
 	{
 		return;
 	}
@@ -1328,76 +1396,17 @@ void UParticleSystemComponent::CollectMeshBatches(TArray<FMeshBatchElement>& Out
 	}
 }
 
-void UParticleSystemComponent::FillMeshInstanceBuffer(uint32 TotalInstances)
+namespace
 {
-	if (TotalInstances == 0)
-	{
-		return;
-	}
-
-	ID3D11Device* Device = GEngine.GetRHIDevice()->GetDevice();
-	ID3D11DeviceContext* Context = GEngine.GetRHIDevice()->GetDeviceContext();
-
-	// 인스턴스 버퍼 생성/리사이즈
-	if (TotalInstances > AllocatedMeshInstanceCount)
-	{
-		if (MeshInstanceBuffer)
-		{
-			MeshInstanceBuffer->Release();
-			MeshInstanceBuffer = nullptr;
-		}
-
-		uint32 NewCount = FMath::Max(TotalInstances * 2, 64u);
-		D3D11_BUFFER_DESC Desc = {};
-		Desc.ByteWidth = NewCount * sizeof(FMeshParticleInstanceVertex);
-		Desc.Usage = D3D11_USAGE_DYNAMIC;
-		Desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-		Desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-
-		if (SUCCEEDED(Device->CreateBuffer(&Desc, nullptr, &MeshInstanceBuffer)))
-		{
-			AllocatedMeshInstanceCount = NewCount;
-		}
-	}
-
-	if (!MeshInstanceBuffer)
-	{
-		return;
-	}
-
-	// 버퍼 매핑
-	D3D11_MAPPED_SUBRESOURCE MappedData;
-	if (FAILED(Context->Map(MeshInstanceBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MappedData)))
-	{
-		return;
-	}
-
-	FMeshParticleInstanceVertex* Instances = static_cast<FMeshParticleInstanceVertex*>(MappedData.pData);
-	uint32 InstanceOffset = 0;
-
-	// 메시 이미터 순회
-	for (FDynamicEmitterDataBase* EmitterData : EmitterRenderData)
+	// 이미터 하나의 파티클을 메시 인스턴스로 기록 (FParticleDynamicBufferAllocator 채우기 작업에서 병렬 실행)
+	void WriteMeshParticleInstances(const FDynamicMeshEmitterReplayDataBase& MeshSource, FMeshParticleInstanceVertex* Instances)
 	{
-		if (!EmitterData)
-			continue;
-
-		const FDynamicEmitterReplayDataBase& Source = EmitterData->GetSource();
-		if (Source.eEmitterType != EDynamicEmitterType::Mesh)
-			continue;
-
-		// 메시 이미터로 캐스팅하여 MeshRotationPayloadOffset 접근
-		const FDynamicMeshEmitterReplayDataBase& MeshSource =
-			static_cast<const FDynamicMeshEmitterReplayDataBase&>(Source);
-
-		const int32 ParticleCount = Source.ActiveParticleCount;
-		const int32 ParticleStride = Source.ParticleStride;
-		const uint8* ParticleData = Source.DataContainer.ParticleData;
-		const uint16* ParticleIndices = Source.DataContainer.ParticleIndices;
+		const int32 ParticleCount = MeshSource.ActiveParticleCount;
+		const int32 ParticleStride = MeshSource.ParticleStride;
+		const uint8* ParticleData = MeshSource.DataContainer.ParticleData;
+		const uint16* ParticleIndices = MeshSource.DataContainer.ParticleIndices;
 		const int32 MeshRotationOffset = MeshSource.MeshRotationPayloadOffset;
 
-		if (!ParticleData || ParticleCount == 0)
-			continue;
-
 		// 각 파티클의 인스턴스 데이터 생성
 		for (int32 ParticleIdx = 0; ParticleIdx < ParticleCount; ParticleIdx++)
 		{
@@ -1405,9 +1414,8 @@ void UParticleSystemComponent::FillMeshInstanceBuffer(uint32 TotalInstances)
 			const uint8* ParticleBase = ParticleData + ParticleIndex * ParticleStride;
 			const FBaseParticle* Particle = reinterpret_cast<const FBaseParticle*>(ParticleBase);
 
-			FMeshParticleInstanceVertex& Instance = Instances[InstanceOffset];
+			FMeshParticleInstanceVertex& Instance = Instances[ParticleIdx];
 
-			// 컴포넌트 트랜스폼 적용
 			FVector WorldPos = Particle->Location;
 			FVector Scale = Particle->Size;
 
@@ -1421,15 +1429,7 @@ void UParticleSystemComponent::FillMeshInstanceBuffer(uint32 TotalInstances)
 				Rotation = RotPayload->Rotation;
 			}
 
-			// TODO(human): 3D 회전을 포함한 Transform 행렬 계산
-			// Scale, Rotation(Pitch/Yaw/Roll), WorldPos를 사용하여 3x4 변환 행렬을 계산합니다.
-			// 힌트:
-			// 1. 각 축별 회전 행렬: Rx(Pitch), Ry(Yaw), Rz(Roll)
-			// 2. 최종 회전 = Rz * Ry * Rx (Roll -> Yaw -> Pitch 순서)
-			// 3. Transform = Scale * Rotation * Translation
-			// 4. 행렬은 전치하여 저장 (셰이더에서 row_major 사용)
-
-			// 기본 구현: Scale + Translation (회전 없음)
+			// Transform = Scale * Rotation(Roll -> Yaw -> Pitch) * Translation, 전치하여 저장 (셰이더에서 row_major 사용)
 			float RadToDeg = 180.0f / 3.141592f;
 
 			FMatrix FinalMatrix = FMatrix::FromTRS(
@@ -1445,89 +1445,323 @@ void UParticleSystemComponent::FillMeshInstanceBuffer(uint32 TotalInstances)
 
 			// RelativeTime
 			Instance.RelativeTime = Particle->RelativeTime;
-
-			InstanceOffset++;
 		}
 	}
 
-	Context->Unmap(MeshInstanceBuffer, 0);
-}
-
-void UParticleSystemComponent::CreateMeshParticleBatch(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
-{
-	if (!MeshInstanceBuffer)
-	{
-		return;
-	}
-
-	// 파티클 메시 전용 인스턴싱 셰이더 로드 (한 번만)
-	static UShader* ParticleMeshShader = UResourceManager::GetInstance().Load<UShader>("Shaders/Particle/ParticleMesh.hlsl");
-	if (!ParticleMeshShader)
-	{
-		return;
-	}
-
-	// 인스턴스 버퍼 내 현재 오프셋 (각 이미터별로 증가)
-	uint32 InstanceOffset = 0;
-
-	// 각 메시 이미터별로 별도의 배치 생성
-	for (FDynamicEmitterDataBase* EmitterData : EmitterRenderData)
+	// 이미터 하나의 파티클을 스프라이트 인스턴스로 기록
+	void WriteSpriteParticleInstances(const FDynamicSpriteEmitterReplayDataBase& SpriteSource, FSpriteParticleInstanceVertex* Instances)
 	{
-		if (!EmitterData)
-			continue;
-
-		const FDynamicEmitterReplayDataBase& Source = EmitterData->GetSource();
-		if (Source.eEmitterType != EDynamicEmitterType::Mesh)
-			continue;
+		const int32 ParticleCount = SpriteSource.ActiveParticleCount;
+		const int32 ParticleStride = SpriteSource.ParticleStride;
+		const uint8* ParticleData = SpriteSource.DataContainer.ParticleData;
+		const uint16* ParticleIndices = SpriteSource.DataContainer.ParticleIndices;
 
-		const auto& MeshSource = static_cast<const FDynamicMeshEmitterReplayDataBase&>(Source);
-		UStaticMesh* Mesh = MeshSource.MeshData;
-		UMaterialInterface* Material = MeshSource.MaterialInterface;
-		bool bOverrideMaterial = MeshSource.bOverrideMaterial;
-		int32 EmitterInstanceCount = Source.ActiveParticleCount;
+		// Sub-UV 설정 가져오기
+		int32 SubImages_H = 1;
+		int32 SubImages_V = 1;
+		int32 TotalFrames = 1;
 
-		if (!Mesh || EmitterInstanceCount == 0)
+		if (SpriteSource.RequiredModule)
 		{
-			continue;
+			SubImages_H = SpriteSource.RequiredModule->SubImages_Horizontal;
+			SubImages_V = SpriteSource.RequiredModule->SubImages_Vertical;
+			int32 MaxElements = SpriteSource.RequiredModule->SubUV_MaxElements;
+			TotalFrames = (MaxElements > 0) ? MaxElements : (SubImages_H * SubImages_V);
 		}
 
-		// 메시의 섹션(GroupInfo) 정보 가져오기
-		const TArray<FGroupInfo>& MeshGroupInfos = Mesh->GetMeshGroupInfo();
-		const bool bHasSections = !MeshGroupInfos.IsEmpty();
-		const uint32 NumSectionsToProcess = bHasSections ? static_cast<uint32>(MeshGroupInfos.size()) : 1;
-
-		// Lambda: 섹션별 소스 Material 가져오기
-		// bOverrideMaterial이 true면 RequiredModule->Material 사용, false면 메시의 섹션별 Material 사용
-		auto GetSourceMaterial = [&](uint32 SectionIndex) -> UMaterialInterface*
+		// 각 파티클의 인스턴스 데이터 생성
+		for (int32 ParticleIdx = 0; ParticleIdx < ParticleCount; ParticleIdx++)
 		{
-			if (bOverrideMaterial && Material != nullptr)
-			{
-				return Material;
-			}
+			const int32 ParticleIndex = ParticleIndices ? ParticleIndices[ParticleIdx] : ParticleIdx;
+			const FBaseParticle* Particle = reinterpret_cast<const FBaseParticle*>(
+				ParticleData + ParticleIndex * ParticleStride
+			);
 
-			if (bHasSections && SectionIndex < MeshGroupInfos.size())
-			{
-				const FGroupInfo& Group = MeshGroupInfos[SectionIndex];
-				if (!Group.InitialMaterialName.empty())
-				{
-					UMaterialInterface* MeshMaterial = UResourceManager::GetInstance().Get<UMaterial>(Group.InitialMaterialName);
-					if (MeshMaterial)
-					{
-						return MeshMaterial;
-					}
-				}
-			}
+			FSpriteParticleInstanceVertex& Instance = Instances[ParticleIdx];
 
-			return UResourceManager::GetInstance().GetDefaultMaterial();
-		};
+			// 월드 위치
+			Instance.WorldPosition =  Particle->Location;
 
-		// 각 섹션마다 별도의 배치 생성
-		for (uint32 SectionIndex = 0; SectionIndex < NumSectionsToProcess; ++SectionIndex)
-		{
-			uint32 IndexCount = 0;
-			uint32 StartIndex = 0;
+			// 회전 (Z축만)
+			Instance.Rotation = Particle->Rotation;
 
-			if (bHasSections)
+			// 크기 (XY만)
+			Instance.Size = FVector2D(Particle->Size.X, Particle->Size.Y);
+
+			// 색상
+			Instance.Color = Particle->Color;
+
+			// RelativeTime
+			Instance.RelativeTime = Particle->RelativeTime;
+
+			// Sub-UV 프레임 인덱스 계산
+			// RelativeTime (0~1)을 프레임 인덱스 (0~TotalFrames-1)로 변환
+			Instance.SubImageIndex = Particle->RelativeTime * (float)(TotalFrames - 1);
+		}
+	}
+
+	// 빔 하나의 정점/인덱스 기록 (인덱스는 이미터 정점 구간 기준, BaseVertexIndex로 오프셋)
+	void WriteBeamGeometry(const FDynamicBeamEmitterReplayDataBase& BeamSource, const FVector& ViewDirection,
+		FParticleBeamVertex* Vertices, uint32* Indices)
+	{
+		const TArray<FVector>& BeamPoints = BeamSource.BeamPoints;
+		const float BeamWidth = BeamSource.Width;
+		const FLinearColor BeamColor = BeamSource.Color;
+
+		uint32 VertexOffset = 0;
+		uint32 IndexOffset = 0;
+
+		// 1. 모든 정점을 먼저 생성 (Triangle Strip 방식)
+		for (int32 i = 0; i < BeamPoints.Num(); ++i)
+		{
+			const FVector& P = BeamPoints[i];
+			FVector SegmentDir = (i < BeamPoints.Num() - 1) ? (BeamPoints[i + 1] - P) : (P - BeamPoints[i - 1]);
+			SegmentDir.Normalize();
+
+			FVector Up = FVector::Cross(SegmentDir, ViewDirection);
+			Up.Normalize();
+
+			float HalfWidth = BeamWidth * 0.5f;
+
+			// UV의 V좌표는 빔의 길이에 따라 0에서 1까지 변함
+			float V = (float)i / (float)(BeamPoints.Num() - 1);
+
+			// 각 포인트마다 2개의 정점(좌, 우) 생성
+			Vertices[VertexOffset++] = { P - Up * HalfWidth, FVector2D(0.0f, V), BeamColor, BeamWidth };
+			Vertices[VertexOffset++] = { P + Up * HalfWidth, FVector2D(1.0f, V), BeamColor, BeamWidth };
+		}
+
+		// 2. 정점들을 연결하여 인덱스 생성
+		for (int32 i = 0; i < BeamPoints.Num() - 1; ++i)
+		{
+			uint32 V0 = i * 2;           // 현재 세그먼트의 좌측 정점
+			uint32 V1 = i * 2 + 1;       // 현재 세그먼트의 우측 정점
+			uint32 V2 = (i + 1) * 2;     // 다음 세그먼트의 좌측 정점
+			uint32 V3 = (i + 1) * 2 + 1; // 다음 세그먼트의 우측 정점
+
+			// 첫 번째 삼각형 (V0, V2, V1)
+			Indices[IndexOffset++] = V0;
+			Indices[IndexOffset++] = V2;
+			Indices[IndexOffset++] = V1;
+
+			// 두 번째 삼각형 (V1, V2, V3)
+			Indices[IndexOffset++] = V1;
+			Indices[IndexOffset++] = V2;
+			Indices[IndexOffset++] = V3;
+		}
+	}
+
+	// 리본 하나의 정점/인덱스 기록 (인덱스는 이미터 정점 구간 기준, BaseVertexIndex로 오프셋)
+	void WriteRibbonGeometry(const FDynamicRibbonEmitterReplayDataBase& RibbonSource, const FVector& ViewDirection,
+		FParticleRibbonVertex* Vertices, uint32* Indices)
+	{
+		const TArray<FVector>& RibbonPoints = RibbonSource.RibbonPoints;
+		const TArray<FLinearColor>& RibbonColors = RibbonSource.RibbonColors;
+		const float RibbonWidth = RibbonSource.Width;
+		const int32 NumPoints = RibbonPoints.Num();
+
+		uint32 VertexOffset = 0;
+		uint32 IndexOffset = 0;
+
+		// 1. 모든 정점을 먼저 생성 (Triangle Strip 방식)
+		for (int32 i = 0; i < NumPoints; ++i)
+		{
+			const FVector& P = RibbonPoints[i];
+			const FLinearColor& Color = RibbonColors[i];  // 파티클 색상 (페이드 아웃 포함)
+
+			FVector SegmentDir;
+			if (i < NumPoints - 1)
+			{
+				SegmentDir = RibbonPoints[i + 1] - P;
+			}
+			else
+			{
+				SegmentDir = P - RibbonPoints[i - 1];
+			}
+			SegmentDir.Normalize();
+
+			FVector Up = FVector::Cross(SegmentDir, ViewDirection);
+			Up.Normalize();
+
+			// UV의 V좌표는 리본의 길이에 따라 0에서 1까지 변함
+			float V = (float)i / (float)(NumPoints - 1);
+
+			// 테이퍼링: 끝으로 갈수록 너비 감소 (뾰족한 끝 방지)
+			// V=0 (오래된 파티클, 트레일 끝) → 너비 0
+			// V=1 (새로운 파티클, 트레일 시작) → 너비 100%
+			float WidthScale = V;  // 선형 테이퍼링 (V*V or sqrt(V))
+			float HalfWidth = (RibbonWidth * 0.5f) * WidthScale;
+
+			// 각 포인트마다 2개의 정점(좌, 우) 생성
+			Vertices[VertexOffset++] = {
+				P - Up * HalfWidth,		// Position
+				P,						// ControlPoint
+				SegmentDir,				// Tangent
+				Color,					// Color (페이드 아웃 알파 포함)
+				FVector2D(0.0f, V)		// UV
+			};
+			Vertices[VertexOffset++] = {
+				P + Up * HalfWidth,		// Position
+				P,						// ControlPoint
+				SegmentDir,				// Tangent
+				Color,					// Color (페이드 아웃 알파 포함)
+				FVector2D(1.0f, V)		// UV
+			};
+		}
+
+		// 2. 정점들을 연결하여 인덱스 생성
+		for (int32 i = 0; i < NumPoints - 1; ++i)
+		{
+			uint32 V0 = i * 2;
+			uint32 V1 = V0 + 1;
+			uint32 V2 = (i + 1) * 2;
+			uint32 V3 = V2 + 1;
+
+			Indices[IndexOffset++] = V0;
+			Indices[IndexOffset++] = V2;
+			Indices[IndexOffset++] = V1;
+
+			Indices[IndexOffset++] = V1;
+			Indices[IndexOffset++] = V2;
+			Indices[IndexOffset++] = V3;
+		}
+	}
+
+	// 빔/리본 이미터가 구간을 차지하는지 (Fill과 Create가 같은 규칙으로 오프셋을 센다)
+	bool HasBeamGeometry(const FDynamicBeamEmitterReplayDataBase& BeamSource)
+	{
+		return BeamSource.BeamPoints.Num() > 1;
+	}
+
+	bool HasRibbonGeometry(const FDynamicRibbonEmitterReplayDataBase& RibbonSource)
+	{
+		const int32 NumPoints = RibbonSource.RibbonPoints.Num();
+		return NumPoints > 1 && RibbonSource.RibbonColors.Num() == NumPoints;
+	}
+}
+
+void UParticleSystemComponent::FillMeshInstanceBuffer(uint32 TotalInstances)
+{
+	if (TotalInstances == 0)
+	{
+		return;
+	}
+
+	// 공유 링 버퍼에서 컴포넌트 구간 할당, 실제 기록은 이미터별 채우기 작업으로 EndPass에서 병렬 실행
+	FParticleDynamicBufferAllocator& Allocator = FParticleDynamicBufferAllocator::GetInstance();
+	MeshInstanceRange = Allocator.AllocateVertices(TotalInstances, sizeof(FMeshParticleInstanceVertex));
+	if (!MeshInstanceRange.IsValid())
+	{
+		return;
+	}
+
+	FMeshParticleInstanceVertex* Instances = MeshInstanceRange.GetData<FMeshParticleInstanceVertex>();
+	uint32 InstanceOffset = 0;
+
+	// 메시 이미터 순회 (이미터마다 ActiveParticleCount만큼 차지, CreateMeshParticleBatch와 같은 규칙)
+	for (FDynamicEmitterDataBase* EmitterData : EmitterRenderData)
+	{
+		if (!EmitterData)
+			continue;
+
+		const FDynamicEmitterReplayDataBase& Source = EmitterData->GetSource();
+		if (Source.eEmitterType != EDynamicEmitterType::Mesh)
+			continue;
+
+		const int32 ParticleCount = Source.ActiveParticleCount;
+		if (Source.DataContainer.ParticleData && ParticleCount > 0)
+		{
+			const auto* MeshSource = static_cast<const FDynamicMeshEmitterReplayDataBase*>(&Source);
+			FMeshParticleInstanceVertex* EmitterInstances = Instances + InstanceOffset;
+			Allocator.AddFillTask([MeshSource, EmitterInstances]()
+				{
+					WriteMeshParticleInstances(*MeshSource, EmitterInstances);
+				}, ParticleCount);
+		}
+
+		InstanceOffset += ParticleCount;
+	}
+}
+
+void UParticleSystemComponent::CreateMeshParticleBatch(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+{
+	if (!MeshInstanceRange.IsValid())
+	{
+		return;
+	}
+
+	// 파티클 메시 전용 인스턴싱 셰이더 로드 (한 번만)
+	static UShader* ParticleMeshShader = UResourceManager::GetInstance().Load<UShader>("Shaders/Particle/ParticleMesh.hlsl");
+	if (!ParticleMeshShader)
+	{
+		return;
+	}
+
+	// 컴포넌트 구간 내 현재 오프셋 (각 이미터별로 증가)
+	uint32 InstanceOffset = 0;
+
+	// 각 메시 이미터별로 별도의 배치 생성
+	for (FDynamicEmitterDataBase* EmitterData : EmitterRenderData)
+	{
+		if (!EmitterData)
+			continue;
+
+		const FDynamicEmitterReplayDataBase& Source = EmitterData->GetSource();
+		if (Source.eEmitterType != EDynamicEmitterType::Mesh)
+			continue;
+
+		const auto& MeshSource = static_cast<const FDynamicMeshEmitterReplayDataBase&>(Source);
+		UStaticMesh* Mesh = MeshSource.MeshData;
+		UMaterialInterface* Material = MeshSource.MaterialInterface;
+		bool bOverrideMaterial = MeshSource.bOverrideMaterial;
+		int32 EmitterInstanceCount = Source.ActiveParticleCount;
+
+		// 그리지 않는 이미터도 FillMeshInstanceBuffer와 같이 구간은 차지한다
+		const uint32 EmitterFirstInstance = MeshInstanceRange.FirstElement + InstanceOffset;
+		InstanceOffset += EmitterInstanceCount;
+
+		if (!Mesh || EmitterInstanceCount == 0 || !Source.DataContainer.ParticleData)
+		{
+			continue;
+		}
+
+		// 메시의 섹션(GroupInfo) 정보 가져오기
+		const TArray<FGroupInfo>& MeshGroupInfos = Mesh->GetMeshGroupInfo();
+		const bool bHasSections = !MeshGroupInfos.IsEmpty();
+		const uint32 NumSectionsToProcess = bHasSections ? static_cast<uint32>(MeshGroupInfos.size()) : 1;
+
+		// Lambda: 섹션별 소스 Material 가져오기
+		// bOverrideMaterial이 true면 RequiredModule->Material 사용, false면 메시의 섹션별 Material 사용
+		auto GetSourceMaterial = [&](uint32 SectionIndex) -> UMaterialInterface*
+		{
+			if (bOverrideMaterial && Material != nullptr)
+			{
+				return Material;
+			}
+
+			if (bHasSections && SectionIndex < MeshGroupInfos.size())
+			{
+				const FGroupInfo& Group = MeshGroupInfos[SectionIndex];
+				if (!Group.InitialMaterialName.empty())
+				{
+					UMaterialInterface* MeshMaterial = UResourceManager::GetInstance().Get<UMaterial>(Group.InitialMaterialName);
+					if (MeshMaterial)
+					{
+						return MeshMaterial;
+					}
+				}
+			}
+
+			return UResourceManager::GetInstance().GetDefaultMaterial();
+		};
+
+		// 각 섹션마다 별도의 배치 생성
+		for (uint32 SectionIndex = 0; SectionIndex < NumSectionsToProcess; ++SectionIndex)
+		{
+			uint32 IndexCount = 0;
+			uint32 StartIndex = 0;
+
+			if (bHasSections)
 			{
 				const FGroupInfo& Group = MeshGroupInfos[SectionIndex];
 				IndexCount = Group.IndexCount;
@@ -1574,7 +1808,7 @@ void UParticleSystemComponent::CreateMeshParticleBatch(TArray<FMeshBatchElement>
 			}
 
 			// 셰이더 변형 컴파일
-			TArray<FShaderMacro> ShaderMacros = View->ViewShaderMacros;
+			TInlineArray<FShaderMacro, 16> ShaderMacros = View->ViewShaderMacros;
 			if (ParticleMaterial->GetShaderMacros().Num() > 0)
 			{
 				ShaderMacros.Append(ParticleMaterial->GetShaderMacros());
@@ -1600,9 +1834,9 @@ void UParticleSystemComponent::CreateMeshParticleBatch(TArray<FMeshBatchElement>
 
 			// 이 이미터의 인스턴스 수와 시작 위치 설정
 			BatchElement.NumInstances = EmitterInstanceCount;
-			BatchElement.InstanceBuffer = MeshInstanceBuffer;
+			BatchElement.InstanceBuffer = MeshInstanceRange.Buffer;
 			BatchElement.InstanceStride = sizeof(FMeshParticleInstanceVertex);
-			BatchElement.StartInstanceLocation = InstanceOffset;
+			BatchElement.StartInstanceLocation = EmitterFirstInstance;
 
 			BatchElement.IndexCount = IndexCount;
 			BatchElement.StartIndex = StartIndex;
@@ -1615,9 +1849,6 @@ void UParticleSystemComponent::CreateMeshParticleBatch(TArray<FMeshBatchElement>
 
 			OutMeshBatchElements.Add(BatchElement);
 		}
-
-		// 다음 이미터를 위해 오프셋 증가
-		InstanceOffset += EmitterInstanceCount;
 	}
 }
 
@@ -1628,47 +1859,17 @@ void UParticleSystemComponent::FillSpriteInstanceBuffer(uint32 TotalInstances)
 		return;
 	}
 
-	ID3D11Device* Device = GEngine.GetRHIDevice()->GetDevice();
-	ID3D11DeviceContext* Context = GEngine.GetRHIDevice()->GetDeviceContext();
-
-	// 인스턴스 버퍼 생성/리사이즈
-	if (TotalInstances > AllocatedSpriteInstanceCount)
-	{
-		if (SpriteInstanceBuffer)
-		{
-			SpriteInstanceBuffer->Release();
-			SpriteInstanceBuffer = nullptr;
-		}
-
-		uint32 NewCount = FMath::Max(TotalInstances * 2, 64u);
-		D3D11_BUFFER_DESC Desc = {};
-		Desc.ByteWidth = NewCount * sizeof(FSpriteParticleInstanceVertex);
-		Desc.Usage = D3D11_USAGE_DYNAMIC;
-		Desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-		Desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-
-		if (SUCCEEDED(Device->CreateBuffer(&Desc, nullptr, &SpriteInstanceBuffer)))
-		{
-			AllocatedSpriteInstanceCount = NewCount;
-		}
-	}
-
-	if (!SpriteInstanceBuffer)
-	{
-		return;
-	}
-
-	// 버퍼 매핑
-	D3D11_MAPPED_SUBRESOURCE MappedData;
-	if (FAILED(Context->Map(SpriteInstanceBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MappedData)))
+	FParticleDynamicBufferAllocator& Allocator = FParticleDynamicBufferAllocator::GetInstance();
+	SpriteInstanceRange = Allocator.AllocateVertices(TotalInstances, sizeof(FSpriteParticleInstanceVertex));
+	if (!SpriteInstanceRange.IsValid())
 	{
 		return;
 	}
 
-	FSpriteParticleInstanceVertex* Instances = static_cast<FSpriteParticleInstanceVertex*>(MappedData.pData);
+	FSpriteParticleInstanceVertex* Instances = SpriteInstanceRange.GetData<FSpriteParticleInstanceVertex>();
 	uint32 InstanceOffset = 0;
 
-	// 스프라이트 이미터 순회
+	// 스프라이트 이미터 순회 (정렬은 CollectMeshBatches에서 이미 끝남)
 	for (FDynamicEmitterDataBase* EmitterData : EmitterRenderData)
 	{
 		if (!EmitterData)
@@ -1679,66 +1880,23 @@ void UParticleSystemComponent::FillSpriteInstanceBuffer(uint32 TotalInstances)
 			continue;
 
 		const int32 ParticleCount = Source.ActiveParticleCount;
-		const int32 ParticleStride = Source.ParticleStride;
-		const uint8* ParticleData = Source.DataContainer.ParticleData;
-		const uint16* ParticleIndices = Source.DataContainer.ParticleIndices;
-
-		if (!ParticleData || ParticleCount == 0)
-			continue;
-
-		// Sub-UV 설정 가져오기
-		const FDynamicSpriteEmitterData* SpriteEmitterData = static_cast<const FDynamicSpriteEmitterData*>(EmitterData);
-		int32 SubImages_H = 1;
-		int32 SubImages_V = 1;
-		int32 TotalFrames = 1;
-
-		if (SpriteEmitterData->Source.RequiredModule)
+		if (Source.DataContainer.ParticleData && ParticleCount > 0)
 		{
-			SubImages_H = SpriteEmitterData->Source.RequiredModule->SubImages_Horizontal;
-			SubImages_V = SpriteEmitterData->Source.RequiredModule->SubImages_Vertical;
-			int32 MaxElements = SpriteEmitterData->Source.RequiredModule->SubUV_MaxElements;
-			TotalFrames = (MaxElements > 0) ? MaxElements : (SubImages_H * SubImages_V);
+			const auto* SpriteSource = static_cast<const FDynamicSpriteEmitterReplayDataBase*>(&Source);
+			FSpriteParticleInstanceVertex* EmitterInstances = Instances + InstanceOffset;
+			Allocator.AddFillTask([SpriteSource, EmitterInstances]()
+				{
+					WriteSpriteParticleInstances(*SpriteSource, EmitterInstances);
+				}, ParticleCount);
 		}
 
-		// 각 파티클의 인스턴스 데이터 생성
-		for (int32 ParticleIdx = 0; ParticleIdx < ParticleCount; ParticleIdx++)
-		{
-			const int32 ParticleIndex = ParticleIndices ? ParticleIndices[ParticleIdx] : ParticleIdx;
-			const FBaseParticle* Particle = reinterpret_cast<const FBaseParticle*>(
-				ParticleData + ParticleIndex * ParticleStride
-			);
-
-			FSpriteParticleInstanceVertex& Instance = Instances[InstanceOffset];
-
-			// 월드 위치
-			Instance.WorldPosition =  Particle->Location;
-
-			// 회전 (Z축만)
-			Instance.Rotation = Particle->Rotation;
-
-			// 크기 (XY만)
-			Instance.Size = FVector2D(Particle->Size.X, Particle->Size.Y);
-
-			// 색상
-			Instance.Color = Particle->Color;
-
-			// RelativeTime
-			Instance.RelativeTime = Particle->RelativeTime;
-
-			// Sub-UV 프레임 인덱스 계산
-			// RelativeTime (0~1)을 프레임 인덱스 (0~TotalFrames-1)로 변환
-			Instance.SubImageIndex = Particle->RelativeTime * (float)(TotalFrames - 1);
-
-			InstanceOffset++;
-		}
+		InstanceOffset += ParticleCount;
 	}
-
-	Context->Unmap(SpriteInstanceBuffer, 0);
 }
 
 void UParticleSystemComponent::CreateSpriteParticleBatch(TArray<FMeshBatchElement>& OutMeshBatchElements)
 {
-	if (!SpriteInstanceBuffer)
+	if (!SpriteInstanceRange.IsValid())
 	{
 		return;
 	}
@@ -1768,8 +1926,12 @@ void UParticleSystemComponent::CreateSpriteParticleBatch(TArray<FMeshBatchElemen
 		UMaterialInterface* Material = SpriteSource.MaterialInterface;
 		int32 EmitterInstanceCount = Source.ActiveParticleCount;
 
+		// 그리지 않는 이미터도 FillSpriteInstanceBuffer와 같이 구간은 차지한다
+		const uint32 EmitterFirstInstance = SpriteInstanceRange.FirstElement + InstanceOffset;
+		InstanceOffset += EmitterInstanceCount;
+
 		// Material이 없거나 파티클이 없으면 스킵
-		if (!Material || EmitterInstanceCount == 0)
+		if (!Material || EmitterInstanceCount == 0 || !Source.DataContainer.ParticleData)
 		{
 			continue;
 		}
@@ -1802,9 +1964,9 @@ void UParticleSystemComponent::CreateSpriteParticleBatch(TArray<FMeshBatchElemen
 
 		// 이 이미터의 인스턴스 수와 시작 위치 설정
 		BatchElement.NumInstances = EmitterInstanceCount;
-		BatchElement.InstanceBuffer = SpriteInstanceBuffer;
+		BatchElement.InstanceBuffer = SpriteInstanceRange.Buffer;
 		BatchElement.InstanceStride = sizeof(FSpriteParticleInstanceVertex);
-		BatchElement.StartInstanceLocation = InstanceOffset;
+		BatchElement.StartInstanceLocation = EmitterFirstInstance;
 
 		BatchElement.IndexCount = 6;  // 2 triangles
 		BatchElement.StartIndex = 0;
@@ -1828,9 +1990,6 @@ void UParticleSystemComponent::CreateSpriteParticleBatch(TArray<FMeshBatchElemen
 		}
 
 		OutMeshBatchElements.Add(BatchElement);
-
-		// 다음 이미터를 위해 오프셋 증가
-		InstanceOffset += EmitterInstanceCount;
 	}
 }
 
@@ -1849,10 +2008,9 @@ void UParticleSystemComponent::FillBeamBuffers(const FSceneView* View)
 		if (EmitterData && EmitterData->GetSource().eEmitterType == EDynamicEmitterType::Beam)
 		{
 			const auto& BeamSource = static_cast<const FDynamicBeamEmitterReplayDataBase&>(EmitterData->GetSource());
-			const int32 NumPoints = BeamSource.BeamPoints.Num();
-			if (NumPoints > 1)
+			if (HasBeamGeometry(BeamSource))
 			{
-				const int32 SegmentCount = NumPoints - 1;
+				const int32 SegmentCount = BeamSource.BeamPoints.Num() - 1;
 				TotalVertices += (SegmentCount + 1) * 2;
 				TotalIndices += SegmentCount * 6;
 			}
@@ -1864,127 +2022,51 @@ void UParticleSystemComponent::FillBeamBuffers(const FSceneView* View)
 		return;
 	}
 
-	ID3D11Device* Device = GEngine.GetRHIDevice()->GetDevice();
-	ID3D11DeviceContext* Context = GEngine.GetRHIDevice()->GetDeviceContext();
-
-	// 2. 버퍼 생성/리사이즈
-	if (TotalVertices > AllocatedBeamVertexCount)
-	{
-		if (BeamVertexBuffer) BeamVertexBuffer->Release();
-		uint32 NewCount = FMath::Max(TotalVertices * 2, 64u);
-		D3D11_BUFFER_DESC Desc = {};
-		Desc.ByteWidth = NewCount * sizeof(FParticleBeamVertex);
-		Desc.Usage = D3D11_USAGE_DYNAMIC;
-		Desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-		Desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-		if (SUCCEEDED(Device->CreateBuffer(&Desc, nullptr, &BeamVertexBuffer)))
-		{
-			AllocatedBeamVertexCount = NewCount;
-		}
-	}
-
-	if (TotalIndices > AllocatedBeamIndexCount)
-	{
-		if (BeamIndexBuffer) BeamIndexBuffer->Release();
-		uint32 NewCount = FMath::Max(TotalIndices * 2, 128u);
-		D3D11_BUFFER_DESC Desc = {};
-		Desc.ByteWidth = NewCount * sizeof(uint32);
-		Desc.Usage = D3D11_USAGE_DYNAMIC;
-		Desc.BindFlags = D3D11_BIND_INDEX_BUFFER;
-		Desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-		if (SUCCEEDED(Device->CreateBuffer(&Desc, nullptr, &BeamIndexBuffer)))
-		{
-			AllocatedBeamIndexCount = NewCount;
-		}
-	}
-
-	if (!BeamVertexBuffer || !BeamIndexBuffer)
-	{
-		return;
-	}
-
-	// 3. 버퍼 매핑
-	D3D11_MAPPED_SUBRESOURCE VBMappedData, IBMappedData;
-	if (FAILED(Context->Map(BeamVertexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &VBMappedData)) ||
-		FAILED(Context->Map(BeamIndexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &IBMappedData)))
+	// 2. 공유 링 버퍼에서 구간 할당
+	FParticleDynamicBufferAllocator& Allocator = FParticleDynamicBufferAllocator::GetInstance();
+	BeamVertexRange = Allocator.AllocateVertices(TotalVertices, sizeof(FParticleBeamVertex));
+	BeamIndexRange = Allocator.AllocateIndices(TotalIndices);
+	if (!BeamVertexRange.IsValid() || !BeamIndexRange.IsValid())
 	{
-		if (VBMappedData.pData) Context->Unmap(BeamVertexBuffer, 0);
+		BeamVertexRange = {};
+		BeamIndexRange = {};
 		return;
 	}
 
-	auto* Vertices = static_cast<FParticleBeamVertex*>(VBMappedData.pData);
-	auto* Indices = static_cast<uint32*>(IBMappedData.pData);
+	auto* Vertices = BeamVertexRange.GetData<FParticleBeamVertex>();
+	auto* Indices = BeamIndexRange.GetData<uint32>();
 
 	uint32 VertexOffset = 0;
 	uint32 IndexOffset = 0;
 
-	FVector ViewDirection = View->ViewRotation.GetForwardVector();
-	FVector ViewOrigin = View->ViewLocation;
+	const FVector ViewDirection = View->ViewRotation.GetForwardVector();
 
-	// 4. 이미터 순회하며 버퍼 채우기
+	// 3. 이미터별 채우기 작업 등록
 	for (FDynamicEmitterDataBase* EmitterData : EmitterRenderData)
 	{
 		if (!EmitterData || EmitterData->GetSource().eEmitterType != EDynamicEmitterType::Beam)
 			continue;
 
-		const auto& BeamSource = static_cast<const FDynamicBeamEmitterReplayDataBase&>(EmitterData->GetSource());
-		const TArray<FVector>& BeamPoints = BeamSource.BeamPoints;
-		const float BeamWidth = BeamSource.Width;
-		const float TileU = BeamSource.TileU;
-		const FLinearColor BeamColor = BeamSource.Color;
-
-		if (BeamPoints.Num() < 2)
+		const auto* BeamSource = static_cast<const FDynamicBeamEmitterReplayDataBase*>(&EmitterData->GetSource());
+		if (!HasBeamGeometry(*BeamSource))
 			continue;
 
-		uint32 EmitterBaseVertexIndex = VertexOffset;
-
-		// 1. 모든 정점을 먼저 생성 (Triangle Strip 방식)
-		for (int32 i = 0; i < BeamPoints.Num(); ++i)
-		{
-			const FVector& P = BeamPoints[i];
-			FVector SegmentDir = (i < BeamPoints.Num() - 1) ? (BeamPoints[i + 1] - P) : (P - BeamPoints[i - 1]);
-			SegmentDir.Normalize();
-
-			FVector Up = FVector::Cross(SegmentDir, ViewDirection);
-			Up.Normalize();
-			
-			float HalfWidth = BeamWidth * 0.5f;
-
-			// UV의 V좌표는 빔의 길이에 따라 0에서 1까지 변함
-			float V = (float)i / (float)(BeamPoints.Num() - 1);
-			
-			// 각 포인트마다 2개의 정점(좌, 우) 생성
-			Vertices[VertexOffset++] = { P - Up * HalfWidth, FVector2D(0.0f, V), BeamColor, BeamWidth };
-			Vertices[VertexOffset++] = { P + Up * HalfWidth, FVector2D(1.0f, V), BeamColor, BeamWidth };
-		}
-
-		// 2. 정점들을 연결하여 인덱스 생성
-		for (int32 i = 0; i < BeamPoints.Num() - 1; ++i)
-		{
-			uint32 V0 = EmitterBaseVertexIndex + i * 2;     // 현재 세그먼트의 좌측 정점
-			uint32 V1 = EmitterBaseVertexIndex + i * 2 + 1; // 현재 세그먼트의 우측 정점
-			uint32 V2 = EmitterBaseVertexIndex + (i + 1) * 2;     // 다음 세그먼트의 좌측 정점
-			uint32 V3 = EmitterBaseVertexIndex + (i + 1) * 2 + 1; // 다음 세그먼트의 우측 정점
-
-			// 첫 번째 삼각형 (V0, V2, V1)
-			Indices[IndexOffset++] = V0;
-			Indices[IndexOffset++] = V2;
-			Indices[IndexOffset++] = V1;
+		const int32 NumPoints = BeamSource->BeamPoints.Num();
+		FParticleBeamVertex* EmitterVertices = Vertices + VertexOffset;
+		uint32* EmitterIndices = Indices + IndexOffset;
+		Allocator.AddFillTask([BeamSource, ViewDirection, EmitterVertices, EmitterIndices]()
+			{
+				WriteBeamGeometry(*BeamSource, ViewDirection, EmitterVertices, EmitterIndices);
+			}, NumPoints);
 
-			// 두 번째 삼각형 (V1, V2, V3)
-			Indices[IndexOffset++] = V1;
-			Indices[IndexOffset++] = V2;
-			Indices[IndexOffset++] = V3;
-		}
+		VertexOffset += NumPoints * 2;
+		IndexOffset += (NumPoints - 1) * 6;
 	}
-
-	Context->Unmap(BeamVertexBuffer, 0);
-	Context->Unmap(BeamIndexBuffer, 0);
 }
 
 void UParticleSystemComponent::CreateBeamParticleBatch(TArray<FMeshBatchElement>& OutMeshBatchElements)
 {
-	if (!BeamVertexBuffer || !BeamIndexBuffer)
+	if (!BeamVertexRange.IsValid() || !BeamIndexRange.IsValid())
 	{
 		return;
 	}
@@ -1998,9 +2080,18 @@ void UParticleSystemComponent::CreateBeamParticleBatch(TArray<FMeshBatchElement>
 			continue;
 
 		const auto& BeamSource = static_cast<const FDynamicBeamEmitterReplayDataBase&>(EmitterData->GetSource());
-		if (BeamSource.BeamPoints.Num() < 2)
+		if (!HasBeamGeometry(BeamSource))
 			continue;
 
+		// 그리지 않는 이미터도 FillBeamBuffers와 같이 구간은 차지한다
+		const int32 SegmentCount = BeamSource.BeamPoints.Num() - 1;
+		const uint32 NumVertices = (SegmentCount + 1) * 2;
+		const uint32 NumIndices = SegmentCount * 6;
+		const uint32 EmitterVertexOffset = VertexOffset;
+		const uint32 EmitterIndexOffset = IndexOffset;
+		VertexOffset += NumVertices;
+		IndexOffset += NumIndices;
+
 		UMaterialInterface* Material = BeamSource.Material;
 		if (!Material)
 		{
@@ -2014,10 +2105,10 @@ void UParticleSystemComponent::CreateBeamParticleBatch(TArray<FMeshBatchElement>
 
 		UShader* Shader = Material->GetShader();
 		FShaderVariant* ShaderVariant = Shader->GetOrCompileShaderVariant(Material->GetShaderMacros());
-
-		const int32 SegmentCount = BeamSource.BeamPoints.Num() - 1;
-		const uint32 NumVertices = (SegmentCount + 1) * 2;
-		const uint32 NumIndices = SegmentCount * 6;
+		if (!ShaderVariant)
+		{
+			continue;
+		}
 
 		FMeshBatchElement BatchElement;
 		BatchElement.VertexShader = ShaderVariant->VertexShader;
@@ -2025,17 +2116,18 @@ void UParticleSystemComponent::CreateBeamParticleBatch(TArray<FMeshBatchElement>
 		BatchElement.InputLayout = ShaderVariant->InputLayout;
 		BatchElement.Material = Material;
 
-		BatchElement.VertexBuffer = BeamVertexBuffer;
-		BatchElement.IndexBuffer = BeamIndexBuffer;
+		BatchElement.VertexBuffer = BeamVertexRange.Buffer;
+		BatchElement.IndexBuffer = BeamIndexRange.Buffer;
 		BatchElement.VertexStride = sizeof(FParticleBeamVertex);
 
 		BatchElement.NumInstances = 1; // Not instanced
 		BatchElement.InstanceBuffer = nullptr;
 		BatchElement.InstanceStride = 0;
 
+		// 인덱스는 이미터 정점 구간 기준이므로 링 버퍼 내 위치는 StartIndex/BaseVertexIndex로 지정
 		BatchElement.IndexCount = NumIndices;
-		BatchElement.StartIndex = IndexOffset;
-		BatchElement.BaseVertexIndex = VertexOffset;
+		BatchElement.StartIndex = BeamIndexRange.FirstElement + EmitterIndexOffset;
+		BatchElement.BaseVertexIndex = BeamVertexRange.FirstElement + EmitterVertexOffset;
 
 		BatchElement.WorldMatrix = FMatrix::Identity();
 		BatchElement.ObjectID = InternalIndex;
@@ -2045,10 +2137,6 @@ void UParticleSystemComponent::CreateBeamParticleBatch(TArray<FMeshBatchElement>
 		BatchElement.RenderMode = EBatchRenderMode::Translucent;
 
 		OutMeshBatchElements.Add(BatchElement);
-
-		// Update offsets for the next beam
-		VertexOffset += NumVertices;
-		IndexOffset += NumIndices;
 	}
 }
 
@@ -2067,9 +2155,9 @@ void UParticleSystemComponent::FillRibbonBuffers(const FSceneView* View)
 		if (EmitterData && EmitterData->GetSource().eEmitterType == EDynamicEmitterType::Ribbon)
 		{
 			const auto& RibbonSource = static_cast<const FDynamicRibbonEmitterReplayDataBase&>(EmitterData->GetSource());
-			const int32 NumPoints = RibbonSource.RibbonPoints.Num();
-			if (NumPoints > 1)
+			if (HasRibbonGeometry(RibbonSource))
 			{
+				const int32 NumPoints = RibbonSource.RibbonPoints.Num();
 				TotalVertices += NumPoints * 2;
 				TotalIndices += (NumPoints - 1) * 6;
 			}
@@ -2081,150 +2169,51 @@ void UParticleSystemComponent::FillRibbonBuffers(const FSceneView* View)
 		return;
 	}
 
-	ID3D11Device* Device = GEngine.GetRHIDevice()->GetDevice();
-	ID3D11DeviceContext* Context = GEngine.GetRHIDevice()->GetDeviceContext();
-
-	// 2. 버퍼 생성/리사이즈
-	if (TotalVertices > AllocatedRibbonVertexCount)
+	// 2. 공유 링 버퍼에서 구간 할당
+	FParticleDynamicBufferAllocator& Allocator = FParticleDynamicBufferAllocator::GetInstance();
+	RibbonVertexRange = Allocator.AllocateVertices(TotalVertices, sizeof(FParticleRibbonVertex));
+	RibbonIndexRange = Allocator.AllocateIndices(TotalIndices);
+	if (!RibbonVertexRange.IsValid() || !RibbonIndexRange.IsValid())
 	{
-		if (RibbonVertexBuffer) RibbonVertexBuffer->Release();
-		uint32 NewCount = FMath::Max(TotalVertices * 2, 128u);
-		D3D11_BUFFER_DESC Desc = {};
-		Desc.ByteWidth = NewCount * sizeof(FParticleRibbonVertex);
-		Desc.Usage = D3D11_USAGE_DYNAMIC;
-		Desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-		Desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-		if (SUCCEEDED(Device->CreateBuffer(&Desc, nullptr, &RibbonVertexBuffer)))
-		{
-			AllocatedRibbonVertexCount = NewCount;
-		}
-	}
-
-	if (TotalIndices > AllocatedRibbonIndexCount)
-	{
-		if (RibbonIndexBuffer) RibbonIndexBuffer->Release();
-		uint32 NewCount = FMath::Max(TotalIndices * 2, 256u);
-		D3D11_BUFFER_DESC Desc = {};
-		Desc.ByteWidth = NewCount * sizeof(uint32);
-		Desc.Usage = D3D11_USAGE_DYNAMIC;
-		Desc.BindFlags = D3D11_BIND_INDEX_BUFFER;
-		Desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-		if (SUCCEEDED(Device->CreateBuffer(&Desc, nullptr, &RibbonIndexBuffer)))
-		{
-			AllocatedRibbonIndexCount = NewCount;
-		}
-	}
-
-	if (!RibbonVertexBuffer || !RibbonIndexBuffer)
-	{
-		return;
-	}
-
-	// 3. 버퍼 매핑
-	D3D11_MAPPED_SUBRESOURCE VBMappedData, IBMappedData;
-	if (FAILED(Context->Map(RibbonVertexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &VBMappedData)) ||
-		FAILED(Context->Map(RibbonIndexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &IBMappedData)))
-	{
-		if (VBMappedData.pData) Context->Unmap(RibbonVertexBuffer, 0);
-		if (IBMappedData.pData) Context->Unmap(RibbonIndexBuffer, 0);
+		RibbonVertexRange = {};
+		RibbonIndexRange = {};
 		return;
 	}
 
-	auto* Vertices = static_cast<FParticleRibbonVertex*>(VBMappedData.pData);
-	auto* Indices = static_cast<uint32*>(IBMappedData.pData);
+	auto* Vertices = RibbonVertexRange.GetData<FParticleRibbonVertex>();
+	auto* Indices = RibbonIndexRange.GetData<uint32>();
 
 	uint32 VertexOffset = 0;
 	uint32 IndexOffset = 0;
 
-	FVector ViewDirection = View->ViewRotation.GetForwardVector();
-	
-	// 4. 이미터 순회하며 버퍼 채우기
+	const FVector ViewDirection = View->ViewRotation.GetForwardVector();
+
+	// 3. 이미터별 채우기 작업 등록
 	for (FDynamicEmitterDataBase* EmitterData : EmitterRenderData)
 	{
 		if (!EmitterData || EmitterData->GetSource().eEmitterType != EDynamicEmitterType::Ribbon)
 			continue;
-	
-		const auto& RibbonSource = static_cast<const FDynamicRibbonEmitterReplayDataBase&>(EmitterData->GetSource());
-		const TArray<FVector>& RibbonPoints = RibbonSource.RibbonPoints;
-		const TArray<FLinearColor>& RibbonColors = RibbonSource.RibbonColors;
-		const float RibbonWidth = RibbonSource.Width;
-		const int32 NumPoints = RibbonPoints.Num();
 
-		if (NumPoints < 2 || RibbonColors.Num() != NumPoints)
+		const auto* RibbonSource = static_cast<const FDynamicRibbonEmitterReplayDataBase*>(&EmitterData->GetSource());
+		if (!HasRibbonGeometry(*RibbonSource))
 			continue;
 
-		uint32 EmitterBaseVertexIndex = VertexOffset;
-
-		// 1. 모든 정점을 먼저 생성 (Triangle Strip 방식)
-		for (int32 i = 0; i < NumPoints; ++i)
-		{
-			const FVector& P = RibbonPoints[i];
-			const FLinearColor& Color = RibbonColors[i];  // 파티클 색상 (페이드 아웃 포함)
-
-			FVector SegmentDir;
-			if (i < NumPoints - 1)
-			{
-				SegmentDir = RibbonPoints[i + 1] - P;
-			}
-			else
+		const int32 NumPoints = RibbonSource->RibbonPoints.Num();
+		FParticleRibbonVertex* EmitterVertices = Vertices + VertexOffset;
+		uint32* EmitterIndices = Indices + IndexOffset;
+		Allocator.AddFillTask([RibbonSource, ViewDirection, EmitterVertices, EmitterIndices]()
 			{
-				SegmentDir = P - RibbonPoints[i - 1];
-			}
-			SegmentDir.Normalize();
+				WriteRibbonGeometry(*RibbonSource, ViewDirection, EmitterVertices, EmitterIndices);
+			}, NumPoints);
 
-			FVector Up = FVector::Cross(SegmentDir, ViewDirection);
-			Up.Normalize();
-
-			// UV의 V좌표는 리본의 길이에 따라 0에서 1까지 변함
-			float V = (float)i / (float)(NumPoints - 1);
-
-			// 테이퍼링: 끝으로 갈수록 너비 감소 (뾰족한 끝 방지)
-			// V=0 (오래된 파티클, 트레일 끝) → 너비 0
-			// V=1 (새로운 파티클, 트레일 시작) → 너비 100%
-			float WidthScale = V;  // 선형 테이퍼링 (V*V or sqrt(V))
-			float HalfWidth = (RibbonWidth * 0.5f) * WidthScale;
-
-			// 각 포인트마다 2개의 정점(좌, 우) 생성
-			Vertices[VertexOffset++] = {
-				P - Up * HalfWidth,		// Position
-				P,						// ControlPoint
-				SegmentDir,				// Tangent
-				Color,					// Color (페이드 아웃 알파 포함)
-				FVector2D(0.0f, V)		// UV
-			};
-			Vertices[VertexOffset++] = {
-				P + Up * HalfWidth,		// Position
-				P,						// ControlPoint
-				SegmentDir,				// Tangent
-				Color,					// Color (페이드 아웃 알파 포함)
-				FVector2D(1.0f, V)		// UV
-			};
-		}		
-		// 2. 정점들을 연결하여 인덱스 생성
-		for (int32 i = 0; i < NumPoints - 1; ++i)
-		{
-			uint32 V0 = EmitterBaseVertexIndex + i * 2;
-			uint32 V1 = V0 + 1;
-			uint32 V2 = EmitterBaseVertexIndex + (i + 1) * 2;
-			uint32 V3 = V2 + 1;
-
-			Indices[IndexOffset++] = V0;
-			Indices[IndexOffset++] = V2;
-			Indices[IndexOffset++] = V1;
-
-			Indices[IndexOffset++] = V1;
-			Indices[IndexOffset++] = V2;
-			Indices[IndexOffset++] = V3;
-		}
+		VertexOffset += NumPoints * 2;
+		IndexOffset += (NumPoints - 1) * 6;
 	}
-
-	Context->Unmap(RibbonVertexBuffer, 0);
-	Context->Unmap(RibbonIndexBuffer, 0);
 }
 
 void UParticleSystemComponent::CreateRibbonParticleBatch(TArray<FMeshBatchElement>& OutMeshBatchElements)
 {
-	if (!RibbonVertexBuffer || !RibbonIndexBuffer)
+	if (!RibbonVertexRange.IsValid() || !RibbonIndexRange.IsValid())
 	{
 		return;
 	}
@@ -2238,11 +2227,18 @@ void UParticleSystemComponent::CreateRibbonParticleBatch(TArray<FMeshBatchElemen
 			continue;
 
 		const auto& RibbonSource = static_cast<const FDynamicRibbonEmitterReplayDataBase&>(EmitterData->GetSource());
-		const int32 NumPoints = RibbonSource.RibbonPoints.Num();
-
-		if (NumPoints < 2)
+		if (!HasRibbonGeometry(RibbonSource))
 			continue;
 
+		// 그리지 않는 이미터도 FillRibbonBuffers와 같이 구간은 차지한다
+		const int32 NumPoints = RibbonSource.RibbonPoints.Num();
+		const uint32 NumVerticesForThisRibbon = NumPoints * 2;
+		const uint32 NumIndicesForThisRibbon = (NumPoints - 1) * 6;
+		const uint32 EmitterVertexOffset = VertexOffset;
+		const uint32 EmitterIndexOffset = IndexOffset;
+		VertexOffset += NumVerticesForThisRibbon;
+		IndexOffset += NumIndicesForThisRibbon;
+
 		UMaterialInterface* Material = RibbonSource.Material;
 		if (!Material)
 		{
@@ -2257,9 +2253,10 @@ void UParticleSystemComponent::CreateRibbonParticleBatch(TArray<FMeshBatchElemen
 
 		UShader* Shader = Material->GetShader();
 		FShaderVariant* ShaderVariant = Shader->GetOrCompileShaderVariant(Material->GetShaderMacros());
-
-		const uint32 NumVerticesForThisRibbon = NumPoints * 2;
-		const uint32 NumIndicesForThisRibbon = (NumPoints - 1) * 6;
+		if (!ShaderVariant)
+		{
+			continue;
+		}
 
 		FMeshBatchElement BatchElement;
 		BatchElement.VertexShader = ShaderVariant->VertexShader;
@@ -2267,8 +2264,8 @@ void UParticleSystemComponent::CreateRibbonParticleBatch(TArray<FMeshBatchElemen
 		BatchElement.InputLayout = ShaderVariant->InputLayout;
 		BatchElement.Material = Material;
 
-		BatchElement.VertexBuffer = RibbonVertexBuffer;
-		BatchElement.IndexBuffer = RibbonIndexBuffer;
+		BatchElement.VertexBuffer = RibbonVertexRange.Buffer;
+		BatchElement.IndexBuffer = RibbonIndexRange.Buffer;
 		BatchElement.VertexStride = sizeof(FParticleRibbonVertex);
 
 		BatchElement.NumInstances = 1; // Not instanced
@@ -2276,8 +2273,8 @@ void UParticleSystemComponent::CreateRibbonParticleBatch(TArray<FMeshBatchElemen
 		BatchElement.InstanceStride = 0;
 
 		BatchElement.IndexCount = NumIndicesForThisRibbon;
-		BatchElement.StartIndex = IndexOffset;
-		BatchElement.BaseVertexIndex = VertexOffset;
+		BatchElement.StartIndex = RibbonIndexRange.FirstElement + EmitterIndexOffset;
+		BatchElement.BaseVertexIndex = RibbonVertexRange.FirstElement + EmitterVertexOffset;
 
 		BatchElement.WorldMatrix = FMatrix::Identity();
 		BatchElement.ObjectID = InternalIndex;
@@ -2287,9 +2284,5 @@ void UParticleSystemComponent::CreateRibbonParticleBatch(TArray<FMeshBatchElemen
 		BatchElement.RenderMode = EBatchRenderMode::Translucent;
 
 		OutMeshBatchElements.Add(BatchElement);
-
-		// Update offsets for the next ribbon emitter
-		VertexOffset += NumVerticesForThisRibbon;
-		IndexOffset += NumIndicesForThisRibbon;
 	}
 }
\ No newline at end of file
@@ -5,6 +5,8 @@
 #include "Source/Runtime/Engine/Particles/ParticleSystem.h"
 #include "Source/Runtime/Engine/Particles/ParticleEmitterInstance.h"
 #include "Source/Runtime/Engine/Particles/ParticleEventTypes.h"
+#include "Source/Runtime/Engine/Particles/ParticleDynamicBuffer.h"
+#include "Source/Runtime/Engine/Particles/ParticleSignificanceManager.h"
 #include "UParticleSystemComponent.generated.h"
 
 struct FMeshBatchElement;
@@ -40,6 +42,20 @@ public:
 	UPROPERTY(EditAnywhere, Category="Particle System")
 	EDebugParticleType DebugParticleType = EDebugParticleType::Sprite;
 
+	// 중요도 가중치 (화면 크기에 곱해져 월드의 파티클/이미터 예산을 받는 순서를 정한다)
+	UPROPERTY(EditAnywhere, Category="Particle System|Significance", Range="0.0, 10.0")
+	float SignificancePriority = 1.0f;
+
+	// 예산/가시성과 무관하게 매 프레임 시뮬레이션 (게임플레이 이벤트를 내는 이펙트 등)
+	UPROPERTY(EditAnywhere, Category="Particle System|Significance")
+	bool bAlwaysSimulate = false;
+
+	// FParticleSignificanceManager가 매 프레임 갱신하는 중요도 판정과 틱 상태
+	FParticleSignificanceState SignificanceState;
+
+	// 마지막 시뮬레이션 기준 파티클 월드 바운드 (빔/리본이 있으면 비어 있음)
+	FAABB ParticleBounds;
+
 	// 이미터 인스턴스 (런타임)
 	TArray<FParticleEmitterInstance*> EmitterInstances;
 
@@ -76,25 +92,14 @@ public:
 	void AddDeathEvent(const FParticleEventData& Event);
 	void DispatchEventsToReceivers();  // EventReceiver 모듈에 이벤트 전달
 
-	// Dynamic Instance Buffer (메시 파티클 인스턴싱용)
-	ID3D11Buffer* MeshInstanceBuffer = nullptr;
-	uint32 AllocatedMeshInstanceCount = 0;
-
-	// Dynamic Instance Buffer (스프라이트 파티클 인스턴싱용)
-	ID3D11Buffer* SpriteInstanceBuffer = nullptr;
-	uint32 AllocatedSpriteInstanceCount = 0;
-
-	// Dynamic Vertex / Index Buffer (빔 파티클용)
-	ID3D11Buffer* BeamVertexBuffer = nullptr;
-	ID3D11Buffer* BeamIndexBuffer = nullptr;
-	uint32 AllocatedBeamVertexCount = 0;
-	uint32 AllocatedBeamIndexCount = 0;
-
-	// Dynamic Vertex / Index Buffer (리본 파티클용)
-	ID3D11Buffer* RibbonVertexBuffer = nullptr;
-	ID3D11Buffer* RibbonIndexBuffer = nullptr;
-	uint32 AllocatedRibbonVertexCount = 0;
-	uint32 AllocatedRibbonIndexCount = 0;
+	// 이번 파티클 패스에 공유 동적 버퍼(FParticleDynamicBufferAllocator)에서 할당받은 구간
+	// 버퍼는 할당기 소유이며 매 패스 다시 할당된다
+	FParticleBufferRange MeshInstanceRange;		// 메시 파티클 인스턴스
+	FParticleBufferRange SpriteInstanceRange;	// 스프라이트 파티클 인스턴스
+	FParticleBufferRange BeamVertexRange;		// 빔 정점
+	FParticleBufferRange BeamIndexRange;		// 빔 인덱스
+	FParticleBufferRange RibbonVertexRange;		// 리본 정점
+	FParticleBufferRange RibbonIndexRange;		// 리본 인덱스
 
 	// Shared Quad Mesh (스프라이트 인스턴싱용)
 	// ComPtr + static inline: 프로그램 종료 시 자동 해제, cpp 정의 불필요
@@ -118,6 +123,12 @@ public:
 	void DeactivateSystem();
 	void ResetParticles();
 
+	// 이미터 인스턴스/파티클 메모리를 유지한 채 처음부터 다시 재생 (FParticleSystemPool 재사용)
+	void RewindSystem();
+
+	// 모든 이미터의 방출이 끝나고 살아 있는 파티클이 없는지 (무한 루프 이미터가 있으면 false)
+	bool IsSystemComplete() const;
+
 	// 시뮬레이션 속도 제어 (에디터용)
 	void SetSimulationSpeed(float Speed) { CustomTimeScale = Speed; }
 	float GetSimulationSpeed() const { return CustomTimeScale; }
@@ -157,6 +168,8 @@ public:
 
 	void CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) override;
 
+	FAABB GetWorldAABB() const override;
+
 	// 메시 파티클 인스턴싱
 	void FillMeshInstanceBuffer(uint32 TotalInstances);
 	void CreateMeshParticleBatch(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View);
@@ -177,6 +190,7 @@ private:
 	void InitializeEmitterInstances();
 	void ClearEmitterInstances();
 	void UpdateRenderData();
+	void UpdateParticleBounds();
 
 	// === 테스트용 리소스 (디버그 함수에서 생성, Component가 소유) ===
 	float TestTime = 0.0f;
@@ -92,6 +92,28 @@ void USceneComponent::SetRelativeScale(const FVector& NewScale)
 }
 FVector USceneComponent::GetRelativeScale() const { return RelativeScale; }
 
+void USceneComponent::SetMobility(EComponentMobility InMobility)
+{
+    if (Mobility == InMobility)
+    {
+        return;
+    }
+
+    Mobility = InMobility;
+
+    // 정적 LBVH <-> 동적 트리 이동은 다음 파티션 업데이트에서 처리
+    if (UPrimitiveComponent* Primitive = Cast<UPrimitiveComponent>(this))
+    {
+        if (UWorld* World = GetWorld())
+        {
+            if (UWorldPartitionManager* Partition = World->GetPartitionManager())
+            {
+                Partition->MarkDirty(Primitive);
+            }
+        }
+    }
+}
+
 void USceneComponent::AddRelativeLocation(const FVector& DeltaLocation)
 {
     RelativeLocation = RelativeLocation + DeltaLocation;
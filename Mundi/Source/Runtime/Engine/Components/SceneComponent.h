@@ -35,6 +35,15 @@ enum class ETeleportType : uint8
     ResetPhysics
 };
 
+UENUM()
+enum class EComponentMobility : uint8
+{
+    /** 레벨 로드 후 움직이지 않음 (월드 파티션의 정적 LBVH에 들어감) */
+    Static,
+    /** 매 프레임 움직일 수 있음 (월드 파티션의 동적 AABB 트리에 들어감) */
+    Movable
+};
+
 class URenderer;
 UCLASS(DisplayName="씬 컴포넌트", Description="트랜스폼을 가진 기본 컴포넌트입니다")
 class USceneComponent : public UActorComponent
@@ -55,6 +64,9 @@ public:
     UPROPERTY(EditAnywhere, Category="렌더링")
     bool bIsVisible = true;
 
+    UPROPERTY(EditAnywhere, Category="Transform")
+    EComponentMobility Mobility = EComponentMobility::Static;
+
     UPROPERTY(EditAnywhere, Category="Transform")
     FVector RelativeLocation{ 0,0,0 };
 
@@ -145,6 +157,12 @@ public:
     void SetParentId(uint32 InParentId) { ParentId = InParentId; }
 
     void SetVisibility(bool bInVisibility) { bIsVisible = bInVisibility; }
+
+    // Mobility (월드 파티션의 정적/동적 가속 구조 선택에 사용)
+    void SetMobility(EComponentMobility InMobility);
+    EComponentMobility GetMobility() const { return Mobility; }
+    bool IsMovable() const { return Mobility == EComponentMobility::Movable; }
+
     // World가 Pie인 경우 컴포넌트 자체의 Visibility, HiddenInGame, 액터 자체의 HiddenInGame을 다 테스트후 렌더링
     // Editor인 경우 Visibility와 HiddenInEditor만 체크
     bool IsVisible() const { return GWorld->bPie ? (bIsActive && bIsVisible && !bHiddenInGame) 
@@ -7,6 +7,9 @@
 #include "AnimSingleNodeInstance.h"
 #include "AnimStateMachineInstance.h"
 #include "AnimBlendSpaceInstance.h"
+#include "AnimSharingManager.h"
+#include "AnimUpdateRateManager.h"
+#include "AnimationRuntime.h"
 #include "PhysicsAsset.h"
 #include "BodyInstance.h"
 #include "ConstraintInstance.h"
@@ -46,15 +49,7 @@ void USkeletalMeshComponent::TickComponent(float DeltaTime)
         // 애니메이션만 재생 (물리 없음)
         if (bUseAnimation && AnimInstance && SkeletalMesh->GetSkeleton())
         {
-            AnimInstance->NativeUpdateAnimation(DeltaTime);
-
-            FPoseContext OutputPose;
-            OutputPose.Initialize(this, SkeletalMesh->GetSkeleton(), DeltaTime);
-            AnimInstance->EvaluateAnimation(OutputPose);
-
-            BaseAnimationPose = OutputPose.LocalSpacePose;
-            CurrentLocalSpacePose = OutputPose.LocalSpacePose;
-            ForceRecomputePose();
+            TickAnimationPose(DeltaTime);
         }
         break;
 
@@ -62,15 +57,7 @@ void USkeletalMeshComponent::TickComponent(float DeltaTime)
         // 애니메이션이 물리 바디를 제어
         if (bUseAnimation && AnimInstance && SkeletalMesh->GetSkeleton())
         {
-            AnimInstance->NativeUpdateAnimation(DeltaTime);
-
-            FPoseContext OutputPose;
-            OutputPose.Initialize(this, SkeletalMesh->GetSkeleton(), DeltaTime);
-            AnimInstance->EvaluateAnimation(OutputPose);
-
-            BaseAnimationPose = OutputPose.LocalSpacePose;
-            CurrentLocalSpacePose = OutputPose.LocalSpacePose;
-            ForceRecomputePose();
+            TickAnimationPose(DeltaTime);
         }
 
         // 애니메이션 결과를 물리 바디에 동기화
@@ -90,6 +77,133 @@ void USkeletalMeshComponent::TickComponent(float DeltaTime)
     }
 }
 
+void USkeletalMeshComponent::TickAnimationPose(float DeltaTime)
+{
+    // 재생 시간과 노티파이는 업데이트 레이트와 관계없이 매 프레임 진행
+    AnimInstance->NativeUpdateAnimation(DeltaTime);
+
+    FAnimUpdateRateManager& UpdateRate = FAnimUpdateRateManager::Get();
+    AnimUpdateLOD = EAnimUpdateLOD::Near;
+    if (bEnableUpdateRateOptimizations)
+    {
+        const FVector Scale = GetWorldScale();
+        const float MaxScale = std::max({ std::abs(Scale.X), std::abs(Scale.Y), std::abs(Scale.Z) });
+        const float Radius = std::max(AnimBoundsRadius, 0.1f) * MaxScale;
+        AnimUpdateLOD = UpdateRate.ComputeLOD(GetWorldLocation(), Radius, LastRenderFrame, IsVisible());
+    }
+    UpdateRate.RecordComponent(AnimUpdateLOD);
+
+    // 숨겨진 메시는 포즈를 전혀 갱신하지 않는다. 다시 보이면 보간 없이 바로 평가한다.
+    if (AnimUpdateLOD == EAnimUpdateLOD::Invisible)
+    {
+        bAnimPoseStale = true;
+        AnimInterpSteps = 0;
+        UpdateRate.RecordSkip();
+        return;
+    }
+
+    // 공유 포즈는 복사만 하면 되므로 레이트를 낮추지 않고 매 프레임 적용
+    if (TryApplySharedAnimationPose())
+    {
+        bAnimPoseStale = false;
+        AnimInterpSteps = 0;
+        FramesUntilAnimEval = 0;
+        return;
+    }
+
+    const int32 Rate = bEnableUpdateRateOptimizations ? UpdateRate.GetUpdateRate(AnimUpdateLOD) : 1;
+
+    // 가까워져 레이트가 올라가면 남은 대기 프레임도 줄인다
+    FramesUntilAnimEval = std::min(FramesUntilAnimEval, Rate - 1);
+    if (!bAnimPoseStale && FramesUntilAnimEval > 0)
+    {
+        --FramesUntilAnimEval;
+        if (AnimInterpSteps > 0 && AnimInterpStep < AnimInterpSteps)
+        {
+            ++AnimInterpStep;
+            ApplyInterpolatedAnimationPose();
+            UpdateRate.RecordInterpolation();
+        }
+        else
+        {
+            UpdateRate.RecordSkip();
+        }
+        return;
+    }
+
+    FPoseContext OutputPose;
+    OutputPose.Initialize(this, SkeletalMesh->GetSkeleton(), DeltaTime);
+    AnimInstance->EvaluateAnimation(OutputPose);
+    UpdateRate.RecordEvaluation();
+    FramesUntilAnimEval = Rate - 1;
+
+    // 보이는 메시는 다음 평가 전까지 표시 중인 포즈에서 새 포즈로 나눠 따라간다 (최대 Rate - 1 프레임 지연).
+    // 화면 밖 메시는 보간해도 보이지 않으므로 평가한 포즈를 그대로 유지한다.
+    const bool bInterpolate = Rate > 1 && !bAnimPoseStale && AnimUpdateLOD != EAnimUpdateLOD::Offscreen
+        && BaseAnimationPose.Num() == OutputPose.LocalSpacePose.Num();
+    bAnimPoseStale = false;
+
+    if (bInterpolate)
+    {
+        AnimInterpFromPose = BaseAnimationPose;
+        AnimInterpToPose = OutputPose.LocalSpacePose;
+        AnimInterpStep = 1;
+        AnimInterpSteps = Rate;
+        ApplyInterpolatedAnimationPose();
+        return;
+    }
+
+    AnimInterpSteps = 0;
+    BaseAnimationPose = OutputPose.LocalSpacePose;
+    CurrentLocalSpacePose = OutputPose.LocalSpacePose;
+    ForceRecomputePose();
+}
+
+void USkeletalMeshComponent::ApplyInterpolatedAnimationPose()
+{
+    const float Alpha = static_cast<float>(AnimInterpStep) / static_cast<float>(AnimInterpSteps);
+    FAnimationRuntime::BlendTwoPoses(*SkeletalMesh->GetSkeleton(), AnimInterpFromPose, AnimInterpToPose, Alpha, BaseAnimationPose);
+    CurrentLocalSpacePose = BaseAnimationPose;
+    ForceRecomputePose();
+}
+
+bool USkeletalMeshComponent::TryApplySharedAnimationPose()
+{
+    FAnimSharingManager& Sharing = FAnimSharingManager::Get();
+    if (!bEnableAnimSharing || !Sharing.IsEnabled())
+    {
+        return false;
+    }
+
+    UAnimSingleNodeInstance* Single = Cast<UAnimSingleNodeInstance>(AnimInstance);
+    if (!Single || !Single->CanSharePose())
+    {
+        return false;
+    }
+
+    const FAnimNode_SequencePlayer& Player = Single->GetPlayer();
+    const FAnimExtractContext& ExtractCtx = Player.GetExtractContext();
+
+    uint64 BoneMatrixCalcStart = FWindowsPlatformTime::Cycles64();
+
+    // 그룹의 첫 인스턴스만 실제로 평가하고, 나머지는 결과를 복사한다
+    const FSharedAnimPose* Shared = Sharing.GetOrEvaluate(*SkeletalMesh->GetSkeleton(), Player.GetSequence(),
+        ExtractCtx.CurrentTime, ExtractCtx.bLooping, ExtractCtx.bEnableInterpolation, UUID);
+    if (!Shared)
+    {
+        return false;
+    }
+
+    BaseAnimationPose = Shared->LocalPose;
+    CurrentLocalSpacePose = Shared->LocalPose;
+    CurrentComponentSpacePose = Shared->ComponentPose;
+    GetMutableSkinningMatrices() = Shared->SkinningMatrices;
+
+    const double BoneMatrixCalcTimeMS = FWindowsPlatformTime::ToMilliseconds(FWindowsPlatformTime::Cycles64() - BoneMatrixCalcStart);
+    MarkSkinningMatricesUpdated(BoneMatrixCalcTimeMS);
+    return true;
+}
+
 void USkeletalMeshComponent::SetSkeletalMesh(const FString& PathFileName)
 {
     Super::SetSkeletalMesh(PathFileName);
@@ -101,7 +215,6 @@ void USkeletalMeshComponent::SetSkeletalMesh(const FString& PathFileName)
 
         CurrentLocalSpacePose.SetNum(NumBones);
         CurrentComponentSpacePose.SetNum(NumBones);
-        TempFinalSkinningMatrices.SetNum(NumBones);
 
         for (int32 i = 0; i < NumBones; ++i)
         {
@@ -124,6 +237,14 @@ void USkeletalMeshComponent::SetSkeletalMesh(const FString& PathFileName)
         RefPose = CurrentLocalSpacePose;
         ForceRecomputePose();
 
+        // 업데이트 레이트 판단용 화면 크기 반경
+        AnimBoundsRadius = 0.0f;
+        for (const FTransform& BoneTransform : CurrentComponentSpacePose)
+        {
+            AnimBoundsRadius = std::max(AnimBoundsRadius, BoneTransform.Translation.Size());
+        }
+        bAnimPoseStale = true;
+
         // Rebind anim instance to new skeleton
         if (AnimInstance)
         {
@@ -135,7 +256,6 @@ void USkeletalMeshComponent::SetSkeletalMesh(const FString& PathFileName)
         // 메시 로드 실패 시 버퍼 비우기
         CurrentLocalSpacePose.Empty();
         CurrentComponentSpacePose.Empty();
-        TempFinalSkinningMatrices.Empty();
     }
 }
 
@@ -371,6 +491,10 @@ void USkeletalMeshComponent::UpdateFinalSkinningMatrices()
     // 본 행렬 계산 시간 측정 시작
     uint64 BoneMatrixCalcStart = FWindowsPlatformTime::Cycles64();
 
+    // 임시 배열을 거치지 않고 부모의 스키닝 행렬 버퍼에 직접 기록 (본 수가 같으면 재할당 없음)
+    TArray<FMatrix>& SkinningMatrices = GetMutableSkinningMatrices();
+    SkinningMatrices.SetNum(NumBones);
+
     for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
     {
         const FMatrix& InvBindPose = Skeleton.Bones[BoneIndex].InverseBindPose;
@@ -378,7 +502,7 @@ void USkeletalMeshComponent::UpdateFinalSkinningMatrices()
         // 스케일 포함하여 행렬 생성
         const FMatrix ComponentPoseMatrix = CurrentComponentSpacePose[BoneIndex].ToMatrix();
 
-        TempFinalSkinningMatrices[BoneIndex] = InvBindPose * ComponentPoseMatrix;
+        SkinningMatrices[BoneIndex] = InvBindPose * ComponentPoseMatrix;
     }
 
     // 본 행렬 계산 시간 측정 종료
@@ -387,7 +511,7 @@ void USkeletalMeshComponent::UpdateFinalSkinningMatrices()
 
     // 본 행렬 계산 시간을 부모 USkinnedMeshComponent로 전달
     // 부모에서 실제 스키닝 모드(CPU/GPU)에 따라 통계에 추가됨
-    UpdateSkinningMatrices(TempFinalSkinningMatrices, BoneMatrixCalcTimeMS);
+    MarkSkinningMatricesUpdated(BoneMatrixCalcTimeMS);
 }
 
 void USkeletalMeshComponent::ApplyAdditiveTransforms(const TMap<int32, FTransform>& AdditiveTransforms)
@@ -2,6 +2,7 @@
 #include "SkinnedMeshComponent.h"
 #include "PhysicsAsset.h"
 #include "EPhysicsMode.h"
+#include "AnimUpdateRateManager.h"
 #include "USkeletalMeshComponent.generated.h"
 
 class UAnimInstance;
@@ -122,13 +123,29 @@ protected:
      */
     void ForceRecomputePose();
 
+    /**
+     * @brief 애니메이션 인스턴스를 갱신하고 포즈를 평가 (가능하면 군중 공유 포즈 사용)
+     */
+    void TickAnimationPose(float DeltaTime);
+
+    /**
+     * @brief 같은 시퀀스를 재생하는 인스턴스들과 공유된 포즈를 적용
+     * @return 공유 포즈를 적용했으면 true (단일 시퀀스 재생이 아니거나 공유가 꺼져 있으면 false)
+     */
+    bool TryApplySharedAnimationPose();
+
+    /**
+     * @brief 보간 구간의 현재 단계(AnimInterpStep / AnimInterpSteps)로 포즈를 섞어 적용
+     */
+    void ApplyInterpolatedAnimationPose();
+
     /**
      * @brief CurrentLocalSpacePose를 기반으로 CurrentComponentSpacePose 채우기
      */
     void UpdateComponentSpaceTransforms();
 
     /**
-     * @brief CurrentComponentSpacePose를 기반으로 TempFinalSkinningMatrices 채우기
+     * @brief CurrentComponentSpacePose를 기반으로 부모의 최종 스키닝 행렬을 직접 채우기
      */
     void UpdateFinalSkinningMatrices();
 
@@ -143,11 +160,6 @@ protected:
      */
     TArray<FTransform> CurrentComponentSpacePose;
 
-    /**
-     * @brief 부모에게 보낼 최종 스키닝 행렬 (임시 계산용)
-     */
-    TArray<FMatrix> TempFinalSkinningMatrices;
-
 // FOR TEST!!!
 private:
     float TestTime = 0;
@@ -158,6 +170,24 @@ private:
     UAnimInstance* AnimInstance = nullptr;
     bool bUseAnimation = true;
 
+    // 단일 시퀀스 재생 시 같은 (스켈레톤, 시퀀스, 시간)의 인스턴스들과 포즈 평가를 공유
+    UPROPERTY(EditAnywhere, Category="Animation", Tooltip="군중 애니메이션 공유 허용 (FAnimSharingManager)")
+    bool bEnableAnimSharing = true;
+
+    // 화면 크기와 가시성에 따라 N 프레임마다만 평가하고 그 사이는 보간 (FAnimUpdateRateManager)
+    UPROPERTY(EditAnywhere, Category="Animation", Tooltip="애니메이션 업데이트 레이트 최적화 (멀거나 화면 밖인 메시는 N 프레임마다 평가)")
+    bool bEnableUpdateRateOptimizations = true;
+
+    // 업데이트 레이트 최적화 상태
+    EAnimUpdateLOD AnimUpdateLOD = EAnimUpdateLOD::Near;
+    int32 FramesUntilAnimEval = 0;          // 0이면 이번 프레임에 평가
+    int32 AnimInterpStep = 0;
+    int32 AnimInterpSteps = 0;              // 0이면 보간 중이 아님
+    bool bAnimPoseStale = true;             // 숨김 등으로 포즈가 재생 시간을 따라가지 못함 (다음 평가는 보간 없이 적용)
+    float AnimBoundsRadius = 0.0f;          // 레퍼런스 포즈에서 컴포넌트 원점과 가장 먼 본까지의 거리
+    TArray<FTransform> AnimInterpFromPose;
+    TArray<FTransform> AnimInterpToPose;
+
 // ============================================================================
 // Ragdoll Physics Section
 // ============================================================================
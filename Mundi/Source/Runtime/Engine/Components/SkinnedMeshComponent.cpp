@@ -4,10 +4,12 @@
 #include "SceneView.h"
 #include "SkinningStats.h"
 #include "PlatformTime.h"
+#include "AnimUpdateRateManager.h"
 
 USkinnedMeshComponent::USkinnedMeshComponent() : SkeletalMesh(nullptr)
 {
    bCanEverTick = true;
+   Mobility = EComponentMobility::Movable;
 }
 
 USkinnedMeshComponent::~USkinnedMeshComponent()
@@ -94,6 +96,9 @@ void USkinnedMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMes
 {
     if (!SkeletalMesh || !SkeletalMesh->GetSkeletalMeshData()) { return; }
 
+   // 애니메이션 업데이트 레이트 판단용 (섀도우 뷰에서 그려진 경우도 포함)
+   LastRenderFrame = FAnimUpdateRateManager::Get().GetFrameCounter();
+
    // 전역 스키닝 모드 체크 (언리얼 엔진 방식)
    ESkinningMode GlobalMode = View->RenderSettings->GetGlobalSkinningMode();
    const bool bUseGPU = (GlobalMode == ESkinningMode::ForceGPU);
@@ -197,12 +202,15 @@ void USkinnedMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMes
        }
 
        FMeshBatchElement BatchElement;
-       TArray<FShaderMacro> ShaderMacros = View->ViewShaderMacros;
+       TInlineArray<FShaderMacro, 16> ShaderMacros = View->ViewShaderMacros;
        if (0 < MaterialToUse->GetShaderMacros().Num())
        {
           ShaderMacros.Append(MaterialToUse->GetShaderMacros());
        }
 
+       // 비동기 컴파일 중 사용할 Fallback (정점 포맷이 같아야 하므로 스키닝 매크로는 유지)
+       TInlineArray<FShaderMacro, 16> FallbackMacros = View->ViewShaderMacros;
+
        // GPU 스키닝 매크로 추가 (전역 설정 적용)
        if (bUseGPU)
        {
@@ -210,9 +218,10 @@ void USkinnedMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMes
           GPUSkinningMacro.Name = FName("GPU_SKINNING");
           GPUSkinningMacro.Definition = FName("1");
           ShaderMacros.Add(GPUSkinningMacro);
+          FallbackMacros.Add(GPUSkinningMacro);
        }
 
-       FShaderVariant* ShaderVariant = ShaderToUse->GetOrCompileShaderVariant(ShaderMacros);
+       FShaderVariant* ShaderVariant = ShaderToUse->GetOrCompileShaderVariantAsync(ShaderMacros, FallbackMacros);
 
        if (ShaderVariant)
        {
@@ -456,6 +465,11 @@ void USkinnedMeshComponent::PerformSkinning(bool bUseGPU)
 void USkinnedMeshComponent::UpdateSkinningMatrices(const TArray<FMatrix>& InSkinningMatrices, double BoneMatrixCalcTimeMS)
 {
    FinalSkinningMatrices = InSkinningMatrices;
+   MarkSkinningMatricesUpdated(BoneMatrixCalcTimeMS);
+}
+
+void USkinnedMeshComponent::MarkSkinningMatricesUpdated(double BoneMatrixCalcTimeMS)
+{
    LastBoneMatrixCalcTimeMS = BoneMatrixCalcTimeMS;
    bSkinningMatricesDirty = true;
 }
@@ -544,22 +558,16 @@ void USkinnedMeshComponent::UpdateBoneMatrixBuffer()
    // 버퍼 크기는 항상 MAX_BONES 크기로 고정 (256 * 64 = 16384 bytes)
    const int32 AlignedBufferSize = MAX_BONES * sizeof(FMatrix);
 
-   // 동적 배열로 본 행렬 데이터 준비 (MAX_BONES 크기로 생성)
-   TArray<FMatrix> BufferData;
-   BufferData.SetNum(MAX_BONES);
-
-   // 실제 본 행렬 복사
+   // 실제 본 행렬을 복사하고 나머지는 Identity 행렬로 채움 (안전성 확보)
    const int32 BonesToCopy = FMath::Min(NumBones, MAX_BONES);
-   for (int32 i = 0; i < BonesToCopy; ++i)
+   auto FillBoneMatrices = [&](FMatrix* OutMatrices)
    {
-      BufferData[i] = FinalSkinningMatrices[i];
-   }
-
-   // 나머지는 Identity 행렬로 채움 (안전성 확보)
-   for (int32 i = BonesToCopy; i < MAX_BONES; ++i)
-   {
-      BufferData[i] = FMatrix::Identity();
-   }
+      memcpy(OutMatrices, FinalSkinningMatrices.GetData(), BonesToCopy * sizeof(FMatrix));
+      for (int32 i = BonesToCopy; i < MAX_BONES; ++i)
+      {
+         OutMatrices[i] = FMatrix::Identity();
+      }
+   };
 
    ID3D11Device* Device = GEngine.GetRHIDevice()->GetDevice();
    ID3D11DeviceContext* Context = GEngine.GetRHIDevice()->GetDeviceContext();
@@ -588,6 +596,11 @@ void USkinnedMeshComponent::UpdateBoneMatrixBuffer()
       BufferDesc.MiscFlags = 0;
       BufferDesc.StructureByteStride = 0;
 
+      // 생성 시에만 임시 배열로 초기 데이터를 준비
+      TArray<FMatrix> BufferData;
+      BufferData.SetNum(MAX_BONES);
+      FillBoneMatrices(BufferData.GetData());
+
       D3D11_SUBRESOURCE_DATA InitData;
       ZeroMemory(&InitData, sizeof(InitData));
       InitData.pSysMem = BufferData.GetData();
@@ -609,8 +622,8 @@ void USkinnedMeshComponent::UpdateBoneMatrixBuffer()
       HRESULT hr = Context->Map(BoneMatricesBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MappedResource);
       if (SUCCEEDED(hr))
       {
-         // 전체 버퍼 크기만큼 복사 (MAX_BONES * sizeof(FMatrix))
-         memcpy(MappedResource.pData, BufferData.GetData(), AlignedBufferSize);
+         // 매핑된 메모리에 직접 기록 (MAX_BONES * sizeof(FMatrix), 프레임마다 임시 배열 할당 없음)
+         FillBoneMatrices(static_cast<FMatrix*>(MappedResource.pData));
          Context->Unmap(BoneMatricesBuffer, 0);
       }
       else
@@ -55,6 +55,12 @@ protected:
      */
     void UpdateSkinningMatrices(const TArray<FMatrix>& InSkinningMatrices, double BoneMatrixCalcTimeMS = 0.0);
 
+    /**
+     * @brief 스키닝 행렬을 복사 없이 직접 채우기 위한 버퍼. 채운 뒤 MarkSkinningMatricesUpdated를 호출
+     */
+    TArray<FMatrix>& GetMutableSkinningMatrices() { return FinalSkinningMatrices; }
+    void MarkSkinningMatricesUpdated(double BoneMatrixCalcTimeMS = 0.0);
+
     /**
      * @brief GPU 스키닝을 위해 본 행렬을 GPU 버퍼로 업로드
      */
@@ -66,6 +72,11 @@ protected:
      */
     TArray<FNormalVertex> SkinnedVertices;
 
+    /**
+     * @brief 마지막으로 메시 배치를 수집한 프레임 (FAnimUpdateRateManager::GetFrameCounter 기준)
+     */
+    uint64 LastRenderFrame = 0;
+
 private:
     FVector SkinVertexPosition(const FSkinnedVertex& InVertex) const;
     FVector SkinVertexNormal(const FSkinnedVertex& InVertex) const;
@@ -54,7 +54,8 @@ void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMesh
 			}
 			else
 			{
-				UE_LOG("UStaticMeshComponent: 머티리얼이 없거나 셰이더가 없어서 기본 머티리얼 사용 section %u.", SectionIndex);
+				// 매 프레임 호출되는 경로이므로 기본 상세도에서는 출력하지 않음
+				UE_LOG_CATEGORY(LogRender, Verbose, "UStaticMeshComponent: 머티리얼이 없거나 셰이더가 없어서 기본 머티리얼 사용 section %u.", SectionIndex);
 				Material = UResourceManager::GetInstance().GetDefaultMaterial();
 				if (Material)
 				{
@@ -62,7 +63,7 @@ void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMesh
 				}
 				if (!Material || !Shader)
 				{
-					UE_LOG("UStaticMeshComponent: 기본 머티리얼이 없습니다.");
+					UE_LOG_CATEGORY(LogRender, Warning, "UStaticMeshComponent: 기본 머티리얼이 없습니다.");
 					return { nullptr, nullptr };
 				}
 			}
@@ -101,13 +102,14 @@ void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMesh
 		}
 
 		FMeshBatchElement BatchElement;
-		// View 모드 전용 매크로와 머티리얼 개인 매크로를 결합한다
-		TArray<FShaderMacro> ShaderMacros = View->ViewShaderMacros;
+		// View 모드 전용 매크로와 머티리얼 개인 매크로를 결합한다 (배치마다 만들어지므로 인라인 배열로 힙 할당을 피함)
+		TInlineArray<FShaderMacro, 16> ShaderMacros = View->ViewShaderMacros;
 		if (0 < MaterialToUse->GetShaderMacros().Num())
 		{
 			ShaderMacros.Append(MaterialToUse->GetShaderMacros());
 		}
-		FShaderVariant* ShaderVariant = ShaderToUse->GetOrCompileShaderVariant(ShaderMacros);
+		// 처음 보는 머티리얼 조합은 백그라운드에서 컴파일하고, 그동안 뷰 기본 Variant로 그린다
+		FShaderVariant* ShaderVariant = ShaderToUse->GetOrCompileShaderVariantAsync(ShaderMacros, View->ViewShaderMacros);
 
 		if (ShaderVariant)
 		{
@@ -116,6 +116,14 @@ void UVehicleMovementComponent::BeginPlay()
     Super::BeginPlay();
     
     SetupVehicle();
+
+    // 차량 시뮬레이션은 물리 서브스텝과 같은 고정 스텝으로 갱신해야 프레임레이트와 무관하게 동작함
+    UWorld* World = GetWorld();
+    if (World && World->GetPhysicsScene() && !StepPhysScene)
+    {
+        StepPhysScene = World->GetPhysicsScene();
+        PhysSceneStepHandle = StepPhysScene->OnPhysSceneStep.AddDynamic(this, &UVehicleMovementComponent::OnPhysSceneStep);
+    }
 }
 
 void UVehicleMovementComponent::OnRegister(UWorld* InWorld)
@@ -133,6 +141,13 @@ void UVehicleMovementComponent::OnUnregister()
 {
     Super::OnUnregister();
 
+    if (StepPhysScene)
+    {
+        StepPhysScene->OnPhysSceneStep.Remove(PhysSceneStepHandle);
+        StepPhysScene = nullptr;
+        PhysSceneStepHandle = 0;
+    }
+
     ReleaseVehicle();
     
     if (PInputData)
@@ -480,7 +495,11 @@ void UVehicleMovementComponent::TickComponent(float DeltaSeconds)
     UPrimitiveComponent* MeshComp = Cast<UPrimitiveComponent>(UpdatedComponent);
     if (!MeshComp || !MeshComp->GetBodyInstance()) { return; }
 
-    UpdateVehicleSimulation(DeltaSeconds);
+    // 서브스텝 델리게이트가 없을 때만 프레임 단위로 갱신 (OnPhysSceneStep 참고)
+    if (!StepPhysScene)
+    {
+        UpdateVehicleSimulation(DeltaSeconds);
+    }
     
     ProcessVehicleInput(DeltaSeconds);
 
@@ -604,6 +623,16 @@ void UVehicleMovementComponent::UpdateVehicleSimulation(float DeltaTime)
     }
 }
 
+void UVehicleMovementComponent::OnPhysSceneStep(float FixedDeltaTime)
+{
+    if (!PVehicleDrive || !UpdatedComponent) { return; }
+
+    UPrimitiveComponent* MeshComp = Cast<UPrimitiveComponent>(UpdatedComponent);
+    if (!MeshComp || !MeshComp->GetBodyInstance()) { return; }
+
+    UpdateVehicleSimulation(FixedDeltaTime);
+}
+
 void UVehicleMovementComponent::BalanceVehicle(float DeltaSeconds)
 {
     if (PVehicleDrive && IsAllWheelGrounded())
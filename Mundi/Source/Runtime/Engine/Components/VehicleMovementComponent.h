@@ -209,6 +209,9 @@ private:
     /** 물리 시뮬레이션 (레이캐스트 및 차량 업데이트) */
     void UpdateVehicleSimulation(float DeltaTime);
 
+    /** FPhysScene 서브스텝마다 고정 스텝으로 차량을 갱신 */
+    void OnPhysSceneStep(float FixedDeltaTime);
+
     void BalanceVehicle(float DeltaSeconds);
 
     void DownForceIfDecelerate(float DeltaTime);
@@ -243,4 +246,8 @@ private:
 
     /** [더미 버퍼] "TouchBuffer is NULL" 에러 방지용 (사용은 안함) */
     physx::PxRaycastHit* BatchQueryTouchBuffer;
+
+    /** 서브스텝 델리게이트 등록 정보 (등록되지 않았으면 TickComponent에서 프레임 단위로 갱신) */
+    FPhysScene* StepPhysScene = nullptr;
+    FDelegateHandle PhysSceneStepHandle = 0;
 };
\ No newline at end of file
@@ -9,6 +9,11 @@
 #include <ObjManager.h>
 
 #include "PhysicalMaterialLoader.h"
+#include "ShaderCompileManager.h"
+#include "Occlusion.h"
+#include "ParticleDynamicBuffer.h"
+#include "AnimSharingManager.h"
+#include "AnimUpdateRateManager.h"
 #include "Source/Runtime/Engine/PhysicsEngine/PhysXSupport.h"
 #include "Source/Runtime/Engine/Cloth/ClothManager.h"
 
@@ -233,6 +238,15 @@ void UEditorEngine::Tick(float DeltaSeconds)
     //@TODO UV 스크롤 입력 처리 로직 이동
     HandleUVInput(DeltaSeconds);
     
+    // 프레임 선형 할당자 경계 (지난 프레임의 임시 데이터는 각 스레드의 다음 할당 때 회수)
+    FMemoryManager::BeginFrame();
+
+    // 군중 애니메이션 공유 캐시의 프레임 경계 (모든 월드가 같은 캐시를 공유)
+    FAnimSharingManager::Get().BeginFrame();
+
+    // 애니메이션 업데이트 레이트 판단 기준을 지난 프레임의 뷰로 넘긴다
+    FAnimUpdateRateManager::Get().BeginFrame();
+
     //@TODO: Delta Time 계산 + EditorActor Tick은 어떻게 할 것인가 
     for (auto& WorldContext : WorldContexts)
     {
@@ -341,13 +355,18 @@ void UEditorEngine::MainLoop()
         }
         // 크래시 모드가 활성화되면 매 프레임마다 랜덤 객체 삭제
         FPlatformCrashHandler::TickCrashMode();
-        ClothManager->Tick(DeltaSeconds);
         Tick(DeltaSeconds);
+        // 천 시뮬레이션은 워커 스레드에서 렌더링 준비와 겹쳐 실행 (ClothComponent::CollectMeshBatches에서 합류)
+        ClothManager->StartSimulation(DeltaSeconds);
         Render();
+        ClothManager->WaitForSimulation();
         
         // Shader Hot Reloading - Call AFTER render to avoid mid-frame resource conflicts
         // This ensures all GPU commands are submitted before we check for shader updates
         UResourceManager::GetInstance().CheckAndReloadShaders(DeltaSeconds);
+
+        // 백그라운드에서 컴파일이 끝난 셰이더 Variant를 반영 (D3D 객체 생성은 게임 스레드에서)
+        FShaderCompileManager::GetInstance().ProcessCompletedJobs();
     }
 }
 
@@ -365,6 +384,13 @@ void UEditorEngine::Shutdown()
     UUIManager::GetInstance().Release();
 
     USlateManager::GetInstance().Shutdown();
+    // 셰이더 컴파일 워커가 UShader를 참조하지 않도록 리소스 해제 전에 종료
+    FShaderCompileManager::GetInstance().Shutdown();
+    // 오클루더 캐시가 UStaticMesh 포인터를 키로 쓰므로 함께 정리
+    FOcclusionCullingManagerCPU::GetInstance().Shutdown();
+    // 파티클 공유 링 버퍼 해제 (RHI 해제 전)
+    FParticleDynamicBufferAllocator::GetInstance().Shutdown();
+
     // Delete all UObjects (Components, Actors, Resources)
     // Resource destructors will properly release D3D resources
     ObjectFactory::DeleteAll(true);
@@ -390,6 +416,9 @@ void UEditorEngine::Shutdown()
     RHIDevice.Release();
 
     SaveIniFile();
+
+    // 남은 로그를 파일에 쓰고 드레인 스레드 종료
+    FLogManager::GetInstance().Shutdown();
 }
 
 
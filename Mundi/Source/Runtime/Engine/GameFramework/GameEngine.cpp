@@ -8,6 +8,11 @@
 #include "FAudioDevice.h"
 #include "GameUI/SGameHUD.h"
 #include "PhysXSupport.h"
+#include "ShaderCompileManager.h"
+#include "Occlusion.h"
+#include "ParticleDynamicBuffer.h"
+#include "AnimSharingManager.h"
+#include "AnimUpdateRateManager.h"
 #include <sol/sol.hpp>
 
 float UGameEngine::ClientWidth = 1024.0f;
@@ -232,6 +237,15 @@ void UGameEngine::Tick(float DeltaSeconds)
     //@TODO UV 스크롤 입력 처리 로직 이동
     HandleUVInput(DeltaSeconds);
 
+    // 프레임 선형 할당자 경계 (지난 프레임의 임시 데이터는 각 스레드의 다음 할당 때 회수)
+    FMemoryManager::BeginFrame();
+
+    // 군중 애니메이션 공유 캐시의 프레임 경계 (모든 월드가 같은 캐시를 공유)
+    FAnimSharingManager::Get().BeginFrame();
+
+    // 애니메이션 업데이트 레이트 판단 기준을 지난 프레임의 뷰로 넘긴다
+    FAnimUpdateRateManager::Get().BeginFrame();
+
     for (auto& WorldContext : WorldContexts)
     {
         WorldContext.World->Tick(DeltaSeconds);
@@ -336,6 +350,9 @@ void UGameEngine::MainLoop()
         // Shader Hot Reloading - Call AFTER render to avoid mid-frame resource conflicts
         // This ensures all GPU commands are submitted before we check for shader updates
         UResourceManager::GetInstance().CheckAndReloadShaders(DeltaSeconds);
+
+        // 백그라운드에서 컴파일이 끝난 셰이더 Variant를 반영 (D3D 객체 생성은 게임 스레드에서)
+        FShaderCompileManager::GetInstance().ProcessCompletedJobs();
     }
 }
 
@@ -348,6 +365,13 @@ void UGameEngine::Shutdown()
     }
     WorldContexts.clear();
 
+    // 셰이더 컴파일 워커가 UShader를 참조하지 않도록 리소스 해제 전에 종료
+    FShaderCompileManager::GetInstance().Shutdown();
+    // 오클루더 캐시가 UStaticMesh 포인터를 키로 쓰므로 함께 정리
+    FOcclusionCullingManagerCPU::GetInstance().Shutdown();
+    // 파티클 공유 링 버퍼 해제 (RHI 해제 전)
+    FParticleDynamicBufferAllocator::GetInstance().Shutdown();
+
     // Delete all UObjects (Components, Actors, Resources)
     // Resource destructors will properly release D3D resources
     ObjectFactory::DeleteAll(true);
@@ -369,4 +393,7 @@ void UGameEngine::Shutdown()
     RHIDevice.Release();
 
     SaveIniFile();
+
+    // 남은 로그를 파일에 쓰고 드레인 스레드 종료
+    FLogManager::GetInstance().Shutdown();
 }
@@ -33,6 +33,8 @@
 #include "PlayerCameraManager.h"
 #include "Hash.h"
 #include "ParticleEventManager.h"
+#include "ParticleSystemPool.h"
+#include "ParticleSignificanceManager.h"
 #include "GameModeBase.h"
 #include "GameStateBase.h"
 #include "PlayerController.h"
@@ -49,6 +51,8 @@ UWorld::UWorld() : Partition(nullptr)  // Will be created in Initialize() based
 	LightManager = std::make_unique<FLightManager>();
 	LightManager->SetOwningWorld(this);  // Set owning world for optimization decisions
 	LuaManager = std::make_unique<FLuaManager>();
+	ParticleSystemPool = std::make_unique<FParticleSystemPool>(this);
+	ParticleSignificanceManager = std::make_unique<FParticleSignificanceManager>(this);
 
 	UnscaledDelta = 0;
 	SlomoOnlyDelta = 0;
@@ -195,6 +199,12 @@ bool UWorld::TryLoadLastUsedLevel()
 
 bool UWorld::LoadLevelFromFile(const FWideString& Path)
 {
+	// 스트리밍 매니페스트는 상주 씬만 로드하고 나머지 셀은 파티션이 스트리밍
+	if (Partition && std::filesystem::path(Path).extension() == L".streaming")
+	{
+		return Partition->OpenStreaming(this, Path);
+	}
+
 	std::unique_ptr<ULevel> NewLevel = ULevelService::CreateDefaultLevel();
 	JSON LevelJsonData;
 
@@ -246,6 +256,9 @@ void UWorld::Tick(float DeltaSeconds)
     SlomoOnlyDelta = UnscaledDeltaSeconds * TimeDilation;
     GameDelta = UnscaledDeltaSeconds * TimeDilation * TimeStopDilation;
 
+	// 파티클 시스템 중요도 판정과 예산 분배 (이 월드의 지난 프레임 뷰/렌더 기록 기준)
+	ParticleSignificanceManager->BeginFrame();
+
 	// 물리 시뮬레이션 시작 (비동기)
 	if (PhysScene)
 	{
@@ -255,7 +268,9 @@ void UWorld::Tick(float DeltaSeconds)
 	// Actor 별로 Dilation의 Duration을 처리하는 부분
 	if (!ActorTimingMap.IsEmpty())
 	{
-		TArray<TWeakObjectPtr<AActor>> ToRemove;
+		// 이 블록에서만 쓰는 임시 배열이므로 프레임 스택에서 할당 (블록을 나가면 회수)
+		FFrameStackMark FrameStackMark;
+		TFrameArray<TWeakObjectPtr<AActor>> ToRemove;
 
 		for (auto& Pair : ActorTimingMap)
 		{
@@ -291,6 +306,9 @@ void UWorld::Tick(float DeltaSeconds)
 
 	if (Level)
 	{
+		// 완료된 풀 이펙트 회수, 부착 이펙트 위치 갱신 (이번 틱에 스폰된 이펙트는 다음 틱에 검사)
+		ParticleSystemPool->Tick();
+
 		// Tick 중에 새로운 actor가 추가될 수도 있어서 복사 후 호출
 		TArray<AActor*> LevelActors = Level->GetActors();
 
@@ -483,6 +501,8 @@ bool UWorld::DestroyActor(AActor* Actor)
 	// 레벨에서 제거 시도
 	if (Level && Level->RemoveActor(Actor))
 	{
+		OnActorRemoved.Broadcast(Actor);
+
 		// 메모리 해제
 		ObjectFactory::DeleteObject(Actor);
 		return true; // 성공적으로 삭제
@@ -563,6 +583,8 @@ void UWorld::SetLevel(std::unique_ptr<ULevel> InLevel)
 	PlayerCameraManager = nullptr;
 	// ParticleEventManager는 Level의 액터로 등록되어 있으므로 아래 for문에서 삭제됨
 	ParticleEventManager = nullptr;
+	// 풀 호스트 액터도 레벨 액터이므로 함께 삭제됨 (참조만 비움)
+	ParticleSystemPool->Reset();
 
     // Cleanup current
     if (Level)
@@ -619,6 +641,8 @@ void UWorld::SetLevel(std::unique_ptr<ULevel> InLevel)
     // Clean any dangling selection references just in case
     if (SelectionMgr)
 		SelectionMgr->CleanupInvalidActors();
+
+	OnLevelChanged.Broadcast();
 }
 
 void UWorld::AddActorToLevel(AActor* Actor)
@@ -630,9 +654,22 @@ void UWorld::AddActorToLevel(AActor* Actor)
 		Actor->SetWorld(this);
 
 		Actor->RegisterAllComponents(this);
+
+		OnActorAdded.Broadcast(Actor);
 	}
 }
 
+void UWorld::RenameActor(AActor* Actor, const FName& NewName)
+{
+	if (!Actor)
+	{
+		return;
+	}
+
+	Actor->ObjectName = NewName;
+	OnActorRenamed.Broadcast(Actor);
+}
+
 void UWorld::AddPendingKillActor(AActor* Actor)
 {
 	PendingKillActors.Add(Actor);
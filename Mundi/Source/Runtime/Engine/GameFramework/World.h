@@ -6,6 +6,7 @@
 #include "Gizmo/GizmoActor.h"
 #include "LightManager.h"
 #include "WeakObjectPtr.h"
+#include "Delegates.h"
 
 class FPhysScene;
 // Forward Declarations
@@ -30,13 +31,14 @@ class UStaticMesh;
 class FOcclusionCullingManagerCPU;
 class APlayerCameraManager;
 class AParticleEventManager;
+class FParticleSystemPool;
+class FParticleSignificanceManager;
 class UCollisionManager;
 class AGameModeBase;
 
 struct FTransform;
 struct FSceneCompData;
 struct Frustum;
-struct FCandidateDrawable;
 
 enum EDeltaTime { Unscaled, SlomoOnly, Game };
 struct FActorTimeState
@@ -103,6 +105,9 @@ public:
     AActor* SpawnPrefabActor(const FWideString& PrefabPath);
     void AddActorToLevel(AActor* Actor);
 
+    /** 액터 이름을 바꾸고 OnActorRenamed를 알립니다. (아웃라이너 등 이름 인덱스 갱신용) */
+    void RenameActor(AActor* Actor, const FName& NewName);
+
     void AddPendingKillActor(AActor* Actor);
     void ProcessPendingKillActors();
 
@@ -146,6 +151,8 @@ public:
     AGridActor* GetGridActor() { return GridActor; }
     UWorldPartitionManager* GetPartitionManager() { return Partition.get(); }
     AParticleEventManager* GetParticleEventManager() { return ParticleEventManager; }
+    FParticleSystemPool* GetParticleSystemPool() const { return ParticleSystemPool.get(); }
+    FParticleSignificanceManager* GetParticleSignificanceManager() const { return ParticleSignificanceManager.get(); }
     UCollisionManager* GetCollisionManager() { return CollisionManager.get(); }
     FPhysScene* GetPhysicsScene() { return PhysScene.get(); }
 
@@ -159,6 +166,25 @@ public:
     void RequestHitStop(float Duration ,float Dilation = 0.0f); 
     void RequestSlomo(float Duration, float Dilation = 0.0f);
 
+    // ════════════════════════════════════════════════════════════════════════
+    // 액터 목록 변경 이벤트 (에디터 UI가 매 프레임 전체 목록을 비교하지 않도록)
+    // ════════════════════════════════════════════════════════════════════════
+
+    /** 액터가 레벨에 등록된 직후 (AddActorToLevel) */
+    DECLARE_DELEGATE(OnActorAdded, AActor*);
+
+    /** 액터가 레벨에서 제거된 직후, 메모리 해제 직전 (DestroyActor) */
+    DECLARE_DELEGATE(OnActorRemoved, AActor*);
+
+    /** 액터 이름이 바뀐 직후 (RenameActor) */
+    DECLARE_DELEGATE(OnActorRenamed, AActor*);
+
+    /**
+     * 레벨이 통째로 교체된 직후 (SetLevel)
+     * @note 이전 레벨의 액터는 개별 OnActorRemoved 없이 해제되므로 구독자는 보관한 포인터를 모두 버려야 한다.
+     */
+    DECLARE_DELEGATE(OnLevelChanged);
+
 private:
     bool DestroyActor(AActor* Actor);   // 즉시 삭제
 
@@ -184,6 +210,12 @@ private:
     /** === 루아 매니저 ===*/
     std::unique_ptr<FLuaManager> LuaManager;
     
+    /** === 일회성 파티클 이펙트 풀 ===*/
+    std::unique_ptr<FParticleSystemPool> ParticleSystemPool;
+
+    /** === 파티클 중요도/예산 (월드별 뷰와 예산) ===*/
+    std::unique_ptr<FParticleSignificanceManager> ParticleSignificanceManager;
+
     /** === PhysX Scene ===*/
     std::unique_ptr<FPhysScene> PhysScene;
     
@@ -10,6 +10,7 @@
 #include "StaticMeshComponent.h"
 #include "Frustum.h"
 #include "Gizmo/GizmoActor.h"
+#include "WorldPartitionStreaming.h"
 
 IMPLEMENT_CLASS(UWorldPartitionManager)
 
@@ -36,6 +37,11 @@ UWorldPartitionManager::~UWorldPartitionManager()
 		delete BVH;
 		BVH = nullptr;
 	}
+	if (Streaming)
+	{
+		delete Streaming;
+		Streaming = nullptr;
+	}
 }
 
 void UWorldPartitionManager::Clear()
@@ -45,6 +51,21 @@ void UWorldPartitionManager::Clear()
 
 	ComponentDirtyQueue.Empty();
 	ComponentDirtySet.Empty();
+
+	// 레벨 교체로 스트리밍된 액터도 함께 삭제되었으므로 셀 상태만 초기화
+	if (Streaming)
+	{
+		Streaming->Reset();
+	}
+}
+
+bool UWorldPartitionManager::OpenStreaming(UWorld* InWorld, const FWideString& InManifestPath)
+{
+	if (!Streaming)
+	{
+		Streaming = new FWorldPartitionStreaming(InWorld);
+	}
+	return Streaming->Open(InManifestPath);
 }
 
 // 새로 만들어진 PrimitiveComponent를 등록하는 상황에서 맥락을 분명히 드러내기 위한 API입니다.
@@ -74,7 +95,7 @@ void UWorldPartitionManager::BulkRegister(const TArray<AActor*>& Actors)
 			if (UPrimitiveComponent* Smc = Cast<UPrimitiveComponent>(Component))
 			{
 				StaticMeshComponents.push_back(Smc);
-				ComponentDirtySet.erase(Smc);
+				ComponentDirtySet.Remove(Smc);
 			}
 		}
 	}
@@ -88,7 +109,7 @@ void UWorldPartitionManager::Unregister(UPrimitiveComponent* Component)
 	{
 		if (BVH) BVH->Remove(Smc);
 
-		ComponentDirtySet.erase(Smc);
+		ComponentDirtySet.Remove(Smc);
 	}
 }
 
@@ -127,9 +148,9 @@ void UWorldPartitionManager::MarkDirty(UPrimitiveComponent* Smc)
 		return;
 	}
 
-	// second: 새로운 요소가 성공적으로 삽입되었으면 true, 이미 요소가 존재하여 삽입에 실패했으면 false
+	// Add: 새로운 요소가 성공적으로 삽입되었으면 true, 이미 요소가 존재하여 삽입에 실패했으면 false
 	// DirtyQueue 중복 삽입 방지 로직
-	if (ComponentDirtySet.insert(Smc).second)
+	if (ComponentDirtySet.Add(Smc))
 	{
 		ComponentDirtyQueue.push(Smc);
 	}
@@ -137,6 +158,12 @@ void UWorldPartitionManager::MarkDirty(UPrimitiveComponent* Smc)
 
 void UWorldPartitionManager::Update(float DeltaTime, const uint32 BudgetCount)
 {
+	// 스트리밍으로 활성화된 액터는 아래 더티 큐를 통해 이번 프레임에 등록된다
+	if (Streaming && Streaming->IsActive())
+	{
+		Streaming->Tick();
+	}
+
 	// 프레임 히칭 방지를 위해 컴포넌트 카운트 제한
 	uint32 processed = 0;
 	while (processed < BudgetCount)
@@ -147,21 +174,26 @@ void UWorldPartitionManager::Update(float DeltaTime, const uint32 BudgetCount)
 			break;
 		}
 
-		if (ComponentDirtySet.erase(Component) == 0)
+		if (!ComponentDirtySet.Remove(Component))
 		{
 			// 이미 처리되었거나 제거됨
 			continue;
 		}
 
 		if (!Component) continue;
+		// Movable 컴포넌트는 동적 트리에서 바로 갱신되고, Static 컴포넌트만 LBVH 리빌드를 예약한다
 		if (BVH) BVH->Update(Component);
 
 		++processed;
 	}
 
-	if (BVH)
+	// 레벨 로드처럼 여러 프레임에 걸쳐 등록되는 동안에는 리빌드를 미뤄 정적 LBVH를 한 번만 만든다
+	// 단, 매 프레임 예산을 넘는 더티 컴포넌트가 쌓이는 씬에서도 일정 간격마다는 반영한다
+	++FramesSinceStaticFlush;
+	if (BVH && (ComponentDirtyQueue.empty() || FramesSinceStaticFlush >= MaxFramesBetweenStaticFlush))
 	{
 		BVH->FlushRebuild();
+		FramesSinceStaticFlush = 0;
 	}
 }
 
@@ -0,0 +1,737 @@
+﻿#include "pch.h"
+#include "WorldPartitionStreaming.h"
+#include "Actor.h"
+#include "SceneComponent.h"
+#include "CameraActor.h"
+#include "CameraComponent.h"
+#include "PlayerCameraManager.h"
+#include "PlatformTime.h"
+#include <filesystem>
+
+namespace
+{
+	inline uint64 MakeCellKey(int32 X, int32 Y)
+	{
+		return (static_cast<uint64>(static_cast<uint32>(X)) << 32) | static_cast<uint32>(Y);
+	}
+
+	inline int32 ToCellCoord(float Value, float InCellSize)
+	{
+		return static_cast<int32>(std::floor(Value / InCellSize));
+	}
+
+	/**
+	 * 쿠킹 시 액터 분류: 스태틱 메시를 가진 액터만 셀로 보내고 루트 컴포넌트 위치를 셀 좌표로 사용
+	 * (라이트, 게임 모드, 카메라 매니저, 캐릭터 등은 상주 씬에 남긴다)
+	 */
+	bool GetStreamableActorLocation(const JSON& InActorJson, FVector& OutLocation)
+	{
+		uint32 RootId = 0;
+		FJsonSerializer::ReadUint32(InActorJson, "RootComponentId", RootId, 0, false);
+
+		JSON ComponentsJson;
+		if (!FJsonSerializer::ReadArray(InActorJson, "OwnedComponents", ComponentsJson, nullptr, false))
+		{
+			return false;
+		}
+
+		bool bHasStaticMesh = false;
+		bool bFoundRoot = false;
+		for (const JSON& ComponentJson : ComponentsJson.ArrayRange())
+		{
+			FString TypeString;
+			FJsonSerializer::ReadString(ComponentJson, "Type", TypeString, "", false);
+			if (TypeString == "UStaticMeshComponent")
+			{
+				bHasStaticMesh = true;
+			}
+
+			uint32 Id = 0;
+			FJsonSerializer::ReadUint32(ComponentJson, "Id", Id, 0, false);
+			if (Id == RootId)
+			{
+				bFoundRoot = FJsonSerializer::ReadVector(ComponentJson, "RelativeLocation", OutLocation, FVector::Zero(), false);
+			}
+		}
+
+		return bHasStaticMesh && bFoundRoot;
+	}
+}
+
+FWorldPartitionStreaming::FWorldPartitionStreaming(UWorld* InWorld)
+	: World(InWorld)
+{
+}
+
+FWorldPartitionStreaming::~FWorldPartitionStreaming()
+{
+	StopWorkers();
+}
+
+bool FWorldPartitionStreaming::CookScene(const FWideString& InScenePath, float InCellSize, FString& OutMessage)
+{
+	if (InCellSize <= 0.0f)
+	{
+		OutMessage = "Cell size must be positive";
+		return false;
+	}
+
+	JSON SceneJson;
+	if (!FJsonSerializer::LoadJsonFromFile(SceneJson, InScenePath))
+	{
+		OutMessage = "Failed to load scene: " + WideToUTF8(InScenePath);
+		return false;
+	}
+
+	JSON ActorListJson;
+	if (!FJsonSerializer::ReadObject(SceneJson, "Actors", ActorListJson, nullptr, false))
+	{
+		OutMessage = "Scene has no actors";
+		return false;
+	}
+
+	const std::filesystem::path ScenePath(InScenePath);
+	const std::wstring SceneStem = ScenePath.stem().wstring();
+	const std::filesystem::path CellDir = ScenePath.parent_path() / (SceneStem + L"_Cells");
+	std::error_code ErrorCode;
+	std::filesystem::create_directories(CellDir, ErrorCode);
+
+	// 셀별 액터 분배
+	TMap<uint64, JSON> CellActorJsons;
+	TMap<uint64, TPair<int32, int32>> CellCoords;
+	TMap<uint64, int32> CellActorCounts;
+	JSON PersistentActors = json::Object();
+	int32 NumStreamed = 0;
+
+	for (auto& Pair : ActorListJson.ObjectRange())
+	{
+		FVector Location;
+		if (!GetStreamableActorLocation(Pair.second, Location))
+		{
+			PersistentActors[Pair.first] = Pair.second;
+			continue;
+		}
+
+		const int32 X = ToCellCoord(Location.X, InCellSize);
+		const int32 Y = ToCellCoord(Location.Y, InCellSize);
+		const uint64 Key = MakeCellKey(X, Y);
+
+		if (!CellActorJsons.Contains(Key))
+		{
+			CellActorJsons.Add(Key, json::Object());
+			CellCoords.Add(Key, TPair<int32, int32>(X, Y));
+			CellActorCounts.Add(Key, 0);
+		}
+		(*CellActorJsons.Find(Key))[Pair.first] = Pair.second;
+		++(*CellActorCounts.Find(Key));
+		++NumStreamed;
+	}
+
+	// 셀 파일
+	JSON CellListJson = JSON::Make(JSON::Class::Array);
+	for (auto& Pair : CellActorJsons)
+	{
+		const TPair<int32, int32>& Coord = *CellCoords.Find(Pair.first);
+		const std::wstring CellFileName = L"Cell_" + std::to_wstring(Coord.first) + L"_" + std::to_wstring(Coord.second) + L".json";
+
+		JSON CellJson = json::Object();
+		CellJson["Actors"] = Pair.second;
+		if (!FJsonSerializer::SaveJsonToFile(CellJson, (CellDir / CellFileName).wstring()))
+		{
+			OutMessage = "Failed to write cell file: " + WideToUTF8(CellFileName);
+			return false;
+		}
+
+		JSON CellEntry = json::Object();
+		CellEntry["X"] = Coord.first;
+		CellEntry["Y"] = Coord.second;
+		CellEntry["File"] = WideToUTF8(SceneStem + L"_Cells/" + CellFileName);
+		CellEntry["ActorCount"] = *CellActorCounts.Find(Pair.first);
+		CellListJson.append(CellEntry);
+	}
+
+	// 상주 씬 (월드 설정, 카메라, 셀에 넣지 않은 액터)
+	JSON PersistentJson = SceneJson;
+	PersistentJson["Actors"] = PersistentActors;
+	if (!FJsonSerializer::SaveJsonToFile(PersistentJson, (CellDir / L"Persistent.scene").wstring()))
+	{
+		OutMessage = "Failed to write persistent scene";
+		return false;
+	}
+
+	JSON ManifestJson = json::Object();
+	ManifestJson["Version"] = 1;
+	ManifestJson["CellSize"] = InCellSize;
+	ManifestJson["Persistent"] = WideToUTF8(SceneStem + L"_Cells/Persistent.scene");
+	ManifestJson["Cells"] = CellListJson;
+
+	const std::filesystem::path ManifestPath = ScenePath.parent_path() / (SceneStem + L".streaming");
+	if (!FJsonSerializer::SaveJsonToFile(ManifestJson, ManifestPath.wstring()))
+	{
+		OutMessage = "Failed to write manifest";
+		return false;
+	}
+
+	char Buf[256];
+	sprintf_s(Buf, "Cooked %d streamed actors into %d cells (%d persistent) -> %s",
+		NumStreamed, CellActorJsons.Num(), static_cast<int32>(PersistentActors.size()), WideToUTF8(ManifestPath.wstring()).c_str());
+	OutMessage = Buf;
+	return true;
+}
+
+bool FWorldPartitionStreaming::Open(const FWideString& InManifestPath)
+{
+	JSON ManifestJson;
+	if (!FJsonSerializer::LoadJsonFromFile(ManifestJson, InManifestPath))
+	{
+		UE_LOG("[error] WorldStreaming: Failed to load manifest: %s", WideToUTF8(InManifestPath).c_str());
+		return false;
+	}
+
+	const std::filesystem::path BaseDir = std::filesystem::path(InManifestPath).parent_path();
+
+	FString PersistentPath;
+	FJsonSerializer::ReadString(ManifestJson, "Persistent", PersistentPath);
+
+	// 상주 씬 로드 (레벨 교체 중 파티션이 Reset을 호출하므로 셀 목록은 그 뒤에 구성)
+	if (!World->LoadLevelFromFile((BaseDir / UTF8ToWide(PersistentPath)).wstring()))
+	{
+		return false;
+	}
+
+	FJsonSerializer::ReadFloat(ManifestJson, "CellSize", CellSize, 50.0f);
+
+	JSON CellListJson;
+	if (FJsonSerializer::ReadArray(ManifestJson, "Cells", CellListJson))
+	{
+		for (const JSON& CellJson : CellListJson.ArrayRange())
+		{
+			FStreamingCell Cell;
+			FString FileString;
+			FJsonSerializer::ReadInt32(CellJson, "X", Cell.X);
+			FJsonSerializer::ReadInt32(CellJson, "Y", Cell.Y);
+			FJsonSerializer::ReadInt32(CellJson, "ActorCount", Cell.ActorCount);
+			FJsonSerializer::ReadString(CellJson, "File", FileString);
+			Cell.FilePath = (BaseDir / UTF8ToWide(FileString)).wstring();
+
+			CellLookup.Add(MakeCellKey(Cell.X, Cell.Y), Cells.Num());
+			Cells.Add(std::move(Cell));
+		}
+	}
+
+	ResetStats();
+	Stats.CellCount = Cells.Num();
+
+	StartWorkers();
+	bActive = true;
+
+	UE_LOG("WorldStreaming: Opened %s (%d cells, cell size %.1f)", WideToUTF8(InManifestPath).c_str(), Cells.Num(), CellSize);
+	return true;
+}
+
+void FWorldPartitionStreaming::Reset()
+{
+	// 워커 결과는 버리되 스레드는 재사용
+	TArray<FStreamingCellLoadJob*> QueuedJobs;
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		FStreamingCellLoadJob* Job = nullptr;
+		while (PendingJobs.Dequeue(Job))
+		{
+			QueuedJobs.Add(Job);
+		}
+
+		for (FStreamingCell& Cell : Cells)
+		{
+			if (!Cell.PendingJob)
+			{
+				continue;
+			}
+
+			// 아직 큐에 있던 작업은 아래에서 바로 삭제하므로 셀의 참조부터 끊는다
+			if (QueuedJobs.Find(Cell.PendingJob) < 0)
+			{
+				// 워커가 이미 꺼내 간 작업은 ProcessCompletedJobs에서 버려지도록 표시
+				Cell.PendingJob->bCanceled = true;
+				Cell.PendingJob->CellIndex = -1;
+			}
+			Cell.PendingJob = nullptr;
+		}
+	}
+
+	for (FStreamingCellLoadJob* Job : QueuedJobs)
+	{
+		delete Job;
+	}
+
+	Cells.Empty();
+	CellLookup.Empty();
+	bActive = false;
+	bHasSourceOverride = false;
+}
+
+void FWorldPartitionStreaming::ResetStats()
+{
+	const int32 CellCount = Stats.CellCount;
+	Stats = FWorldStreamingStats();
+	Stats.CellCount = CellCount;
+}
+
+FVector FWorldPartitionStreaming::GetStreamingSourceLocation() const
+{
+	if (bHasSourceOverride)
+	{
+		return SourceOverride;
+	}
+
+	// 게임: 플레이어 카메라, 에디터: 에디터 카메라
+	if (World->bPie)
+	{
+		if (APlayerCameraManager* CameraManager = World->GetPlayerCameraManager())
+		{
+			if (UCameraComponent* ViewCamera = CameraManager->GetViewCamera())
+			{
+				return ViewCamera->GetWorldLocation();
+			}
+		}
+	}
+
+	if (ACameraActor* EditorCamera = World->GetEditorCameraActor())
+	{
+		return EditorCamera->GetActorLocation();
+	}
+
+	return FVector::Zero();
+}
+
+float FWorldPartitionStreaming::GetDistanceToCell(const FStreamingCell& InCell, const FVector& InLocation) const
+{
+	// XY 평면에서 셀 사각형까지의 거리 (셀 안이면 0)
+	const float MinX = InCell.X * CellSize;
+	const float MinY = InCell.Y * CellSize;
+	const float DX = std::max({ MinX - InLocation.X, 0.0f, InLocation.X - (MinX + CellSize) });
+	const float DY = std::max({ MinY - InLocation.Y, 0.0f, InLocation.Y - (MinY + CellSize) });
+	return std::sqrt(DX * DX + DY * DY);
+}
+
+int32 FWorldPartitionStreaming::FindCellIndex(const FVector& InLocation) const
+{
+	const int32* Index = CellLookup.Find(MakeCellKey(ToCellCoord(InLocation.X, CellSize), ToCellCoord(InLocation.Y, CellSize)));
+	return Index ? *Index : -1;
+}
+
+void FWorldPartitionStreaming::Tick()
+{
+	if (!bActive)
+	{
+		return;
+	}
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	Stats.ActorsActivatedThisFrame = 0;
+
+	const FVector SourceLocation = GetStreamingSourceLocation();
+	bHasSourceOverride = false;
+
+	// 1. 반경 판정: LoadRadius 안은 요청, UnloadRadius 밖은 언로드
+	for (int32 i = 0; i < Cells.Num(); ++i)
+	{
+		FStreamingCell& Cell = Cells[i];
+		const float Distance = GetDistanceToCell(Cell, SourceLocation);
+
+		if (Distance <= LoadRadius)
+		{
+			if (Cell.State == EStreamingCellState::Unloaded)
+			{
+				RequestCell(i);
+			}
+			else if (Cell.State == EStreamingCellState::Loading && Cell.PendingJob)
+			{
+				Cell.PendingJob->bCanceled = false;
+			}
+		}
+		else if (Distance > UnloadRadius)
+		{
+			if (Cell.State == EStreamingCellState::Loading && Cell.PendingJob)
+			{
+				Cell.PendingJob->bCanceled = true;
+			}
+			else if (Cell.State == EStreamingCellState::Activating || Cell.State == EStreamingCellState::Loaded)
+			{
+				UnloadCell(i);
+			}
+		}
+	}
+
+	// 2. 워커가 끝낸 셀을 활성화 대기열로
+	ProcessCompletedJobs();
+
+	// 3. 남은 예산만큼 액터 생성/등록
+	const uint64 BudgetCycles = static_cast<uint64>(ActivationBudgetMS / 1000.0 / FPlatformTime::GetSecondsPerCycle());
+	ActivatePendingActors(StartCycles + BudgetCycles);
+
+	// 통계
+	Stats.GameThreadTimeMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+	Stats.MaxGameThreadTimeMS = std::max(Stats.MaxGameThreadTimeMS, Stats.GameThreadTimeMS);
+	if (Stats.GameThreadTimeMS > HitchThresholdMS)
+	{
+		++Stats.HitchFrames;
+	}
+
+	Stats.LoadedCells = 0;
+	Stats.LoadingCells = 0;
+	Stats.ActivatingCells = 0;
+	Stats.StreamedActors = 0;
+	for (const FStreamingCell& Cell : Cells)
+	{
+		switch (Cell.State)
+		{
+		case EStreamingCellState::Loaded: ++Stats.LoadedCells; break;
+		case EStreamingCellState::Loading: ++Stats.LoadingCells; break;
+		case EStreamingCellState::Activating: ++Stats.ActivatingCells; break;
+		default: break;
+		}
+		Stats.StreamedActors += Cell.Actors.Num();
+	}
+}
+
+void FWorldPartitionStreaming::RequestCell(int32 CellIndex)
+{
+	FStreamingCell& Cell = Cells[CellIndex];
+
+	FStreamingCellLoadJob* Job = new FStreamingCellLoadJob();
+	Job->CellIndex = CellIndex;
+	Job->FilePath = Cell.FilePath;
+
+	Cell.PendingJob = Job;
+	Cell.State = EStreamingCellState::Loading;
+
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		PendingJobs.Enqueue(Job);
+	}
+	WorkAvailable.notify_one();
+}
+
+void FWorldPartitionStreaming::UnloadCell(int32 CellIndex)
+{
+	FStreamingCell& Cell = Cells[CellIndex];
+
+	for (TWeakObjectPtr<AActor>& WeakActor : Cell.Actors)
+	{
+		AActor* Actor = WeakActor.Get();
+		if (!Actor || Actor->IsPendingDestroy())
+		{
+			continue;
+		}
+
+		// 같은 셀을 다시 로드할 때 SceneId가 파괴된 컴포넌트를 가리키지 않도록
+		for (USceneComponent* Component : Actor->GetSceneComponents())
+		{
+			USceneComponent::GetSceneIdMap().Remove(Component->GetSceneId());
+		}
+
+		// PIE에서는 EndPlay 후 파괴 (지연 파괴 경로)
+		Actor->Destroy();
+	}
+
+	Cell.Actors.Empty();
+	Cell.ActorJsons.Empty();
+	Cell.NextActorIndex = 0;
+	Cell.State = EStreamingCellState::Unloaded;
+	++Stats.TotalCellUnloads;
+}
+
+void FWorldPartitionStreaming::ProcessCompletedJobs()
+{
+	TArray<FStreamingCellLoadJob*> Jobs;
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		Jobs = std::move(CompletedJobs);
+		CompletedJobs.Empty();
+	}
+
+	for (FStreamingCellLoadJob* Job : Jobs)
+	{
+		if (Job->CellIndex >= 0 && Job->CellIndex < Cells.Num())
+		{
+			FStreamingCell& Cell = Cells[Job->CellIndex];
+			if (Cell.PendingJob == Job)
+			{
+				Cell.PendingJob = nullptr;
+
+				if (Job->bCanceled)
+				{
+					Cell.State = EStreamingCellState::Unloaded;
+					++Stats.CanceledLoads;
+				}
+				else if (!Job->bSucceeded)
+				{
+					UE_LOG("[error] WorldStreaming: Failed to load cell (%d, %d)", Cell.X, Cell.Y);
+					Cell.State = EStreamingCellState::Unloaded;
+				}
+				else
+				{
+					Cell.ActorJsons = std::move(Job->ActorJsons);
+					Cell.NextActorIndex = 0;
+					Cell.State = EStreamingCellState::Activating;
+				}
+			}
+		}
+		delete Job;
+	}
+}
+
+bool FWorldPartitionStreaming::ActivatePendingActors(uint64 InDeadlineCycles)
+{
+	for (FStreamingCell& Cell : Cells)
+	{
+		if (Cell.State != EStreamingCellState::Activating)
+		{
+			continue;
+		}
+
+		while (Cell.NextActorIndex < Cell.ActorJsons.Num())
+		{
+			// 최소 한 액터는 진행해 예산이 아주 작아도 멈추지 않게 한다
+			if (Stats.ActorsActivatedThisFrame > 0 && FPlatformTime::Cycles64() >= InDeadlineCycles)
+			{
+				return false;
+			}
+
+			JSON& ActorJson = Cell.ActorJsons[Cell.NextActorIndex++];
+
+			FString TypeString;
+			FJsonSerializer::ReadString(ActorJson, "Type", TypeString, "", false);
+			UClass* NewClass = UClass::FindClass(TypeString);
+			if (!NewClass || !NewClass->IsChildOf(AActor::StaticClass()))
+			{
+				continue;
+			}
+
+			AActor* NewActor = Cast<AActor>(ObjectFactory::NewObject(NewClass));
+			if (!NewActor)
+			{
+				continue;
+			}
+
+			NewActor->Serialize(true, ActorJson);
+			World->AddActorToLevel(NewActor);
+			if (World->bPie)
+			{
+				NewActor->BeginPlay();
+			}
+
+			Cell.Actors.Add(NewActor);
+			++Stats.ActorsActivatedThisFrame;
+		}
+
+		Cell.ActorJsons.Empty();
+		Cell.State = EStreamingCellState::Loaded;
+		++Stats.TotalCellLoads;
+	}
+
+	return true;
+}
+
+void FWorldPartitionStreaming::FlushStreaming()
+{
+	while (true)
+	{
+		bool bPending = false;
+		for (const FStreamingCell& Cell : Cells)
+		{
+			if (Cell.State == EStreamingCellState::Loading)
+			{
+				bPending = true;
+				break;
+			}
+		}
+
+		ProcessCompletedJobs();
+		const bool bActivated = ActivatePendingActors(UINT64_MAX);
+		if (!bPending && bActivated)
+		{
+			return;
+		}
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+}
+
+TArray<FVector> FWorldPartitionStreaming::MakeDefaultFlythroughPath() const
+{
+	TArray<FVector> Path;
+	if (Cells.IsEmpty())
+	{
+		return Path;
+	}
+
+	int32 MinX = INT_MAX, MinY = INT_MAX, MaxX = INT_MIN, MaxY = INT_MIN;
+	for (const FStreamingCell& Cell : Cells)
+	{
+		MinX = std::min(MinX, Cell.X);
+		MinY = std::min(MinY, Cell.Y);
+		MaxX = std::max(MaxX, Cell.X);
+		MaxY = std::max(MaxY, Cell.Y);
+	}
+
+	// 셀 그리드 바운드를 지그재그로 훑는 경로 (셀 중심 높이)
+	const float Z = 2.0f;
+	for (int32 Y = MinY; Y <= MaxY; ++Y)
+	{
+		const bool bForward = ((Y - MinY) % 2) == 0;
+		const float StartX = (bForward ? MinX : MaxX + 1) * CellSize;
+		const float EndX = (bForward ? MaxX + 1 : MinX) * CellSize;
+		const float CenterY = (Y + 0.5f) * CellSize;
+		Path.Add(FVector(StartX, CenterY, Z));
+		Path.Add(FVector(EndX, CenterY, Z));
+	}
+	return Path;
+}
+
+FStreamingFlythroughResult FWorldPartitionStreaming::RunFlythrough(const TArray<FVector>& InPath, float InSpeed, float InFrameTime)
+{
+	FStreamingFlythroughResult Result;
+	if (!bActive || InPath.Num() < 2 || InSpeed <= 0.0f || InFrameTime <= 0.0f)
+	{
+		return Result;
+	}
+
+	const FWorldStreamingStats StartStats = Stats;
+	const float StepDistance = InSpeed * InFrameTime;
+	double TotalFrameMS = 0.0;
+
+	for (int32 Segment = 0; Segment + 1 < InPath.Num(); ++Segment)
+	{
+		const FVector Start = InPath[Segment];
+		const FVector End = InPath[Segment + 1];
+		const float Length = (End - Start).Size();
+		const int32 NumSteps = std::max(1, static_cast<int32>(std::ceil(Length / StepDistance)));
+
+		for (int32 Step = 1; Step <= NumSteps; ++Step)
+		{
+			const FVector Location = Start + (End - Start) * (static_cast<float>(Step) / NumSteps);
+
+			const uint64 FrameStart = FPlatformTime::Cycles64();
+			SetStreamingSource(Location);
+			Tick();
+			// 지연 파괴된 언로드 액터 정리 (일반 프레임의 월드 Tick 대신)
+			World->ProcessPendingKillActors();
+			const double FrameMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - FrameStart);
+
+			++Result.Frames;
+			TotalFrameMS += FrameMS;
+			Result.MaxFrameMS = std::max(Result.MaxFrameMS, FrameMS);
+			if (FrameMS > HitchThresholdMS)
+			{
+				++Result.HitchFrames;
+			}
+
+			const int32 CellIndex = FindCellIndex(Location);
+			if (CellIndex >= 0 && Cells[CellIndex].State != EStreamingCellState::Loaded)
+			{
+				++Result.LateCellFrames;
+			}
+
+			// 실제 프레임 간격만큼 기다려 백그라운드 로드가 프레임과 겹치게 한다
+			const double RemainingMS = InFrameTime * 1000.0 - FrameMS;
+			if (RemainingMS > 0.0)
+			{
+				std::this_thread::sleep_for(std::chrono::microseconds(static_cast<int64>(RemainingMS * 1000.0)));
+			}
+		}
+	}
+
+	Result.AvgFrameMS = Result.Frames > 0 ? TotalFrameMS / Result.Frames : 0.0;
+	Result.CellLoads = Stats.TotalCellLoads - StartStats.TotalCellLoads;
+	Result.CellUnloads = Stats.TotalCellUnloads - StartStats.TotalCellUnloads;
+	return Result;
+}
+
+void FWorldPartitionStreaming::StartWorkers()
+{
+	if (!Workers.IsEmpty())
+	{
+		return;
+	}
+
+	bStopping = false;
+	const int32 NumWorkers = 2;
+	for (int32 i = 0; i < NumWorkers; ++i)
+	{
+		Workers.Emplace(&FWorldPartitionStreaming::WorkerLoop, this);
+	}
+}
+
+void FWorldPartitionStreaming::StopWorkers()
+{
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		bStopping = true;
+	}
+	WorkAvailable.notify_all();
+
+	for (std::thread& Worker : Workers)
+	{
+		if (Worker.joinable())
+		{
+			Worker.join();
+		}
+	}
+	Workers.Empty();
+
+	FStreamingCellLoadJob* Job = nullptr;
+	while (PendingJobs.Dequeue(Job))
+	{
+		delete Job;
+	}
+	for (FStreamingCellLoadJob* CompletedJob : CompletedJobs)
+	{
+		delete CompletedJob;
+	}
+	CompletedJobs.Empty();
+}
+
+void FWorldPartitionStreaming::WorkerLoop()
+{
+	while (true)
+	{
+		FStreamingCellLoadJob* Job = nullptr;
+		{
+			std::unique_lock<std::mutex> Lock(Mutex);
+			WorkAvailable.wait(Lock, [this]() { return bStopping || !PendingJobs.IsEmpty(); });
+			if (bStopping)
+			{
+				return;
+			}
+			PendingJobs.Dequeue(Job);
+		}
+
+		if (!Job)
+		{
+			continue;
+		}
+
+		// 파일 읽기 + 파싱만 수행 (UObject/월드 접근 금지)
+		JSON CellJson;
+		if (FJsonSerializer::LoadJsonFromFile(CellJson, Job->FilePath))
+		{
+			JSON ActorListJson;
+			if (FJsonSerializer::ReadObject(CellJson, "Actors", ActorListJson, nullptr, false))
+			{
+				Job->ActorJsons.Reserve(ActorListJson.size());
+				for (auto& Pair : ActorListJson.ObjectRange())
+				{
+					Job->ActorJsons.Add(std::move(Pair.second));
+				}
+				Job->bSucceeded = true;
+			}
+		}
+
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			CompletedJobs.Add(Job);
+		}
+	}
+}
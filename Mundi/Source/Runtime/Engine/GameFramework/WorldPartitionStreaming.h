@@ -0,0 +1,170 @@
+﻿#pragma once
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include "Vector.h"
+#include "WeakObjectPtr.h"
+
+class UWorld;
+class AActor;
+
+// 스트리밍 셀 상태
+enum class EStreamingCellState : uint8
+{
+	Unloaded,
+	Loading,        // 워커 스레드가 셀 파일을 읽고 파싱 중
+	Activating,     // 게임 스레드가 프레임 예산 안에서 액터를 생성/등록 중
+	Loaded
+};
+
+// 백그라운드 셀 로드 작업
+// 워커 스레드는 파일 읽기와 JSON 파싱만 수행하고, UObject 생성/등록은 게임 스레드에서 처리합니다.
+struct FStreamingCellLoadJob
+{
+	int32 CellIndex = -1;
+	FWideString FilePath;
+
+	// 결과
+	TArray<JSON> ActorJsons;
+	bool bSucceeded = false;
+	bool bCanceled = false;     // 로드 중 셀이 반경을 벗어남 (게임 스레드 전용)
+};
+
+struct FStreamingCell
+{
+	int32 X = 0;
+	int32 Y = 0;
+	FWideString FilePath;
+	int32 ActorCount = 0;
+
+	EStreamingCellState State = EStreamingCellState::Unloaded;
+	FStreamingCellLoadJob* PendingJob = nullptr;
+
+	// 활성화 대기 중인 액터 데이터와 진행 위치
+	TArray<JSON> ActorJsons;
+	int32 NextActorIndex = 0;
+
+	TArray<TWeakObjectPtr<AActor>> Actors;   // 게임 로직이 먼저 파괴할 수 있음
+};
+
+// 스트리밍 통계
+struct FWorldStreamingStats
+{
+	int32 CellCount = 0;
+	int32 LoadedCells = 0;
+	int32 LoadingCells = 0;
+	int32 ActivatingCells = 0;
+	int32 StreamedActors = 0;
+
+	// 이번 프레임
+	int32 ActorsActivatedThisFrame = 0;
+	double GameThreadTimeMS = 0.0;      // 활성화 + 언로드에 쓴 게임 스레드 시간
+
+	// 누적
+	uint64 TotalCellLoads = 0;
+	uint64 TotalCellUnloads = 0;
+	uint64 CanceledLoads = 0;
+	uint32 HitchFrames = 0;             // GameThreadTimeMS가 HitchThresholdMS를 넘은 프레임
+	double MaxGameThreadTimeMS = 0.0;
+};
+
+// 카메라 경로 비행 테스트 결과
+struct FStreamingFlythroughResult
+{
+	int32 Frames = 0;
+	int32 HitchFrames = 0;
+	int32 LateCellFrames = 0;           // 소스가 들어간 셀이 아직 로드되지 않았던 프레임
+	double MaxFrameMS = 0.0;
+	double AvgFrameMS = 0.0;
+	uint64 CellLoads = 0;
+	uint64 CellUnloads = 0;
+};
+
+/**
+ * @brief 그리드 기반 월드 파티션 스트리밍
+ *
+ * CookScene으로 .scene을 XY 그리드 셀 파일로 나누고, 실행 중에는 스트리밍 소스(플레이어 카메라/에디터 카메라)
+ * 주변 LoadRadius 안의 셀을 백그라운드에서 읽어 게임 스레드에서 예산만큼씩 액터를 생성한다.
+ * UnloadRadius 밖의 셀은 언로드한다. (LoadRadius < UnloadRadius로 경계에서 반복 로드 방지)
+ */
+class FWorldPartitionStreaming
+{
+public:
+	explicit FWorldPartitionStreaming(UWorld* InWorld);
+	~FWorldPartitionStreaming();
+
+	/**
+	 * .scene 파일을 스트리밍용으로 굽는다.
+	 * 스태틱 메시를 가진 액터는 루트 위치 기준 셀 파일(<Scene>_Cells/Cell_X_Y.json)로, 나머지는 상주 씬(<Scene>_Cells/Persistent.scene)으로 나누고
+	 * 매니페스트(<Scene>.streaming)를 쓴다.
+	 */
+	static bool CookScene(const FWideString& InScenePath, float InCellSize, FString& OutMessage);
+
+	/** 매니페스트를 열어 상주 씬을 로드하고 스트리밍을 시작한다. */
+	bool Open(const FWideString& InManifestPath);
+
+	/** 셀 상태를 잊는다. (액터는 레벨 교체 시 이미 삭제됨) */
+	void Reset();
+
+	bool IsActive() const { return bActive; }
+
+	/** 이번 프레임의 스트리밍 소스 위치 (지정하지 않으면 플레이어/에디터 카메라 사용) */
+	void SetStreamingSource(const FVector& InLocation) { SourceOverride = InLocation; bHasSourceOverride = true; }
+
+	/** 셀 요청/언로드, 완료된 로드 반영, 예산 내 액터 활성화 (게임 스레드, 매 프레임) */
+	void Tick();
+
+	/** 요청된 셀이 모두 로드될 때까지 블로킹 (로딩 화면/테스트용) */
+	void FlushStreaming();
+
+	/** 경로를 따라 스트리밍 소스를 이동시키며 렌더링 없이 프레임을 흉내 내고 히치를 보고한다. */
+	FStreamingFlythroughResult RunFlythrough(const TArray<FVector>& InPath, float InSpeed, float InFrameTime);
+
+	/** 셀 그리드 전체를 한 바퀴 도는 기본 경로 */
+	TArray<FVector> MakeDefaultFlythroughPath() const;
+
+	const FWorldStreamingStats& GetStats() const { return Stats; }
+	void ResetStats();
+
+	// 설정
+	float LoadRadius = 60.0f;
+	float UnloadRadius = 80.0f;
+	float ActivationBudgetMS = 2.0f;
+	float HitchThresholdMS = 8.0f;
+
+private:
+	FVector GetStreamingSourceLocation() const;
+	float GetDistanceToCell(const FStreamingCell& InCell, const FVector& InLocation) const;
+	int32 FindCellIndex(const FVector& InLocation) const;
+
+	void RequestCell(int32 CellIndex);
+	void UnloadCell(int32 CellIndex);
+	void ProcessCompletedJobs();
+
+	/** @return 예산 안에서 모든 대기 액터를 활성화했으면 true */
+	bool ActivatePendingActors(uint64 InDeadlineCycles);
+
+	void StartWorkers();
+	void StopWorkers();
+	void WorkerLoop();
+
+	UWorld* World = nullptr;
+	bool bActive = false;
+
+	float CellSize = 50.0f;
+	TArray<FStreamingCell> Cells;
+	TMap<uint64, int32> CellLookup;     // (X, Y) -> Cells 인덱스
+
+	FVector SourceOverride;
+	bool bHasSourceOverride = false;
+
+	// 로드 워커
+	TArray<std::thread> Workers;
+	std::mutex Mutex;
+	std::condition_variable WorkAvailable;
+	TQueue<FStreamingCellLoadJob*> PendingJobs;
+	TArray<FStreamingCellLoadJob*> CompletedJobs;
+	bool bStopping = false;
+
+	FWorldStreamingStats Stats;
+};
@@ -8,10 +8,302 @@
 #include "ShapeComponent.h"
 #include "StaticMeshComponent.h"
 #include "Collision.h"
-#include "BoundingSphere.h"
 #include "AABB.h"
 #include "OBB.h"
 
+namespace
+{
+	// 이미터 단위로 한 번만 풀어 둔 충돌 후보 (파티클마다 GetShape/트랜스폼 역행렬을 다시 구하지 않도록)
+	enum class ECollisionCandidateKind : uint8
+	{
+		Box,		// 박스 셰이프, 스태틱 메시 AABB (축 정렬 OBB)
+		Sphere,
+		Capsule,
+	};
+
+	struct FParticleCollisionCandidate
+	{
+		UPrimitiveComponent* Component = nullptr;
+		ECollisionCandidateKind Kind = ECollisionCandidateKind::Box;
+		FAABB Bounds;		// 파티클 반지름만큼 넓힌 월드 바운드 (경로 바운드와 겹칠 때만 정밀 검사)
+		FOBB Box;			// 반지름만큼 넓히지 않은 원본 박스
+		FVector P0;			// Sphere 중심 / Capsule 중심선 시작
+		FVector P1;			// Capsule 중심선 끝
+		float Radius = 0.0f;	// Sphere/Capsule 반지름 + 파티클 반지름
+	};
+
+	// 스레드별 스크래치 버퍼. 이미터마다 비우기만 하고 용량은 유지하므로 정상 상태에서는 할당이 없다
+	struct FParticleCollisionScratch
+	{
+		TArray<UPrimitiveComponent*> Components;
+		TArray<FParticleCollisionCandidate> Candidates;
+	};
+
+	FParticleCollisionScratch& GetCollisionScratch()
+	{
+		thread_local FParticleCollisionScratch Scratch;
+		return Scratch;
+	}
+
+	bool BoundsOverlap(const FAABB& A, const FAABB& B)
+	{
+		return A.Min.X <= B.Max.X && A.Max.X >= B.Min.X
+			&& A.Min.Y <= B.Max.Y && A.Max.Y >= B.Min.Y
+			&& A.Min.Z <= B.Max.Z && A.Max.Z >= B.Min.Z;
+	}
+
+	// 구 스윕: Start에서 Delta만큼 움직이는 점과 (이미 파티클 반지름을 더한) 구의 최초 접촉 시간 [0, 1]
+	bool SweepPointSphere(const FVector& Start, const FVector& Delta, const FVector& Center, float Radius, float& OutTime, FVector& OutNormal)
+	{
+		const FVector M = Start - Center;
+		const float C = FVector::Dot(M, M) - Radius * Radius;
+		if (C <= 0.0f)
+		{
+			// 시작부터 겹침: 중심에서 밀어내는 방향
+			OutTime = 0.0f;
+			OutNormal = M.SizeSquared() > KINDA_SMALL_NUMBER ? M.GetSafeNormal() : FVector(0.0f, 0.0f, 1.0f);
+			return true;
+		}
+
+		const float A = FVector::Dot(Delta, Delta);
+		const float B = FVector::Dot(M, Delta);
+		if (A < KINDA_SMALL_NUMBER || B >= 0.0f)
+		{
+			return false;
+		}
+
+		const float Discriminant = B * B - A * C;
+		if (Discriminant < 0.0f)
+		{
+			return false;
+		}
+
+		const float Time = (-B - std::sqrt(Discriminant)) / A;
+		if (Time > 1.0f)
+		{
+			return false;
+		}
+
+		OutTime = FMath::Max(Time, 0.0f);
+		OutNormal = (Start + Delta * OutTime - Center).GetSafeNormal();
+		return true;
+	}
+
+	// 캡슐 스윕: 원통 옆면과 양 끝 반구 중 가장 이른 접촉
+	bool SweepPointCapsule(const FVector& Start, const FVector& Delta, const FVector& P0, const FVector& P1, float Radius, float& OutTime, FVector& OutNormal)
+	{
+		const FVector Segment = P1 - P0;
+		const float SegmentLength = Segment.Size();
+		if (SegmentLength < KINDA_SMALL_NUMBER)
+		{
+			return SweepPointSphere(Start, Delta, P0, Radius, OutTime, OutNormal);
+		}
+		const FVector Axis = Segment / SegmentLength;
+
+		// 시작부터 겹침
+		const FVector ToStart = Start - P0;
+		const float StartProjection = FMath::Clamp(FVector::Dot(ToStart, Axis), 0.0f, SegmentLength);
+		const FVector StartClosest = P0 + Axis * StartProjection;
+		if (FVector::DistSquared(Start, StartClosest) <= Radius * Radius)
+		{
+			OutTime = 0.0f;
+			const FVector Push = Start - StartClosest;
+			OutNormal = Push.SizeSquared() > KINDA_SMALL_NUMBER ? Push.GetSafeNormal() : FVector(0.0f, 0.0f, 1.0f);
+			return true;
+		}
+
+		bool bHit = false;
+		float BestTime = FLT_MAX;
+		FVector BestNormal;
+
+		// 옆면: 축에 수직인 성분만으로 무한 원통과 교차한 뒤 선분 범위 확인
+		const FVector DeltaPerp = Delta - Axis * FVector::Dot(Delta, Axis);
+		const FVector StartPerp = ToStart - Axis * FVector::Dot(ToStart, Axis);
+		const float A = FVector::Dot(DeltaPerp, DeltaPerp);
+		if (A > KINDA_SMALL_NUMBER)
+		{
+			const float B = FVector::Dot(StartPerp, DeltaPerp);
+			const float C = FVector::Dot(StartPerp, StartPerp) - Radius * Radius;
+			const float Discriminant = B * B - A * C;
+			if (Discriminant >= 0.0f)
+			{
+				const float Time = (-B - std::sqrt(Discriminant)) / A;
+				const float Along = FVector::Dot(ToStart + Delta * Time, Axis);
+				if (Time >= 0.0f && Time <= 1.0f && Along >= 0.0f && Along <= SegmentLength)
+				{
+					bHit = true;
+					BestTime = Time;
+					BestNormal = (StartPerp + DeltaPerp * Time).GetSafeNormal();
+				}
+			}
+		}
+
+		// 양 끝 반구
+		const FVector Caps[2] = { P0, P1 };
+		for (const FVector& Cap : Caps)
+		{
+			float CapTime;
+			FVector CapNormal;
+			if (SweepPointSphere(Start, Delta, Cap, Radius, CapTime, CapNormal) && CapTime < BestTime)
+			{
+				bHit = true;
+				BestTime = CapTime;
+				BestNormal = CapNormal;
+			}
+		}
+
+		if (bHit)
+		{
+			OutTime = BestTime;
+			OutNormal = BestNormal;
+		}
+		return bHit;
+	}
+
+	// 박스 스윕: OBB 축 공간에서 반지름만큼 넓힌 슬랩과 교차 (모서리는 둥글게 처리하지 않아 약간 보수적)
+	bool SweepPointBox(const FVector& Start, const FVector& Delta, const FOBB& Box, float Inflate, float& OutTime, FVector& OutNormal)
+	{
+		const FVector ToStart = Start - Box.Center;
+
+		float LocalStart[3];
+		float LocalDelta[3];
+		float Extent[3];
+		bool bInside = true;
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			LocalStart[Axis] = FVector::Dot(ToStart, Box.Axes[Axis]);
+			LocalDelta[Axis] = FVector::Dot(Delta, Box.Axes[Axis]);
+			Extent[Axis] = Box.HalfExtent[Axis] + Inflate;
+			bInside &= FMath::Abs(LocalStart[Axis]) <= Extent[Axis];
+		}
+
+		if (bInside)
+		{
+			// 시작부터 겹침: 가장 가까운 면으로 밀어냄
+			float MinDist = FLT_MAX;
+			for (int32 Axis = 0; Axis < 3; Axis++)
+			{
+				const float Dist = Extent[Axis] - FMath::Abs(LocalStart[Axis]);
+				if (Dist < MinDist)
+				{
+					MinDist = Dist;
+					OutNormal = Box.Axes[Axis] * (LocalStart[Axis] > 0.0f ? 1.0f : -1.0f);
+				}
+			}
+			OutTime = 0.0f;
+			return true;
+		}
+
+		float EnterTime = -FLT_MAX;
+		float ExitTime = FLT_MAX;
+		int32 EnterAxis = -1;
+		float EnterSign = 1.0f;
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			if (FMath::Abs(LocalDelta[Axis]) < KINDA_SMALL_NUMBER)
+			{
+				if (FMath::Abs(LocalStart[Axis]) > Extent[Axis])
+				{
+					return false;
+				}
+				continue;
+			}
+
+			const float InvDelta = 1.0f / LocalDelta[Axis];
+			float Near = (-Extent[Axis] - LocalStart[Axis]) * InvDelta;
+			float Far = (Extent[Axis] - LocalStart[Axis]) * InvDelta;
+			if (Near > Far)
+			{
+				std::swap(Near, Far);
+			}
+
+			if (Near > EnterTime)
+			{
+				// +방향으로 들어오면 -면에 닿는다
+				EnterTime = Near;
+				EnterAxis = Axis;
+				EnterSign = LocalDelta[Axis] > 0.0f ? -1.0f : 1.0f;
+			}
+			ExitTime = FMath::Min(ExitTime, Far);
+		}
+
+		if (EnterAxis < 0 || EnterTime > ExitTime || EnterTime < 0.0f || EnterTime > 1.0f)
+		{
+			return false;
+		}
+
+		OutTime = EnterTime;
+		OutNormal = Box.Axes[EnterAxis] * EnterSign;
+		return true;
+	}
+
+	// 브로드페이즈 결과를 형상별 월드 공간 데이터로 변환
+	void BuildCollisionCandidates(const TArray<UPrimitiveComponent*>& InComponents, float ParticleRadius, TArray<FParticleCollisionCandidate>& OutCandidates)
+	{
+		OutCandidates.Empty();
+		for (UPrimitiveComponent* PrimComp : InComponents)
+		{
+			if (!PrimComp)
+			{
+				continue;
+			}
+
+			FParticleCollisionCandidate Candidate;
+			Candidate.Component = PrimComp;
+
+			if (UShapeComponent* ShapeComp = Cast<UShapeComponent>(PrimComp))
+			{
+				FShape Shape;
+				ShapeComp->GetShape(Shape);
+				const FTransform ShapeTransform = ShapeComp->GetWorldTransform();
+
+				switch (Shape.Kind)
+				{
+				case EShapeKind::Box:
+					Candidate.Kind = ECollisionCandidateKind::Box;
+					Collision::BuildOBB(Shape, ShapeTransform, Candidate.Box);
+					break;
+
+				case EShapeKind::Sphere:
+					Candidate.Kind = ECollisionCandidateKind::Sphere;
+					Candidate.P0 = ShapeTransform.Translation;
+					Candidate.Radius = Shape.Sphere.SphereRadius * Collision::UniformScaleMax(ShapeTransform.Scale3D) + ParticleRadius;
+					break;
+
+				case EShapeKind::Capsule:
+					Candidate.Kind = ECollisionCandidateKind::Capsule;
+					Collision::BuildCapsule(Shape, ShapeTransform, Candidate.P0, Candidate.P1, Candidate.Radius);
+					Candidate.Radius += ParticleRadius;
+					break;
+
+				default:
+					continue;
+				}
+			}
+			// StaticMeshComponent는 월드 AABB를 축 정렬 박스로 취급
+			else if (UStaticMeshComponent* MeshComp = Cast<UStaticMeshComponent>(PrimComp))
+			{
+				const FAABB MeshAABB = MeshComp->GetWorldAABB();
+				Candidate.Kind = ECollisionCandidateKind::Box;
+				Candidate.Box.Center = MeshAABB.GetCenter();
+				Candidate.Box.HalfExtent = MeshAABB.GetHalfExtent();
+				Candidate.Box.Axes[0] = FVector(1.0f, 0.0f, 0.0f);
+				Candidate.Box.Axes[1] = FVector(0.0f, 1.0f, 0.0f);
+				Candidate.Box.Axes[2] = FVector(0.0f, 0.0f, 1.0f);
+			}
+			else
+			{
+				continue;
+			}
+
+			Candidate.Bounds = PrimComp->GetWorldAABB();
+			Candidate.Bounds.Min = Candidate.Bounds.Min - FVector(ParticleRadius, ParticleRadius, ParticleRadius);
+			Candidate.Bounds.Max = Candidate.Bounds.Max + FVector(ParticleRadius, ParticleRadius, ParticleRadius);
+			OutCandidates.Add(Candidate);
+		}
+	}
+}
+
 void UParticleModuleCollision::Spawn(FParticleEmitterInstance* Owner, int32 Offset, float SpawnTime, FBaseParticle* ParticleBase)
 {
 	if (!ParticleBase || !Owner || !Owner->Component)
@@ -58,8 +350,37 @@ void UParticleModuleCollision::Update(FModuleUpdateContext& Context)
 	}
 	FBVHierarchy* BVH = Partition->GetBVH();
 
-	float DeltaTime = Context.DeltaTime;
-	int32 Offset = Context.Offset;
+	FParticleCollisionScratch& Scratch = GetCollisionScratch();
+	Scratch.Components.Empty();
+	Scratch.Candidates.Empty();
+
+	// 1. 광역 검사: 이미터 전체 이동 경로(OldLocation ~ Location)를 감싸는 바운드로 BVH를 한 번만 질의
+	{
+		FVector SweptMin(FLT_MAX, FLT_MAX, FLT_MAX);
+		FVector SweptMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		bool bHasParticles = false;
+
+		BEGIN_UPDATE_LOOP
+			SweptMin.X = FMath::Min(SweptMin.X, FMath::Min(Particle.OldLocation.X, Particle.Location.X));
+			SweptMin.Y = FMath::Min(SweptMin.Y, FMath::Min(Particle.OldLocation.Y, Particle.Location.Y));
+			SweptMin.Z = FMath::Min(SweptMin.Z, FMath::Min(Particle.OldLocation.Z, Particle.Location.Z));
+			SweptMax.X = FMath::Max(SweptMax.X, FMath::Max(Particle.OldLocation.X, Particle.Location.X));
+			SweptMax.Y = FMath::Max(SweptMax.Y, FMath::Max(Particle.OldLocation.Y, Particle.Location.Y));
+			SweptMax.Z = FMath::Max(SweptMax.Z, FMath::Max(Particle.OldLocation.Z, Particle.Location.Z));
+			bHasParticles = true;
+		END_UPDATE_LOOP
+
+		if (bHasParticles)
+		{
+			const FVector RadiusExtent(ParticleRadius, ParticleRadius, ParticleRadius);
+			BVH->QueryIntersectedComponents(FAABB(SweptMin - RadiusExtent, SweptMax + RadiusExtent), Scratch.Components);
+
+			// 후보 형상과 월드 공간 데이터는 이 이미터 업데이트 동안 한 번만 계산
+			BuildCollisionCandidates(Scratch.Components, ParticleRadius, Scratch.Candidates);
+		}
+	}
+
+	const TArray<FParticleCollisionCandidate>& Candidates = Scratch.Candidates;
 
 	BEGIN_UPDATE_LOOP
 		PARTICLE_ELEMENT(FParticleCollisionPayload, CollPayload);
@@ -80,199 +401,98 @@ void UParticleModuleCollision::Update(FModuleUpdateContext& Context)
 			continue;
 		}
 
-		// 이동 경로 계산 (터널링 방지)
-		FVector Start = Particle.OldLocation;
-		FVector End = Particle.Location;
+		if (Candidates.IsEmpty())
+		{
+			CurrentOffset = Offset;  // continue 전 오프셋 리셋 필수!
+			continue;
+		}
+
+		// 이동 경로 계산 (터널링 방지: 현재 위치만 보지 않고 경로 전체를 스윕)
+		const FVector Start = Particle.OldLocation;
+		const FVector End = Particle.Location;
+		const FVector Delta = End - Start;
 
-		// 1. 광역 검사 (CollisionManager AABB 쿼리) - 경로 전체를 포함하는 바운드
 		FAABB PathBounds;
-		// Component-wise min/max
-		PathBounds.Min = FVector(
-			FMath::Min(Start.X, End.X) - ParticleRadius,
-			FMath::Min(Start.Y, End.Y) - ParticleRadius,
-			FMath::Min(Start.Z, End.Z) - ParticleRadius
-		);
-		PathBounds.Max = FVector(
-			FMath::Max(Start.X, End.X) + ParticleRadius,
-			FMath::Max(Start.Y, End.Y) + ParticleRadius,
-			FMath::Max(Start.Z, End.Z) + ParticleRadius
-		);
-
-		// BVH에서 PrimitiveComponent 쿼리 (ShapeComponent + StaticMeshComponent 포함)
-		TArray<UPrimitiveComponent*> Candidates = BVH->QueryIntersectedComponents(PathBounds);
-
-		// 2. 정밀 검사
-		for (UPrimitiveComponent* PrimComp : Candidates)
+		PathBounds.Min = FVector(FMath::Min(Start.X, End.X), FMath::Min(Start.Y, End.Y), FMath::Min(Start.Z, End.Z));
+		PathBounds.Max = FVector(FMath::Max(Start.X, End.X), FMath::Max(Start.Y, End.Y), FMath::Max(Start.Z, End.Z));
+
+		// 2. 정밀 검사: 경로와 겹치는 후보 중 가장 먼저 닿는 표면
+		const FParticleCollisionCandidate* HitCandidate = nullptr;
+		float HitTime = FLT_MAX;
+		FVector HitNormal = FVector(0.0f, 0.0f, 0.0f);
+
+		for (const FParticleCollisionCandidate& Candidate : Candidates)
 		{
-			if (!PrimComp)
+			if (!BoundsOverlap(PathBounds, Candidate.Bounds))
 			{
 				continue;
 			}
 
-			// 충돌 검사: 파티클 현재 위치를 구체로 취급
-			FBoundingSphere ParticleSphere;
-			ParticleSphere.Center = Particle.Location;
-			ParticleSphere.Radius = ParticleRadius;
-
-			// 충돌 여부 검사
+			float Time = 0.0f;
+			FVector Normal;
 			bool bCollided = false;
-			FVector HitNormal = FVector(0.0f, 0.0f, 0.0f);
-
-			// 1. ShapeComponent인 경우 - 기존 정밀 충돌 검사
-			if (UShapeComponent* ShapeComp = Cast<UShapeComponent>(PrimComp))
+			switch (Candidate.Kind)
 			{
-				FShape Shape;
-				ShapeComp->GetShape(Shape);
-				FTransform ShapeTransform = ShapeComp->GetWorldTransform();
-
-				switch (Shape.Kind)
-				{
-				case EShapeKind::Box:
-					{
-						FOBB BoxOBB;
-						Collision::BuildOBB(Shape, ShapeTransform, BoxOBB);
-						bCollided = Collision::Overlap_Sphere_OBB(ParticleSphere.Center, ParticleSphere.Radius, BoxOBB);
-						if (bCollided)
-						{
-							// 박스의 가장 가까운 표면 법선 계산 (단순화)
-							FMatrix InvMatrix = ShapeTransform.ToMatrix().Inverse();
-							FVector LocalPos = InvMatrix.TransformPosition(Particle.Location);
-							FVector Extent = Shape.Box.BoxExtent;
-
-							// 각 축에서 가장 가까운 면 찾기
-							float MinDist = FLT_MAX;
-							for (int32 Axis = 0; Axis < 3; Axis++)
-							{
-								float Dist = FMath::Abs(FMath::Abs(LocalPos[Axis]) - Extent[Axis]);
-								if (Dist < MinDist)
-								{
-									MinDist = Dist;
-									HitNormal = FVector(0.0f, 0.0f, 0.0f);
-									HitNormal[Axis] = (LocalPos[Axis] > 0) ? 1.0f : -1.0f;
-								}
-							}
-							// 월드 공간으로 변환
-							HitNormal = ShapeTransform.ToMatrix().TransformVector(HitNormal);
-							HitNormal.Normalize();
-						}
-					}
-					break;
-
-				case EShapeKind::Sphere:
-					{
-						FVector SphereCenter = ShapeTransform.Translation;
-						float SphereRadius = Shape.Sphere.SphereRadius * Collision::UniformScaleMax(ShapeTransform.Scale3D);
-						float Dist = FVector::Distance(ParticleSphere.Center, SphereCenter);
-						bCollided = (Dist < (ParticleSphere.Radius + SphereRadius));
-						if (bCollided)
-						{
-							HitNormal = (ParticleSphere.Center - SphereCenter);
-							HitNormal.Normalize();
-						}
-					}
-					break;
-
-				case EShapeKind::Capsule:
-					{
-						// 캡슐 충돌 검사
-						FVector P0, P1;
-						float CapsuleRadius;
-						Collision::BuildCapsule(Shape, ShapeTransform, P0, P1, CapsuleRadius);
-
-						// 파티클 위치에서 캡슐 중심선까지의 최단 거리
-						FVector CapsuleDir = P1 - P0;
-						float CapsuleLen = CapsuleDir.Size();
-						if (CapsuleLen > KINDA_SMALL_NUMBER)
-						{
-							CapsuleDir /= CapsuleLen;
-						}
-
-						FVector ToParticle = ParticleSphere.Center - P0;
-						float Projection = FMath::Clamp(FVector::Dot(ToParticle, CapsuleDir), 0.0f, CapsuleLen);
-						FVector ClosestPoint = P0 + CapsuleDir * Projection;
-
-						float Dist = FVector::Distance(ParticleSphere.Center, ClosestPoint);
-						bCollided = (Dist < (ParticleSphere.Radius + CapsuleRadius));
-						if (bCollided)
-						{
-							HitNormal = (ParticleSphere.Center - ClosestPoint);
-							HitNormal.Normalize();
-						}
-					}
-					break;
-				}
+			case ECollisionCandidateKind::Box:
+				bCollided = SweepPointBox(Start, Delta, Candidate.Box, ParticleRadius, Time, Normal);
+				break;
+			case ECollisionCandidateKind::Sphere:
+				bCollided = SweepPointSphere(Start, Delta, Candidate.P0, Candidate.Radius, Time, Normal);
+				break;
+			case ECollisionCandidateKind::Capsule:
+				bCollided = SweepPointCapsule(Start, Delta, Candidate.P0, Candidate.P1, Candidate.Radius, Time, Normal);
+				break;
 			}
-			// 2. StaticMeshComponent인 경우 - AABB 기반 충돌
-			else if (UStaticMeshComponent* MeshComp = Cast<UStaticMeshComponent>(PrimComp))
-			{
-				FAABB MeshAABB = MeshComp->GetWorldAABB();
-
-				// 파티클 구체와 AABB 충돌 검사
-				FVector ClosestPoint;
-				ClosestPoint.X = FMath::Clamp(ParticleSphere.Center.X, MeshAABB.Min.X, MeshAABB.Max.X);
-				ClosestPoint.Y = FMath::Clamp(ParticleSphere.Center.Y, MeshAABB.Min.Y, MeshAABB.Max.Y);
-				ClosestPoint.Z = FMath::Clamp(ParticleSphere.Center.Z, MeshAABB.Min.Z, MeshAABB.Max.Z);
 
-				float DistSq = FVector::DistSquared(ParticleSphere.Center, ClosestPoint);
-				bCollided = (DistSq < ParticleSphere.Radius * ParticleSphere.Radius);
-
-				if (bCollided)
-				{
-					// AABB 표면 법선 계산
-					HitNormal = ParticleSphere.Center - ClosestPoint;
-					if (HitNormal.SizeSquared() > KINDA_SMALL_NUMBER)
-					{
-						HitNormal.Normalize();
-					}
-					else
-					{
-						// 파티클이 AABB 내부에 있는 경우 - 위쪽으로 밀어냄
-						HitNormal = FVector(0.0f, 0.0f, 1.0f);
-					}
-				}
+			if (bCollided && Time < HitTime)
+			{
+				HitCandidate = &Candidate;
+				HitTime = Time;
+				HitNormal = Normal;
 			}
+		}
+
+		if (HitCandidate)
+		{
+			UPrimitiveComponent* PrimComp = HitCandidate->Component;
+			const FVector HitLocation = Start + Delta * HitTime;
 
-			if (bCollided)
+			// 충돌 이벤트 생성
+			if (bGenerateCollisionEvents)
 			{
-				// 충돌 이벤트 생성
-				if (bGenerateCollisionEvents && PSC)
+				// 컴포넌트 유효성 검사 (언리얼 방식)
+				if (!PrimComp->IsPendingDestroy())
 				{
-					// 컴포넌트 유효성 검사 (언리얼 방식)
-					if (PrimComp && !PrimComp->IsPendingDestroy())
+					AActor* Owner = PrimComp->GetOwner();
+					// 파괴 예정인 Actor는 null로 처리
+					if (Owner && Owner->IsPendingDestroy())
 					{
-						AActor* Owner = PrimComp->GetOwner();
-						// 파괴 예정인 Actor는 null로 처리
-						if (Owner && Owner->IsPendingDestroy())
-						{
-							Owner = nullptr;
-						}
-
-						FParticleEventCollideData Event;
-						Event.Type = EParticleEventType::Collision;
-						Event.EventName = CollisionEventName;  // 이벤트 이름 설정
-						Event.Position = Particle.Location;
-						Event.Velocity = Particle.Velocity;
-						Event.Normal = HitNormal;
-						Event.HitComponent = PrimComp;
-						Event.HitActor = Owner;
-						Event.EmitterTime = Context.Owner.EmitterTime;
-
-						PSC->AddCollisionEvent(Event);
+						Owner = nullptr;
 					}
-				}
 
-				// 충돌 위치 보정 (표면에서 약간 띄움)
-				Particle.Location += HitNormal * ParticleRadius * 0.1f;
+					FParticleEventCollideData Event;
+					Event.Type = EParticleEventType::Collision;
+					Event.EventName = CollisionEventName;  // 이벤트 이름 설정
+					Event.Position = HitLocation;
+					Event.Velocity = Particle.Velocity;
+					Event.Normal = HitNormal;
+					Event.HitComponent = PrimComp;
+					Event.HitActor = Owner;
+					Event.EmitterTime = Context.Owner.EmitterTime;
+
+					PSC->AddCollisionEvent(Event);
+				}
+			}
 
-				// 바운스 처리
-				ApplyDamping(Particle, CollPayload, HitNormal);
-				CollPayload.UsedCollisionCount++;
+			// 충돌 위치 보정 (접촉 지점에서 표면 밖으로 약간 띄움)
+			Particle.Location = HitLocation + HitNormal * ParticleRadius * 0.1f;
 
-				// 충돌 발생 플래그 설정
-				Particle.Flags |= STATE_Particle_CollisionHasOccurred;
+			// 바운스 처리
+			ApplyDamping(Particle, CollPayload, HitNormal);
+			CollPayload.UsedCollisionCount++;
 
-				break;  // 한 프레임에 하나의 충돌만 처리
-			}
+			// 충돌 발생 플래그 설정
+			Particle.Flags |= STATE_Particle_CollisionHasOccurred;
 		}
 	END_UPDATE_LOOP
 }
@@ -71,7 +71,7 @@ public:
 	// 스폰 시 페이로드 초기화
 	virtual void Spawn(FParticleEmitterInstance* Owner, int32 Offset, float SpawnTime, FBaseParticle* ParticleBase) override;
 
-	// 매 프레임 충돌 검사
+	// 매 프레임 충돌 검사 (이미터당 BVH 질의 1회 + 파티클별 스윕 검사)
 	virtual void Update(FModuleUpdateContext& Context) override;
 
 	// 직렬화
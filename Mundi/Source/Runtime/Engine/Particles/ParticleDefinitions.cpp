@@ -32,7 +32,7 @@ bool FParticleDataContainer::Alloc(int32 InParticleDataNumBytes, int32 InParticl
 		* 반환 타입이 void*이므로, 이를 uint8*로 캐스팅해서 바이트 배열처럼 쓰기 위해 static_cast<uint8*> 사용.
 		* ParticleData는 이 메모리 블록의 시작 주소를 가리키게 됨.
 		*/
-		ParticleData = static_cast<uint8*>(_aligned_malloc(MemBlockSize, 16));
+		ParticleData = static_cast<uint8*>(FMemoryManager::Allocate(MemBlockSize, 16, EMemoryTag::Particles));
 
 		if (ParticleData)
 		{
@@ -67,8 +67,7 @@ void FParticleDataContainer::Free()
 {
 	if (ParticleData)
 	{
-		// 정렬된 메모리는 _aligned_free로 해제
-		_aligned_free(ParticleData);
+		FMemoryManager::Deallocate(ParticleData);
 		ParticleData = nullptr;
 		ParticleIndices = nullptr;
 	}
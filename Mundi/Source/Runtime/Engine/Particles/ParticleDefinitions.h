@@ -420,6 +420,9 @@ struct FDynamicSpriteEmitterDataBase : public FDynamicEmitterDataBase
 // 스프라이트 이미터 데이터 구현
 struct FDynamicSpriteEmitterData : public FDynamicSpriteEmitterDataBase
 {
+	// 이미터마다 매 프레임 생성/삭제되므로 풀에서 할당
+	DECLARE_POOLED_ALLOCATION(FDynamicSpriteEmitterData, EMemoryTag::Particles)
+
 	FDynamicSpriteEmitterReplayDataBase Source;
 
 	virtual ~FDynamicSpriteEmitterData() = default;
@@ -438,6 +441,9 @@ struct FDynamicSpriteEmitterData : public FDynamicSpriteEmitterDataBase
 // 메시 이미터 데이터 구현
 struct FDynamicMeshEmitterData : public FDynamicSpriteEmitterData
 {
+	// 이미터마다 매 프레임 생성/삭제되므로 풀에서 할당
+	DECLARE_POOLED_ALLOCATION(FDynamicMeshEmitterData, EMemoryTag::Particles)
+
 	FDynamicMeshEmitterReplayDataBase MeshSource;
 
 	virtual ~FDynamicMeshEmitterData() = default;
@@ -458,6 +464,9 @@ struct FDynamicMeshEmitterData : public FDynamicSpriteEmitterData
 // 빔 이미터 데이터 구현
 struct FDynamicBeamEmitterData : public FDynamicSpriteEmitterDataBase
 {
+	// 이미터마다 매 프레임 생성/삭제되므로 풀에서 할당
+	DECLARE_POOLED_ALLOCATION(FDynamicBeamEmitterData, EMemoryTag::Particles)
+
 	FDynamicBeamEmitterReplayDataBase Source;
 
 	virtual ~FDynamicBeamEmitterData() = default;
@@ -478,6 +487,9 @@ struct FDynamicBeamEmitterData : public FDynamicSpriteEmitterDataBase
 // 리본 이미터 데이터 구현
 struct FDynamicRibbonEmitterData : public FDynamicSpriteEmitterDataBase
 {
+	// 이미터마다 매 프레임 생성/삭제되므로 풀에서 할당
+	DECLARE_POOLED_ALLOCATION(FDynamicRibbonEmitterData, EMemoryTag::Particles)
+
 	FDynamicRibbonEmitterReplayDataBase Source;
 
 	virtual ~FDynamicRibbonEmitterData() = default;
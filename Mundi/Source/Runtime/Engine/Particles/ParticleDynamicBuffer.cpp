@@ -0,0 +1,314 @@
+﻿#include "pch.h"
+#include "ParticleDynamicBuffer.h"
+#include <atomic>
+#include <thread>
+
+namespace
+{
+	// 스레드 하나가 맡을 최소 파티클 수 (이보다 적으면 스레드 생성 비용이 더 크다)
+	constexpr uint32 MinParticlesPerFillThread = 4096;
+	constexpr int32 MaxFillThreads = 8;
+}
+
+FParticleDynamicBufferAllocator& FParticleDynamicBufferAllocator::GetInstance()
+{
+	static FParticleDynamicBufferAllocator Instance;
+	return Instance;
+}
+
+void FParticleDynamicBufferAllocator::BeginPass()
+{
+	if (bInPass)
+	{
+		EndPass();
+	}
+
+	bInPass = true;
+	for (FRing* Ring : { &VertexRing, &IndexRing })
+	{
+		Ring->bUsedThisPass = false;
+		Ring->PassBytes = 0;
+	}
+
+	Stats.Allocations = 0;
+	Stats.Maps = 0;
+	Stats.VertexBytes = 0;
+	Stats.IndexBytes = 0;
+	Stats.FillTasks = 0;
+	Stats.FillThreads = 0;
+}
+
+void FParticleDynamicBufferAllocator::EndPass()
+{
+	if (!bInPass)
+	{
+		return;
+	}
+	bInPass = false;
+
+	VertexRing.LastPassBytes = VertexRing.PassBytes;
+	IndexRing.LastPassBytes = IndexRing.PassBytes;
+
+	// 채우기는 매핑된 메모리에만 쓰므로 언맵 전에 끝낸다
+	RunFillTasks();
+
+	ID3D11DeviceContext* Context = GEngine.GetRHIDevice()->GetDeviceContext();
+	for (ID3D11Buffer* Buffer : MappedBuffers)
+	{
+		Context->Unmap(Buffer, 0);
+	}
+	MappedBuffers.Empty();
+	VertexRing.MappedData = nullptr;
+	IndexRing.MappedData = nullptr;
+
+	// 교체된 버퍼는 이번 패스의 드로우가 아직 참조하므로 몇 프레임 뒤에 해제
+	URenderer* Renderer = GEngine.GetRenderer();
+	for (ID3D11Buffer* Buffer : RetiredBuffers)
+	{
+		if (Renderer)
+		{
+			Renderer->DeferredReleaseBuffer(Buffer);
+		}
+		else
+		{
+			Buffer->Release();
+		}
+	}
+	RetiredBuffers.Empty();
+}
+
+FParticleBufferRange FParticleDynamicBufferAllocator::AllocateVertices(uint32 NumElements, uint32 Stride)
+{
+	FParticleBufferRange Range = Allocate(VertexRing, NumElements, Stride);
+	if (Range.IsValid())
+	{
+		Stats.VertexBytes += static_cast<uint64>(NumElements) * Stride;
+		Stats.VertexCapacity = VertexRing.Capacity;
+	}
+	return Range;
+}
+
+FParticleBufferRange FParticleDynamicBufferAllocator::AllocateIndices(uint32 NumIndices)
+{
+	FParticleBufferRange Range = Allocate(IndexRing, NumIndices, sizeof(uint32));
+	if (Range.IsValid())
+	{
+		Stats.IndexBytes += static_cast<uint64>(NumIndices) * sizeof(uint32);
+		Stats.IndexCapacity = IndexRing.Capacity;
+	}
+	return Range;
+}
+
+FParticleBufferRange FParticleDynamicBufferAllocator::Allocate(FRing& Ring, uint32 NumElements, uint32 Stride)
+{
+	FParticleBufferRange Range;
+	if (!bInPass || NumElements == 0 || Stride == 0)
+	{
+		return Range;
+	}
+
+	const uint64 Bytes = static_cast<uint64>(NumElements) * Stride;
+	auto AlignedCursor = [&Ring, Stride]() { return (static_cast<uint64>(Ring.Cursor) + Stride - 1) / Stride * Stride; };
+
+	// 패스의 첫 할당: 직전 패스만큼 쓸 자리가 꼬리에 없으면 미리 처음으로 돌아간다
+	// (패스 도중에는 앞서 내준 구간 때문에 되감을 수 없어 버퍼를 키워야 하므로)
+	const uint64 ExpectedBytes = Ring.bUsedThisPass ? Bytes : std::max<uint64>(Bytes, Ring.LastPassBytes);
+
+	if (!Ring.Buffer || AlignedCursor() + ExpectedBytes > Ring.Capacity)
+	{
+		if (Ring.Buffer && !Ring.bUsedThisPass && Bytes <= Ring.Capacity)
+		{
+			// 링 끝: 이번 패스가 아직 이 버퍼를 쓰지 않았으므로 DISCARD로 처음부터 (이전 패스 드로우는 이미 제출됨)
+			if (Ring.MappedData)
+			{
+				GEngine.GetRHIDevice()->GetDeviceContext()->Unmap(Ring.Buffer, 0);
+				MappedBuffers.Remove(Ring.Buffer);
+				Ring.MappedData = nullptr;
+			}
+			Ring.Cursor = 0;
+			if (!MapRing(Ring, D3D11_MAP_WRITE_DISCARD))
+			{
+				return Range;
+			}
+			++Stats.Wraps;
+		}
+		else
+		{
+			// 이번 패스의 구간이 아직 그려지지 않았으므로 덮어쓸 수 없다 → 더 큰 버퍼로 교체
+			const uint64 Needed = std::max<uint64>(static_cast<uint64>(Ring.Capacity) * 2, (Ring.PassBytes + Bytes) * 2);
+			const uint32 NewCapacity = static_cast<uint32>(std::min<uint64>(std::max<uint64>(Needed, Ring.InitialCapacity), 0x7FFFFFFFull));
+			if (Ring.Buffer)
+			{
+				// 매핑된 채로 두었다가 EndPass에서 언맵/해제
+				if (!Ring.MappedData)
+				{
+					Ring.Buffer->Release();
+				}
+				else
+				{
+					RetiredBuffers.Add(Ring.Buffer);
+				}
+				Ring.Buffer = nullptr;
+				Ring.MappedData = nullptr;
+				++Stats.Grows;
+			}
+			if (!CreateRingBuffer(Ring, NewCapacity) || !MapRing(Ring, D3D11_MAP_WRITE_DISCARD))
+			{
+				return Range;
+			}
+		}
+	}
+	else if (!Ring.MappedData)
+	{
+		// 패스의 첫 할당: 앞쪽 구간은 GPU가 읽고 있을 수 있으므로 덮어쓰지 않는다고 약속하고 이어 쓴다
+		if (!MapRing(Ring, D3D11_MAP_WRITE_NO_OVERWRITE))
+		{
+			return Range;
+		}
+	}
+
+	const uint64 Offset = AlignedCursor();
+	Ring.Cursor = static_cast<uint32>(Offset + Bytes);
+	Ring.PassBytes += Bytes;
+	Ring.bUsedThisPass = true;
+
+	Range.Buffer = Ring.Buffer;
+	Range.Data = Ring.MappedData + Offset;
+	Range.FirstElement = static_cast<uint32>(Offset / Stride);
+	Range.NumElements = NumElements;
+	++Stats.Allocations;
+	return Range;
+}
+
+bool FParticleDynamicBufferAllocator::CreateRingBuffer(FRing& Ring, uint32 InCapacity)
+{
+	D3D11_BUFFER_DESC Desc = {};
+	Desc.ByteWidth = InCapacity;
+	Desc.Usage = D3D11_USAGE_DYNAMIC;
+	Desc.BindFlags = Ring.BindFlags;
+	Desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+	ID3D11Device* Device = GEngine.GetRHIDevice()->GetDevice();
+	if (FAILED(Device->CreateBuffer(&Desc, nullptr, &Ring.Buffer)))
+	{
+		Ring.Buffer = nullptr;
+		Ring.Capacity = 0;
+		return false;
+	}
+
+	Ring.Capacity = InCapacity;
+	Ring.Cursor = 0;
+	return true;
+}
+
+bool FParticleDynamicBufferAllocator::MapRing(FRing& Ring, D3D11_MAP MapType)
+{
+	D3D11_MAPPED_SUBRESOURCE MappedData = {};
+	if (FAILED(GEngine.GetRHIDevice()->GetDeviceContext()->Map(Ring.Buffer, 0, MapType, 0, &MappedData)))
+	{
+		return false;
+	}
+
+	Ring.MappedData = static_cast<uint8*>(MappedData.pData);
+	MappedBuffers.Add(Ring.Buffer);
+	++Stats.Maps;
+	return true;
+}
+
+void FParticleDynamicBufferAllocator::AddFillTask(std::function<void()> InTask, uint32 InCost)
+{
+	FillTasks.Add({ std::move(InTask), InCost });
+}
+
+void FParticleDynamicBufferAllocator::RunFillTasks()
+{
+	const int32 NumTasks = FillTasks.Num();
+	Stats.FillTasks = static_cast<uint32>(NumTasks);
+	if (NumTasks == 0)
+	{
+		return;
+	}
+
+	uint64 TotalCost = 0;
+	for (const FFillTask& Task : FillTasks)
+	{
+		TotalCost += Task.Cost;
+	}
+
+	const int32 HardwareThreads = std::max(1, static_cast<int32>(std::thread::hardware_concurrency()));
+	const int32 NumThreads = static_cast<int32>(std::clamp<uint64>(std::min<uint64>(TotalCost / MinParticlesPerFillThread, static_cast<uint64>(std::min(HardwareThreads, MaxFillThreads))), 1, static_cast<uint64>(NumTasks)));
+	Stats.FillThreads = static_cast<uint32>(NumThreads);
+
+	if (NumThreads == 1)
+	{
+		for (FFillTask& Task : FillTasks)
+		{
+			Task.Task();
+		}
+	}
+	else
+	{
+		// 큰 작업부터 가져가도록 정렬 후 원자 카운터로 분배 (각 작업은 자기 구간에만 쓴다)
+		std::sort(FillTasks.begin(), FillTasks.end(), [](const FFillTask& A, const FFillTask& B) { return A.Cost > B.Cost; });
+
+		std::atomic<int32> NextTask{ 0 };
+		auto Worker = [this, &NextTask, NumTasks]()
+			{
+				for (int32 Index = NextTask.fetch_add(1); Index < NumTasks; Index = NextTask.fetch_add(1))
+				{
+					FillTasks[Index].Task();
+				}
+			};
+
+		TArray<std::thread> Workers;
+		Workers.Reserve(NumThreads - 1);
+		for (int32 i = 1; i < NumThreads; ++i)
+		{
+			Workers.Emplace(Worker);
+		}
+		Worker();
+		for (std::thread& Thread : Workers)
+		{
+			Thread.join();
+		}
+	}
+
+	FillTasks.Empty();
+}
+
+void FParticleDynamicBufferAllocator::Shutdown()
+{
+	FillTasks.Empty();
+	if (bInPass)
+	{
+		bInPass = false;
+		if (ID3D11DeviceContext* Context = GEngine.GetRHIDevice() ? GEngine.GetRHIDevice()->GetDeviceContext() : nullptr)
+		{
+			for (ID3D11Buffer* Buffer : MappedBuffers)
+			{
+				Context->Unmap(Buffer, 0);
+			}
+		}
+	}
+	MappedBuffers.Empty();
+
+	for (ID3D11Buffer* Buffer : RetiredBuffers)
+	{
+		Buffer->Release();
+	}
+	RetiredBuffers.Empty();
+
+	for (FRing* Ring : { &VertexRing, &IndexRing })
+	{
+		if (Ring->Buffer)
+		{
+			Ring->Buffer->Release();
+			Ring->Buffer = nullptr;
+		}
+		Ring->MappedData = nullptr;
+		Ring->Capacity = 0;
+		Ring->Cursor = 0;
+		Ring->PassBytes = 0;
+		Ring->LastPassBytes = 0;
+	}
+}
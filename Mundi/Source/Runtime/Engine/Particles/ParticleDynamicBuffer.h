@@ -0,0 +1,114 @@
+﻿#pragma once
+
+#include <functional>
+
+// 공유 링 버퍼에서 잘라 받은 구간
+// 버퍼는 패스가 끝날 때까지 매핑되어 있으며, Data에는 패스 안에서만 쓸 수 있다.
+struct FParticleBufferRange
+{
+	ID3D11Buffer* Buffer = nullptr;
+	uint8* Data = nullptr;
+	uint32 FirstElement = 0;	// 스트라이드 단위 시작 위치 (StartInstanceLocation / BaseVertexIndex / StartIndex)
+	uint32 NumElements = 0;
+
+	bool IsValid() const { return Buffer != nullptr && Data != nullptr; }
+
+	template<typename T>
+	T* GetData() const { return reinterpret_cast<T*>(Data); }
+};
+
+// 파티클 동적 버퍼 통계
+struct FParticleBufferStats
+{
+	// 마지막 패스
+	uint32 Allocations = 0;
+	uint32 Maps = 0;
+	uint64 VertexBytes = 0;
+	uint64 IndexBytes = 0;
+	uint32 FillTasks = 0;
+	uint32 FillThreads = 0;
+
+	// 링 버퍼 크기
+	uint32 VertexCapacity = 0;
+	uint32 IndexCapacity = 0;
+
+	// 누적
+	uint32 Wraps = 0;		// 끝에 도달해 DISCARD로 처음부터 다시 쓴 횟수
+	uint32 Grows = 0;		// 한 패스가 링을 넘쳐 더 큰 버퍼로 교체한 횟수
+};
+
+/**
+ * 모든 파티클 시스템이 공유하는 프레임 동적 버퍼 할당기 (싱글톤)
+ * 정점/인스턴스용 링 하나와 인덱스용 링 하나를 MAP_WRITE_NO_OVERWRITE로 이어 쓰고,
+ * 링 끝에 도달하면 DISCARD로 처음부터 다시 쓴다.
+ *
+ * 사용법 (FSceneRenderer::RenderParticleSystemPass):
+ * 1. BeginPass()
+ * 2. 컴포넌트가 Allocate*로 구간을 받아 배치를 만들고, 실제 채우기는 AddFillTask로 등록
+ * 3. EndPass()에서 채우기 작업을 병렬로 실행한 뒤 언맵 (이후 드로우)
+ */
+class FParticleDynamicBufferAllocator
+{
+public:
+	static FParticleDynamicBufferAllocator& GetInstance();
+
+	void BeginPass();
+	void EndPass();
+
+	/** 스트라이드 배수 위치에서 정점/인스턴스 NumElements개를 할당 */
+	FParticleBufferRange AllocateVertices(uint32 NumElements, uint32 Stride);
+
+	/** uint32 인덱스 NumIndices개를 할당 */
+	FParticleBufferRange AllocateIndices(uint32 NumIndices);
+
+	/** EndPass에서 실행할 채우기 작업. Cost는 작업량(파티클 수) 추정치로 스레드 분배에 쓴다 */
+	void AddFillTask(std::function<void()> InTask, uint32 InCost);
+
+	/** 버퍼 해제 (엔진 종료 시, 디바이스 해제 전에 호출) */
+	void Shutdown();
+
+	const FParticleBufferStats& GetStats() const { return Stats; }
+
+private:
+	FParticleDynamicBufferAllocator() = default;
+	~FParticleDynamicBufferAllocator() = default;
+	FParticleDynamicBufferAllocator(const FParticleDynamicBufferAllocator&) = delete;
+	FParticleDynamicBufferAllocator& operator=(const FParticleDynamicBufferAllocator&) = delete;
+
+	struct FRing
+	{
+		ID3D11Buffer* Buffer = nullptr;
+		uint8* MappedData = nullptr;
+		uint32 Capacity = 0;
+		uint32 Cursor = 0;				// 다음에 쓸 바이트 위치
+		bool bUsedThisPass = false;		// 이번 패스에서 이미 구간을 내줬는지 (DISCARD 불가)
+		UINT BindFlags = 0;
+		uint32 InitialCapacity = 0;
+		uint64 PassBytes = 0;			// 이번 패스에서 할당한 바이트
+		uint64 LastPassBytes = 0;		// 직전 패스에서 할당한 바이트 (패스 시작 시 남은 공간 판단용)
+	};
+
+	struct FFillTask
+	{
+		std::function<void()> Task;
+		uint32 Cost = 0;
+	};
+
+	FParticleBufferRange Allocate(FRing& Ring, uint32 NumElements, uint32 Stride);
+	bool CreateRingBuffer(FRing& Ring, uint32 InCapacity);
+	bool MapRing(FRing& Ring, D3D11_MAP MapType);
+	void RunFillTasks();
+
+	FRing VertexRing{ nullptr, nullptr, 0, 0, false, D3D11_BIND_VERTEX_BUFFER, 4 * 1024 * 1024, 0, 0 };
+	FRing IndexRing{ nullptr, nullptr, 0, 0, false, D3D11_BIND_INDEX_BUFFER, 1024 * 1024, 0, 0 };
+
+	// 이번 패스에서 매핑한 버퍼 (교체된 버퍼 포함, EndPass에서 언맵)
+	TArray<ID3D11Buffer*> MappedBuffers;
+	// 패스 도중 교체된 버퍼 (언맵 후 지연 해제)
+	TArray<ID3D11Buffer*> RetiredBuffers;
+
+	TArray<FFillTask> FillTasks;
+	bool bInPass = false;
+
+	FParticleBufferStats Stats;
+};
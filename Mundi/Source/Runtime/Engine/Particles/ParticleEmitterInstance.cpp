@@ -74,46 +74,15 @@ void FParticleEmitterInstance::Init(UParticleSystemComponent* InComponent, UPart
 
 	ParticleSize = SpriteTemplate->ParticleSize;
 
-	// 언리얼 엔진 호환: 타이밍 상태 초기화
-	EmitterTime = 0.0f;
-	SecondsSinceCreation = 0.0f;
-	CurrentLoopCount = 0;
-	bEmitterEnabled = true;
-	bDelayComplete = false;
+	// 언리얼 엔진 호환: 타이밍 상태 초기화 (딜레이/지속 시간 샘플링 포함)
 	// BurstFired 배열은 SetupEmitter()에서 초기화됨
-	SpawnFraction = 0.0f;
+	ResetTiming();
 
 	// 언리얼 엔진 호환: Required 모듈에서 설정 읽기
 	if (CurrentLODLevel->RequiredModule)
 	{
 		UParticleModuleRequired* RequiredModule = CurrentLODLevel->RequiredModule;
 
-		// EmitterDelay 초기화 (랜덤 범위 지원)
-		if (RequiredModule->EmitterDelayLow > 0.0f)
-		{
-			EmitterDelayActual = RandomStream.GetRangeFloat(
-				RequiredModule->EmitterDelayLow,
-				RequiredModule->EmitterDelay
-			);
-		}
-		else
-		{
-			EmitterDelayActual = RequiredModule->EmitterDelay;
-		}
-
-		// EmitterDuration 초기화 (랜덤 범위 지원)
-		if (RequiredModule->EmitterDurationLow > 0.0f)
-		{
-			EmitterDurationActual = RandomStream.GetRangeFloat(
-				RequiredModule->EmitterDurationLow,
-				RequiredModule->EmitterDuration
-			);
-		}
-		else
-		{
-			EmitterDurationActual = RequiredModule->EmitterDuration;
-		}
-
 		// 이미터 트랜스폼 캐시
 		CachedEmitterOrigin = RequiredModule->EmitterOrigin;
 		CachedEmitterRotation = RequiredModule->EmitterRotation;
@@ -137,6 +106,68 @@ void FParticleEmitterInstance::Init(UParticleSystemComponent* InComponent, UPart
 	Resize(100); // Default to 100 particles
 }
 
+void FParticleEmitterInstance::ResetTiming()
+{
+	EmitterTime = 0.0f;
+	SecondsSinceCreation = 0.0f;
+	CurrentLoopCount = 0;
+	bEmitterEnabled = true;
+	bDelayComplete = false;
+	SpawnFraction = 0.0f;
+	for (int32 i = 0; i < BurstFired.Num(); ++i)
+	{
+		BurstFired[i] = false;
+	}
+
+	UParticleModuleRequired* RequiredModule = CurrentLODLevel ? CurrentLODLevel->RequiredModule : nullptr;
+	if (!RequiredModule)
+	{
+		return;
+	}
+
+	// EmitterDelay 초기화 (랜덤 범위 지원)
+	if (RequiredModule->EmitterDelayLow > 0.0f)
+	{
+		EmitterDelayActual = RandomStream.GetRangeFloat(
+			RequiredModule->EmitterDelayLow,
+			RequiredModule->EmitterDelay
+		);
+	}
+	else
+	{
+		EmitterDelayActual = RequiredModule->EmitterDelay;
+	}
+
+	// EmitterDuration 초기화 (랜덤 범위 지원)
+	if (RequiredModule->EmitterDurationLow > 0.0f)
+	{
+		EmitterDurationActual = RandomStream.GetRangeFloat(
+			RequiredModule->EmitterDurationLow,
+			RequiredModule->EmitterDuration
+		);
+	}
+	else
+	{
+		EmitterDurationActual = RequiredModule->EmitterDuration;
+	}
+}
+
+void FParticleEmitterInstance::Rewind()
+{
+	// 파티클 데이터 버퍼(FParticleDataContainer)는 그대로 두고 상태만 처음으로 되돌린다
+	KillAllParticles();
+	FrameSpawnedCount = 0;
+	FrameKilledCount = 0;
+	ResetTiming();
+}
+
+bool FParticleEmitterInstance::IsComplete() const
+{
+	// 루프가 끝나 비활성화되었고 남은 파티클도 없음 (무한 루프 이미터는 완료되지 않음)
+	const bool bEmitting = bEmitterEnabled && CurrentLODLevel && CurrentLODLevel->bEnabled;
+	return !bEmitting && ActiveParticles == 0;
+}
+
 void FParticleEmitterInstance::SetLODLevel(int32 NewLODIndex)
 {
 	if (NewLODIndex == CurrentLODLevelIndex || !SpriteTemplate)
@@ -381,11 +412,18 @@ void FParticleEmitterInstance::Tick(float DeltaTime, bool bSuppressSpawning)
 	FrameSpawnedCount = 0;
 	FrameKilledCount = 0;
 
-	if (!CurrentLODLevel || !bEmitterEnabled || !CurrentLODLevel->bEnabled)
+	if (!CurrentLODLevel)
 	{
 		return;
 	}
 
+	// 방출이 끝났어도 남은 파티클은 수명이 다할 때까지 진행시킨다 (멈춘 채로 남으면 IsComplete가 영원히 false)
+	if (!bEmitterEnabled || !CurrentLODLevel->bEnabled)
+	{
+		UpdateParticles(DeltaTime);
+		return;
+	}
+
 	UParticleModuleRequired* RequiredModule = CurrentLODLevel->RequiredModule;
 
 	// 언리얼 엔진 호환: 타이머 업데이트
@@ -1022,14 +1060,11 @@ bool FParticleEmitterInstance::BuildRibbonDynamicData(FDynamicRibbonEmitterData*
 
 	// 파티클을 나이(RelativeTime)순으로 정렬하기 위해 인덱스 배열을 복사하고 정렬합니다.
 	// 오래된 파티클(RelativeTime이 큰 값)이 트레일의 앞쪽이 됩니다.
-	TArray<uint16> SortedIndices;
-	SortedIndices.Reserve(ActiveParticles);
-	for (int32 i = 0; i < ActiveParticles; ++i)
-	{
-		SortedIndices.Add(ParticleIndices[i]);
-	}
+	// 정렬용 인덱스는 이 함수 안에서만 쓰므로 프레임 선형 할당자에서 받는다
+	uint16* SortedIndices = FMemoryManager::AllocateFrameArray<uint16>(ActiveParticles);
+	memcpy(SortedIndices, ParticleIndices, sizeof(uint16) * ActiveParticles);
 
-	std::sort(SortedIndices.begin(), SortedIndices.end(), [&](uint16 A, uint16 B) {
+	std::sort(SortedIndices, SortedIndices + ActiveParticles, [&](uint16 A, uint16 B) {
 		const FBaseParticle* ParticleA = reinterpret_cast<const FBaseParticle*>(ParticleData + A * ParticleStride);
 		const FBaseParticle* ParticleB = reinterpret_cast<const FBaseParticle*>(ParticleData + B * ParticleStride);
 		return ParticleA->RelativeTime > ParticleB->RelativeTime; // 내림차순 정렬 (오래된 것이 먼저)
@@ -74,6 +74,9 @@ struct FParticleEmitterInstance
 	FVector CachedEmitterRotation;   // Required 모듈의 EmitterRotation 캐시 (Euler angles)
 	FMatrix EmitterToWorld;          // 이미터 회전 변환 행렬 (파티클 속도 회전용)
 
+	// 컴포넌트 활성화/템플릿 교체마다 생성/삭제되므로 풀에서 할당
+	DECLARE_POOLED_ALLOCATION(FParticleEmitterInstance, EMemoryTag::Particles)
+
 	// 생성자 / 소멸자
 	FParticleEmitterInstance();
 	virtual ~FParticleEmitterInstance();
@@ -81,6 +84,15 @@ struct FParticleEmitterInstance
 	// 이미터 인스턴스 초기화
 	void Init(UParticleSystemComponent* InComponent, UParticleEmitter* InTemplate);
 
+	// 타이밍 상태 초기화 (딜레이/지속 시간 재샘플링, 버스트 리셋)
+	void ResetTiming();
+
+	// 할당된 파티클 메모리를 유지한 채 처음 상태로 되돌림 (풀 재사용)
+	void Rewind();
+
+	// 방출이 끝나고 살아 있는 파티클도 없는지
+	bool IsComplete() const;
+
 	// LOD 레벨 전환 
 	void SetLODLevel(int32 NewLODIndex);
 
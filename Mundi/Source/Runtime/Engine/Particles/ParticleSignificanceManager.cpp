@@ -0,0 +1,309 @@
+﻿#include "pch.h"
+#include "ParticleSignificanceManager.h"
+#include "ParticleSystemComponent.h"
+#include "ParticleEmitterInstance.h"
+#include <cfloat>
+
+namespace
+{
+	// 에디터 멀티 뷰포트 + 프리뷰 창을 넘는 뷰는 무시한다
+	constexpr int32 MaxTrackedViews = 8;
+
+	// 파티클이 없거나 바운드를 알 수 없는 시스템(빔/리본)의 화면 크기 추정용 반경
+	constexpr float DefaultSystemRadius = 1.0f;
+
+	struct FSignificanceCandidate
+	{
+		UParticleSystemComponent* Component = nullptr;
+		float Score = 0.0f;
+		int32 NumParticles = 0;
+		int32 NumEmitters = 0;
+		bool bAlwaysSimulate = false;
+	};
+}
+
+bool FParticleSignificanceManager::bEnabled = true;
+int32 FParticleSignificanceManager::MaxParticles = 50000;
+int32 FParticleSignificanceManager::MaxEmitters = 512;
+int32 FParticleSignificanceManager::UpdateRates[static_cast<int32>(EParticleSignificance::Count)] = { 1, 1, 2, 4, 0 };
+float FParticleSignificanceManager::MidScreenSize = 0.1f;
+float FParticleSignificanceManager::FarScreenSize = 0.02f;
+float FParticleSignificanceManager::MaxCatchUpTime = 1.0f;
+
+FParticleSignificanceManager::FParticleSignificanceManager(UWorld* InWorld)
+	: World(InWorld)
+{
+}
+
+FParticleSignificanceManager::~FParticleSignificanceManager()
+{
+	// 월드보다 오래 사는 컴포넌트가 해제된 매니저를 참조하지 않도록 연결을 끊는다
+	for (UParticleSystemComponent* Component : Components)
+	{
+		Component->SignificanceState.Manager = nullptr;
+	}
+}
+
+void FParticleSignificanceManager::RegisterComponent(UParticleSystemComponent* InComponent)
+{
+	if (!InComponent)
+	{
+		return;
+	}
+
+	FParticleSignificanceManager* Previous = InComponent->SignificanceState.Manager;
+	if (Previous == this)
+	{
+		return;
+	}
+	if (Previous)
+	{
+		Previous->UnregisterComponent(InComponent);
+	}
+
+	// 새로 등록된 시스템은 첫 렌더 전까지 화면 안으로 간주 (스폰 직후 이펙트가 화면 밖 간격으로 늦게 시작하지 않도록)
+	InComponent->SignificanceState.LastRenderFrame = FrameCounter;
+	InComponent->SignificanceState.Manager = this;
+	Components.Add(InComponent);
+}
+
+void FParticleSignificanceManager::UnregisterComponent(UParticleSystemComponent* InComponent)
+{
+	const int32 Index = Components.Find(InComponent);
+	if (Index >= 0)
+	{
+		Components.RemoveAtSwap(Index);
+		InComponent->SignificanceState.Manager = nullptr;
+	}
+}
+
+void FParticleSignificanceManager::BeginFrame()
+{
+	++FrameCounter;
+
+	// 렌더가 한 번도 돌지 않은 프레임(최소화 등)에는 이전 뷰를 유지한다
+	if (!PendingViews.IsEmpty())
+	{
+		std::swap(Views, PendingViews);
+		PendingViews.Empty();
+	}
+
+	Stats = FParticleSignificanceStats();
+
+	// 1. 버킷/점수/비용 계산
+	TArray<FSignificanceCandidate> Candidates;
+	Candidates.Reserve(Components.Num());
+
+	for (UParticleSystemComponent* Component : Components)
+	{
+		FParticleSignificanceState& State = Component->SignificanceState;
+		State.bSuppressSpawning = false;
+
+		if (!Component->IsVisible())
+		{
+			State.Bucket = EParticleSignificance::Hidden;
+			State.Score = 0.0f;
+			// 항상 시뮬레이션하는 시스템은 숨겨져 있어도 매 프레임 진행 (다시 보일 때 상태가 맞아야 함)
+			State.TickInterval = Component->bAlwaysSimulate ? 1 : GetUpdateRate(EParticleSignificance::Hidden);
+			++Stats.SystemsPerBucket[static_cast<int32>(State.Bucket)];
+			continue;
+		}
+
+		const FAABB Bounds = Component->GetWorldAABB();
+		const bool bHasBounds = Bounds.Min.X < Bounds.Max.X || Bounds.Min.Y < Bounds.Max.Y || Bounds.Min.Z < Bounds.Max.Z;
+		const FVector Center = bHasBounds ? Bounds.GetCenter() : Component->GetWorldLocation();
+		const float Radius = bHasBounds ? std::max(Bounds.GetHalfExtent().Size(), DefaultSystemRadius) : DefaultSystemRadius;
+		const float ScreenSize = ComputeScreenSize(Center, Radius);
+
+		// 지난 프레임(또는 이번 프레임)에 어떤 뷰에서도 그려지지 않았으면 화면 밖
+		if (State.LastRenderFrame + 1 < FrameCounter)
+		{
+			State.Bucket = EParticleSignificance::Offscreen;
+		}
+		else if (ScreenSize >= MidScreenSize)
+		{
+			State.Bucket = EParticleSignificance::Near;
+		}
+		else
+		{
+			State.Bucket = ScreenSize >= FarScreenSize ? EParticleSignificance::Mid : EParticleSignificance::Far;
+		}
+		++Stats.SystemsPerBucket[static_cast<int32>(State.Bucket)];
+
+		// 화면에 보이는 시스템이 항상 화면 밖 시스템보다 먼저 예산을 받는다
+		const float Priority = std::max(Component->SignificancePriority, 0.0f);
+		const float ClampedSize = std::min(ScreenSize, 1.0e6f);
+		State.Score = State.Bucket == EParticleSignificance::Offscreen ? Priority * ClampedSize * 1.0e-6f : Priority * ClampedSize + Priority;
+		State.TickInterval = GetUpdateRate(State.Bucket);
+
+		FSignificanceCandidate& Candidate = Candidates[Candidates.Emplace()];
+		Candidate.Component = Component;
+		Candidate.Score = State.Score;
+		Candidate.bAlwaysSimulate = Component->bAlwaysSimulate;
+		for (const FParticleEmitterInstance* Instance : Component->EmitterInstances)
+		{
+			if (Instance && Instance->bEmitterEnabled)
+			{
+				Candidate.NumParticles += Instance->ActiveParticles;
+				++Candidate.NumEmitters;
+			}
+		}
+	}
+
+	// 2. 순위대로 예산 배분 (항상 시뮬레이션하는 시스템이 먼저, 나머지는 점수 순)
+	std::sort(Candidates.begin(), Candidates.end(), [](const FSignificanceCandidate& A, const FSignificanceCandidate& B)
+		{
+			if (A.bAlwaysSimulate != B.bAlwaysSimulate)
+			{
+				return A.bAlwaysSimulate;
+			}
+			return A.Score > B.Score;
+		});
+
+	const int32 ThrottledRate = GetUpdateRate(EParticleSignificance::Offscreen);
+	for (const FSignificanceCandidate& Candidate : Candidates)
+	{
+		FParticleSignificanceState& State = Candidate.Component->SignificanceState;
+		const bool bExempt = !bEnabled || Candidate.bAlwaysSimulate;
+
+		// 파티클 예산 초과: 새 스폰만 막는다 (기존 파티클은 수명대로 사라지며 예산이 돌아온다)
+		if (!bExempt && MaxParticles > 0 && Stats.BudgetedParticles + Candidate.NumParticles > MaxParticles)
+		{
+			State.bSuppressSpawning = true;
+			++Stats.SpawnSuppressedSystems;
+		}
+		else
+		{
+			Stats.BudgetedParticles += Candidate.NumParticles;
+		}
+
+		// 이미터 예산 초과: 화면 밖 시스템과 같은 간격으로만 시뮬레이션
+		if (!bExempt && MaxEmitters > 0 && Stats.BudgetedEmitters + Candidate.NumEmitters > MaxEmitters)
+		{
+			State.TickInterval = std::max(State.TickInterval, ThrottledRate);
+			++Stats.EmitterThrottledSystems;
+		}
+		else
+		{
+			Stats.BudgetedEmitters += Candidate.NumEmitters;
+		}
+
+		if (Candidate.bAlwaysSimulate)
+		{
+			State.TickInterval = 1;
+		}
+	}
+}
+
+void FParticleSignificanceManager::RegisterView(const FVector& ViewLocation, float FieldOfView, bool bPerspective)
+{
+	if (PendingViews.Num() >= MaxTrackedViews)
+	{
+		return;
+	}
+
+	FViewInfo View;
+	View.Location = ViewLocation;
+	View.bPerspective = bPerspective;
+
+	const float HalfFovTan = std::tan(DegreesToRadians(std::clamp(FieldOfView, 1.0f, 170.0f)) * 0.5f);
+	View.ScreenScale = 1.0f / HalfFovTan;
+
+	PendingViews.Add(View);
+}
+
+float FParticleSignificanceManager::ComputeScreenSize(const FVector& Center, float Radius) const
+{
+	if (Views.IsEmpty())
+	{
+		return FLT_MAX;
+	}
+
+	float MaxScreenSize = 0.0f;
+	for (const FViewInfo& View : Views)
+	{
+		if (!View.bPerspective)
+		{
+			return FLT_MAX;
+		}
+
+		const float Distance = (Center - View.Location).Size();
+		if (Distance <= Radius)
+		{
+			return FLT_MAX;
+		}
+
+		MaxScreenSize = std::max(MaxScreenSize, Radius * View.ScreenScale / Distance);
+	}
+	return MaxScreenSize;
+}
+
+bool FParticleSignificanceManager::ConsumeSimulationTime(FParticleSignificanceState& State, float DeltaTime, float& OutSimulationTime)
+{
+	// 오래 숨겨진 시스템이 시간을 끝없이 쌓지 않도록 따라잡기 한도 바로 위에서 멈춘다
+	State.PendingTime = std::min(State.PendingTime + DeltaTime, MaxCatchUpTime + 1.0f);
+	++State.FramesSinceSimulation;
+
+	const int32 Interval = bEnabled ? State.TickInterval : 1;
+	if (Interval <= 0 || State.FramesSinceSimulation < Interval)
+	{
+		++Stats.SkippedTicks;
+		return false;
+	}
+
+	OutSimulationTime = State.PendingTime;
+	if (OutSimulationTime > MaxCatchUpTime && State.FramesSinceSimulation > 1)
+	{
+		// 수명이 짧은 파티클은 마지막 구간만 시뮬레이션해도 결과가 같으므로 나머지는 버린다
+		OutSimulationTime = MaxCatchUpTime;
+		++Stats.FastForwards;
+	}
+
+	State.PendingTime = 0.0f;
+	State.FramesSinceSimulation = 0;
+	++Stats.SimulatedSystems;
+	return true;
+}
+
+void FParticleSignificanceManager::SetBudget(int32 InMaxParticles, int32 InMaxEmitters)
+{
+	MaxParticles = std::max(InMaxParticles, 0);
+	MaxEmitters = std::max(InMaxEmitters, 0);
+}
+
+void FParticleSignificanceManager::SetUpdateRate(EParticleSignificance Bucket, int32 InRate)
+{
+	if (Bucket == EParticleSignificance::Hidden || Bucket == EParticleSignificance::Count)
+	{
+		return;
+	}
+	UpdateRates[static_cast<int32>(Bucket)] = std::clamp(InRate, 1, 30);
+}
+
+int32 FParticleSignificanceManager::GetUpdateRate(EParticleSignificance Bucket)
+{
+	if (Bucket == EParticleSignificance::Count)
+	{
+		return 1;
+	}
+	return UpdateRates[static_cast<int32>(Bucket)];
+}
+
+void FParticleSignificanceManager::SetScreenSizeThresholds(float InMidThreshold, float InFarThreshold)
+{
+	MidScreenSize = std::max(InMidThreshold, 0.0f);
+	FarScreenSize = std::clamp(InFarThreshold, 0.0f, MidScreenSize);
+}
+
+const char* FParticleSignificanceManager::GetBucketName(EParticleSignificance Bucket)
+{
+	switch (Bucket)
+	{
+	case EParticleSignificance::Near:		return "Near";
+	case EParticleSignificance::Mid:		return "Mid";
+	case EParticleSignificance::Far:		return "Far";
+	case EParticleSignificance::Offscreen:	return "Offscreen";
+	case EParticleSignificance::Hidden:		return "Hidden";
+	default:								return "Unknown";
+	}
+}
@@ -0,0 +1,139 @@
+﻿#pragma once
+#include "Vector.h"
+
+class UParticleSystemComponent;
+class UWorld;
+class FParticleSignificanceManager;
+
+// 파티클 시스템 중요도 버킷. 가까운 순서이며 Offscreen/Hidden은 화면 크기와 무관하다.
+enum class EParticleSignificance : uint8
+{
+	Near = 0,		// 매 프레임 시뮬레이션
+	Mid,
+	Far,
+	Offscreen,		// 지난 프레임에 그려지지 않음 (컬링됨)
+	Hidden,			// 숨김 컴포넌트: 다시 보일 때까지 시뮬레이션하지 않음
+	Count
+};
+
+// 컴포넌트별 중요도 판정 결과와 틱 상태 (UParticleSystemComponent가 보관)
+struct FParticleSignificanceState
+{
+	EParticleSignificance Bucket = EParticleSignificance::Near;
+	float Score = 0.0f;				// 화면 크기 * 우선순위 (클수록 먼저 예산을 받는다)
+	int32 TickInterval = 1;			// N 프레임에 한 번 시뮬레이션 (0 = 보일 때까지 건너뜀)
+	bool bSuppressSpawning = false;	// 파티클 예산 초과: 기존 파티클만 갱신
+	int32 FramesSinceSimulation = 0;
+	float PendingTime = 0.0f;		// 건너뛴 프레임에서 누적된, 아직 시뮬레이션하지 않은 시간
+	uint64 LastRenderFrame = 0;		// 마지막으로 그려진 GetFrameCounter() 값
+	FParticleSignificanceManager* Manager = nullptr;	// 등록된 월드의 매니저 (미등록이면 nullptr)
+};
+
+struct FParticleSignificanceStats
+{
+	uint32 SystemsPerBucket[static_cast<int32>(EParticleSignificance::Count)] = {};
+	int32 BudgetedParticles = 0;		// 예산을 받은 시스템의 파티클 합 (판정 시점)
+	int32 BudgetedEmitters = 0;			// 예산을 받은 시스템의 활성 이미터 합
+	uint32 SpawnSuppressedSystems = 0;	// 파티클 예산 초과로 스폰을 막은 시스템
+	uint32 EmitterThrottledSystems = 0;	// 이미터 예산 초과로 업데이트 간격을 늘린 시스템
+	uint32 SimulatedSystems = 0;		// 이번 프레임 실제로 시뮬레이션한 시스템
+	uint32 SkippedTicks = 0;			// 업데이트 간격/숨김 때문에 건너뛴 틱
+	uint32 CatchUpSteps = 0;			// 밀린 시간을 나눠 시뮬레이션한 추가 스텝
+	uint32 FastForwards = 0;			// 따라잡기 한도를 넘어 밀린 시간을 버린 횟수
+};
+
+/**
+ * 파티클 시스템 중요도/예산 매니저 (UWorld마다 하나, UWorld::GetParticleSignificanceManager)
+ * - 지난 프레임의 뷰 기준 화면 크기, 가시성, 디자이너 우선순위로 그 월드에 등록된 파티클 시스템의 순위를 매긴다.
+ * - 순위대로 파티클/이미터 예산을 나눠 주고, 예산 밖 시스템은 스폰을 막거나 업데이트 간격을 늘린다.
+ *   에디터/PIE/프리뷰 월드가 서로의 예산과 뷰에 영향을 주지 않도록 뷰와 예산 집계는 월드별이고, 설정값만 공유한다.
+ * - 화면 밖/숨김 시스템은 간격을 두고(또는 보일 때까지) 시뮬레이션을 건너뛰고, 다시 틱할 때 밀린 시간을 따라잡는다.
+ * - 렌더러는 뷰를 RegisterView로 알리고, 파티클 시스템은 그려질 때 LastRenderFrame을 기록한다.
+ * @note 게임 스레드 전용. 월드 틱이 렌더보다 먼저 돌므로 항상 한 프레임 전 가시성을 사용한다.
+ */
+class FParticleSignificanceManager
+{
+public:
+	explicit FParticleSignificanceManager(UWorld* InWorld);
+	~FParticleSignificanceManager();
+
+	FParticleSignificanceManager(const FParticleSignificanceManager&) = delete;
+	FParticleSignificanceManager& operator=(const FParticleSignificanceManager&) = delete;
+
+	/** 다른 월드에 등록되어 있었다면 그 매니저에서 빼고 옮긴다 */
+	void RegisterComponent(UParticleSystemComponent* InComponent);
+	void UnregisterComponent(UParticleSystemComponent* InComponent);
+
+	/** 월드 틱 시작 시 호출. 지난 프레임의 뷰로 등록된 시스템의 순위를 매기고 예산을 나눈다. */
+	void BeginFrame();
+
+	/** 렌더링된 뷰 등록 (FSceneRenderer::PrepareView). FOV는 도 단위, 직교 뷰는 항상 Near */
+	void RegisterView(const FVector& ViewLocation, float FieldOfView, bool bPerspective);
+
+	/**
+	 * 이번 틱에 시뮬레이션할지 결정한다. (UParticleSystemComponent::TickComponent)
+	 * @param OutSimulationTime 시뮬레이션할 시간 (건너뛴 프레임의 시간 포함, MaxCatchUpTime으로 제한)
+	 * @return false면 시간만 누적하고 시뮬레이션을 건너뛴다
+	 */
+	bool ConsumeSimulationTime(FParticleSignificanceState& State, float DeltaTime, float& OutSimulationTime);
+
+	// --- 설정 (모든 월드 공유) ---
+	static void SetEnabled(bool bInEnabled) { bEnabled = bInEnabled; }
+	static bool IsEnabled() { return bEnabled; }
+
+	/** 월드별 예산. 0 이하면 제한 없음 */
+	static void SetBudget(int32 InMaxParticles, int32 InMaxEmitters);
+	static int32 GetMaxParticles() { return MaxParticles; }
+	static int32 GetMaxEmitters() { return MaxEmitters; }
+
+	static void SetUpdateRate(EParticleSignificance Bucket, int32 InRate);
+	static int32 GetUpdateRate(EParticleSignificance Bucket);
+
+	/** Near/Mid, Mid/Far 경계 화면 크기 (반경 / 화면 절반 높이) */
+	static void SetScreenSizeThresholds(float InMidThreshold, float InFarThreshold);
+	static float GetMidScreenSize() { return MidScreenSize; }
+	static float GetFarScreenSize() { return FarScreenSize; }
+
+	/** 한 번에 따라잡을 최대 시간 (초). 더 오래 밀린 시간은 버린다 (빨리 감기) */
+	static void SetMaxCatchUpTime(float InSeconds) { MaxCatchUpTime = std::max(InSeconds, 0.0f); }
+	static float GetMaxCatchUpTime() { return MaxCatchUpTime; }
+
+	UWorld* GetWorld() const { return World; }
+
+	uint64 GetFrameCounter() const { return FrameCounter; }
+
+	void RecordCatchUpSteps(uint32 InSteps) { Stats.CatchUpSteps += InSteps; }
+
+	/** 이번 프레임 통계 (월드 틱 이후 ~ 다음 BeginFrame 전까지 유효) */
+	const FParticleSignificanceStats& GetStats() const { return Stats; }
+
+	static const char* GetBucketName(EParticleSignificance Bucket);
+
+private:
+	struct FViewInfo
+	{
+		FVector Location;
+		float ScreenScale = 1.0f;	// 1 / tan(FOV / 2)
+		bool bPerspective = true;
+	};
+
+	/** 가장 크게 보이는 뷰 기준 화면 크기. 직교 뷰나 바운드 안쪽의 뷰는 FLT_MAX */
+	float ComputeScreenSize(const FVector& Center, float Radius) const;
+
+	UWorld* World = nullptr;
+	TArray<UParticleSystemComponent*> Components;
+
+	TArray<FViewInfo> PendingViews;		// 이번 프레임에 렌더링되는 뷰
+	TArray<FViewInfo> Views;			// 판단 기준 (지난 프레임의 뷰)
+
+	uint64 FrameCounter = 1;
+	FParticleSignificanceStats Stats;
+
+	static bool bEnabled;
+	static int32 MaxParticles;
+	static int32 MaxEmitters;
+	static int32 UpdateRates[static_cast<int32>(EParticleSignificance::Count)];
+	static float MidScreenSize;
+	static float FarScreenSize;
+	static float MaxCatchUpTime;
+};
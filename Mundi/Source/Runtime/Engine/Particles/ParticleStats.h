@@ -24,6 +24,24 @@ struct FParticleStats
     int32 KilledThisFrame = 0;       // 이번 프레임 사망 수
     uint64 MemoryBytes = 0;          // 총 메모리 (바이트)
 
+    // 중요도/예산 (FParticleSignificanceManager)
+    int32 CulledSystemCount = 0;       // 뷰 절두체 밖이라 배치를 수집하지 않은 시스템 수
+    int32 ParticleBudget = 0;          // 전역 파티클 예산 (0 = 무제한)
+    int32 BudgetedParticles = 0;       // 예산을 받은 시스템의 파티클 합
+    int32 EmitterBudget = 0;           // 전역 이미터 예산 (0 = 무제한)
+    int32 BudgetedEmitters = 0;        // 예산을 받은 시스템의 이미터 합
+    int32 SpawnSuppressedSystems = 0;  // 파티클 예산 초과로 스폰을 막은 시스템 수
+    int32 ThrottledSystems = 0;        // 이미터 예산 초과로 업데이트 간격을 늘린 시스템 수
+    int32 SimulatedSystems = 0;        // 이번 프레임 시뮬레이션한 시스템 수
+    int32 SkippedTicks = 0;            // 업데이트 간격/숨김으로 건너뛴 틱 수
+    int32 CatchUpSteps = 0;            // 밀린 시간을 따라잡느라 추가로 돈 스텝 수
+
+    // 일회성 이펙트 풀 (FParticleSystemPool, 누적 히트/미스)
+    uint32 PoolHits = 0;               // 풀에서 재사용한 스폰
+    uint32 PoolMisses = 0;             // 새 컴포넌트를 만든 스폰
+    int32 PoolActiveEffects = 0;       // 재생 중인 풀 이펙트
+    int32 PoolFreeComponents = 0;      // 재사용 대기 중인 컴포넌트
+
     void Reset() { *this = FParticleStats(); }
 };
 
@@ -0,0 +1,415 @@
+﻿#include "pch.h"
+#include "ParticleSystemPool.h"
+#include "ParticleSystemComponent.h"
+#include "ParticleSystem.h"
+#include "Actor.h"
+#include "ParticleEmitter.h"
+#include "ParticleLODLevel.h"
+#include "ParticleEmitterInstance.h"
+#include "Modules/ParticleModuleRequired.h"
+#include "Modules/ParticleModuleTypeDataSprite.h"
+#include "Modules/ParticleModuleSpawn.h"
+#include "Modules/ParticleModuleLifetime.h"
+
+FParticleSystemPool::FParticleSystemPool(UWorld* InWorld)
+	: World(InWorld)
+{
+}
+
+UParticleSystemComponent* FParticleSystemPool::SpawnEmitterAtLocation(UParticleSystem* Template, const FVector& Location,
+	const FQuat& Rotation, const FVector& Scale)
+{
+	UParticleSystemComponent* Component = AcquireComponent(Template);
+	if (!Component)
+	{
+		return nullptr;
+	}
+
+	Component->SetWorldTransform(FTransform(Location, Rotation, Scale));
+	Component->RewindSystem();
+	Component->SetVisibility(true);
+
+	FActiveEffect& Effect = ActiveEffects[ActiveEffects.Emplace()];
+	Effect.Component = Component;
+	Effect.Template = Template;
+
+	UpdateCounts();
+	return Component;
+}
+
+UParticleSystemComponent* FParticleSystemPool::SpawnEmitterAttached(UParticleSystem* Template, USceneComponent* AttachTo,
+	const FVector& RelativeLocation, const FQuat& RelativeRotation)
+{
+	if (!AttachTo)
+	{
+		return nullptr;
+	}
+
+	UParticleSystemComponent* Component = AcquireComponent(Template);
+	if (!Component)
+	{
+		return nullptr;
+	}
+
+	// 호스트 액터가 달라 실제로 부착하지 않고, Tick에서 부모의 월드 트랜스폼을 따라간다
+	const FTransform RelativeTransform(RelativeLocation, RelativeRotation, FVector(1.0f, 1.0f, 1.0f));
+	Component->SetWorldTransform(AttachTo->GetWorldTransform().GetWorldTransform(RelativeTransform));
+	Component->RewindSystem();
+	Component->SetVisibility(true);
+
+	FActiveEffect& Effect = ActiveEffects[ActiveEffects.Emplace()];
+	Effect.Component = Component;
+	Effect.Template = Template;
+	Effect.AttachParent = AttachTo;
+	Effect.RelativeTransform = RelativeTransform;
+	Effect.bAttached = true;
+
+	UpdateCounts();
+	return Component;
+}
+
+void FParticleSystemPool::ReleaseToPool(UParticleSystemComponent* Component)
+{
+	for (int32 i = 0; i < ActiveEffects.Num(); ++i)
+	{
+		if (ActiveEffects[i].Component == Component)
+		{
+			const FActiveEffect Effect = ActiveEffects[i];
+			ActiveEffects.RemoveAtSwap(i);
+			ReturnToPool(Effect);
+			UpdateCounts();
+			return;
+		}
+	}
+}
+
+void FParticleSystemPool::Tick()
+{
+	for (int32 i = ActiveEffects.Num() - 1; i >= 0; --i)
+	{
+		FActiveEffect& Effect = ActiveEffects[i];
+		UParticleSystemComponent* Component = Effect.Component.Get();
+
+		// 외부에서 호스트 액터가 파괴됨 (레벨 정리 등)
+		if (!Component)
+		{
+			ActiveEffects.RemoveAtSwap(i);
+			continue;
+		}
+
+		bool bFinished = Component->IsSystemComplete();
+		if (!bFinished && Effect.bAttached)
+		{
+			USceneComponent* Parent = Effect.AttachParent.Get();
+			AActor* ParentOwner = Parent ? Parent->GetOwner() : nullptr;
+			if (!Parent || (ParentOwner && ParentOwner->IsPendingDestroy()))
+			{
+				// 부모가 사라지면 남은 파티클을 기다리지 않고 회수
+				bFinished = true;
+			}
+			else
+			{
+				Component->SetWorldTransform(Parent->GetWorldTransform().GetWorldTransform(Effect.RelativeTransform));
+			}
+		}
+
+		if (bFinished)
+		{
+			const FActiveEffect Finished = Effect;
+			ActiveEffects.RemoveAtSwap(i);
+			ReturnToPool(Finished);
+		}
+	}
+
+	UpdateCounts();
+}
+
+void FParticleSystemPool::Reset()
+{
+	ActiveEffects.Empty();
+	FreeComponents.Empty();
+	UpdateCounts();
+}
+
+void FParticleSystemPool::SetMaxFreePerTemplate(int32 InMaxFree)
+{
+	MaxFreePerTemplate = std::max(InMaxFree, 0);
+
+	for (auto& Pair : FreeComponents)
+	{
+		TArray<TWeakObjectPtr<UParticleSystemComponent>>& FreeList = Pair.second;
+		while (FreeList.Num() > MaxFreePerTemplate)
+		{
+			DestroyPooledComponent(FreeList.back().Get());
+			FreeList.pop_back();
+			++Stats.Evictions;
+		}
+	}
+	UpdateCounts();
+}
+
+void FParticleSystemPool::TrimFreeComponents()
+{
+	for (auto& Pair : FreeComponents)
+	{
+		for (const TWeakObjectPtr<UParticleSystemComponent>& Pooled : Pair.second)
+		{
+			DestroyPooledComponent(Pooled.Get());
+			++Stats.Evictions;
+		}
+	}
+	FreeComponents.Empty();
+	UpdateCounts();
+}
+
+void FParticleSystemPool::ResetStats()
+{
+	Stats.Hits = 0;
+	Stats.Misses = 0;
+	Stats.Returns = 0;
+	Stats.Evictions = 0;
+}
+
+UParticleSystemComponent* FParticleSystemPool::AcquireComponent(UParticleSystem* Template)
+{
+	if (!Template || !World)
+	{
+		return nullptr;
+	}
+
+	// 1. 같은 템플릿의 대기 컴포넌트 재사용 (이미 파괴된 항목은 건너뜀)
+	if (TArray<TWeakObjectPtr<UParticleSystemComponent>>* FreeList = FreeComponents.Find(Template))
+	{
+		while (!FreeList->IsEmpty())
+		{
+			UParticleSystemComponent* Component = FreeList->back().Get();
+			FreeList->pop_back();
+			if (Component && Component->GetOwner() && !Component->GetOwner()->IsPendingDestroy())
+			{
+				++Stats.Hits;
+				return Component;
+			}
+		}
+	}
+
+	// 2. 새 호스트 액터 + 컴포넌트 생성 (템플릿은 등록 전에 지정해야 디버그 시스템이 만들어지지 않음)
+	AActor* HostActor = World->SpawnActor<AActor>();
+	if (!HostActor)
+	{
+		return nullptr;
+	}
+	HostActor->ObjectName = "PooledParticleSystem";
+
+	UParticleSystemComponent* Component = NewObject<UParticleSystemComponent>();
+	HostActor->AddOwnedComponent(Component);
+	Component->bAutoActivate = false;
+	Component->SetTemplate(Template);
+	Component->RegisterComponent(World);
+
+	++Stats.Misses;
+	return Component;
+}
+
+void FParticleSystemPool::ReturnToPool(const FActiveEffect& Effect)
+{
+	UParticleSystemComponent* Component = Effect.Component.Get();
+	if (!Component)
+	{
+		return;
+	}
+
+	++Stats.Returns;
+
+	TArray<TWeakObjectPtr<UParticleSystemComponent>>& FreeList = FreeComponents[Effect.Template];
+	if (FreeList.Num() >= MaxFreePerTemplate)
+	{
+		DestroyPooledComponent(Component);
+		++Stats.Evictions;
+		return;
+	}
+
+	// 숨기면 중요도 매니저가 틱을 건너뛰고 렌더러도 수집하지 않는다 (이미터 메모리는 유지)
+	Component->SetVisibility(false);
+	Component->ResetParticles();
+	FreeList.Add(Component);
+}
+
+void FParticleSystemPool::DestroyPooledComponent(UParticleSystemComponent* Component)
+{
+	if (Component && Component->GetOwner())
+	{
+		Component->GetOwner()->Destroy();
+	}
+}
+
+void FParticleSystemPool::UpdateCounts()
+{
+	Stats.ActiveEffects = ActiveEffects.Num();
+	Stats.FreeComponents = 0;
+	for (const auto& Pair : FreeComponents)
+	{
+		Stats.FreeComponents += Pair.second.Num();
+	}
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// Self test
+// ────────────────────────────────────────────────────────────────────────────
+
+namespace
+{
+	int32 CountActiveParticles(const UParticleSystemComponent* Component)
+	{
+		int32 Count = 0;
+		for (const FParticleEmitterInstance* Instance : Component->EmitterInstances)
+		{
+			Count += Instance ? Instance->ActiveParticles : 0;
+		}
+		return Count;
+	}
+
+	bool AreAllEmittersDisabled(const UParticleSystemComponent* Component)
+	{
+		for (const FParticleEmitterInstance* Instance : Component->EmitterInstances)
+		{
+			if (Instance && Instance->bEmitterEnabled)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/** 0.1초 동안 한 번 버스트하고 끝나는 이미터. 파티클 수명(0.5초)이 방출 시간보다 길다 */
+	UParticleSystem* GetSelfTestBurstTemplate()
+	{
+		// 풀에서 파괴된 컴포넌트가 지연 삭제될 때까지 참조할 수 있으므로 한 번 만들어 계속 쓴다
+		static UParticleSystem* Template = nullptr;
+		if (Template)
+		{
+			return Template;
+		}
+
+		Template = NewObject<UParticleSystem>();
+		UParticleEmitter* Emitter = NewObject<UParticleEmitter>();
+		UParticleLODLevel* LODLevel = NewObject<UParticleLODLevel>();
+		LODLevel->bEnabled = true;
+
+		UParticleModuleRequired* RequiredModule = NewObject<UParticleModuleRequired>();
+		RequiredModule->EmitterDuration = 0.1f;
+		RequiredModule->EmitterLoops = 1;
+		LODLevel->Modules.Add(RequiredModule);
+		LODLevel->Modules.Add(NewObject<UParticleModuleTypeDataSprite>());
+
+		UParticleModuleSpawn* SpawnModule = NewObject<UParticleModuleSpawn>();
+		SpawnModule->SpawnRate = FDistributionFloat(0.0f);
+		SpawnModule->BurstList.Add(FParticleBurst(16, 0.0f));
+		LODLevel->Modules.Add(SpawnModule);
+
+		UParticleModuleLifetime* LifetimeModule = NewObject<UParticleModuleLifetime>();
+		LifetimeModule->Lifetime = FDistributionFloat(0.5f);
+		LODLevel->Modules.Add(LifetimeModule);
+
+		LODLevel->CacheModuleInfo();
+		Emitter->LODLevels.Add(LODLevel);
+		Emitter->CacheEmitterModuleInfo();
+		Template->Emitters.Add(Emitter);
+		return Template;
+	}
+}
+
+int32 RunParticleSystemPoolSelfTest(UWorld* InWorld, TArray<FString>& OutFailures)
+{
+	int32 NumChecks = 0;
+	auto Check = [&](bool bCondition, const char* Description)
+	{
+		++NumChecks;
+		if (!bCondition)
+		{
+			OutFailures.Add(Description);
+		}
+	};
+
+	if (!InWorld)
+	{
+		Check(false, "pool: no world");
+		return NumChecks;
+	}
+
+	// 월드 풀의 통계를 건드리지 않도록 별도 풀을 쓴다. 월드 틱 대신 컴포넌트와 풀을 직접 틱한다
+	FParticleSystemPool Pool(InWorld);
+	UParticleSystem* Template = GetSelfTestBurstTemplate();
+	const float FrameTime = 1.0f / 30.0f;
+	const int32 MaxFrames = 90;   // 3초 (방출 0.1초 + 수명 0.5초면 충분)
+
+	// 프레임을 돌려 이펙트가 풀로 돌아올 때까지의 프레임 수를 반환 (돌아오지 않으면 -1)
+	// 방출이 끝난 뒤에도 살아 있는 파티클이 있었는지 기록한다
+	auto RunUntilReturned = [&](UParticleSystemComponent* Component, bool& bOutOutlivedEmission)
+	{
+		bOutOutlivedEmission = false;
+		for (int32 Frame = 0; Frame < MaxFrames; ++Frame)
+		{
+			Component->TickComponent(FrameTime);
+			if (AreAllEmittersDisabled(Component) && CountActiveParticles(Component) > 0)
+			{
+				bOutOutlivedEmission = true;
+			}
+
+			Pool.Tick();
+			if (Pool.GetStats().ActiveEffects == 0)
+			{
+				return Frame + 1;
+			}
+		}
+		return -1;
+	};
+
+	// 1. 첫 스폰은 미스 (새 호스트 액터/컴포넌트 생성)
+	UParticleSystemComponent* First = Pool.SpawnEmitterAtLocation(Template, FVector(0.0f, 0.0f, 0.0f));
+	Check(First != nullptr, "pool: spawn returns a component");
+	if (!First)
+	{
+		return NumChecks;
+	}
+	Check(Pool.GetStats().Misses == 1 && Pool.GetStats().Hits == 0, "pool: first spawn is a miss");
+	Check(Pool.GetStats().ActiveEffects == 1, "pool: spawned effect is active");
+
+	First->TickComponent(FrameTime);
+	Check(CountActiveParticles(First) == 16, "pool: burst spawns 16 particles");
+
+	// 2. 방출이 끝나도 파티클은 수명대로 진행해 사라지고, 이펙트는 자동으로 풀에 돌아온다
+	bool bOutlivedEmission = false;
+	const int32 FramesToReturn = RunUntilReturned(First, bOutlivedEmission);
+	Check(bOutlivedEmission, "pool: particles outlive the emitter duration");
+	Check(FramesToReturn > 0, "pool: finite burst returns to the pool");
+	Check(Pool.GetStats().Returns == 1 && Pool.GetStats().FreeComponents == 1, "pool: returned component is kept for reuse");
+	Check(!First->IsVisible() && CountActiveParticles(First) == 0, "pool: returned component is hidden and empty");
+
+	// 3. 같은 템플릿 재스폰은 히트이며 같은 컴포넌트를 되감아 다시 재생한다
+	UParticleSystemComponent* Second = Pool.SpawnEmitterAtLocation(Template, FVector(100.0f, 0.0f, 0.0f));
+	Check(Second == First, "pool: respawn reuses the returned component");
+	Check(Pool.GetStats().Hits == 1 && Pool.GetStats().FreeComponents == 0, "pool: respawn is a hit");
+	if (Second)
+	{
+		Check(Second->IsVisible(), "pool: reused component is visible again");
+		Second->TickComponent(FrameTime);
+		Check(CountActiveParticles(Second) == 16, "pool: rewound emitter bursts again");
+		Check(RunUntilReturned(Second, bOutlivedEmission) > 0, "pool: reused effect returns to the pool");
+	}
+
+	// 4. 명시적 반환과 보관 한도
+	UParticleSystemComponent* Third = Pool.SpawnEmitterAtLocation(Template, FVector(0.0f, 0.0f, 0.0f));
+	UParticleSystemComponent* Fourth = Pool.SpawnEmitterAtLocation(Template, FVector(0.0f, 0.0f, 0.0f));
+	Check(Third && Fourth && Third != Fourth, "pool: concurrent spawns get distinct components");
+	Pool.SetMaxFreePerTemplate(1);
+	Pool.ReleaseToPool(Third);
+	Pool.ReleaseToPool(Fourth);
+	Check(Pool.GetStats().ActiveEffects == 0 && Pool.GetStats().FreeComponents == 1, "pool: release respects the per-template limit");
+	Check(Pool.GetStats().Evictions == 1, "pool: over-limit release evicts the component");
+
+	// 5. 정리 (호스트 액터는 지연 파괴)
+	Pool.TrimFreeComponents();
+	Check(Pool.GetStats().FreeComponents == 0, "pool: trim destroys free components");
+
+	return NumChecks;
+}
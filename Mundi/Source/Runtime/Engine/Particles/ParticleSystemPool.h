@@ -0,0 +1,94 @@
+﻿#pragma once
+#include "Vector.h"
+#include "WeakObjectPtr.h"
+
+class UWorld;
+class UParticleSystem;
+class UParticleSystemComponent;
+class USceneComponent;
+
+// 파티클 시스템 풀 통계 (월드별, 누적 카운터는 ResetStats 전까지 유지)
+struct FParticleSystemPoolStats
+{
+	uint32 Hits = 0;			// 풀에서 꺼내 재사용한 스폰
+	uint32 Misses = 0;			// 새 액터/컴포넌트/이미터 인스턴스를 만든 스폰
+	uint32 Returns = 0;			// 완료(또는 명시 반환)되어 풀로 돌아온 이펙트
+	uint32 Evictions = 0;		// 템플릿별 보관 한도를 넘어 파괴한 컴포넌트
+	int32 ActiveEffects = 0;	// 재생 중인 풀 이펙트
+	int32 FreeComponents = 0;	// 재사용 대기 중인 컴포넌트
+
+	float GetHitRate() const
+	{
+		const uint32 Total = Hits + Misses;
+		return Total > 0 ? static_cast<float>(Hits) / static_cast<float>(Total) : 0.0f;
+	}
+};
+
+/**
+ * 일회성(fire-and-forget) 파티클 이펙트용 파티클 시스템 풀 (UWorld 소유)
+ * - UParticleSystem 템플릿별로 다 쓴 컴포넌트를 보관했다가, 같은 템플릿 스폰 시 이미터 인스턴스와
+ *   파티클 메모리를 그대로 둔 채 되감아 재사용한다. (게임 월드의 템플릿 복제도 한 번만 일어난다)
+ * - 이펙트마다 숨김 처리된 호스트 액터 하나를 두며, 컴포넌트가 그 액터의 루트다.
+ * - 모든 이미터가 끝나면 Tick에서 자동으로 풀에 돌아온다. 무한 루프 이펙트는 ReleaseToPool로 반환해야 한다.
+ * - 부착 스폰은 매 프레임 부모의 월드 트랜스폼을 따라가며, 부모가 사라지면 즉시 반환된다.
+ */
+class FParticleSystemPool
+{
+public:
+	explicit FParticleSystemPool(UWorld* InWorld);
+	~FParticleSystemPool() = default;
+
+	/** 월드 위치에 이펙트를 재생한다. 반환된 컴포넌트는 완료 후 다른 스폰에 재사용되므로 보관하지 않는다. */
+	UParticleSystemComponent* SpawnEmitterAtLocation(UParticleSystem* Template, const FVector& Location,
+		const FQuat& Rotation = FQuat::Identity(), const FVector& Scale = FVector(1.0f, 1.0f, 1.0f));
+
+	/** AttachTo의 월드 트랜스폼 기준 상대 위치에 이펙트를 붙여 재생한다. */
+	UParticleSystemComponent* SpawnEmitterAttached(UParticleSystem* Template, USceneComponent* AttachTo,
+		const FVector& RelativeLocation = FVector(0.0f, 0.0f, 0.0f), const FQuat& RelativeRotation = FQuat::Identity());
+
+	/** 재생 중인 이펙트를 즉시 풀로 돌린다. (루프 이펙트 정지 등) */
+	void ReleaseToPool(UParticleSystemComponent* Component);
+
+	/** 월드 틱 시작 시 호출. 부착 이펙트 위치 갱신, 완료된 이펙트 회수 */
+	void Tick();
+
+	/** 레벨 교체 시 호출. 호스트 액터는 레벨과 함께 삭제되므로 참조만 버린다. */
+	void Reset();
+
+	/** 템플릿별로 보관할 최대 대기 컴포넌트 수 (넘으면 반환 시 파괴) */
+	void SetMaxFreePerTemplate(int32 InMaxFree);
+	int32 GetMaxFreePerTemplate() const { return MaxFreePerTemplate; }
+
+	/** 템플릿별 대기 컴포넌트를 모두 파괴한다. */
+	void TrimFreeComponents();
+
+	const FParticleSystemPoolStats& GetStats() const { return Stats; }
+	void ResetStats();
+
+private:
+	struct FActiveEffect
+	{
+		TWeakObjectPtr<UParticleSystemComponent> Component;
+		UParticleSystem* Template = nullptr;
+		TWeakObjectPtr<USceneComponent> AttachParent;
+		FTransform RelativeTransform;
+		bool bAttached = false;
+	};
+
+	UParticleSystemComponent* AcquireComponent(UParticleSystem* Template);
+	void ReturnToPool(const FActiveEffect& Effect);
+	void DestroyPooledComponent(UParticleSystemComponent* Component);
+	void UpdateCounts();
+
+	UWorld* World = nullptr;
+
+	TArray<FActiveEffect> ActiveEffects;
+	TMap<UParticleSystem*, TArray<TWeakObjectPtr<UParticleSystemComponent>>> FreeComponents;
+
+	int32 MaxFreePerTemplate = 16;
+
+	FParticleSystemPoolStats Stats;
+};
+
+/** 유한 버스트 이펙트를 풀로 스폰해 완료 후 회수/재사용되는지 점검 (콘솔 PARTICLEPOOL SELFTEST). 검사 수를 반환 */
+int32 RunParticleSystemPoolSelfTest(UWorld* InWorld, TArray<FString>& OutFailures);
@@ -266,6 +266,9 @@ void FBodyInstance::SetBodyTransform(const FTransform& NewTransform, bool bTelep
         PxTransform PNewTransform = U2PTransform(NewTransform);
         RigidActor->setGlobalPose(PNewTransform);
 
+        // 게임 코드가 직접 옮긴 포즈는 이전 물리 상태에서 보간하지 않음
+        PhysScene->ResetInterpolation(RigidActor, NewTransform);
+
         if (bTeleport && IsDynamic())
         {
             PxRigidDynamic* DynamicActor = RigidActor->is<PxRigidDynamic>();
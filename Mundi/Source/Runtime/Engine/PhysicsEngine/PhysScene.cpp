@@ -4,6 +4,8 @@
 #include "BodyInstance.h"
 #include "PhysXSimEventCallback.h"
 #include "PrimitiveComponent.h"
+#include "PhysicsStats.h"
+#include "PlatformTime.h"
 
 // 커스텀 Simulation Filter Shader
 // FilterData 구조:
@@ -151,6 +153,7 @@ void FPhysScene::DeferReleaseActor(PxActor* InActor)
     }
 
     InActor->userData = nullptr;
+    BodyStates.Remove(InActor);
     {
         std::lock_guard<std::mutex> Lock(DeferredReleaseMutex);
         DeferredReleaseQueue.Add(InActor);
@@ -272,15 +275,56 @@ void FPhysScene::TermPhysScene()
 
 void FPhysScene::TickPhysScene(float DeltaTime)
 {
+    NumSubStepsThisFrame = 0;
+
     if (!PhysXScene)          { return; }
 
     if (bPhysXSceneExecuting) { return; }
 
     if (DeltaTime <= 0.0f)    { return; }
 
-    DeltaTime = FMath::Min(DeltaTime, 0.016f);
-    PhysXScene->simulate(DeltaTime);
-    bPhysXSceneExecuting = true;
+    // 프레임 시간을 누적하고 고정 스텝 단위로 소비한다.
+    // 최대 서브스텝을 넘는 시간은 버린다 (물리가 느려지는 대신 프레임이 더 느려지는 악순환 방지).
+    TimeAccumulator += DeltaTime;
+
+    int32 NumSteps = static_cast<int32>(TimeAccumulator / FixedTimeStep);
+    float DroppedTime = 0.0f;
+    if (NumSteps > MaxSubSteps)
+    {
+        DroppedTime = (NumSteps - MaxSubSteps) * FixedTimeStep;
+        TimeAccumulator -= DroppedTime;
+        NumSteps = MaxSubSteps;
+    }
+
+    const bool bRecordStats = OwningWorld && !OwningWorld->IsPreviewWorld();
+    const uint64 StartCycles = FWindowsPlatformTime::Cycles64();
+
+    // 마지막 스텝을 제외한 서브스텝은 즉시 완료시키고, 마지막 스텝만 게임 틱과 겹쳐서 실행한다.
+    for (int32 Step = 0; Step < NumSteps; ++Step)
+    {
+        if (Step > 0)
+        {
+            PhysXScene->fetchResults(true);
+            CaptureBodyStates();
+        }
+
+        SnapshotPreviousBodyStates();
+        OnPhysSceneStep.Broadcast(FixedTimeStep);
+
+        PhysXScene->simulate(FixedTimeStep);
+        TimeAccumulator -= FixedTimeStep;
+        ++StepCounter;
+    }
+
+    NumSubStepsThisFrame = NumSteps;
+    bPhysXSceneExecuting = NumSteps > 0;
+
+    if (bRecordStats)
+    {
+        FPhysicsStatManager& StatManager = FPhysicsStatManager::GetInstance();
+        StatManager.RecordFrame(FixedTimeStep, MaxSubSteps, NumSteps, DroppedTime);
+        StatManager.GetMutableStats().SimulateTimeMS = FWindowsPlatformTime::ToMilliseconds(FWindowsPlatformTime::Cycles64() - StartCycles);
+    }
 }
 
 void FPhysScene::WaitPhysScene()
@@ -291,6 +335,7 @@ void FPhysScene::WaitPhysScene()
     {
         PhysXScene->fetchResults(true);
         bPhysXSceneExecuting = false;
+        bHasUncapturedResults = true;
     }
 }
 
@@ -298,6 +343,12 @@ void FPhysScene::ProcessPhysScene()
 {
     if (!PhysXScene) { return; }
 
+    if (bHasUncapturedResults)
+    {
+        CaptureBodyStates();
+        bHasUncapturedResults = false;
+    }
+
     SyncComponentsToBodies();
 
     DispatchPhysNotifications_AssumesLocked();
@@ -305,7 +356,35 @@ void FPhysScene::ProcessPhysScene()
     FlushDeferredReleases();
 }
 
-void FPhysScene::SyncComponentsToBodies()
+void FPhysScene::SetFixedTimeStep(float InFixedTimeStep)
+{
+    // 너무 작은 스텝은 서브스텝 폭주, 너무 큰 스텝은 터널링을 유발하므로 범위를 제한한다.
+    FixedTimeStep = FMath::Clamp(InFixedTimeStep, 1.0f / 240.0f, 1.0f / 15.0f);
+}
+
+void FPhysScene::SetMaxSubSteps(int32 InMaxSubSteps)
+{
+    MaxSubSteps = FMath::Max(InMaxSubSteps, 1);
+}
+
+float FPhysScene::GetInterpolationAlpha() const
+{
+    return FMath::Clamp(TimeAccumulator / FixedTimeStep, 0.0f, 1.0f);
+}
+
+void FPhysScene::ResetInterpolation(const PxActor* InActor, const FTransform& InTransform)
+{
+    FBodyInterpolationState* State = BodyStates.Find(InActor);
+    if (!State)
+    {
+        return;
+    }
+
+    State->PreviousTransform = InTransform;
+    State->CurrentTransform = InTransform;
+}
+
+void FPhysScene::CaptureBodyStates()
 {
     if (!PhysXScene) { return; }
 
@@ -339,6 +418,66 @@ void FPhysScene::SyncComponentsToBodies()
             continue;
         }
 
+        const FTransform Pose = P2UTransform(RigidActor->getGlobalPose());
+
+        auto It = BodyStates.find(RigidActor);
+        if (It == BodyStates.end())
+        {
+            // 처음 움직인 바디는 보간할 이전 상태가 없으므로 현재 포즈로 시작
+            FBodyInterpolationState NewState;
+            NewState.PreviousTransform = Pose;
+            NewState.CurrentTransform = Pose;
+            NewState.LastMovedStep = StepCounter;
+            BodyStates.Add(RigidActor, NewState);
+        }
+        else
+        {
+            It->second.CurrentTransform = Pose;
+            It->second.LastMovedStep = StepCounter;
+        }
+    }
+}
+
+void FPhysScene::SnapshotPreviousBodyStates()
+{
+    for (auto& Pair : BodyStates)
+    {
+        FBodyInterpolationState& State = Pair.second;
+        // 지난 스텝에 움직이지 않은 바디는 이미 두 상태가 같다
+        if (State.LastMovedStep == StepCounter)
+        {
+            State.PreviousTransform = State.CurrentTransform;
+        }
+    }
+}
+
+void FPhysScene::SyncComponentsToBodies()
+{
+    if (!PhysXScene) { return; }
+
+    const float Alpha = bInterpolateTransforms ? GetInterpolationAlpha() : 1.0f;
+
+    for (auto& Pair : BodyStates)
+    {
+        FBodyInterpolationState& State = Pair.second;
+
+        // 최신 스텝에서 움직이지 않은 바디는 최종 포즈를 한 번만 반영한다
+        const bool bMoving = (State.LastMovedStep == StepCounter);
+        if (!bMoving && State.LastSyncedStep == StepCounter)
+        {
+            continue;
+        }
+
+        // userData가 nullptr이면 이미 정리된 바디 (TermBody에서 클리어됨)
+        const PxActor* Actor = Pair.first;
+        if (!Actor->userData) { continue; }
+
+        FBodyInstance* BodyInstance = static_cast<FBodyInstance*>(Actor->userData);
+        if (!BodyInstance->IsValidBodyInstance() || BodyInstance->RigidActor != Actor)
+        {
+            continue;
+        }
+
         // OwnerComponent가 유효한지 확인
         UPrimitiveComponent* OwnerComp = BodyInstance->OwnerComponent;
         if (!OwnerComp)
@@ -346,9 +485,20 @@ void FPhysScene::SyncComponentsToBodies()
             continue;
         }
 
-        FTransform NewTransform = BodyInstance->GetUnrealWorldTransform();
+        FTransform NewTransform = bMoving
+            ? FTransform::Lerp(State.PreviousTransform, State.CurrentTransform, Alpha)
+            : State.CurrentTransform;
         NewTransform.Scale3D = OwnerComp->GetWorldScale();
         OwnerComp->SetWorldTransform(NewTransform, EUpdateTransformFlags::SkipPhysicsUpdate, ETeleportType::None);
+
+        State.LastSyncedStep = StepCounter;
+    }
+
+    if (OwningWorld && !OwningWorld->IsPreviewWorld())
+    {
+        FPhysicsStats& Stats = FPhysicsStatManager::GetInstance().GetMutableStats();
+        Stats.InterpolationAlpha = Alpha;
+        Stats.InterpolatedBodyCount = static_cast<uint32>(BodyStates.Num());
     }
 }
 
@@ -3,6 +3,7 @@
 #include <mutex>
 
 #include "PhysXSupport.h"
+#include "Delegates.h"
 
 class FPhysXSimEventCallback;
 
@@ -70,6 +71,40 @@ public:
     /** 시뮬레이션 종료를 대기한다. (BodyInstance::TermBody에서 호출) */
     void WaitPhysScene();
 
+    // ==================================================================================
+    // Fixed Timestep Interface
+    // ==================================================================================
+
+    /** 고정 시뮬레이션 스텝(초)을 설정한다. 프레임 시간을 누적해 이 간격으로만 시뮬레이션한다. */
+    void SetFixedTimeStep(float InFixedTimeStep);
+
+    float GetFixedTimeStep() const { return FixedTimeStep; }
+
+    /** 한 프레임에 실행할 최대 서브스텝 수. 초과한 시간은 버린다 (스텝이 스텝을 부르는 폭주 방지). */
+    void SetMaxSubSteps(int32 InMaxSubSteps);
+
+    int32 GetMaxSubSteps() const { return MaxSubSteps; }
+
+    /** 컴포넌트 트랜스폼을 마지막 두 물리 상태 사이에서 보간할지 여부 */
+    void SetInterpolationEnabled(bool bEnabled) { bInterpolateTransforms = bEnabled; }
+
+    bool IsInterpolationEnabled() const { return bInterpolateTransforms; }
+
+    /** 이번 프레임에 실행된 서브스텝 수 */
+    int32 GetNumSubStepsThisFrame() const { return NumSubStepsThisFrame; }
+
+    /** 남은 누적 시간 / 고정 스텝 (0 = 이전 물리 상태, 1 = 최신 물리 상태) */
+    float GetInterpolationAlpha() const;
+
+    /** 텔레포트 등 게임 코드가 바디 포즈를 직접 설정했을 때 보간을 끊는다. */
+    void ResetInterpolation(const PxActor* InActor, const FTransform& InTransform);
+
+    /**
+     * 서브스텝마다 simulate() 직전에 호출된다. (인자: 고정 스텝)
+     * @note 차량처럼 스텝 단위로 갱신해야 하는 시스템용. 시뮬레이션 중이 아니므로 씬 쓰기가 안전하다.
+     */
+    DECLARE_DELEGATE(OnPhysSceneStep, float);
+
     // ==================================================================================
     // Raycast Interface
     // ==================================================================================
@@ -169,9 +204,15 @@ private:
     bool SweepSingleInternal(const PxGeometry& Geometry, const FVector& Start, const FVector& End,
                              const FQuat& Rotation, FHitResult& OutHit, AActor* IgnoreActor) const;
 
-    /** 컴포넌트의 트랜스폼에 시뮬레이션 결과를 동기화 */
+    /** 컴포넌트의 트랜스폼에 시뮬레이션 결과를 동기화 (보간 적용) */
     void SyncComponentsToBodies();
 
+    /** 방금 끝난 스텝에서 움직인 바디의 포즈를 최신 물리 상태로 기록 */
+    void CaptureBodyStates();
+
+    /** 다음 스텝을 시작하기 전에 최신 상태를 이전 상태로 넘긴다 */
+    void SnapshotPreviousBodyStates();
+
     /** 큐에 쌓인 충돌 이벤트를 메인 스레드에서 처리 */
     void DispatchPhysNotifications_AssumesLocked();
 
@@ -210,4 +251,29 @@ private:
 
     /** PhysX Scene 시뮬레이션 실행 여부 (실행 시점과 동기화 시점 사이) */
     bool bPhysXSceneExecuting;
+
+    /** 바디 보간 상태 (PxActor 단위, DeferReleaseActor에서 제거) */
+    struct FBodyInterpolationState
+    {
+        FTransform PreviousTransform;
+        FTransform CurrentTransform;
+        uint32 LastMovedStep = 0;   // 마지막으로 움직인 스텝 (최신 스텝이 아니면 두 상태가 같음)
+        uint32 LastSyncedStep = 0;  // 정지한 바디를 한 번만 동기화하기 위한 기록
+    };
+    TMap<const PxActor*, FBodyInterpolationState> BodyStates;
+
+    /** 고정 스텝 설정 */
+    float FixedTimeStep = 1.0f / 60.0f;
+    int32 MaxSubSteps = 4;
+    bool bInterpolateTransforms = true;
+
+    /** 아직 시뮬레이션하지 않은 누적 시간 */
+    float TimeAccumulator = 0.0f;
+
+    /** 실행한 스텝 수 (보간 상태 판별용) */
+    uint32 StepCounter = 0;
+    int32 NumSubStepsThisFrame = 0;
+
+    /** fetchResults 이후 아직 CaptureBodyStates로 기록하지 않은 결과가 있는지 */
+    bool bHasUncapturedResults = false;
 };
@@ -5,12 +5,21 @@
 
 class UPhysicalMaterial;
 /**
- * @note 현재는 PhysX에서 제공하는 디폴트 할당자를 사용한다.
  * @note PhysX의 메모리 할당자 래퍼
- * @todo 별도의 메모리 할당 로직이 필요할 경우 'allocate()'를 오버라이딩해서 사용한다.
+ * @note FMemoryManager를 거쳐 Physics 태그로 추적한다. (PhysX는 16바이트 정렬을 요구)
  */
-class FPhysXAllocator : public PxDefaultAllocator
+class FPhysXAllocator : public PxAllocatorCallback
 {
+public:
+    virtual void* allocate(size_t size, const char* typeName, const char* filename, int line) override
+    {
+        return FMemoryManager::Allocate(size, 16, EMemoryTag::Physics);
+    }
+
+    virtual void deallocate(void* ptr) override
+    {
+        FMemoryManager::Deallocate(ptr);
+    }
 };
 
 /**
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * 물리 고정 스텝 통계 구조체
+ * 프레임 시간과 무관하게 고정 간격으로 시뮬레이션하므로, 프레임당 서브스텝 수로 부하를 확인합니다.
+ */
+struct FPhysicsStats
+{
+	// 고정 스텝 설정
+	float FixedTimeStepMS = 0.0f;           // 고정 시뮬레이션 스텝 (밀리초)
+	int32_t MaxSubSteps = 0;                // 프레임당 최대 서브스텝
+
+	// 프레임 통계
+	int32_t SubStepsThisFrame = 0;          // 이번 프레임에 실행한 서브스텝 수
+	float InterpolationAlpha = 0.0f;        // 렌더링 트랜스폼 보간 계수 (0 = 이전 상태, 1 = 최신 상태)
+	uint32_t InterpolatedBodyCount = 0;     // 보간 상태를 추적 중인 바디 수
+	double SimulateTimeMS = 0.0;            // 게임 스레드에서 대기한 시뮬레이션 시간 (동기 서브스텝 + fetchResults)
+
+	// 누적 통계
+	uint64_t TotalFrames = 0;
+	uint64_t TotalSubSteps = 0;
+	uint32_t ClampedFrames = 0;             // 최대 서브스텝에 걸려 시간을 버린 프레임 수
+	double DroppedTimeMS = 0.0;             // 최대 서브스텝 초과로 버린 시간 누적
+
+	double GetAverageSubSteps() const
+	{
+		if (TotalFrames == 0) return 0.0;
+		return static_cast<double>(TotalSubSteps) / static_cast<double>(TotalFrames);
+	}
+};
+
+/**
+ * 물리 통계 전역 매니저 (싱글톤)
+ * 게임/에디터 월드의 FPhysScene만 기록합니다. (프리뷰 월드 제외)
+ */
+class FPhysicsStatManager
+{
+public:
+	static FPhysicsStatManager& GetInstance()
+	{
+		static FPhysicsStatManager Instance;
+		return Instance;
+	}
+
+	const FPhysicsStats& GetStats() const { return CurrentStats; }
+	FPhysicsStats& GetMutableStats() { return CurrentStats; }
+
+	/**
+	 * 프레임의 스텝 결과를 기록합니다. (FPhysScene::TickPhysScene에서 호출)
+	 */
+	void RecordFrame(float InFixedTimeStep, int32_t InMaxSubSteps, int32_t InSubSteps, float InDroppedTime)
+	{
+		CurrentStats.FixedTimeStepMS = InFixedTimeStep * 1000.0f;
+		CurrentStats.MaxSubSteps = InMaxSubSteps;
+		CurrentStats.SubStepsThisFrame = InSubSteps;
+
+		CurrentStats.TotalFrames++;
+		CurrentStats.TotalSubSteps += InSubSteps;
+		if (InDroppedTime > 0.0f)
+		{
+			CurrentStats.ClampedFrames++;
+			CurrentStats.DroppedTimeMS += InDroppedTime * 1000.0;
+		}
+	}
+
+	void ResetAccumulatedStats()
+	{
+		CurrentStats.TotalFrames = 0;
+		CurrentStats.TotalSubSteps = 0;
+		CurrentStats.ClampedFrames = 0;
+		CurrentStats.DroppedTimeMS = 0.0;
+	}
+
+private:
+	FPhysicsStatManager() = default;
+	~FPhysicsStatManager() = default;
+	FPhysicsStatManager(const FPhysicsStatManager&) = delete;
+	FPhysicsStatManager& operator=(const FPhysicsStatManager&) = delete;
+
+	FPhysicsStats CurrentStats;
+};
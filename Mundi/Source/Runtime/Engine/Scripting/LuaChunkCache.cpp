@@ -0,0 +1,269 @@
+﻿#include "pch.h"
+#include "LuaChunkCache.h"
+#include "PlatformTime.h"
+#include <fstream>
+
+namespace
+{
+	int WriteBytecode(lua_State*, const void* Data, size_t Size, void* UserData)
+	{
+		static_cast<FString*>(UserData)->append(static_cast<const char*>(Data), Size);
+		return 0;
+	}
+
+	bool ReadFileBytes(const std::filesystem::path& Path, FString& OutBytes)
+	{
+		std::ifstream File(Path, std::ios::binary);
+		if (!File)
+		{
+			return false;
+		}
+		OutBytes.assign(std::istreambuf_iterator<char>(File), std::istreambuf_iterator<char>());
+		return true;
+	}
+
+	// Lua 바이트코드 시그니처 (LUA_SIGNATURE)
+	bool IsBytecode(const FString& Bytes)
+	{
+		return Bytes.size() > 4 && Bytes.compare(0, 4, LUA_SIGNATURE) == 0;
+	}
+}
+
+FLuaChunkCache& FLuaChunkCache::GetInstance()
+{
+	static FLuaChunkCache Instance;
+	return Instance;
+}
+
+FString FLuaChunkCache::MakeKey(const FString& Path)
+{
+	FString Key = NormalizePath(Path);
+	std::transform(Key.begin(), Key.end(), Key.begin(), [](unsigned char C) { return static_cast<char>(std::tolower(C)); });
+	return Key;
+}
+
+sol::protected_function FLuaChunkCache::Instantiate(sol::state& Lua, const FString& Path)
+{
+	const FLuaChunkCacheEntry* Entry = FindOrCompile(Lua, Path);
+	if (!Entry)
+	{
+		return {};
+	}
+
+	// 바이너리 모드로만 로드: 파서를 거치지 않고 새 클로저(_ENV 업밸류 포함)만 만든다
+	sol::load_result Chunk = Lua.load(Entry->Bytecode, "@" + Path, sol::load_mode::binary);
+	if (!Chunk.valid() && Entry->bFromBytecodeFile)
+	{
+		// 그대로 두면 다음 FindOrCompile이 같은 .luac를 다시 골라 스크립트가 영영 실행되지 않는다
+		sol::error Err = Chunk;
+		UE_LOG("[Lua][warning] %s: falling back to source (%s)", GetBytecodePath(Path).c_str(), Err.what());
+		RejectedBytecodeFiles[MakeKey(Path)] = Entry->BytecodeWriteTime;
+		++Stats.BytecodeFileRejects;
+		Invalidate(Path);
+
+		Entry = FindOrCompile(Lua, Path);
+		if (!Entry)
+		{
+			return {};
+		}
+		Chunk = Lua.load(Entry->Bytecode, "@" + Path, sol::load_mode::binary);
+	}
+
+	if (!Chunk.valid())
+	{
+		sol::error Err = Chunk;
+		UE_LOG("[Lua][error] %s", Err.what());
+		Invalidate(Path);
+		return {};
+	}
+	return Chunk;
+}
+
+const FLuaChunkCacheEntry* FLuaChunkCache::FindOrCompile(sol::state& Lua, const FString& Path)
+{
+	const FString Key = MakeKey(Path);
+	const uint64 NowCycles = FPlatformTime::Cycles64();
+
+	std::error_code Ec;
+	const std::filesystem::path SourcePath(UTF8ToWide(Path));
+
+	if (FLuaChunkCacheEntry* Cached = Entries.Find(Key))
+	{
+		// 스폰이 몰릴 때 같은 파일의 수정 시간을 컴포넌트마다 조회하지 않는다
+		const double SinceValidated = (NowCycles - Cached->LastValidatedCycles) * FPlatformTime::GetSecondsPerCycle();
+		if (SinceValidated < ValidationIntervalSeconds)
+		{
+			++Stats.Hits;
+			return Cached;
+		}
+
+		const auto WriteTime = std::filesystem::last_write_time(SourcePath, Ec);
+		if (Ec || WriteTime == Cached->SourceWriteTime)
+		{
+			Cached->LastValidatedCycles = NowCycles;
+			++Stats.Hits;
+			return Cached;
+		}
+
+		UE_LOG("[Lua] Script changed, recompiling: %s", Path.c_str());
+		Entries.Remove(Key);
+		++Stats.Invalidations;
+	}
+
+	FLuaChunkCacheEntry NewEntry;
+	NewEntry.SourcePath = Path;
+	NewEntry.SourceWriteTime = std::filesystem::last_write_time(SourcePath, Ec);
+	NewEntry.LastValidatedCycles = NowCycles;
+
+	// 미리 구운 .luac가 소스보다 새것이면 그대로 사용
+	const std::filesystem::path BytecodePath(UTF8ToWide(GetBytecodePath(Path)));
+	std::error_code BytecodeEc;
+	const auto BytecodeWriteTime = std::filesystem::last_write_time(BytecodePath, BytecodeEc);
+	const auto* Rejected = RejectedBytecodeFiles.Find(Key);
+	const bool bRejected = Rejected && !BytecodeEc && *Rejected == BytecodeWriteTime;
+	if (!BytecodeEc && !bRejected && (Ec || BytecodeWriteTime >= NewEntry.SourceWriteTime)
+		&& ReadFileBytes(BytecodePath, NewEntry.Bytecode) && IsBytecode(NewEntry.Bytecode))
+	{
+		NewEntry.bFromBytecodeFile = true;
+		NewEntry.BytecodeWriteTime = BytecodeWriteTime;
+		++Stats.BytecodeFileLoads;
+	}
+	else if (!CompileSource(Lua, Path, NewEntry.Bytecode))
+	{
+		return nullptr;
+	}
+
+	Entries.Add(Key, std::move(NewEntry));
+	Stats.CachedFiles = static_cast<uint32>(Entries.Num());
+	return Entries.Find(Key);
+}
+
+bool FLuaChunkCache::CompileSource(sol::state& Lua, const FString& Path, FString& OutBytecode)
+{
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	sol::load_result Chunk = Lua.load_file(Path, sol::load_mode::text);
+	if (!Chunk.valid())
+	{
+		sol::error Err = Chunk;
+		UE_LOG("[Lua][error] %s", Err.what());
+		return false;
+	}
+
+	// 디버그 정보(라인 번호)는 에러 메시지를 위해 유지
+	sol::protected_function Func = Chunk;
+	OutBytecode.clear();
+	if (Func.dump(&WriteBytecode, &OutBytecode, false) != 0 || OutBytecode.empty())
+	{
+		UE_LOG("[Lua][error] Failed to dump bytecode: %s", Path.c_str());
+		return false;
+	}
+
+	++Stats.Compiles;
+	Stats.TotalCompileMS += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+	return true;
+}
+
+int32 FLuaChunkCache::InvalidateChangedFiles()
+{
+	TArray<FString> ChangedKeys;
+	for (auto& Pair : Entries)
+	{
+		std::error_code Ec;
+		const auto WriteTime = std::filesystem::last_write_time(std::filesystem::path(UTF8ToWide(Pair.second.SourcePath)), Ec);
+		if (!Ec && WriteTime != Pair.second.SourceWriteTime)
+		{
+			ChangedKeys.Add(Pair.first);
+		}
+	}
+
+	for (const FString& Key : ChangedKeys)
+	{
+		Entries.Remove(Key);
+	}
+	Stats.Invalidations += ChangedKeys.Num();
+	Stats.CachedFiles = static_cast<uint32>(Entries.Num());
+	return static_cast<int32>(ChangedKeys.Num());
+}
+
+void FLuaChunkCache::Invalidate(const FString& Path)
+{
+	if (Entries.Remove(MakeKey(Path)))
+	{
+		++Stats.Invalidations;
+	}
+	Stats.CachedFiles = static_cast<uint32>(Entries.Num());
+}
+
+void FLuaChunkCache::InvalidateAll()
+{
+	Stats.Invalidations += Entries.Num();
+	Entries.clear();
+	Stats.CachedFiles = 0;
+}
+
+bool FLuaChunkCache::CookBytecodeFile(sol::state& Lua, const FString& Path, FString& OutMessage)
+{
+	FString Bytecode;
+	if (!CompileSource(Lua, Path, Bytecode))
+	{
+		OutMessage = "compile failed: " + Path;
+		return false;
+	}
+
+	const FString OutPath = GetBytecodePath(Path);
+	std::ofstream File(std::filesystem::path(UTF8ToWide(OutPath)), std::ios::binary | std::ios::trunc);
+	if (!File)
+	{
+		OutMessage = "cannot write: " + OutPath;
+		return false;
+	}
+	File.write(Bytecode.data(), static_cast<std::streamsize>(Bytecode.size()));
+
+	// 다음 로드에서 새 .luac를 읽도록 기존 항목(과 이전 .luac의 실패 기록)은 버린다
+	RejectedBytecodeFiles.Remove(MakeKey(Path));
+	Invalidate(Path);
+	OutMessage = OutPath + " (" + std::to_string(Bytecode.size()) + " bytes)";
+	return true;
+}
+
+int32 FLuaChunkCache::CookDirectory(sol::state& Lua, const FString& Directory, FString& OutMessage)
+{
+	std::error_code Ec;
+	const std::filesystem::path Root(UTF8ToWide(Directory));
+	if (!std::filesystem::is_directory(Root, Ec))
+	{
+		OutMessage = "not a directory: " + Directory;
+		return 0;
+	}
+
+	int32 Cooked = 0;
+	int32 Failed = 0;
+	for (const auto& It : std::filesystem::recursive_directory_iterator(Root, Ec))
+	{
+		if (!It.is_regular_file() || It.path().extension() != L".lua")
+		{
+			continue;
+		}
+
+		FString Message;
+		if (CookBytecodeFile(Lua, NormalizePath(WideToUTF8(It.path().wstring())), Message))
+		{
+			++Cooked;
+		}
+		else
+		{
+			UE_LOG("[Lua][warning] %s", Message.c_str());
+			++Failed;
+		}
+	}
+
+	OutMessage = std::to_string(Cooked) + " cooked, " + std::to_string(Failed) + " failed";
+	return Cooked;
+}
+
+void FLuaChunkCache::ResetStats()
+{
+	Stats = FLuaChunkCacheStats();
+	Stats.CachedFiles = static_cast<uint32>(Entries.Num());
+}
@@ -0,0 +1,82 @@
+﻿#pragma once
+#include <sol/sol.hpp>
+#include <filesystem>
+
+/**
+ * 스크립트 파일 하나의 컴파일 결과
+ * 바이트코드는 lua_State와 무관하므로 에디터 월드와 PIE 월드의 FLuaManager가 함께 사용한다.
+ */
+struct FLuaChunkCacheEntry
+{
+	FString SourcePath;                                     // 원본 경로 (키는 소문자로 정규화됨)
+	FString Bytecode;                                       // lua_dump 결과 (디버그 정보 포함)
+	std::filesystem::file_time_type SourceWriteTime{};      // 컴파일 당시 .lua 수정 시간
+	std::filesystem::file_time_type BytecodeWriteTime{};    // bFromBytecodeFile일 때 읽은 .luac 수정 시간
+	uint64 LastValidatedCycles = 0;                         // 마지막으로 파일 시간을 확인한 시점
+	bool bFromBytecodeFile = false;                         // 미리 구운 .luac에서 읽었는지
+};
+
+struct FLuaChunkCacheStats
+{
+	uint32 CachedFiles = 0;
+	uint64 Hits = 0;                // 캐시된 바이트코드로 인스턴스만 생성
+	uint64 Compiles = 0;            // .lua를 파싱/컴파일
+	uint64 BytecodeFileLoads = 0;   // .luac를 읽어서 사용
+	uint64 BytecodeFileRejects = 0; // 로드에 실패해 소스로 대신 컴파일한 .luac
+	uint64 Invalidations = 0;       // 수정 시간이 바뀌어 버린 항목
+	double TotalCompileMS = 0.0;
+};
+
+/**
+ * 컴파일 결과 캐시 (싱글톤)
+ * - 키: 정규화된 스크립트 경로, 값: 바이트코드 + 소스 수정 시간
+ * - 컴포넌트마다 바이트코드에서 새 클로저만 만들어 환경을 붙이므로 파일 읽기/파싱이 없다.
+ * - 소스 수정 시간이 바뀐 파일만 다시 컴파일한다 (핫 리로드).
+ * - <스크립트>.luac가 소스보다 새것이면 컴파일 없이 그대로 사용한다.
+ *   로드에 실패한 .luac (다른 Lua 빌드로 구운 파일 등)는 같은 파일이 다시 구워질 때까지 무시하고 소스를 컴파일한다.
+ * @note 게임 스레드 전용
+ */
+class FLuaChunkCache
+{
+public:
+	static FLuaChunkCache& GetInstance();
+
+	/**
+	 * 스크립트의 새 청크 인스턴스를 만든다. (필요하면 컴파일/재컴파일)
+	 * @return 실패 시 invalid 함수 (에러는 로그로 출력)
+	 */
+	sol::protected_function Instantiate(sol::state& Lua, const FString& Path);
+
+	/** 수정된 파일의 항목만 버린다. @return 버린 항목 수 */
+	int32 InvalidateChangedFiles();
+
+	void Invalidate(const FString& Path);
+	void InvalidateAll();
+
+	/** 스크립트를 컴파일해서 <Path>c (.luac)로 저장한다. */
+	bool CookBytecodeFile(sol::state& Lua, const FString& Path, FString& OutMessage);
+
+	/** 디렉터리 아래 모든 .lua를 .luac로 굽는다. @return 성공한 파일 수 */
+	int32 CookDirectory(sol::state& Lua, const FString& Directory, FString& OutMessage);
+
+	const FLuaChunkCacheStats& GetStats() const { return Stats; }
+	void ResetStats();
+
+	/** 같은 파일을 연속으로 로드할 때 수정 시간을 다시 확인하지 않는 간격 (초) */
+	double ValidationIntervalSeconds = 0.5;
+
+private:
+	FLuaChunkCache() = default;
+	~FLuaChunkCache() = default;
+	FLuaChunkCache(const FLuaChunkCache&) = delete;
+	FLuaChunkCache& operator=(const FLuaChunkCache&) = delete;
+
+	const FLuaChunkCacheEntry* FindOrCompile(sol::state& Lua, const FString& Path);
+	bool CompileSource(sol::state& Lua, const FString& Path, FString& OutBytecode);
+	static FString MakeKey(const FString& Path);
+	static FString GetBytecodePath(const FString& Path) { return Path + "c"; }
+
+	TMap<FString, FLuaChunkCacheEntry> Entries;
+	TMap<FString, std::filesystem::file_time_type> RejectedBytecodeFiles;   // 키 -> 로드에 실패한 .luac의 수정 시간
+	FLuaChunkCacheStats Stats;
+};
@@ -7,7 +7,7 @@
 #include "ObjectFactory.h"
 
 // Global bound classes map for reflection-based access
-TMap<UClass*, FBoundClassDesc> GBoundClasses;
+TFlatMap<UClass*, FBoundClassDesc> GBoundClasses;
 
 // External function from LuaManager.cpp
 extern sol::object MakeCompProxy(sol::state_view SolState, UObject* Instance, UClass* Class);
@@ -17,7 +17,7 @@ extern sol::object MakeCompProxy(sol::state_view SolState, UObject* Instance, UC
 void BuildBoundClass(UClass* Class)
 {
     if (!Class) return;
-    if (GBoundClasses.count(Class)) return;
+    if (GBoundClasses.Contains(Class)) return;
 
     FBoundClassDesc Desc;
     Desc.Class = Class;
@@ -34,7 +34,7 @@ void BuildBoundClass(UClass* Class)
 
     UE_LOG("[LuaProxy] Bound class: %s (%d/%d properties exposed to Lua)",
            Class->Name, BoundCount, (int)Class->GetAllProperties().size());
-    GBoundClasses.emplace(Class, std::move(Desc));
+    GBoundClasses.Emplace(Class, std::move(Desc));
 }
 
 bool LuaComponentProxy::IsValid() const
@@ -94,11 +94,11 @@ sol::object LuaComponentProxy::Index(sol::this_state LuaState, LuaComponentProxy
     }
 
     // ===== 2. Reflection-based fallback (LuaReadWrite metadata) =====
-    auto It = GBoundClasses.find(Self.Class);
-    if (It == GBoundClasses.end()) return sol::nil;
+    const FBoundClassDesc* ClassDesc = GBoundClasses.Find(Self.Class);
+    if (!ClassDesc) return sol::nil;
 
-    auto ItProp = It->second.PropsByName.find(Key);
-    if (ItProp == It->second.PropsByName.end()) return sol::nil;
+    auto ItProp = ClassDesc->PropsByName.find(Key);
+    if (ItProp == ClassDesc->PropsByName.end()) return sol::nil;
 
     const FProperty* Property = ItProp->second.Property;
 
@@ -206,11 +206,11 @@ void LuaComponentProxy::NewIndex(LuaComponentProxy& Self, const char* Key, sol::
     }
 
     // ===== 2. Reflection-based fallback =====
-    auto IterateClass = GBoundClasses.find(Self.Class);
-    if (IterateClass == GBoundClasses.end()) return;
+    const FBoundClassDesc* ClassDesc = GBoundClasses.Find(Self.Class);
+    if (!ClassDesc) return;
 
-    auto It = IterateClass->second.PropsByName.find(Key);
-    if (It == IterateClass->second.PropsByName.end()) return;
+    auto It = ClassDesc->PropsByName.find(Key);
+    if (It == ClassDesc->PropsByName.end()) return;
 
     const FProperty* Property = It->second.Property;
 
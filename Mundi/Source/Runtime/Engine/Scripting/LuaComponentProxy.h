@@ -18,7 +18,7 @@ struct FBoundClassDesc
     TMap<FString, FBoundProp> PropsByName;
 };
 
-extern TMap<UClass*, FBoundClassDesc> GBoundClasses;
+extern TFlatMap<UClass*, FBoundClassDesc> GBoundClasses;
 
 void BuildBoundClass(UClass* Class);
 
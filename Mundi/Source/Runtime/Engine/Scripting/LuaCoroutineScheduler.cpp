@@ -1,33 +1,176 @@
 ﻿#include "pch.h"
 #include "LuaCoroutineScheduler.h"
+#include "PlatformTime.h"
+
+namespace
+{
+	constexpr uint32 SlotBits = 20;
+	constexpr uint32 SlotMask = (1u << SlotBits) - 1;
+	constexpr uint32 GenerationMask = (1u << (32 - SlotBits)) - 1;
+
+	// 힙 정렬 기준: WakeTime이 작은 항목이 front
+	struct FTimerGreater
+	{
+		template<typename T>
+		bool operator()(const T& A, const T& B) const { return A.WakeTime > B.WakeTime; }
+	};
+
+	void RemoveHandleSwap(TArray<uint32>& List, uint32 Handle)
+	{
+		auto It = std::find(List.begin(), List.end(), Handle);
+		if (It != List.end())
+		{
+			List.RemoveAtSwap(static_cast<int32>(std::distance(List.begin(), It)));
+		}
+	}
+}
+
+FLuaCoroutineScheduler::FLuaCoroutineScheduler()
+{
+	Tasks.Reserve(100);
+	TimerHeap.Reserve(100);
+}
 
 void FLuaCoroutineScheduler::ShutdownBeforeLuaClose()
 {
 	for (auto& Task : Tasks)
 	{
-		if (Task.Co.valid())
+		if (!Task.Finished && Task.Co.valid())
 		{
 			Task.Co.abandon(); // Lua쪽 Coroutine 무력화 필수
 		}
 	}
 	Tasks.Empty(); 
+	FirstFree = -1;
+
+	TimerHeap.Empty();
+	PredicateWaits.Empty();
+	ReadyTasks.Empty();
+	EventWaits.Empty();
+	OwnerTasks.Empty();
+	ResumeBatch.Empty();
+	PredicateScratch.Empty();
+	StaleTimers = 0;
+
+	Stats = FLuaCoroutineStats();
 }
 
-FLuaCoroutineScheduler::FLuaCoroutineScheduler()
+int32 FLuaCoroutineScheduler::AllocateSlot()
 {
-	Tasks.Reserve(100);
+	if (FirstFree >= 0)
+	{
+		const int32 Slot = FirstFree;
+		FirstFree = Tasks[Slot].NextFree;
+		Tasks[Slot].NextFree = -1;
+		return Slot;
+	}
+
+	if (static_cast<uint32>(Tasks.Num()) >= SlotMask)
+	{
+		return -1;
+	}
+	return Tasks.Emplace();
+}
+
+void FLuaCoroutineScheduler::ReleaseSlot(int32 Slot)
+{
+	FCoroTask& Task = Tasks[Slot];
+	const uint32 Handle = MakeHandle(Slot);
+
+	if (Task.Owner)
+	{
+		if (TArray<uint32>* OwnerList = OwnerTasks.Find(Task.Owner))
+		{
+			RemoveHandleSwap(*OwnerList, Handle);
+			if (OwnerList->IsEmpty())
+			{
+				OwnerTasks.Remove(Task.Owner);
+			}
+		}
+	}
+
+	// 이벤트 대기는 트리거되지 않으면 영원히 남으므로 여기서 지운다. 타이머는 꺼낼 때 걸러낸다.
+	if (Task.WaitType == EWaitType::Event)
+	{
+		if (TArray<uint32>* Waiting = EventWaits.Find(Task.EventName))
+		{
+			RemoveHandleSwap(*Waiting, Handle);
+			if (Waiting->IsEmpty())
+			{
+				EventWaits.Remove(Task.EventName);
+			}
+		}
+	}
+	else if (Task.WaitType == EWaitType::Time)
+	{
+		++StaleTimers;
+	}
+
+	Task.Co = sol::coroutine(); // 참조 해제
+	Task.Thread = sol::thread();
+	Task.Predicate = nullptr;
+	Task.Owner = nullptr;
+	Task.WaitType = EWaitType::None;
+	Task.Finished = true;
+	Task.Generation = (Task.Generation + 1) & GenerationMask;
+	Task.NextFree = FirstFree;
+	FirstFree = Slot;
+
+	--Stats.LiveTasks;
+}
+
+uint32 FLuaCoroutineScheduler::MakeHandle(int32 Slot) const
+{
+	return (Tasks[Slot].Generation << SlotBits) | static_cast<uint32>(Slot + 1);
+}
+
+int32 FLuaCoroutineScheduler::ResolveHandle(uint32 Handle) const
+{
+	const int32 Slot = static_cast<int32>(Handle & SlotMask) - 1;
+	if (Slot < 0 || Slot >= Tasks.Num())
+	{
+		return -1;
+	}
+
+	const FCoroTask& Task = Tasks[Slot];
+	if (Task.Finished || Task.Generation != (Handle >> SlotBits))
+	{
+		return -1;
+	}
+	return Slot;
 }
 
 FLuaCoroHandle FLuaCoroutineScheduler::Register(sol::thread&& Thread, sol::coroutine&& Co, void* Owner)
 {
-	FCoroTask Task;
+	const int32 Slot = AllocateSlot();
+	if (Slot < 0)
+	{
+		UE_LOG("[Lua][error] Coroutine slots exhausted\n");
+		return FLuaCoroHandle{};
+	}
+
+	FCoroTask& Task = Tasks[Slot];
 	Task.Thread = std::move(Thread); /* Thread Anchoring */
 	Task.Co     = std::move(Co);
 	Task.Owner  = Owner;
-	Task.Id     = ++NextId;
-	Tasks.push_back(std::move(Task));
-	
-	return FLuaCoroHandle{ Task.Id };
+	Task.WaitType = EWaitType::None;
+	Task.Finished = false;
+	++Stats.LiveTasks;
+
+	const uint32 Handle = MakeHandle(Slot);
+	if (Owner)
+	{
+		OwnerTasks[Owner].Add(Handle);
+	}
+
+	// 첫 재개는 다음 Process에서
+	ReadyTasks.Add(Handle);
+	return FLuaCoroHandle{ Handle };
+}
+
+void FLuaCoroutineScheduler::AddCoroutine(sol::coroutine&& Co)
+{
+	Register(sol::thread(), std::move(Co), nullptr);
 }
 
 void FLuaCoroutineScheduler::Tick(double DeltaTime)
@@ -36,115 +179,308 @@ void FLuaCoroutineScheduler::Tick(double DeltaTime)
 	const double Clamped = std::min(DeltaTime, MaxDeltaClamp);
 	NowSeconds += Clamped;
 
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	Stats.ResumesThisFrame = 0;
+
 	Process(NowSeconds);
+
+	Stats.TimerWaits = TimerHeap.Num();
+	Stats.PredicateWaits = PredicateWaits.Num();
+	Stats.EventWaits = 0;
+	for (const auto& Pair : EventWaits)
+	{
+		Stats.EventWaits += Pair.second.Num();
+	}
+	Stats.ProcessMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+}
+
+void FLuaCoroutineScheduler::PushTimer(double WakeTime, uint32 Handle)
+{
+	TimerHeap.push_back(FTimerEntry{ WakeTime, Handle });
+	std::push_heap(TimerHeap.begin(), TimerHeap.end(), FTimerGreater());
 }
+
+int32 FLuaCoroutineScheduler::ResolveTimer(const FTimerEntry& Entry) const
+{
+	const int32 Slot = ResolveHandle(Entry.Handle);
+	if (Slot < 0)
+	{
+		return -1;
+	}
+
+	const FCoroTask& Task = Tasks[Slot];
+	if (Task.WaitType != EWaitType::Time || Task.WakeTime != Entry.WakeTime)
+	{
+		return -1;
+	}
+	return Slot;
+}
+
 void FLuaCoroutineScheduler::Process(double Now)
 {
-	for (auto& task : Tasks)
+	// 1) 지난 프레임에 태그 없이 yield했거나 새로 등록된 태스크
+	ResumeBatch.Empty();
+	std::swap(ResumeBatch, ReadyTasks);
+
+	// 2) 기상 시간이 지난 타이머만 힙에서 꺼낸다
+	while (!TimerHeap.IsEmpty() && TimerHeap.front().WakeTime <= Now)
 	{
-		if (task.Finished)
+		std::pop_heap(TimerHeap.begin(), TimerHeap.end(), FTimerGreater());
+		const FTimerEntry Entry = TimerHeap.back();
+		TimerHeap.pop_back();
+
+		// 세대가 한 바퀴 돌아 재사용된 슬롯이 이벤트/다른 타이머를 기다리는 중이면 깨우지 않는다
+		const int32 Slot = ResolveTimer(Entry);
+		if (Slot >= 0)
+		{
+			// 재개 전에 대기를 풀어 같은 항목이 중복으로 깨우지 않게 한다
+			Tasks[Slot].WaitType = EWaitType::None;
+			ResumeBatch.Add(Entry.Handle);
+		}
+		else if (StaleTimers > 0)
+		{
+			--StaleTimers;
+		}
+	}
+
+	// 취소된 타이머가 힙의 절반을 넘으면 한 번에 정리
+	if (StaleTimers > 64 && StaleTimers * 2 > TimerHeap.Num())
+	{
+		auto NewEnd = std::remove_if(TimerHeap.begin(), TimerHeap.end(),
+			[this](const FTimerEntry& Entry) { return ResolveTimer(Entry) < 0; });
+		TimerHeap.erase(NewEnd, TimerHeap.end());
+		std::make_heap(TimerHeap.begin(), TimerHeap.end(), FTimerGreater());
+		StaleTimers = 0;
+	}
+
+	// 3) 조건 대기는 매 프레임 평가
+	PredicateScratch.Empty();
+	for (const uint32 Handle : PredicateWaits)
+	{
+		const int32 Slot = ResolveHandle(Handle);
+		if (Slot < 0 || Tasks[Slot].WaitType != EWaitType::Predicate)
+		{
 			continue;
+		}
+
+		// 조건 함수 안에서 코루틴이 등록되면 Tasks가 재할당될 수 있으므로 복사해서 호출
+		const std::function<bool()> Predicate = Tasks[Slot].Predicate;
+		if (!Predicate || Predicate())
+		{
+			ResumeBatch.Add(Handle);
+		}
+		else
+		{
+			PredicateScratch.Add(Handle);
+		}
+	}
+	std::swap(PredicateWaits, PredicateScratch);
 
-		// 조건 충족 여부
-		switch (task.WaitType)
+	// 조건 충족 시 resume 실행 (앞선 재개에서 취소됐을 수 있으므로 다시 확인)
+	for (const uint32 Handle : ResumeBatch)
+	{
+		const int32 Slot = ResolveHandle(Handle);
+		if (Slot >= 0)
 		{
-		case EWaitType::Time:
-			// UE_LOG("Now=%.3f Wake=%.3f", TotalTime, task.WakeTime);
-			if (task.WakeTime > Now) continue;
-			break;
-		case EWaitType::Predicate:
-			// 람다 함수가 있지만, 조건이 달성 안 됐을 때
-			if (task.Predicate && !task.Predicate()) continue; 
-			break;
-			// case EWaitType::Event: // Event "Trigger"는 Tick 함수 내에서 조건 확인하지 않음
+			ResumeTask(Slot, Now);
 		}
+	}
+	ResumeBatch.Empty();
+}
+
+void FLuaCoroutineScheduler::ResumeTask(int32 Slot, double Now)
+{
+	bool bFinished = true;
+	{
+		// 코루틴 안에서 TriggerEvent가 불리면 재개가 중첩되므로 이전 상태를 복원한다
+		const int32 PrevRunningSlot = RunningSlot;
+		const bool bPrevRunningCancelled = bRunningCancelled;
+		RunningSlot = Slot;
+		bRunningCancelled = false;
+
+		sol::protected_function_result Result = Tasks[Slot].Co();
+
+		const bool bCancelled = bRunningCancelled;
+		RunningSlot = PrevRunningSlot;
+		bRunningCancelled = bPrevRunningCancelled;
+		++Stats.ResumesThisFrame;
 
-		// 조건 충족 시 resume 실행
-		sol::protected_function_result Result = task.Co();
-		if (!Result.valid())
+		// 재개 중에 Register가 호출되면 Tasks가 재할당되므로 이후에 참조를 얻는다
+		FCoroTask& Task = Tasks[Slot];
+		const uint32 Handle = MakeHandle(Slot);
+
+		if (bCancelled)
+		{
+			// 자기 자신(또는 소유자)을 취소한 경우, 재개가 끝난 뒤 해제
+		}
+		else if (!Result.valid())
 		{
 			sol::error Err = Result;
 			UE_LOG("[Lua][error] Coroutine error: %s\n", Err.what());
-			task.Finished = true;
-			continue;
 		}
-		
 		// 이후 yield가 다시 올 경우, 다음 조건 실행 = 재세팅
-		if (Result.status() == sol::call_status::yielded)
+		else if (Result.status() == sol::call_status::yielded)
 		{
-			std::string Tag = Result.get<FString>(0); // 해당 Co의 첫번째 string 매개변수
+			bFinished = false;
+
+			FString Tag;
+			if (Result.return_count() > 0 && Result.get_type(0) == sol::type::string)
+			{
+				Tag = Result.get<FString>(0); // 해당 Co의 첫번째 string 매개변수
+			}
+
 			if (Tag == "wait_time")
 			{
-				double Sec = Result.get<double>(1);
-				task.WaitType = EWaitType::Time;
-				task.WakeTime = Now + Sec;
+				const double Sec = Result.get<double>(1);
+				Task.WaitType = EWaitType::Time;
+				Task.WakeTime = Now + Sec;
+				PushTimer(Task.WakeTime, Handle);
 			}
 			else if (Tag == "wait_predicate")
 			{
 				sol::function Condition = Result.get<sol::function>(1); 
-				task.WaitType = EWaitType::Predicate;
-				task.Predicate = [Condition]()
+				Task.WaitType = EWaitType::Predicate;
+				Task.Predicate = [Condition]()
 				{
 					sol::protected_function_result Result = Condition();
 					if (!Result.valid()) return false; 
 					return Result.get<bool>();
 				};
+				PredicateWaits.Add(Handle);
 			}
 			else if (Tag == "wait_event")
 			{
-				task.WaitType = EWaitType::Event;
-				task.EventName = Result.get<FString>(1);
+				Task.WaitType = EWaitType::Event;
+				Task.EventName = FName(Result.get<FString>(1));
+				EventWaits[Task.EventName].Add(Handle);
 			}
 			else
 			{
-				task.WaitType = EWaitType::None;
+				Task.WaitType = EWaitType::None;
+				ReadyTasks.Add(Handle);
 			}
 		}
-		else if (Result.status() == sol::call_status::runtime)
-		{
-			task.Finished = true;
-		}
-		else if (Result.status() == sol::call_status::ok)
-		{
-			task.Finished = true;
-		}
-		else if (Result.status() == sol::call_status::file)
-		{
-			task.Finished = true;
-		}
-		else if (Result.status() == sol::call_status::memory)
-		{
-			task.Finished = true;
-		}
+		// ok / runtime / file / memory: 종료
 	}
-}
-
 
-void FLuaCoroutineScheduler::AddCoroutine(sol::coroutine&& Co)
-{
-	Tasks.push_back({std::move(Co)});
+	// Result가 스레드 스택을 정리한 뒤에 참조를 놓는다
+	if (bFinished)
+	{
+		Tasks[Slot].WaitType = EWaitType::None;
+		ReleaseSlot(Slot);
+	}
 }
 
 void FLuaCoroutineScheduler::TriggerEvent(const FString& EventName)
 {
-	for (auto& task : Tasks)
+	const FName Key(EventName);
+	TArray<uint32>* Waiting = EventWaits.Find(Key);
+	if (!Waiting)
+	{
+		return;
+	}
+
+	// 재개 중 같은 이벤트를 다시 기다리는 태스크는 새 목록에 들어가 이번 트리거로는 재개되지 않는다
+	TArray<uint32> Handles = std::move(*Waiting);
+	EventWaits.Remove(Key);
+
+	for (const uint32 Handle : Handles)
 	{
-		if (task.Finished) continue;
-		if (task.WaitType != EWaitType::Event) continue;
-		if (task.EventName == EventName)
+		const int32 Slot = ResolveHandle(Handle);
+		if (Slot < 0 || Tasks[Slot].WaitType != EWaitType::Event)
 		{
-			task.WaitType = EWaitType::None;
-			task.Co(); // resume
+			continue;
 		}
+		ResumeTask(Slot, NowSeconds);
+	}
+}
+
+void FLuaCoroutineScheduler::Cancel(FLuaCoroHandle Handle)
+{
+	const int32 Slot = ResolveHandle(Handle.Id);
+	if (Slot < 0)
+	{
+		return;
 	}
+
+	if (Slot == RunningSlot)
+	{
+		bRunningCancelled = true;
+		return;
+	}
+	ReleaseSlot(Slot);
 }
 
 void FLuaCoroutineScheduler::CancelByOwner(void* Owner)
 {
-	for (auto& Task : Tasks) {
-		if (Task.Owner == Owner && !Task.Finished) {
-			Task.Finished = true;
-			Task.Co = sol::coroutine(); // 참조 해제
-		}
+	TArray<uint32>* OwnerList = OwnerTasks.Find(Owner);
+	if (!OwnerList)
+	{
+		return;
+	}
+
+	TArray<uint32> Handles = std::move(*OwnerList);
+	OwnerTasks.Remove(Owner);
+
+	for (const uint32 Handle : Handles)
+	{
+		Cancel(FLuaCoroHandle{ Handle });
+	}
+}
+
+FLuaCoroBenchmarkResult FLuaCoroutineScheduler::RunBenchmark(sol::state& Lua, int32 NumCoroutines, int32 NumFrames)
+{
+	FLuaCoroBenchmarkResult BenchResult;
+	BenchResult.NumCoroutines = NumCoroutines;
+	BenchResult.Frames = NumFrames;
+
+	// 1~10초 사이로 잠드는 코루틴 (초당 약 NumCoroutines / 5.5개가 깨어남)
+	sol::protected_function_result Factory = Lua.safe_script(R"(
+return function(sec)
+    return function()
+        while true do
+            coroutine.yield("wait_time", sec)
+        end
+    end
+end
+)", sol::script_pass_on_error);
+	if (!Factory.valid())
+	{
+		sol::error Err = Factory;
+		UE_LOG("[Lua][error] Coroutine benchmark: %s\n", Err.what());
+		return BenchResult;
+	}
+	sol::function MakeSleeper = Factory;
+
+	FLuaCoroutineScheduler Bench;
+	Bench.Tasks.Reserve(NumCoroutines);
+	Bench.TimerHeap.Reserve(NumCoroutines);
+
+	const uint64 RegisterStart = FPlatformTime::Cycles64();
+	for (int32 Index = 0; Index < NumCoroutines; ++Index)
+	{
+		sol::function Sleeper = MakeSleeper(1.0 + (Index % 10));
+
+		sol::thread Thread = sol::thread::create(Lua);
+		sol::state_view ThreadState = Thread.state();
+		sol::coroutine Coroutine(ThreadState.lua_state(), Sleeper);
+		Bench.Register(std::move(Thread), std::move(Coroutine), &Bench);
 	}
+	BenchResult.RegisterMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - RegisterStart);
+
+	const double DeltaTime = 1.0 / 60.0;
+	double TotalMS = 0.0;
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		Bench.Tick(DeltaTime);
+		TotalMS += Bench.Stats.ProcessMS;
+		BenchResult.MaxTickMS = std::max(BenchResult.MaxTickMS, Bench.Stats.ProcessMS);
+		BenchResult.Resumes += Bench.Stats.ResumesThisFrame;
+	}
+	BenchResult.AvgTickMS = NumFrames > 0 ? TotalMS / NumFrames : 0.0;
+
+	// abandon은 레지스트리 참조를 남기므로, 살아있는 상태에서는 취소로 정리한다
+	Bench.CancelByOwner(&Bench);
+	Lua.collect_garbage();
+	return BenchResult;
 }
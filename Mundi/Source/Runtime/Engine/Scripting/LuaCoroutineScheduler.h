@@ -2,6 +2,7 @@
 #include <sol/sol.hpp>
 #include <sol/coroutine.hpp>
 
+// Id = (세대 << 20) | (슬롯 + 1). 슬롯이 재사용되어도 이전 핸들은 세대가 달라 무효가 된다.
 struct FLuaCoroHandle {
     uint32_t Id = 0;
     explicit operator bool() const { return Id != 0; }
@@ -23,11 +24,40 @@ struct FCoroTask
     EWaitType WaitType  = EWaitType::None;
     double WakeTime = 0.0;			// wait_time(n초)
     std::function<bool()> Predicate;// wait_until()
-    std::string EventName;			// wait_event("Test")
-    bool Finished = false;
-    uint32 Id = 0;
+    FName EventName;				// wait_event("Test")
+    bool Finished = true;           // 빈 슬롯도 Finished
+    uint32 Generation = 1;
+    int32 NextFree = -1;
 };
 
+struct FLuaCoroutineStats
+{
+    int32 LiveTasks = 0;
+    int32 TimerWaits = 0;           // 힙에 남은 항목 (취소된 항목 포함)
+    int32 PredicateWaits = 0;
+    int32 EventWaits = 0;
+    int32 ResumesThisFrame = 0;
+    double ProcessMS = 0.0;
+};
+
+struct FLuaCoroBenchmarkResult
+{
+    int32 NumCoroutines = 0;
+    int32 Frames = 0;
+    double RegisterMS = 0.0;
+    double AvgTickMS = 0.0;
+    double MaxTickMS = 0.0;
+    uint64 Resumes = 0;
+};
+
+/**
+ * 씬 단위 Lua 코루틴 스케줄러
+ * - 태스크는 프리 리스트로 재사용하는 슬롯에 저장하고, 핸들은 슬롯 + 세대로 만든다.
+ * - 대기 종류별로 따로 관리해 매 프레임 전체 태스크를 훑지 않는다.
+ *   wait_time은 기상 시간 최소 힙, wait_event는 이벤트 이름(FName) → 대기 태스크 목록,
+ *   wait_predicate는 별도 목록 (조건은 매 프레임 평가해야 함), 그 외 yield는 다음 프레임 준비 목록.
+ * - 취소된 태스크의 힙 항목은 지우지 않고, 꺼낼 때 세대/대기 종류/기상 시간이 다르면 버린다.
+ */
 class FLuaCoroutineScheduler
 {
 public:
@@ -40,15 +70,61 @@ public:
     void AddCoroutine(sol::coroutine&& Co);
     void TriggerEvent(const FString& EventName);
     
+    void Cancel(FLuaCoroHandle Handle);
     void CancelByOwner(void* Owner);
     void ShutdownBeforeLuaClose();
+
+    bool IsAlive(FLuaCoroHandle Handle) const { return ResolveHandle(Handle.Id) >= 0; }
+    const FLuaCoroutineStats& GetStats() const { return Stats; }
+
+    /** 오래 잠든 코루틴 NumCoroutines개를 별도 스케줄러에 올리고 NumFrames 동안 Tick 시간을 잰다 */
+    static FLuaCoroBenchmarkResult RunBenchmark(sol::state& Lua, int32 NumCoroutines, int32 NumFrames);
     
 private:
+    struct FTimerEntry
+    {
+        double WakeTime;
+        uint32 Handle;
+    };
+
     void Process(double Now);
 
+    int32 AllocateSlot();
+    void ReleaseSlot(int32 Slot);
+    int32 ResolveHandle(uint32 Handle) const;
+    uint32 MakeHandle(int32 Slot) const;
+
+    /** 코루틴을 재개하고, 다시 yield하면 태그에 맞는 대기 구조에 넣는다. 끝났으면 슬롯을 해제한다. */
+    void ResumeTask(int32 Slot, double Now);
+
+    void PushTimer(double WakeTime, uint32 Handle);
+
+    /**
+     * 힙 항목이 아직 유효한 타이머인지 (세대는 12비트라 슬롯 재사용으로 한 바퀴 돌 수 있으므로
+     * 대기 종류와 기상 시간까지 같아야 같은 wait_time으로 본다. 타이머가 아니면 -1)
+     */
+    int32 ResolveTimer(const FTimerEntry& Entry) const;
+
 private:
     TArray<FCoroTask> Tasks;
-    uint32 NextId = 0;
+    int32 FirstFree = -1;
+
+    TArray<FTimerEntry> TimerHeap;                  // WakeTime 최소 힙
+    TArray<uint32> PredicateWaits;
+    TArray<uint32> ReadyTasks;                      // 다음 Process에서 재개 (등록 직후, 태그 없는 yield)
+    TMap<FName, TArray<uint32>> EventWaits;
+    TMap<void*, TArray<uint32>> OwnerTasks;
+
+    // Process 중 재사용하는 임시 버퍼
+    TArray<uint32> ResumeBatch;
+    TArray<uint32> PredicateScratch;
+
+    int32 StaleTimers = 0;                          // 취소되어 힙에 남은 타이머 수 (추정치)
+
+    int32 RunningSlot = -1;                         // 재개 중인 슬롯 (재개 중 취소는 끝난 뒤 해제)
+    bool bRunningCancelled = false;
+
+    FLuaCoroutineStats Stats;
     
     double NowSeconds = 0.0;
     double MaxDeltaClamp = 0.1; // 한 프레임의 최대 반영시간, Debug으로 중단 시에도 시간이 가지 않게 방지
@@ -9,6 +9,7 @@
 #include "CameraActor.h"
 #include "CameraComponent.h"
 #include "PlayerCameraManager.h"
+#include "LuaChunkCache.h"
 #include <tuple>
 
 sol::object MakeCompProxy(sol::state_view SolState, UObject* Instance, UClass* Class) {
@@ -20,9 +21,33 @@ sol::object MakeCompProxy(sol::state_view SolState, UObject* Instance, UClass* C
     return sol::make_object(SolState, std::move(Proxy));
 }
 
+// Lua 힙을 FMemoryManager로 보내 Scripting 태그로 추적한다 (lua_Alloc 규약: NewSize == 0이면 해제)
+static void* LuaAllocate(void* UserData, void* Ptr, size_t OldSize, size_t NewSize)
+{
+    if (NewSize == 0)
+    {
+        FMemoryManager::Deallocate(Ptr);
+        return nullptr;
+    }
+
+    // 축소는 실패하면 안 되므로 제자리에서 처리
+    if (Ptr && NewSize <= OldSize)
+    {
+        return Ptr;
+    }
+
+    void* NewPtr = FMemoryManager::Allocate(NewSize, alignof(std::max_align_t), EMemoryTag::Scripting);
+    if (NewPtr && Ptr)
+    {
+        memcpy(NewPtr, Ptr, OldSize);
+        FMemoryManager::Deallocate(Ptr);
+    }
+    return NewPtr;
+}
+
 FLuaManager::FLuaManager()
 {
-    Lua = new sol::state();
+    Lua = new sol::state(sol::default_at_panic, LuaAllocate);
     
     
     // Open essential standard libraries for gameplay scripts
@@ -358,6 +383,8 @@ FLuaManager::FLuaManager()
     ExposeGlobalFunctions();
     ExposeAllComponentsToLua();
 
+    TickManager = std::make_unique<FLuaTickManager>(*Lua);
+
     // 위 등록 마친 뒤 fall back 설정 : Shared lib의 fall back은 G
     sol::table MetaTableShared = Lua->create_table();
     MetaTableShared[sol::meta_function::index] = Lua->globals();
@@ -631,10 +658,10 @@ void FLuaManager::ExposeGlobalFunctions()
 }
 
 bool FLuaManager::LoadScriptInto(sol::environment& Env, const FString& Path) {
-    auto Chunk = Lua->load_file(Path);
-    if (!Chunk.valid()) { sol::error Err = Chunk; UE_LOG("[Lua][error] %s", Err.what()); return false; }
-    
-    sol::protected_function ProtectedFunc = Chunk;
+    // 파일 단위 바이트코드 캐시에서 새 청크 인스턴스만 생성 (같은 스크립트를 쓰는 컴포넌트끼리 파싱 공유)
+    sol::protected_function ProtectedFunc = FLuaChunkCache::GetInstance().Instantiate(*Lua, Path);
+    if (!ProtectedFunc.valid()) { return false; }
+
     sol::set_environment(Env, ProtectedFunc);         
     auto Result = ProtectedFunc();
     if (!Result.valid()) { sol::error Err = Result; UE_LOG("[Lua][error] %s", Err.what()); return false; }
@@ -643,12 +670,20 @@ bool FLuaManager::LoadScriptInto(sol::environment& Env, const FString& Path) {
 
 void FLuaManager::Tick(double DeltaSeconds)
 {
+    // 이번 프레임에 틱이 필요한 스크립트 컴포넌트들을 한 번의 Lua 호출로 실행
+    TickManager->Dispatch();
+
     CoroutineSchedular.Tick(DeltaSeconds);
 }
 
 void FLuaManager::ShutdownBeforeLuaClose()
 {
     CoroutineSchedular.ShutdownBeforeLuaClose();
+
+    if (TickManager)
+    {
+        TickManager->Shutdown();
+    }
     
     FLuaBindRegistry::Get().Reset();
     
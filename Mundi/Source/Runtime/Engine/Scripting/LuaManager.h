@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "LuaCoroutineScheduler.h"
+#include "LuaTickManager.h"
 #include <sol/sol.hpp>
 
 namespace sol { class state; }
@@ -23,16 +24,18 @@ public:
     // Env 테이블에서 Name(함수 이름) 키를 조회해서 함수로 캐스팅
     static sol::protected_function GetFunc(sol::environment& Env, const char* Name);
     
-    void Tick(double DeltaSeconds);            // 내부에서 누적 TotalTime 관리
+    void Tick(double DeltaSeconds);            // 스크립트 Tick 일괄 디스패치 + 코루틴 (내부에서 누적 TotalTime 관리)
     void ShutdownBeforeLuaClose();             // 코루틴 abandon -> Tasks 비우기
     
     class FLuaCoroutineScheduler& GetScheduler() { return CoroutineSchedular; }
+    FLuaTickManager& GetTickManager() { return *TickManager; }
 
 private:
     sol::state* Lua = nullptr;
     sol::table SharedLib;                         // 공용 유틸 테이블
 
     FLuaCoroutineScheduler CoroutineSchedular;    // 씬 단위 Coroutine Manager
+    std::unique_ptr<FLuaTickManager> TickManager; // 스크립트 컴포넌트 Tick 일괄 처리
 };
 
 // Helper function to wrap C++ object pointers in LuaComponentProxy for Lua
@@ -0,0 +1,329 @@
+﻿#include "pch.h"
+#include "LuaTickManager.h"
+#include "PlatformTime.h"
+
+namespace
+{
+    // 디스패처: 틱이 대기 중인 그룹만 돌며 파일 단위로 시간을 잰다.
+    // deltas[i]가 false가 아니면 이번 프레임에 호출할 슬롯 (값은 누적 DeltaTime)
+    const char* LuaTickDispatcherSource = R"(
+local pcall, tostring, clock = pcall, tostring, ...
+return function(groups, dueGroups, dueCount, times, errors)
+    for n = 1, dueCount do
+        local g = dueGroups[n]
+        local group = groups[g]
+        local funcs, deltas = group.funcs, group.deltas
+        local t0 = clock()
+        for i = 1, group.count do
+            local dt = deltas[i]
+            if dt then
+                deltas[i] = false
+                local ok, err = pcall(funcs[i], dt)
+                if not ok then
+                    errors[#errors + 1] = g
+                    errors[#errors + 1] = i
+                    errors[#errors + 1] = tostring(err)
+                end
+            end
+        end
+        times[n] = clock() - t0
+    end
+end
+)";
+}
+
+FLuaTickManager::FLuaTickManager(sol::state& InLua)
+    : Lua(InLua)
+{
+    GroupsTable = Lua.create_table();
+    DueGroupsTable = Lua.create_table();
+    TimesTable = Lua.create_table();
+    ErrorsTable = Lua.create_table();
+
+    sol::load_result Loader = Lua.load(LuaTickDispatcherSource, "=LuaTickDispatcher", sol::load_mode::text);
+    if (!Loader.valid())
+    {
+        sol::error Err = Loader;
+        UE_LOG("[Lua][error] Tick dispatcher: %s", Err.what());
+        return;
+    }
+
+    sol::protected_function Factory = Loader;
+    auto Clock = sol::make_object(Lua, []() { return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64()); });
+    sol::protected_function_result Result = Factory(Clock);
+    if (!Result.valid())
+    {
+        sol::error Err = Result;
+        UE_LOG("[Lua][error] Tick dispatcher: %s", Err.what());
+        return;
+    }
+    Dispatcher = Result;
+}
+
+FLuaTickManager::~FLuaTickManager()
+{
+    Shutdown();
+}
+
+int32 FLuaTickManager::FindOrAddGroup(const FString& ScriptPath)
+{
+    const FString Key = NormalizePath(ScriptPath);
+    if (int32* Found = GroupByPath.Find(Key))
+    {
+        return *Found;
+    }
+
+    const int32 GroupIndex = static_cast<int32>(Groups.Num());
+    FTickGroup& Group = Groups.emplace_back();
+    Group.Stats.ScriptPath = Key;
+    Group.ProfileKey = "Lua:" + std::filesystem::path(Key).filename().string();
+    Group.Funcs = Lua.create_table();
+    Group.Deltas = Lua.create_table();
+    Group.Table = Lua.create_table_with("funcs", Group.Funcs, "deltas", Group.Deltas, "count", 0);
+    GroupsTable.raw_set(GroupIndex + 1, Group.Table);
+
+    GroupByPath.Add(Key, GroupIndex);
+    return GroupIndex;
+}
+
+FLuaTickHandle FLuaTickManager::Register(const FString& ScriptPath, const sol::protected_function& TickFunc, float TickInterval, int32 TickEveryNFrames)
+{
+    if (!TickFunc.valid() || !Dispatcher.valid())
+    {
+        return {};
+    }
+
+    const int32 GroupIndex = FindOrAddGroup(ScriptPath);
+    FTickGroup& Group = Groups[GroupIndex];
+
+    int32 SlotIndex;
+    if (Group.FirstFree != -1)
+    {
+        SlotIndex = Group.FirstFree;
+        Group.FirstFree = Group.Slots[SlotIndex].NextFree;
+    }
+    else
+    {
+        SlotIndex = static_cast<int32>(Group.Slots.Num());
+        Group.Slots.Add(FTickSlot());
+        Group.Table.raw_set("count", SlotIndex + 1);
+    }
+
+    FTickSlot& Slot = Group.Slots[SlotIndex];
+    Slot = FTickSlot();
+    Slot.TickInterval = std::max(TickInterval, 0.0f);
+    Slot.TickEveryNFrames = std::max(TickEveryNFrames, 1);
+    Slot.bActive = true;
+
+    Group.Funcs.raw_set(SlotIndex + 1, TickFunc);
+    Group.Deltas.raw_set(SlotIndex + 1, false);
+    Group.Stats.NumInstances++;
+    Stats.RegisteredScripts++;
+
+    return FLuaTickHandle{ GroupIndex, SlotIndex };
+}
+
+void FLuaTickManager::Unregister(FLuaTickHandle& Handle)
+{
+    if (!Handle.IsValid() || Handle.Group >= Groups.Num())
+    {
+        Handle = FLuaTickHandle();
+        return;
+    }
+
+    FTickGroup& Group = Groups[Handle.Group];
+    FTickSlot& Slot = Group.Slots[Handle.Slot];
+    if (Slot.bActive)
+    {
+        // 함수 참조를 놓아 스크립트 환경이 수거될 수 있게 한다
+        Group.Funcs.raw_set(Handle.Slot + 1, false);
+        Group.Deltas.raw_set(Handle.Slot + 1, false);
+
+        // 대기 중인 틱을 빼지 않으면 같은 슬롯을 재사용한 새 스크립트가 PendingDelta 0으로 틱을 받는다
+        if (Slot.bQueued)
+        {
+            for (int32 Index = 0; Index < DueSlots.Num(); ++Index)
+            {
+                if (DueSlots[Index].Group == Handle.Group && DueSlots[Index].Slot == Handle.Slot)
+                {
+                    DueSlots.RemoveAt(Index);
+                    break;
+                }
+            }
+            Slot.bQueued = false;
+        }
+
+        Slot.bActive = false;
+        Slot.NextFree = Group.FirstFree;
+        Group.FirstFree = Handle.Slot;
+        Group.Stats.NumInstances--;
+        Stats.RegisteredScripts--;
+    }
+
+    Handle = FLuaTickHandle();
+}
+
+void FLuaTickManager::QueueTick(const FLuaTickHandle& Handle, float DeltaTime)
+{
+    if (!Handle.IsValid() || Handle.Group >= Groups.Num())
+    {
+        return;
+    }
+
+    FTickSlot& Slot = Groups[Handle.Group].Slots[Handle.Slot];
+    if (!Slot.bActive || Slot.bErrored)
+    {
+        return;
+    }
+
+    Slot.AccumulatedTime += DeltaTime;
+    Slot.AccumulatedFrames++;
+    if (Slot.AccumulatedFrames < Slot.TickEveryNFrames || Slot.AccumulatedTime < Slot.TickInterval)
+    {
+        return;
+    }
+
+    // 간격 동안 누적된 시간을 한 번에 전달
+    Slot.PendingDelta = Slot.AccumulatedTime;
+    Slot.AccumulatedTime = 0.0f;
+    Slot.AccumulatedFrames = 0;
+
+    if (!Slot.bQueued)
+    {
+        Slot.bQueued = true;
+        DueSlots.Add(Handle);
+    }
+}
+
+void FLuaTickManager::Dispatch()
+{
+    Stats.TicksThisFrame = 0;
+    Stats.DispatchedGroups = 0;
+    Stats.DispatchMS = 0.0;
+    for (FTickGroup& Group : Groups)
+    {
+        Group.Stats.TicksThisFrame = 0;
+        Group.Stats.TimeMS = 0.0;
+    }
+
+    if (DueSlots.IsEmpty() || !Dispatcher.valid())
+    {
+        DueSlots.Empty();
+        return;
+    }
+
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+
+    // 1) 대기 중인 슬롯의 DeltaTime을 Lua 테이블에 기록 (raw set만, 함수 호출 없음)
+    DueGroups.Empty();
+    for (const FLuaTickHandle& Handle : DueSlots)
+    {
+        FTickGroup& Group = Groups[Handle.Group];
+        FTickSlot& Slot = Group.Slots[Handle.Slot];
+        Slot.bQueued = false;
+        if (!Slot.bActive || Slot.bErrored)
+        {
+            continue;
+        }
+
+        Group.Deltas.raw_set(Handle.Slot + 1, Slot.PendingDelta);
+        Group.Stats.TicksThisFrame++;
+        if (!Group.bDue)
+        {
+            Group.bDue = true;
+            DueGroups.Add(Handle.Group);
+        }
+    }
+    DueSlots.Empty();
+
+    const int32 DueCount = static_cast<int32>(DueGroups.Num());
+    for (int32 Index = 0; Index < DueCount; ++Index)
+    {
+        DueGroupsTable.raw_set(Index + 1, DueGroups[Index] + 1);
+    }
+
+    // 2) 한 번의 protected call로 모든 스크립트 Tick 실행
+    sol::protected_function_result Result = Dispatcher(GroupsTable, DueGroupsTable, DueCount, TimesTable, ErrorsTable);
+    if (!Result.valid())
+    {
+        sol::error Err = Result;
+        UE_LOG("[Lua][error] Tick dispatcher: %s", Err.what());
+    }
+
+    // 3) 파일별 시간 수집 (디스패치 중 새로 등록된 그룹이 있어도 DueGroups 인덱스는 유효)
+    for (int32 Index = 0; Index < DueCount; ++Index)
+    {
+        FTickGroup& Group = Groups[DueGroups[Index]];
+        Group.bDue = false;
+        Group.Stats.TimeMS = TimesTable.raw_get_or(Index + 1, 0.0);
+        Group.Stats.PeakMS = std::max(Group.Stats.PeakMS, Group.Stats.TimeMS);
+        Stats.TicksThisFrame += Group.Stats.TicksThisFrame;
+        FScopeCycleCounter::AddTimeProfile(TStatId(Group.ProfileKey), Group.Stats.TimeMS);
+    }
+    Stats.DispatchedGroups = DueCount;
+
+    HandleErrors();
+
+    Stats.DispatchMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+}
+
+void FLuaTickManager::HandleErrors()
+{
+    const int32 NumValues = static_cast<int32>(ErrorsTable.size());
+    if (NumValues == 0)
+    {
+        return;
+    }
+
+    // { group, slot, message } 3개씩
+    for (int32 Index = 1; Index + 2 <= NumValues; Index += 3)
+    {
+        const int32 GroupIndex = ErrorsTable.raw_get_or(Index, 0) - 1;
+        const int32 SlotIndex = ErrorsTable.raw_get_or(Index + 1, 0) - 1;
+        const FString Message = ErrorsTable.raw_get_or(Index + 2, FString("unknown error"));
+        if (GroupIndex < 0 || GroupIndex >= Groups.Num())
+        {
+            continue;
+        }
+
+        FTickGroup& Group = Groups[GroupIndex];
+        UE_LOG("[Lua][error] Tick (%s): %s", Group.Stats.ScriptPath.c_str(), Message.c_str());
+        Group.Stats.Errors++;
+        Stats.TotalErrors++;
+
+        // 에러가 난 인스턴스만 틱을 멈춘다 (다른 인스턴스/스크립트는 계속 진행)
+        if (SlotIndex >= 0 && SlotIndex < Group.Slots.Num())
+        {
+            Group.Slots[SlotIndex].bErrored = true;
+        }
+    }
+
+    ErrorsTable = Lua.create_table();
+}
+
+void FLuaTickManager::Shutdown()
+{
+    Dispatcher = sol::nil;
+    GroupsTable = sol::nil;
+    DueGroupsTable = sol::nil;
+    TimesTable = sol::nil;
+    ErrorsTable = sol::nil;
+    Groups.Empty();
+    GroupByPath.clear();
+    DueSlots.Empty();
+    DueGroups.Empty();
+    Stats = FLuaTickStats();
+}
+
+void FLuaTickManager::GetScriptStats(TArray<FLuaScriptTickStats>& OutStats) const
+{
+    OutStats.Empty();
+    OutStats.Reserve(Groups.Num());
+    for (const FTickGroup& Group : Groups)
+    {
+        if (Group.Stats.NumInstances > 0)
+        {
+            OutStats.Add(Group.Stats);
+        }
+    }
+}
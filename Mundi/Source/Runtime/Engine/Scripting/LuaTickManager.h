@@ -0,0 +1,102 @@
+﻿#pragma once
+#include <sol/sol.hpp>
+
+struct FLuaTickHandle
+{
+    int32 Group = -1;   // 스크립트 파일 그룹
+    int32 Slot = -1;    // 그룹 내 슬롯
+    bool IsValid() const { return Group >= 0 && Slot >= 0; }
+};
+
+/** 스크립트 파일 단위 틱 통계 */
+struct FLuaScriptTickStats
+{
+    FString ScriptPath;
+    int32 NumInstances = 0;
+    int32 TicksThisFrame = 0;
+    double TimeMS = 0.0;            // 이번 프레임에 이 파일의 Tick들이 쓴 시간
+    double PeakMS = 0.0;
+    uint32 Errors = 0;
+};
+
+struct FLuaTickStats
+{
+    int32 RegisteredScripts = 0;
+    int32 TicksThisFrame = 0;
+    int32 DispatchedGroups = 0;
+    double DispatchMS = 0.0;        // C++ → Lua 디스패치 전체 (마샬링 포함)
+    uint64 TotalErrors = 0;
+};
+
+/**
+ * Lua 스크립트 틱 매니저
+ * - 컴포넌트의 TickComponent는 C++에서 "이번 프레임에 틱 필요"만 기록한다 (Lua 호출 없음).
+ * - FLuaManager::Tick에서 Lua 쪽 디스패처를 한 번만 protected call 하고, 디스패처가 스크립트 파일별로
+ *   Tick 함수를 pcall로 호출한다. 한 스크립트의 에러는 그 인스턴스만 비활성화한다.
+ * - 틱 간격 (N 프레임마다 / N 초마다)은 C++에서 누적해 처리하고, 누적된 DeltaTime을 전달한다.
+ * @note 엔진에 틱 그룹이 없으므로 디스패치는 월드 틱당 한 번 (액터 틱 이후)이다.
+ */
+class FLuaTickManager
+{
+public:
+    explicit FLuaTickManager(sol::state& InLua);
+    ~FLuaTickManager();
+
+    FLuaTickHandle Register(const FString& ScriptPath, const sol::protected_function& TickFunc, float TickInterval, int32 TickEveryNFrames);
+    void Unregister(FLuaTickHandle& Handle);
+
+    /** 컴포넌트 틱에서 호출. 간격이 차면 다음 Dispatch에서 누적 DeltaTime으로 호출된다. */
+    void QueueTick(const FLuaTickHandle& Handle, float DeltaTime);
+
+    /** 대기 중인 모든 스크립트 Tick을 한 번의 Lua 호출로 실행 */
+    void Dispatch();
+
+    /** Lua 상태 해제 전에 모든 참조를 놓는다 */
+    void Shutdown();
+
+    const FLuaTickStats& GetStats() const { return Stats; }
+    void GetScriptStats(TArray<FLuaScriptTickStats>& OutStats) const;
+
+private:
+    struct FTickSlot
+    {
+        float TickInterval = 0.0f;
+        int32 TickEveryNFrames = 1;
+        float AccumulatedTime = 0.0f;
+        int32 AccumulatedFrames = 0;
+        float PendingDelta = 0.0f;
+        bool bActive = false;
+        bool bQueued = false;       // 이번 프레임 DueSlots에 들어감
+        bool bErrored = false;      // 에러 이후 틱 중단
+        int32 NextFree = -1;
+    };
+
+    struct FTickGroup
+    {
+        FLuaScriptTickStats Stats;
+        FString ProfileKey;
+        sol::table Table;           // { funcs = {}, deltas = {}, count = N }
+        sol::table Funcs;
+        sol::table Deltas;
+        TArray<FTickSlot> Slots;
+        int32 FirstFree = -1;
+        bool bDue = false;
+    };
+
+    int32 FindOrAddGroup(const FString& ScriptPath);
+    void HandleErrors();
+
+    sol::state& Lua;
+    sol::protected_function Dispatcher;
+    sol::table GroupsTable;
+    sol::table DueGroupsTable;
+    sol::table TimesTable;
+    sol::table ErrorsTable;
+
+    TArray<FTickGroup> Groups;
+    TMap<FString, int32> GroupByPath;
+    TArray<FLuaTickHandle> DueSlots;
+    TArray<int32> DueGroups;
+
+    FLuaTickStats Stats;
+};
@@ -11,6 +11,7 @@
 #include "OBB.h"
 #include "Frustum.h"
 #include "Picking.h" // FRay
+#include "PlatformTime.h"
 
 #include "StaticMeshComponent.h"
 
@@ -45,6 +46,12 @@ namespace {
         outTMax = tmax;
         return true;
     }
+
+    inline bool IsSameBounds(const FAABB& A, const FAABB& B)
+    {
+        return A.Min.X == B.Min.X && A.Min.Y == B.Min.Y && A.Min.Z == B.Min.Z
+            && A.Max.X == B.Max.X && A.Max.Y == B.Max.Y && A.Max.Z == B.Max.Z;
+    }
 }
 
 FBVHierarchy::FBVHierarchy(const FAABB& InBounds, int InDepth, int InMaxDepth, int InMaxObjects)
@@ -63,18 +70,43 @@ FBVHierarchy::~FBVHierarchy()
 void FBVHierarchy::Clear()
 {
     // NOTE: TMap, TArray를 clear로 비우면 capacity가 그대로이기 때문에 새 객체로 초기화
-    StaticMeshComponentBounds = TMap<UPrimitiveComponent*, FAABB>();
+    StaticMeshComponentBounds = TFlatMap<UPrimitiveComponent*, FAABB>();
     StaticMeshComponentArray = TArray<UPrimitiveComponent*>();
+    StaticBoundsSoA = FAABBSoA();
     Nodes = TArray<FLBVHNode>();
     Bounds = FAABB();
     bPendingRebuild = false;
+
+    DynamicTree.Clear();
+    DynamicProxies = TMap<UPrimitiveComponent*, FDynamicProxy>();
+    PromotedStatics = TMap<UPrimitiveComponent*, uint32>();
+    Stats.StaticCount = 0;
+    Stats.DynamicCount = 0;
+    Stats.DynamicTreeHeight = 0;
 }
 
 void FBVHierarchy::BulkUpdate(const TArray<UPrimitiveComponent*>& Components)
 {
     for (const auto& SMC : Components)
     {
-        if (SMC)
+        if (!SMC)
+        {
+            continue;
+        }
+
+        if (SMC->IsMovable())
+        {
+            if (FDynamicProxy* Proxy = DynamicProxies.Find(SMC))
+            {
+                Proxy->Bounds = SMC->GetWorldAABB();
+                DynamicTree.MoveProxy(Proxy->ProxyId, Proxy->Bounds);
+            }
+            else
+            {
+                AddDynamic(SMC, SMC->GetWorldAABB());
+            }
+        }
+        else
         {
             StaticMeshComponentBounds.Add(SMC, SMC->GetWorldAABB());
         }
@@ -101,8 +133,58 @@ void FBVHierarchy::Update(UPrimitiveComponent* InComponent)
 
     const FAABB WorldBounds = InComponent->GetWorldAABB();
 
-    StaticMeshComponentBounds.Add(InComponent, WorldBounds);
-    bPendingRebuild = true;
+    // 이미 동적 트리에 있으면 여유 AABB를 벗어났을 때만 재삽입
+    if (FDynamicProxy* Proxy = DynamicProxies.Find(InComponent))
+    {
+        // 실제로 움직였을 때만 갱신 (움직이지 않은 중복 Update가 정적 트리 복귀를 계속 미루지 않도록)
+        if (uint32* LastMovedFlush = PromotedStatics.Find(InComponent))
+        {
+            if (!IsSameBounds(Proxy->Bounds, WorldBounds))
+            {
+                *LastMovedFlush = FlushCounter;
+            }
+        }
+        Proxy->Bounds = WorldBounds;
+        if (DynamicTree.MoveProxy(Proxy->ProxyId, WorldBounds))
+        {
+            ++Stats.DynamicReinsertCount;
+        }
+        else
+        {
+            ++Stats.DynamicFatHitCount;
+        }
+        Stats.DynamicRotationCount = DynamicTree.GetRotationCount();
+        Stats.DynamicTreeHeight = DynamicTree.GetHeight();
+        return;
+    }
+
+    const FAABB* StaticBounds = StaticMeshComponentBounds.Find(InComponent);
+
+    // Movable이거나, Static인데 등록 이후 움직였으면 정적 LBVH에서 빼서 동적 트리로 옮긴다 (전체 리빌드 반복 방지)
+    const bool bMovedStatic = StaticBounds && !IsSameBounds(*StaticBounds, WorldBounds);
+    if (InComponent->IsMovable() || bMovedStatic)
+    {
+        if (StaticBounds)
+        {
+            StaticMeshComponentBounds.Remove(InComponent);
+            bPendingRebuild = true;
+        }
+        if (bMovedStatic && !InComponent->IsMovable())
+        {
+            ++Stats.PromotedToDynamicCount;
+            PromotedStatics.Add(InComponent, FlushCounter);
+        }
+        AddDynamic(InComponent, WorldBounds);
+        return;
+    }
+
+    if (!StaticBounds)
+    {
+        // 제거 후 리빌드 전에 다시 등록되면 LBVH/StaticBoundsSoA에는 아직 이전 바운드 슬롯이 남아 있다.
+        // 리빌드 전까지는 동적 트리에 올려 실제 바운드로 질의되게 하고, 다음 FlushRebuild에서 바로 정적 LBVH로 옮긴다
+        AddDynamic(InComponent, WorldBounds);
+        PromotedStatics.Add(InComponent, FlushCounter - StaticDemoteDelay);
+    }
 }
 
 void FBVHierarchy::Remove(UPrimitiveComponent* InComponent)
@@ -117,74 +199,155 @@ void FBVHierarchy::Remove(UPrimitiveComponent* InComponent)
         StaticMeshComponentBounds.Remove(InComponent);
         bPendingRebuild = true;
     }
+
+    RemoveDynamic(InComponent);
 }
 
-void FBVHierarchy::QueryFrustum(const FFrustum& InFrustum)
+void FBVHierarchy::AddDynamic(UPrimitiveComponent* InComponent, const FAABB& InBounds)
 {
-    if (Nodes.empty()) return;
-    //프러스텀 외부에 바운드 존재
-    if (!IsAABBVisible(InFrustum, Nodes[0].Bounds)) return;
-    //프러스텀 내부에 바운드 존재 (교차 X)
-    if (!IsAABBIntersects(InFrustum, Nodes[0].Bounds))
+    FDynamicProxy Proxy;
+    Proxy.ProxyId = DynamicTree.CreateProxy(InBounds, InComponent);
+    Proxy.Bounds = InBounds;
+    DynamicProxies.Add(InComponent, Proxy);
+
+    ++Stats.DynamicInsertCount;
+    Stats.DynamicCount = DynamicTree.GetProxyCount();
+    Stats.DynamicTreeHeight = DynamicTree.GetHeight();
+    Stats.DynamicRotationCount = DynamicTree.GetRotationCount();
+}
+
+void FBVHierarchy::RemoveDynamic(UPrimitiveComponent* InComponent)
+{
+    const FDynamicProxy* Proxy = DynamicProxies.Find(InComponent);
+    if (!Proxy)
     {
-        for (UPrimitiveComponent* Component : StaticMeshComponentArray)
-        {
-            if (!Component) continue;
-            if (StaticMeshComponentBounds.find(Component) == StaticMeshComponentBounds.end())
-                continue;
-            if (AActor* Owner = Component->GetOwner())
-            {
-                Owner->SetCulled(false);
-            }
-        }
         return;
     }
-    //프러스텀과 바운드가 교차
-    TArray<int32> IdxStack;
-    IdxStack.push_back({ 0 });
+
+    DynamicTree.DestroyProxy(Proxy->ProxyId);
+    DynamicProxies.Remove(InComponent);
+    PromotedStatics.Remove(InComponent);
+
+    ++Stats.DynamicRemoveCount;
+    Stats.DynamicCount = DynamicTree.GetProxyCount();
+    Stats.DynamicTreeHeight = DynamicTree.GetHeight();
+    Stats.DynamicRotationCount = DynamicTree.GetRotationCount();
+}
+
+template<typename VisitorFunc>
+void FBVHierarchy::ForEachStaticInFrustum(const FFrustumSIMD& InFrustum, VisitorFunc Visitor) const
+{
+    if (Nodes.empty()) return;
+
+    //프러스텀 외부에 바운드 존재
+    uint8 RootInsideMask;
+    if (InFrustum.TestAABB(Nodes[0].Bounds, FRUSTUM_NO_PLANES_INSIDE, RootInsideMask) == EFrustumTestResult::Outside) return;
+
+    // (노드 인덱스, 완전히 안쪽인 평면 마스크) - 자손은 마스크에 켜진 평면을 검사하지 않는다
+    // 스택 깊이는 트리 깊이 수준이므로 인라인 배열로 충분
+    TInlineArray<std::pair<int32, uint8>, 64> IdxStack;
+    IdxStack.push_back({ 0, RootInsideMask });
 
     while (!IdxStack.empty())
     {
-        int32 Idx = IdxStack.back();
+        const auto [Idx, InsideMask] = IdxStack.back();
         IdxStack.pop_back();
-        const FLBVHNode& node = Nodes[Idx];
-        if (node.IsLeaf())
+        const FLBVHNode& Node = Nodes[Idx];
+        if (Node.IsLeaf())
         {
-            for (int32 i = 0; i < node.Count; ++i)
+            // 리프의 바운드는 SoA로 4개씩 검사 (리빌드 전에 제거된 컴포넌트는 맵에 없으므로 걸러낸다)
+            const int32 End = Node.First + Node.Count;
+            for (int32 Index = Node.First; Index < End; Index += 4)
             {
-                UPrimitiveComponent* Component = StaticMeshComponentArray[node.First + i];
-                if (!Component || StaticMeshComponentBounds.find(Component) == StaticMeshComponentBounds.end())
-                    continue;
-                const FAABB* Cached = StaticMeshComponentBounds.Find(Component);
-                const FAABB Box = Cached ? *Cached : Component->GetWorldAABB();
-                if (IsAABBVisible(InFrustum, Box))
+                int32 VisibleMask = 0xF;
+                if (InsideMask != FRUSTUM_ALL_PLANES_INSIDE)
                 {
-                    if (AActor* Owner = Component->GetOwner())
+                    __m128 CX, CY, CZ, EX, EY, EZ;
+                    StaticBoundsSoA.Load4(Index, CX, CY, CZ, EX, EY, EZ);
+                    int32 LeafInsideMask;
+                    InFrustum.TestAABB4(CX, CY, CZ, EX, EY, EZ, InsideMask, VisibleMask, LeafInsideMask);
+                }
+
+                const int32 NumLanes = std::min(4, End - Index);
+                for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+                {
+                    if (!(VisibleMask & (1 << Lane))) continue;
+                    UPrimitiveComponent* Component = StaticMeshComponentArray[Index + Lane];
+                    if (Component && StaticMeshComponentBounds.Contains(Component))
                     {
-                        Owner->SetCulled(false);
+                        Visitor(Component);
                     }
                 }
             }
             continue;
         }
-        if (node.Left >= 0 && IsAABBVisible(InFrustum, Nodes[node.Left].Bounds))
-            IdxStack.push_back({ node.Left });
-        if (node.Right >= 0 && IsAABBVisible(InFrustum, Nodes[node.Right].Bounds))
-            IdxStack.push_back({ node.Right });
+
+        for (int32 Child : { Node.Left, Node.Right })
+        {
+            if (Child < 0) continue;
+            uint8 ChildInsideMask;
+            if (InFrustum.TestAABB(Nodes[Child].Bounds, InsideMask, ChildInsideMask) != EFrustumTestResult::Outside)
+            {
+                IdxStack.push_back({ Child, ChildInsideMask });
+            }
+        }
     }
 }
 
+template<typename VisitorFunc>
+void FBVHierarchy::ForEachDynamicInFrustum(const FFrustumSIMD& InFrustum, VisitorFunc Visitor) const
+{
+    // 여유 AABB로 가지치기 후 실제 바운드 검사 (실제 바운드는 여유 AABB 안이므로 리프의 평면 마스크를 그대로 쓴다)
+    DynamicTree.TraverseWithState<uint8>(FRUSTUM_NO_PLANES_INSIDE,
+        [&](const FAABB& NodeBounds, uint8 ParentInsideMask, uint8& OutInsideMask)
+        {
+            return InFrustum.TestAABB(NodeBounds, ParentInsideMask, OutInsideMask) != EFrustumTestResult::Outside;
+        },
+        [&](int32 ProxyId, uint8 InsideMask)
+        {
+            UPrimitiveComponent* Component = DynamicTree.GetComponent(ProxyId);
+            const FDynamicProxy* Proxy = DynamicProxies.Find(Component);
+            uint8 ProxyInsideMask;
+            if (Proxy && InFrustum.TestAABB(Proxy->Bounds, InsideMask, ProxyInsideMask) != EFrustumTestResult::Outside)
+            {
+                Visitor(Component);
+            }
+        });
+}
+
+void FBVHierarchy::QueryFrustum(const FFrustum& InFrustum)
+{
+    // 평면 전치는 질의당 한 번
+    const FFrustumSIMD Frustum(InFrustum);
+    const auto MarkVisible = [](UPrimitiveComponent* Component)
+        {
+            if (AActor* Owner = Component->GetOwner())
+            {
+                Owner->SetCulled(false);
+            }
+        };
+
+    ForEachDynamicInFrustum(Frustum, MarkVisible);
+    ForEachStaticInFrustum(Frustum, MarkVisible);
+}
+
+void FBVHierarchy::QueryFrustumComponents(const FFrustum& InFrustum, TArray<UPrimitiveComponent*>& OutComponents) const
+{
+    const FFrustumSIMD Frustum(InFrustum);
+    const auto AddComponent = [&OutComponents](UPrimitiveComponent* Component) { OutComponents.Add(Component); };
+
+    ForEachDynamicInFrustum(Frustum, AddComponent);
+    ForEachStaticInFrustum(Frustum, AddComponent);
+}
+
 void FBVHierarchy::DebugDraw(URenderer* Renderer) const
 {
     if (!Renderer) return;
-    if (Nodes.empty()) return;
 
-    for (size_t i = 0; i < Nodes.size(); ++i)
+    auto DrawBox = [Renderer](const FAABB& Box, const FVector4& LineColor)
     {
-        const FLBVHNode& N = Nodes[i];
-        const FVector Min = N.Bounds.Min;
-        const FVector Max = N.Bounds.Max;
-        const FVector4 LineColor(1.0f, N.IsLeaf() ? 0.2f : 0.8f, 0.0f, 1.0f);
+        const FVector Min = Box.Min;
+        const FVector Max = Box.Max;
 
         TArray<FVector> Start;
         TArray<FVector> End;
@@ -215,7 +378,19 @@ void FBVHierarchy::DebugDraw(URenderer* Renderer) const
         Start.Add(v3); End.Add(v7); Color.Add(LineColor);
 
         Renderer->AddLines(Start, End, Color);
+    };
+
+    // 정적 LBVH: 주황/빨강, 동적 트리: 하늘색 계열
+    for (size_t i = 0; i < Nodes.size(); ++i)
+    {
+        const FLBVHNode& N = Nodes[i];
+        DrawBox(N.Bounds, FVector4(1.0f, N.IsLeaf() ? 0.2f : 0.8f, 0.0f, 1.0f));
     }
+
+    DynamicTree.ForEachNode([&](const FAABB& NodeBounds, bool bLeaf)
+        {
+            DrawBox(NodeBounds, FVector4(0.0f, bLeaf ? 0.6f : 0.9f, 1.0f, 1.0f));
+        });
 }
 
 int FBVHierarchy::TotalNodeCount() const
@@ -225,12 +400,13 @@ int FBVHierarchy::TotalNodeCount() const
 
 int FBVHierarchy::TotalActorCount() const
 {
-    return static_cast<int>(StaticMeshComponentArray.size());
+    return static_cast<int>(StaticMeshComponentArray.size()) + DynamicTree.GetProxyCount();
 }
 
 int FBVHierarchy::MaxOccupiedDepth() const
 {
-    return (Nodes.empty()) ? 0 : (int)std::ceil(std::log2((double)Nodes.size() + 1));
+    const int StaticDepth = (Nodes.empty()) ? 0 : (int)std::ceil(std::log2((double)Nodes.size() + 1));
+    return std::max(StaticDepth, DynamicTree.GetHeight() + 1);
 }
 
 void FBVHierarchy::DebugDump() const
@@ -271,9 +447,15 @@ namespace
 
 void FBVHierarchy::BuildLBVH()
 {
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+
     StaticMeshComponentArray = StaticMeshComponentBounds.GetKeys();
     const int N = StaticMeshComponentArray.Num();
     Nodes = TArray<FLBVHNode>();
+    StaticBoundsSoA.Reset(N);
+
+    ++Stats.StaticRebuildCount;
+    Stats.StaticCount = N;
 
     if (N == 0)
     {
@@ -349,11 +531,15 @@ void FBVHierarchy::BuildLBVH()
     for (int i = 0; i < N; ++i)
     {
         StaticMeshComponentArray[i] = ComponentCodePairs[i].first;
+        const FAABB* Bound = StaticMeshComponentBounds.Find(StaticMeshComponentArray[i]);
+        StaticBoundsSoA.Add(Bound ? *Bound : StaticMeshComponentArray[i]->GetWorldAABB());
     }
 
     Nodes.reserve(std::max(1, 2 * N));
     Nodes.clear();
     BuildRange(0, N);
+
+    Stats.LastStaticRebuildMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
 }
 
 int FBVHierarchy::BuildRange(int s, int e)
@@ -410,6 +596,47 @@ void FBVHierarchy::QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float
         OutBestT = std::numeric_limits<float>::infinity();
     }
 
+    // 동적 트리에서 찾은 거리가 정적 LBVH 탐색의 상한이 된다
+    QueryRayClosestDynamic(Ray, OutActor, OutBestT);
+    QueryRayClosestStatic(Ray, OutActor, OutBestT);
+}
+
+void FBVHierarchy::QueryRayClosestDynamic(const FRay& Ray, AActor*& OutActor, OUT float& OutBestT) const
+{
+    const float Epsilon = 1e-3f;
+    DynamicTree.Traverse(
+        [&](const FAABB& NodeBounds)
+        {
+            float tmin, tmax;
+            if (!RayAABB_IntersectT(Ray, NodeBounds, tmin, tmax))
+                return false;
+            return !OutActor || tmin <= OutBestT + Epsilon;
+        },
+        [&](int32 ProxyId)
+        {
+            UPrimitiveComponent* Component = DynamicTree.GetComponent(ProxyId);
+            const FDynamicProxy* Proxy = DynamicProxies.Find(Component);
+            if (!Proxy) return;
+            AActor* Owner = Component->GetOwner();
+            if (!Owner || Owner->GetActorHiddenInEditor()) return;
+
+            float tmin, tmax;
+            if (!RayAABB_IntersectT(Ray, Proxy->Bounds, tmin, tmax))
+                return;
+            if (OutActor && tmin > OutBestT + Epsilon)
+                return;
+
+            float hitDistance;
+            if (CPickingSystem::CheckActorPicking(Owner, Ray, hitDistance) && hitDistance < OutBestT)
+            {
+                OutBestT = hitDistance;
+                OutActor = Owner;
+            }
+        });
+}
+
+void FBVHierarchy::QueryRayClosestStatic(const FRay& Ray, AActor*& OutActor, OUT float& OutBestT) const
+{
     if (Nodes.empty()) return;
 
     float tminRoot, tmaxRoot;
@@ -442,12 +669,16 @@ void FBVHierarchy::QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float
             {
                 UPrimitiveComponent* Component = StaticMeshComponentArray[node.First + i];
                 if (!Component) continue;
+
+                // 리빌드 전에 제거된 컴포넌트는 이미 파괴됐을 수 있으므로 맵에 있는 것만 접근한다
+                const FAABB* Cached = StaticMeshComponentBounds.Find(Component);
+                if (!Cached) continue;
+
                 AActor* Owner = Component->GetOwner();
                 if (!Owner) continue;
                 if (Owner->GetActorHiddenInEditor()) continue;
 
-                const FAABB* Cached = StaticMeshComponentBounds.Find(Component);
-                const FAABB Box = Cached ? *Cached : Component->GetWorldAABB();
+                const FAABB& Box = *Cached;
 
                 float tmin, tmax;
                 if (!RayAABB_IntersectT(Ray, Box, tmin, tmax))
@@ -494,8 +725,44 @@ void FBVHierarchy::QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float
     }
 }
 
+bool FBVHierarchy::DemoteSettledStatics()
+{
+    TArray<UPrimitiveComponent*> Settled;
+    for (const auto& Pair : PromotedStatics)
+    {
+        if (FlushCounter - Pair.second >= StaticDemoteDelay)
+        {
+            Settled.Add(Pair.first);
+        }
+    }
+
+    for (UPrimitiveComponent* Component : Settled)
+    {
+        const FDynamicProxy* Proxy = DynamicProxies.Find(Component);
+        if (!Proxy || Component->IsMovable())
+        {
+            // 그 사이 Movable로 바뀌었으면 동적 트리에 그대로 둔다
+            PromotedStatics.Remove(Component);
+            continue;
+        }
+
+        const FAABB SettledBounds = Proxy->Bounds;
+        RemoveDynamic(Component);
+        StaticMeshComponentBounds.Add(Component, SettledBounds);
+        ++Stats.DemotedToStaticCount;
+    }
+
+    return Settled.Num() > 0;
+}
+
 void FBVHierarchy::FlushRebuild()
 {
+    ++FlushCounter;
+    if (!PromotedStatics.IsEmpty() && DemoteSettledStatics())
+    {
+        bPendingRebuild = true;
+    }
+
     if (bPendingRebuild)
     {
         BuildLBVH();
@@ -504,15 +771,31 @@ void FBVHierarchy::FlushRebuild()
 }
 
 template<typename BoundType, typename NodeIntersectFunc, typename ComponentIntersectFunc>
-TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponentsGeneric(
+void FBVHierarchy::QueryIntersectedComponentsGeneric(
     const BoundType& InBound,
     NodeIntersectFunc NodeIntersects,
-    ComponentIntersectFunc ComponentIntersects) const
+    ComponentIntersectFunc ComponentIntersects,
+    TArray<UPrimitiveComponent*>& OutComponents) const
 {
-    TSet<UPrimitiveComponent*> IntersectedComponents;
+    // 정적/동적 집합은 서로 겹치지 않고 각 집합 안의 컴포넌트는 유일하므로 중복 제거용 TSet 없이 바로 담는다
+    OutComponents.Empty();
+
+    // 동적 트리: 여유 AABB로 가지치기, 실제 바운드로 최종 판정
+    DynamicTree.Traverse(
+        [&](const FAABB& NodeBounds) { return NodeIntersects(NodeBounds, InBound); },
+        [&](int32 ProxyId)
+        {
+            UPrimitiveComponent* Component = DynamicTree.GetComponent(ProxyId);
+            const FDynamicProxy* Proxy = DynamicProxies.Find(Component);
+            if (Proxy && ComponentIntersects(Proxy->Bounds, InBound))
+            {
+                OutComponents.Add(Component);
+            }
+        });
+
     if (Nodes.empty())
-        return TArray<UPrimitiveComponent*>();
-    TArray<int32> IdxStack;
+        return;
+    TInlineArray<int32, 64> IdxStack;
     IdxStack.push_back({ 0 });
 
     while (!IdxStack.empty())
@@ -527,13 +810,10 @@ TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponentsGeneric(
                 for (int32 i = 0; i < Node.Count; ++i)
                 {
                     UPrimitiveComponent* Component = StaticMeshComponentArray[Node.First + i];
-                    if (!Component || StaticMeshComponentBounds.find(Component) == StaticMeshComponentBounds.end())
-                        continue;
-                    const FAABB* Cached = StaticMeshComponentBounds.Find(Component);
-                    const FAABB Box = Cached ? *Cached : Component->GetWorldAABB();
-                    if (ComponentIntersects(Box, InBound))
+                    const FAABB* Cached = Component ? StaticMeshComponentBounds.Find(Component) : nullptr;
+                    if (Cached && ComponentIntersects(*Cached, InBound))
                     {
-                        IntersectedComponents.insert(Component);
+                        OutComponents.Add(Component);
                     }
                 }
             }
@@ -544,35 +824,48 @@ TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponentsGeneric(
             }
         }
     }
-    return IntersectedComponents.Array();
 }
 
 // FAABB 오버로드
 TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponents(const FAABB& InBound) const
 {
-    return QueryIntersectedComponentsGeneric(
+    TArray<UPrimitiveComponent*> Result;
+    QueryIntersectedComponents(InBound, Result);
+    return Result;
+}
+
+void FBVHierarchy::QueryIntersectedComponents(const FAABB& InBound, TArray<UPrimitiveComponent*>& OutComponents) const
+{
+    QueryIntersectedComponentsGeneric(
         InBound,
         [](const FAABB& nodeBound, const FAABB& inBound) { return nodeBound.Intersects(inBound); },
-        [](const FAABB& compBound, const FAABB& inBound) { return inBound.Intersects(compBound); }
+        [](const FAABB& compBound, const FAABB& inBound) { return inBound.Intersects(compBound); },
+        OutComponents
     );
 }
 
 // FOBB 오버로드
 TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponents(const FOBB& InBound) const
 {
-    return QueryIntersectedComponentsGeneric(
+    TArray<UPrimitiveComponent*> Result;
+    QueryIntersectedComponentsGeneric(
         InBound,
         [](const FAABB& nodeBound, const FOBB& inBound) { return Collision::Intersects(nodeBound, inBound); },
-        [](const FAABB& compBound, const FOBB& inBound) { return Collision::Intersects(compBound, inBound); }
+        [](const FAABB& compBound, const FOBB& inBound) { return Collision::Intersects(compBound, inBound); },
+        Result
     );
+    return Result;
 }
 
 // FBoundingSphere 오버로드
 TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponents(const FBoundingSphere& InBound) const
 {
-    return QueryIntersectedComponentsGeneric(
+    TArray<UPrimitiveComponent*> Result;
+    QueryIntersectedComponentsGeneric(
         InBound,
         [](const FAABB& nodeBound, const FBoundingSphere& inBound) { return Collision::Intersects(nodeBound, inBound); },
-        [](const FAABB& compBound, const FBoundingSphere& inBound) { return Collision::Intersects(compBound, inBound); }
+        [](const FAABB& compBound, const FBoundingSphere& inBound) { return Collision::Intersects(compBound, inBound); },
+        Result
     );
+    return Result;
 }
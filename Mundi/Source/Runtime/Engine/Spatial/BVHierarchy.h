@@ -1,4 +1,6 @@
 ﻿#pragma once
+#include "DynamicAABBTree.h"
+#include "Frustum.h"
 
 struct FFrustum;
 struct FRay; // forward declaration for ray type
@@ -7,8 +9,30 @@ class AActor;
 struct FOBB;
 struct FBoundingSphere;
 
+/** 정적/동적 가속 구조 통계 */
+struct FBVHStats
+{
+    int32 StaticCount = 0;              // 정적 LBVH에 들어간 컴포넌트
+    int32 DynamicCount = 0;             // 동적 트리에 들어간 컴포넌트
+    int32 DynamicTreeHeight = 0;
+
+    uint64 StaticRebuildCount = 0;      // 정적 LBVH 전체 리빌드 횟수 (누적)
+    double LastStaticRebuildMS = 0.0;
+
+    uint64 DynamicInsertCount = 0;      // 동적 트리 신규 삽입
+    uint64 DynamicRemoveCount = 0;
+    uint64 DynamicReinsertCount = 0;    // 여유 AABB를 벗어나 다시 삽입한 이동
+    uint64 DynamicFatHitCount = 0;      // 여유 AABB 안에서 끝나 트리를 건드리지 않은 이동
+    uint64 DynamicRotationCount = 0;    // 균형 회전 (누적)
+    uint64 PromotedToDynamicCount = 0;  // Static인데 움직여서 동적 트리로 옮긴 컴포넌트
+    uint64 DemotedToStaticCount = 0;    // 움직임이 멈춰 다시 정적 LBVH로 돌려보낸 컴포넌트
+};
+
 /**
  * @brief Broad phase BVH based on UPrimitiveComponent
+ *
+ * 정적 컴포넌트는 Morton 정렬 LBVH에 한 번에 빌드하고, Movable 컴포넌트는 동적 AABB 트리에서 증분 갱신한다.
+ * 모든 질의는 두 구조를 함께 순회하므로 호출하는 쪽은 구분할 필요가 없다.
  */
 class FBVHierarchy
 {
@@ -34,9 +58,14 @@ public:
 
     void QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float& OutBestT) const;
     void QueryFrustum(const FFrustum& InFrustum);
+    // 절두체와 겹치는 컴포넌트 수집 (섀도우 뷰 캐스터 컬링 등, 액터 컬링 플래그는 건드리지 않음)
+    void QueryFrustumComponents(const FFrustum& InFrustum, TArray<UPrimitiveComponent*>& OutComponents) const;
+    bool Contains(UPrimitiveComponent* InComponent) const { return StaticMeshComponentBounds.Contains(InComponent) || DynamicProxies.Contains(InComponent); }
     TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FAABB& InBound) const;
     TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FOBB& InBound) const;
     TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FBoundingSphere& InBound) const;
+    // 결과 배열을 재사용하는 버전 (OutComponents는 비우고 채움, 파티클 충돌처럼 한 프레임에 여러 번 질의하는 곳용)
+    void QueryIntersectedComponents(const FAABB& InBound, TArray<UPrimitiveComponent*>& OutComponents) const;
 
     void DebugDraw(URenderer* Renderer) const;
 
@@ -46,6 +75,7 @@ public:
     int MaxOccupiedDepth() const;
     void DebugDump() const;
     const FAABB& GetBounds() const { return Bounds; }
+    const FBVHStats& GetStats() const { return Stats; }
 
     // 프러스텀 기준으로 오클루더(내부노드 AABB) / 오클루디(리프의 액터들) 수집
     // VP는 행벡터 기준(네 컨벤션): p' = p * VP
@@ -63,11 +93,32 @@ private:
     };
     void BuildLBVH();
 
+    // === Dynamic tree ===
+    struct FDynamicProxy
+    {
+        int32 ProxyId = FDynamicAABBTree::NullNode;
+        FAABB Bounds;   // 실제 바운드 (트리는 여유 AABB를 가짐)
+    };
+    void AddDynamic(UPrimitiveComponent* InComponent, const FAABB& InBounds);
+
+    // 절두체와 겹치는 컴포넌트마다 Visitor(UPrimitiveComponent*) 호출 (완전히 안쪽인 평면은 자손에서 검사 생략)
+    template<typename VisitorFunc>
+    void ForEachStaticInFrustum(const FFrustumSIMD& InFrustum, VisitorFunc Visitor) const;
+    template<typename VisitorFunc>
+    void ForEachDynamicInFrustum(const FFrustumSIMD& InFrustum, VisitorFunc Visitor) const;
+
+    void RemoveDynamic(UPrimitiveComponent* InComponent);
+    // 한동안 움직이지 않은 승격 컴포넌트를 정적 LBVH로 되돌린다 (리빌드가 필요하면 true)
+    bool DemoteSettledStatics();
+    void QueryRayClosestStatic(const FRay& Ray, AActor*& OutActor, OUT float& OutBestT) const;
+    void QueryRayClosestDynamic(const FRay& Ray, AActor*& OutActor, OUT float& OutBestT) const;
+
 private:
     template<typename BoundType, typename NodeIntersectFunc, typename ComponentIntersectFunc>
-    TArray<UPrimitiveComponent*> QueryIntersectedComponentsGeneric(const BoundType& InBound
+    void QueryIntersectedComponentsGeneric(const BoundType& InBound
         , NodeIntersectFunc NodeIntersects
-        , ComponentIntersectFunc ComponentIntersects) const;
+        , ComponentIntersectFunc ComponentIntersects
+        , TArray<UPrimitiveComponent*>& OutComponents) const;
 
     int BuildRange(int s, int e);
 
@@ -76,11 +127,24 @@ private:
     int MaxObjects;
     FAABB Bounds;
 
-    TMap<UPrimitiveComponent*, FAABB> StaticMeshComponentBounds;
+    TFlatMap<UPrimitiveComponent*, FAABB> StaticMeshComponentBounds;   // 오픈 어드레싱 (조회 빈도가 높음)
     TArray<UPrimitiveComponent*> StaticMeshComponentArray;
+    FAABBSoA StaticBoundsSoA;   // StaticMeshComponentArray와 같은 순서의 바운드 (리프를 4개씩 컬링)
 
     // LBVH nodes
     TArray<FLBVHNode> Nodes;
 
     bool bPendingRebuild = false;
+
+    // Movable 컴포넌트
+    FDynamicAABBTree DynamicTree;
+    TMap<UPrimitiveComponent*, FDynamicProxy> DynamicProxies;
+
+    // 동적 트리에 임시로 올라간 Static 컴포넌트 -> 마지막으로 움직인 FlushRebuild 호출 번호
+    TMap<UPrimitiveComponent*, uint32> PromotedStatics;
+    uint32 FlushCounter = 0;
+    // 이만큼의 FlushRebuild 동안 움직이지 않으면 정적 LBVH로 되돌린다 (에디터 드래그 중 리빌드 반복 방지)
+    static constexpr uint32 StaticDemoteDelay = 30;
+
+    FBVHStats Stats;
 };
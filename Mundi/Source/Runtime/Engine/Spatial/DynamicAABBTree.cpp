@@ -0,0 +1,317 @@
+﻿#include "pch.h"
+#include "DynamicAABBTree.h"
+
+namespace
+{
+    // 삽입 비용 계산용 표면적 (SAH)
+    inline float SurfaceArea(const FAABB& Box)
+    {
+        const FVector D = Box.Max - Box.Min;
+        return 2.0f * (D.X * D.Y + D.Y * D.Z + D.Z * D.X);
+    }
+}
+
+FDynamicAABBTree::FDynamicAABBTree(float InMargin)
+    : Margin(InMargin)
+{
+}
+
+void FDynamicAABBTree::Clear()
+{
+    Nodes = TArray<FTreeNode>();
+    Root = NullNode;
+    FreeList = NullNode;
+    NodeCount = 0;
+    ProxyCount = 0;
+}
+
+int32 FDynamicAABBTree::AllocateNode()
+{
+    if (FreeList == NullNode)
+    {
+        Nodes.push_back(FTreeNode{});
+        FreeList = static_cast<int32>(Nodes.size()) - 1;
+        Nodes[FreeList].Parent = NullNode;
+    }
+
+    const int32 NodeId = FreeList;
+    FreeList = Nodes[NodeId].Parent;
+
+    FTreeNode& Node = Nodes[NodeId];
+    Node = FTreeNode{};
+    Node.Height = 0;
+    ++NodeCount;
+    return NodeId;
+}
+
+void FDynamicAABBTree::FreeNode(int32 NodeId)
+{
+    FTreeNode& Node = Nodes[NodeId];
+    Node.Parent = FreeList;
+    Node.Component = nullptr;
+    Node.Height = -1;
+    FreeList = NodeId;
+    --NodeCount;
+}
+
+FAABB FDynamicAABBTree::Fatten(const FAABB& InBounds) const
+{
+    const FVector Extension(Margin, Margin, Margin);
+    return FAABB(InBounds.Min - Extension, InBounds.Max + Extension);
+}
+
+int32 FDynamicAABBTree::CreateProxy(const FAABB& InBounds, UPrimitiveComponent* InComponent)
+{
+    const int32 ProxyId = AllocateNode();
+    Nodes[ProxyId].Bounds = Fatten(InBounds);
+    Nodes[ProxyId].Component = InComponent;
+
+    InsertLeaf(ProxyId);
+    ++ProxyCount;
+    return ProxyId;
+}
+
+void FDynamicAABBTree::DestroyProxy(int32 ProxyId)
+{
+    if (ProxyId < 0 || ProxyId >= static_cast<int32>(Nodes.size()) || !Nodes[ProxyId].IsLeaf() || Nodes[ProxyId].Height < 0)
+    {
+        return;
+    }
+
+    RemoveLeaf(ProxyId);
+    FreeNode(ProxyId);
+    --ProxyCount;
+}
+
+bool FDynamicAABBTree::MoveProxy(int32 ProxyId, const FAABB& InBounds)
+{
+    // 여유 AABB 안에서 움직이면 트리 구조는 그대로
+    if (Nodes[ProxyId].Bounds.Contains(InBounds))
+    {
+        return false;
+    }
+
+    RemoveLeaf(ProxyId);
+    Nodes[ProxyId].Bounds = Fatten(InBounds);
+    InsertLeaf(ProxyId);
+    return true;
+}
+
+void FDynamicAABBTree::InsertLeaf(int32 Leaf)
+{
+    if (Root == NullNode)
+    {
+        Root = Leaf;
+        Nodes[Root].Parent = NullNode;
+        return;
+    }
+
+    // 1. 면적 비용이 가장 작은 형제 찾기 (분기 한정 하강)
+    const FAABB LeafBounds = Nodes[Leaf].Bounds;
+    int32 Index = Root;
+    while (!Nodes[Index].IsLeaf())
+    {
+        const FTreeNode& Node = Nodes[Index];
+        const float Area = SurfaceArea(Node.Bounds);
+        const float CombinedArea = SurfaceArea(FAABB::Union(Node.Bounds, LeafBounds));
+
+        // 이 노드의 형제로 새 부모를 만드는 비용
+        const float Cost = 2.0f * CombinedArea;
+        // 더 내려갈 때 조상들이 늘어나는 비용
+        const float InheritanceCost = 2.0f * (CombinedArea - Area);
+
+        auto ChildCost = [&](int32 Child)
+            {
+                const FTreeNode& ChildNode = Nodes[Child];
+                const float NewArea = SurfaceArea(FAABB::Union(ChildNode.Bounds, LeafBounds));
+                if (ChildNode.IsLeaf())
+                {
+                    return NewArea + InheritanceCost;
+                }
+                return (NewArea - SurfaceArea(ChildNode.Bounds)) + InheritanceCost;
+            };
+
+        const float Cost1 = ChildCost(Node.Child1);
+        const float Cost2 = ChildCost(Node.Child2);
+
+        if (Cost < Cost1 && Cost < Cost2)
+        {
+            break;
+        }
+
+        Index = (Cost1 < Cost2) ? Node.Child1 : Node.Child2;
+    }
+
+    const int32 Sibling = Index;
+
+    // 2. 새 부모 노드 생성
+    const int32 OldParent = Nodes[Sibling].Parent;
+    const int32 NewParent = AllocateNode();
+    Nodes[NewParent].Parent = OldParent;
+    Nodes[NewParent].Bounds = FAABB::Union(LeafBounds, Nodes[Sibling].Bounds);
+    Nodes[NewParent].Height = Nodes[Sibling].Height + 1;
+    Nodes[NewParent].Child1 = Sibling;
+    Nodes[NewParent].Child2 = Leaf;
+    Nodes[Sibling].Parent = NewParent;
+    Nodes[Leaf].Parent = NewParent;
+
+    if (OldParent != NullNode)
+    {
+        if (Nodes[OldParent].Child1 == Sibling)
+        {
+            Nodes[OldParent].Child1 = NewParent;
+        }
+        else
+        {
+            Nodes[OldParent].Child2 = NewParent;
+        }
+    }
+    else
+    {
+        Root = NewParent;
+    }
+
+    // 3. 루트까지 올라가며 균형과 바운드 갱신
+    Index = Nodes[Leaf].Parent;
+    while (Index != NullNode)
+    {
+        Index = Balance(Index);
+
+        const int32 Child1 = Nodes[Index].Child1;
+        const int32 Child2 = Nodes[Index].Child2;
+        Nodes[Index].Height = 1 + std::max(Nodes[Child1].Height, Nodes[Child2].Height);
+        Nodes[Index].Bounds = FAABB::Union(Nodes[Child1].Bounds, Nodes[Child2].Bounds);
+
+        Index = Nodes[Index].Parent;
+    }
+}
+
+void FDynamicAABBTree::RemoveLeaf(int32 Leaf)
+{
+    if (Leaf == Root)
+    {
+        Root = NullNode;
+        return;
+    }
+
+    const int32 Parent = Nodes[Leaf].Parent;
+    const int32 GrandParent = Nodes[Parent].Parent;
+    const int32 Sibling = (Nodes[Parent].Child1 == Leaf) ? Nodes[Parent].Child2 : Nodes[Parent].Child1;
+
+    if (GrandParent != NullNode)
+    {
+        // 부모를 지우고 형제를 조부모에 연결
+        if (Nodes[GrandParent].Child1 == Parent)
+        {
+            Nodes[GrandParent].Child1 = Sibling;
+        }
+        else
+        {
+            Nodes[GrandParent].Child2 = Sibling;
+        }
+        Nodes[Sibling].Parent = GrandParent;
+        FreeNode(Parent);
+
+        int32 Index = GrandParent;
+        while (Index != NullNode)
+        {
+            Index = Balance(Index);
+
+            const int32 Child1 = Nodes[Index].Child1;
+            const int32 Child2 = Nodes[Index].Child2;
+            Nodes[Index].Bounds = FAABB::Union(Nodes[Child1].Bounds, Nodes[Child2].Bounds);
+            Nodes[Index].Height = 1 + std::max(Nodes[Child1].Height, Nodes[Child2].Height);
+
+            Index = Nodes[Index].Parent;
+        }
+    }
+    else
+    {
+        Root = Sibling;
+        Nodes[Sibling].Parent = NullNode;
+        FreeNode(Parent);
+    }
+}
+
+int32 FDynamicAABBTree::Balance(int32 IndexA)
+{
+    FTreeNode& A = Nodes[IndexA];
+    if (A.IsLeaf() || A.Height < 2)
+    {
+        return IndexA;
+    }
+
+    const int32 IndexB = A.Child1;
+    const int32 IndexC = A.Child2;
+    FTreeNode& B = Nodes[IndexB];
+    FTreeNode& C = Nodes[IndexC];
+
+    const int32 HeightDiff = C.Height - B.Height;
+
+    // 한쪽이 2 이상 깊으면 깊은 자식을 위로 올린다
+    auto Rotate = [&](int32 IndexUp, int32 IndexOther) -> int32
+        {
+            FTreeNode& Up = Nodes[IndexUp];
+            const int32 IndexF = Up.Child1;
+            const int32 IndexG = Up.Child2;
+            FTreeNode& F = Nodes[IndexF];
+            FTreeNode& G = Nodes[IndexG];
+
+            // Up을 A 자리로
+            Up.Child1 = IndexA;
+            Up.Parent = A.Parent;
+            A.Parent = IndexUp;
+
+            if (Up.Parent != NullNode)
+            {
+                if (Nodes[Up.Parent].Child1 == IndexA)
+                {
+                    Nodes[Up.Parent].Child1 = IndexUp;
+                }
+                else
+                {
+                    Nodes[Up.Parent].Child2 = IndexUp;
+                }
+            }
+            else
+            {
+                Root = IndexUp;
+            }
+
+            // 더 높은 손자는 Up에 남기고, 낮은 손자를 A로 내린다
+            const bool bKeepF = F.Height > G.Height;
+            const int32 IndexKeep = bKeepF ? IndexF : IndexG;
+            const int32 IndexMove = bKeepF ? IndexG : IndexF;
+
+            Up.Child2 = IndexKeep;
+            if (A.Child1 == IndexUp)
+            {
+                A.Child1 = IndexMove;
+            }
+            else
+            {
+                A.Child2 = IndexMove;
+            }
+            Nodes[IndexMove].Parent = IndexA;
+
+            A.Bounds = FAABB::Union(Nodes[IndexOther].Bounds, Nodes[IndexMove].Bounds);
+            Up.Bounds = FAABB::Union(A.Bounds, Nodes[IndexKeep].Bounds);
+
+            A.Height = 1 + std::max(Nodes[IndexOther].Height, Nodes[IndexMove].Height);
+            Up.Height = 1 + std::max(A.Height, Nodes[IndexKeep].Height);
+
+            ++RotationCount;
+            return IndexUp;
+        };
+
+    if (HeightDiff > 1)
+    {
+        return Rotate(IndexC, IndexB);
+    }
+    if (HeightDiff < -1)
+    {
+        return Rotate(IndexB, IndexC);
+    }
+
+    return IndexA;
+}
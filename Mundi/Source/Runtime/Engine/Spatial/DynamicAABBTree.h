@@ -0,0 +1,161 @@
+﻿#pragma once
+#include "AABB.h"
+
+class UPrimitiveComponent;
+
+/**
+ * @brief 움직이는 컴포넌트용 동적 AABB 트리
+ *
+ * 리프는 실제 바운드보다 여유(Margin)만큼 키운 AABB를 저장한다.
+ * 실제 바운드가 여유 AABB를 벗어날 때만 리프를 빼고 다시 넣으므로, 조금씩 움직이는 컴포넌트는 트리를 건드리지 않는다.
+ * 삽입은 면적 비용이 가장 작은 형제를 찾아 붙이고, 경로를 따라 회전으로 높이를 맞춘다. (전체 리빌드 없음)
+ */
+class FDynamicAABBTree
+{
+public:
+    static constexpr int32 NullNode = -1;
+
+    explicit FDynamicAABBTree(float InMargin = 0.2f);
+
+    void Clear();
+
+    /** 리프 생성 후 프록시 ID 반환 */
+    int32 CreateProxy(const FAABB& InBounds, UPrimitiveComponent* InComponent);
+
+    void DestroyProxy(int32 ProxyId);
+
+    /**
+     * 프록시 바운드 갱신
+     * @return 여유 AABB를 벗어나 다시 삽입했으면 true (트리 안에 머물렀으면 false)
+     */
+    bool MoveProxy(int32 ProxyId, const FAABB& InBounds);
+
+    const FAABB& GetFatBounds(int32 ProxyId) const { return Nodes[ProxyId].Bounds; }
+    UPrimitiveComponent* GetComponent(int32 ProxyId) const { return Nodes[ProxyId].Component; }
+
+    bool IsEmpty() const { return Root == NullNode; }
+    int32 GetRoot() const { return Root; }
+    int32 GetHeight() const { return Root == NullNode ? 0 : Nodes[Root].Height; }
+    int32 GetProxyCount() const { return ProxyCount; }
+    int32 GetNodeCount() const { return NodeCount; }
+
+    /** 삽입/제거 시 높이 균형을 맞추기 위해 수행한 회전 수 (누적) */
+    uint64 GetRotationCount() const { return RotationCount; }
+
+    /**
+     * 노드 단위 순회. NodeVisitor(const FAABB&)가 false면 서브트리를 건너뛴다.
+     * 리프에 도달하면 LeafVisitor(ProxyId)를 호출한다.
+     */
+    template<typename NodeVisitorFunc, typename LeafVisitorFunc>
+    void Traverse(NodeVisitorFunc NodeVisitor, LeafVisitorFunc LeafVisitor) const
+    {
+        if (Root == NullNode) return;
+
+        TArray<int32> Stack;
+        Stack.reserve(64);
+        Stack.push_back(Root);
+        while (!Stack.empty())
+        {
+            const int32 NodeId = Stack.back();
+            Stack.pop_back();
+
+            const FTreeNode& Node = Nodes[NodeId];
+            if (!NodeVisitor(Node.Bounds))
+            {
+                continue;
+            }
+
+            if (Node.IsLeaf())
+            {
+                LeafVisitor(NodeId);
+            }
+            else
+            {
+                Stack.push_back(Node.Child1);
+                Stack.push_back(Node.Child2);
+            }
+        }
+    }
+
+    /**
+     * 부모에서 자식으로 상태(예: 절두체 평면 마스크)를 넘기며 순회한다.
+     * NodeVisitor(const FAABB&, StateType ParentState, StateType& OutState)가 false면 서브트리를 건너뛰고,
+     * 리프에 도달하면 LeafVisitor(ProxyId, StateType)를 호출한다.
+     */
+    template<typename StateType, typename NodeVisitorFunc, typename LeafVisitorFunc>
+    void TraverseWithState(StateType RootState, NodeVisitorFunc NodeVisitor, LeafVisitorFunc LeafVisitor) const
+    {
+        if (Root == NullNode) return;
+
+        TArray<std::pair<int32, StateType>> Stack;
+        Stack.reserve(64);
+        Stack.push_back({ Root, RootState });
+        while (!Stack.empty())
+        {
+            const auto [NodeId, ParentState] = Stack.back();
+            Stack.pop_back();
+
+            const FTreeNode& Node = Nodes[NodeId];
+            StateType NodeState = ParentState;
+            if (!NodeVisitor(Node.Bounds, ParentState, NodeState))
+            {
+                continue;
+            }
+
+            if (Node.IsLeaf())
+            {
+                LeafVisitor(NodeId, NodeState);
+            }
+            else
+            {
+                Stack.push_back({ Node.Child1, NodeState });
+                Stack.push_back({ Node.Child2, NodeState });
+            }
+        }
+    }
+
+    /** 디버그 드로우용 노드 순회 (리프 여부 포함) */
+    template<typename VisitorFunc>
+    void ForEachNode(VisitorFunc Visitor) const
+    {
+        for (int32 i = 0; i < static_cast<int32>(Nodes.size()); ++i)
+        {
+            if (Nodes[i].Height >= 0)
+            {
+                Visitor(Nodes[i].Bounds, Nodes[i].IsLeaf());
+            }
+        }
+    }
+
+private:
+    struct FTreeNode
+    {
+        FAABB Bounds;
+        UPrimitiveComponent* Component = nullptr;
+        int32 Parent = NullNode;        // 프리 리스트에서는 다음 빈 노드
+        int32 Child1 = NullNode;
+        int32 Child2 = NullNode;
+        int32 Height = -1;              // 리프 0, 빈 노드 -1
+
+        bool IsLeaf() const { return Child1 == NullNode; }
+    };
+
+    int32 AllocateNode();
+    void FreeNode(int32 NodeId);
+
+    void InsertLeaf(int32 Leaf);
+    void RemoveLeaf(int32 Leaf);
+
+    /** A를 루트로 하는 서브트리를 회전해 높이 차를 1 이하로 맞추고 새 서브트리 루트를 반환 */
+    int32 Balance(int32 A);
+
+    FAABB Fatten(const FAABB& InBounds) const;
+
+    TArray<FTreeNode> Nodes;
+    int32 Root = NullNode;
+    int32 FreeList = NullNode;
+    int32 NodeCount = 0;
+    int32 ProxyCount = 0;
+    float Margin;
+    uint64 RotationCount = 0;
+};
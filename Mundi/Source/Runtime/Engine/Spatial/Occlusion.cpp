@@ -1,228 +1,801 @@
 ﻿#include "pch.h"
 #include "Occlusion.h"
-#include "Frustum.h"
+#include "OcclusionStats.h"
+#include "StaticMesh.h"
+#include "StaticMeshComponent.h"
+#include "PlatformTime.h"
+#include <immintrin.h>
+#include <cfloat>
+
+namespace
+{
+	// 근평면 클리핑 후에도 w가 이보다 작으면 투영하지 않는다
+	constexpr float MinClipW = 1e-5f;
+
+	// 후보 판정 작업 하나가 맡을 AABB 수
+	constexpr int32 CandidatesPerJob = 128;
+
+	inline FVector4 TransformToClip(const FVector& P, const FMatrix& M)
+	{
+		// 행벡터: (x, y, z, 1) * M
+		__m128 R = _mm_mul_ps(_mm_set1_ps(P.X), M.Rows[0]);
+		R = _mm_add_ps(R, _mm_mul_ps(_mm_set1_ps(P.Y), M.Rows[1]));
+		R = _mm_add_ps(R, _mm_mul_ps(_mm_set1_ps(P.Z), M.Rows[2]));
+		R = _mm_add_ps(R, M.Rows[3]);
+		FVector4 Out;
+		Out.SimdData = R;
+		return Out;
+	}
+
+	inline FVector4 LerpClip(const FVector4& A, const FVector4& B, float T)
+	{
+		return FVector4(A.X + (B.X - A.X) * T, A.Y + (B.Y - A.Y) * T, A.Z + (B.Z - A.Z) * T, A.W + (B.W - A.W) * T);
+	}
+
+	/**
+	 * 격자 정점 클러스터링으로 삼각형 수를 줄인다.
+	 * 클러스터 정점은 원래 정점들의 평균이라 원본 AABB 밖으로 나가지 않는다.
+	 */
+	void SimplifyByClustering(const FStaticMesh& Source, int32 GridResolution, FOccluderMesh& Out)
+	{
+		FVector Min(FLT_MAX, FLT_MAX, FLT_MAX);
+		FVector Max(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		for (const FNormalVertex& Vertex : Source.Vertices)
+		{
+			Min = FVector(std::min(Min.X, Vertex.pos.X), std::min(Min.Y, Vertex.pos.Y), std::min(Min.Z, Vertex.pos.Z));
+			Max = FVector(std::max(Max.X, Vertex.pos.X), std::max(Max.Y, Vertex.pos.Y), std::max(Max.Z, Vertex.pos.Z));
+		}
+
+		const FVector Size = Max - Min;
+		const float Res = static_cast<float>(GridResolution);
+		auto CellCoord = [&](float Value, float MinValue, float Extent)
+			{
+				if (Extent <= KINDA_SMALL_NUMBER) return 0;
+				return std::clamp(static_cast<int32>((Value - MinValue) / Extent * Res), 0, GridResolution - 1);
+			};
+
+		// 원본 정점 → 클러스터 → 새 정점
+		TArray<int32> CellToVertex;
+		CellToVertex.SetNum(GridResolution * GridResolution * GridResolution, -1);
+		TArray<int32> Remap;
+		Remap.SetNum(Source.Vertices.Num());
+		TArray<FVector> Sums;
+		TArray<int32> Counts;
+
+		for (int32 i = 0; i < Source.Vertices.Num(); ++i)
+		{
+			const FVector& P = Source.Vertices[i].pos;
+			const int32 Cell = (CellCoord(P.Z, Min.Z, Size.Z) * GridResolution + CellCoord(P.Y, Min.Y, Size.Y)) * GridResolution + CellCoord(P.X, Min.X, Size.X);
+			if (CellToVertex[Cell] < 0)
+			{
+				CellToVertex[Cell] = Sums.Num();
+				Sums.Add(FVector(0.0f, 0.0f, 0.0f));
+				Counts.Add(0);
+			}
+			const int32 NewIndex = CellToVertex[Cell];
+			Sums[NewIndex] = Sums[NewIndex] + P;
+			++Counts[NewIndex];
+			Remap[i] = NewIndex;
+		}
+
+		Out.Positions.SetNum(Sums.Num());
+		for (int32 i = 0; i < Sums.Num(); ++i)
+		{
+			Out.Positions[i] = Sums[i] * (1.0f / static_cast<float>(Counts[i]));
+		}
+
+		// 한 클러스터로 뭉친 삼각형은 버린다
+		Out.Indices.Empty();
+		for (int32 i = 0; i + 2 < Source.Indices.Num(); i += 3)
+		{
+			const int32 I0 = Remap[Source.Indices[i]];
+			const int32 I1 = Remap[Source.Indices[i + 1]];
+			const int32 I2 = Remap[Source.Indices[i + 2]];
+			if (I0 == I1 || I1 == I2 || I0 == I2) continue;
+			Out.Indices.Add(I0);
+			Out.Indices.Add(I1);
+			Out.Indices.Add(I2);
+		}
+		Out.bSimplified = true;
+	}
+}
+
+// ------------------------------------------------------------
+// FOcclusionDepthBuffer
+// ------------------------------------------------------------
+
+void FOcclusionDepthBuffer::Initialize(int32 InWidth, int32 InHeight)
+{
+	// 타일 단위로 맞춘다
+	const int32 NewTilesX = std::max(1, (InWidth + TileSize - 1) / TileSize);
+	const int32 NewTilesY = std::max(1, (InHeight + TileSize - 1) / TileSize);
+	if (NewTilesX == TilesX && NewTilesY == TilesY)
+	{
+		return;
+	}
 
-// NDC Z가 [-1..1]인 프로젝션이면 아래 변환을 켜세요.
-// static inline float To01(float z_ndc) { return z_ndc * 0.5f + 0.5f; }
-static inline void Clamp01(float& v) { v = std::max(0.0f, std::min(1.0f, v)); }
+	TilesX = NewTilesX;
+	TilesY = NewTilesY;
+	Width = TilesX * TileSize;
+	Height = TilesY * TileSize;
+	Depth.SetNum(TilesX * TilesY * TilePixels);
 
-// 헬퍼: 뷰공간 Z → [0..1] 선형
-static inline float LinearizeZ01(float zView, float zNear, float zFar) {
-	// LH 기준, 카메라 앞 z가 + 방향일 때
-	float z = (zView - zNear) / (zFar - zNear);
-	return std::max(0.f, std::min(1.f, z));
+	HZBLevels.Empty();
+	int32 LevelW = TilesX, LevelH = TilesY;
+	while (true)
+	{
+		TArray<float> Level;
+		Level.SetNum(LevelW * LevelH);
+		HZBLevels.Add(std::move(Level));
+		if (LevelW == 1 && LevelH == 1) break;
+		LevelW = std::max(1, (LevelW + 1) / 2);
+		LevelH = std::max(1, (LevelH + 1) / 2);
+	}
 }
 
-// FBound(Min/Max) → 8코너
-static inline void MakeAabbCornersMinMax(const FAABB& B, FVector Corners[8])
+void FOcclusionDepthBuffer::Clear()
 {
-	const FVector& mn = B.Min;
-	const FVector& mx = B.Max;
-	Corners[0] = { mn.X, mn.Y, mn.Z };
-	Corners[1] = { mx.X, mn.Y, mn.Z };
-	Corners[2] = { mn.X, mx.Y, mn.Z };
-	Corners[3] = { mx.X, mx.Y, mn.Z };
-	Corners[4] = { mn.X, mn.Y, mx.Z };
-	Corners[5] = { mx.X, mn.Y, mx.Z };
-	Corners[6] = { mn.X, mx.Y, mx.Z };
-	Corners[7] = { mx.X, mx.Y, mx.Z };
+	std::fill(Depth.begin(), Depth.end(), 1.0f);
 }
 
-bool FOcclusionCullingManagerCPU::ComputeRectAndMinZ(
-	const FCandidateDrawable& D, int /*ViewW*/, int /*ViewH*/, FOcclusionRect& OutR)
+void FOcclusionDepthBuffer::RasterizeTriangle(const FOcclusionTriangle& Tri, int32 BinIndex)
 {
-	FVector C[8];
-	MakeAabbCornersMinMax(D.Bound, C);
+	const int32 MinY = std::max(Tri.MinY, BinIndex * TileSize);
+	const int32 MaxY = std::min(Tri.MaxY, BinIndex * TileSize + TileSize - 1);
+	if (MinY > MaxY)
+	{
+		return;
+	}
 
-	float MinX = +1e9f, MinY = +1e9f, MaxX = -1e9f, MaxY = -1e9f;
-	float MinZLin = +1e9f, MaxZLin = -1e9f; // ★ 선형 깊이(0..1)
+	const __m128 LaneOffset = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+	const __m128 Zero = _mm_setzero_ps();
+	const __m128 A0 = _mm_set1_ps(Tri.EdgeA[0]), A1 = _mm_set1_ps(Tri.EdgeA[1]), A2 = _mm_set1_ps(Tri.EdgeA[2]);
+	const __m128 ZA = _mm_set1_ps(Tri.ZA);
+	const __m128 ZMax = _mm_set1_ps(Tri.ZMax);
+
+	const int32 TileX0 = Tri.MinX >> TileShift;
+	const int32 TileX1 = Tri.MaxX >> TileShift;
+
+	for (int32 Y = MinY; Y <= MaxY; ++Y)
+	{
+		const float PY = static_cast<float>(Y) + 0.5f;
+		// 행마다 y 항을 상수에 미리 더해 둔다
+		const __m128 C0 = _mm_set1_ps(Tri.EdgeB[0] * PY + Tri.EdgeC[0]);
+		const __m128 C1 = _mm_set1_ps(Tri.EdgeB[1] * PY + Tri.EdgeC[1]);
+		const __m128 C2 = _mm_set1_ps(Tri.EdgeB[2] * PY + Tri.EdgeC[2]);
+		const __m128 ZC = _mm_set1_ps(Tri.ZB * PY + Tri.ZC);
+		const int32 LocalRow = (Y & (TileSize - 1)) * TileSize;
+
+		for (int32 TileX = TileX0; TileX <= TileX1; ++TileX)
+		{
+			float* Row = GetTile(TileX, BinIndex) + LocalRow;
+			for (int32 Half = 0; Half < TileSize; Half += 4)
+			{
+				const int32 X = TileX * TileSize + Half;
+				if (X + 3 < Tri.MinX || X > Tri.MaxX) continue;
+
+				const __m128 PX = _mm_add_ps(_mm_set1_ps(static_cast<float>(X)), LaneOffset);
+				const __m128 E0 = _mm_add_ps(_mm_mul_ps(A0, PX), C0);
+				const __m128 E1 = _mm_add_ps(_mm_mul_ps(A1, PX), C1);
+				const __m128 E2 = _mm_add_ps(_mm_mul_ps(A2, PX), C2);
+				const __m128 Inside = _mm_and_ps(_mm_and_ps(_mm_cmpgt_ps(E0, Zero), _mm_cmpgt_ps(E1, Zero)), _mm_cmpgt_ps(E2, Zero));
+				if (_mm_movemask_ps(Inside) == 0) continue;
+
+				const __m128 Z = _mm_min_ps(_mm_add_ps(_mm_mul_ps(ZA, PX), ZC), ZMax);
+				const __m128 Old = _mm_loadu_ps(Row + Half);
+				const __m128 New = _mm_min_ps(Old, Z);
+				_mm_storeu_ps(Row + Half, _mm_or_ps(_mm_and_ps(Inside, New), _mm_andnot_ps(Inside, Old)));
+			}
+		}
+	}
+}
+
+void FOcclusionDepthBuffer::UpdateTileMax(int32 BinIndex)
+{
+	TArray<float>& TileMax = HZBLevels[0];
+	for (int32 TileX = 0; TileX < TilesX; ++TileX)
+	{
+		const float* Tile = GetTile(TileX, BinIndex);
+		__m128 Max = _mm_loadu_ps(Tile);
+		for (int32 i = 4; i < TilePixels; i += 4)
+		{
+			Max = _mm_max_ps(Max, _mm_loadu_ps(Tile + i));
+		}
+		Max = _mm_max_ps(Max, _mm_shuffle_ps(Max, Max, _MM_SHUFFLE(2, 3, 0, 1)));
+		Max = _mm_max_ps(Max, _mm_shuffle_ps(Max, Max, _MM_SHUFFLE(1, 0, 3, 2)));
+		_mm_store_ss(&TileMax[BinIndex * TilesX + TileX], Max);
+	}
+}
+
+void FOcclusionDepthBuffer::BuildHZB()
+{
+	int32 SrcW = TilesX, SrcH = TilesY;
+	for (int32 Level = 1; Level < HZBLevels.Num(); ++Level)
+	{
+		const TArray<float>& Src = HZBLevels[Level - 1];
+		TArray<float>& Dst = HZBLevels[Level];
+		const int32 DstW = std::max(1, (SrcW + 1) / 2);
+		const int32 DstH = std::max(1, (SrcH + 1) / 2);
+		for (int32 Y = 0; Y < DstH; ++Y)
+		{
+			const int32 Y0 = Y * 2, Y1 = std::min(Y * 2 + 1, SrcH - 1);
+			for (int32 X = 0; X < DstW; ++X)
+			{
+				const int32 X0 = X * 2, X1 = std::min(X * 2 + 1, SrcW - 1);
+				Dst[Y * DstW + X] = std::max(std::max(Src[Y0 * SrcW + X0], Src[Y0 * SrcW + X1]), std::max(Src[Y1 * SrcW + X0], Src[Y1 * SrcW + X1]));
+			}
+		}
+		SrcW = DstW;
+		SrcH = DstH;
+	}
+}
 
-	int used = 0;
-	for (int i = 0; i < 8; i++)
+bool FOcclusionDepthBuffer::IsRectOccluded(int32 X0, int32 Y0, int32 X1, int32 Y1, float MinZ) const
+{
+	// 1) 사각형이 2x2 텍셀 이하로 들어가는 가장 거친 레벨에서 한 번에 판정
+	const int32 TileX0 = X0 >> TileShift, TileY0 = Y0 >> TileShift;
+	const int32 TileX1 = X1 >> TileShift, TileY1 = Y1 >> TileShift;
+	int32 Level = 0;
+	while (Level + 1 < HZBLevels.Num() && (((TileX1 >> Level) - (TileX0 >> Level)) > 1 || ((TileY1 >> Level) - (TileY0 >> Level)) > 1))
 	{
-		const float p[4] = { C[i].X, C[i].Y, C[i].Z, 1.0f };
+		++Level;
+	}
+	{
+		const TArray<float>& L = HZBLevels[Level];
+		const int32 LevelW = std::max(1, (TilesX + (1 << Level) - 1) >> Level);
+		bool bAllCloser = true;
+		for (int32 Y = TileY0 >> Level; Y <= (TileY1 >> Level) && bAllCloser; ++Y)
+		{
+			for (int32 X = TileX0 >> Level; X <= (TileX1 >> Level); ++X)
+			{
+				if (!(L[Y * LevelW + X] < MinZ)) { bAllCloser = false; break; }
+			}
+		}
+		if (bAllCloser)
+		{
+			return true;
+		}
+	}
 
-		// 1) 화면 사각형용: WVP → NDC
-		float c[4];
-		MulPointRow(p, D.WorldViewProj, c);
-		if (c[3] <= 0.0f) continue;
+	// 2) 타일 단위로 내려가서, 타일 최대 깊이로 가려지지 않는 타일만 픽셀을 확인
+	const TArray<float>& TileMax = HZBLevels[0];
+	const __m128 MinZ4 = _mm_set1_ps(MinZ);
+	const __m128i LaneIndex = _mm_setr_epi32(0, 1, 2, 3);
+	for (int32 TileY = TileY0; TileY <= TileY1; ++TileY)
+	{
+		for (int32 TileX = TileX0; TileX <= TileX1; ++TileX)
+		{
+			if (TileMax[TileY * TilesX + TileX] < MinZ) continue;
+
+			const float* Tile = GetTile(TileX, TileY);
+			const int32 RowY0 = std::max(Y0, TileY * TileSize), RowY1 = std::min(Y1, TileY * TileSize + TileSize - 1);
+			const int32 ColX0 = std::max(X0, TileX * TileSize), ColX1 = std::min(X1, TileX * TileSize + TileSize - 1);
+			for (int32 Y = RowY0; Y <= RowY1; ++Y)
+			{
+				const float* Row = Tile + (Y & (TileSize - 1)) * TileSize;
+				for (int32 Half = 0; Half < TileSize; Half += 4)
+				{
+					const int32 X = TileX * TileSize + Half;
+					if (X + 3 < ColX0 || X > ColX1) continue;
+
+					// 사각형 안 픽셀 중 하나라도 MinZ 이상이면(덮이지 않았거나 더 멀면) 보임
+					const __m128i PX = _mm_add_epi32(_mm_set1_epi32(X), LaneIndex);
+					const __m128i InRange = _mm_andnot_si128(
+						_mm_or_si128(_mm_cmplt_epi32(PX, _mm_set1_epi32(ColX0)), _mm_cmpgt_epi32(PX, _mm_set1_epi32(ColX1))),
+						_mm_set1_epi32(-1));
+					const __m128 NotCloser = _mm_cmpnlt_ps(_mm_loadu_ps(Row + Half), MinZ4);
+					if (_mm_movemask_ps(_mm_and_ps(NotCloser, _mm_castsi128_ps(InRange))) != 0)
+					{
+						return false;
+					}
+				}
+			}
+		}
+	}
+	return true;
+}
 
-		const float invW = 1.0f / c[3];
-		const float ndcX = c[0] * invW;  // -1..1
-		const float ndcY = c[1] * invW;  // -1..1
-		// const float ndcZ = c[2] * invW; // 깊이는 쓰지 않음
+// ------------------------------------------------------------
+// FOcclusionCullingManagerCPU
+// ------------------------------------------------------------
 
-		const float u = 0.5f * (ndcX + 1.0f);
-		const float v = 0.5f * (ndcY + 1.0f);
+FOcclusionCullingManagerCPU::~FOcclusionCullingManagerCPU()
+{
+	StopWorkers();
+}
 
-		MinX = std::min(MinX, u); MinY = std::min(MinY, v);
-		MaxX = std::max(MaxX, u); MaxY = std::max(MaxY, v);
+void FOcclusionCullingManagerCPU::Shutdown()
+{
+	StopWorkers();
+	bShutdown = true;
+	OccluderMeshes.Empty();
+	OccluderJobs.Empty();
+}
 
-		// 2) 깊이: WorldView로 뷰 공간 z → 선형 0..1
-		float v4[4];
-		MulPointRow(p, D.WorldView, v4);     // p_world * (World*View) == p_world * View (월드좌표니까 View만 와도 OK)
-		const float zView = v4[2];          // LH: +Z 앞
-		const float zLin01 = LinearizeZ01(zView, D.NearClip, D.FarClip);
+void FOcclusionCullingManagerCPU::SetOccluderTriangleBudget(int32 InBudget)
+{
+	InBudget = std::max(16, InBudget);
+	if (InBudget != OccluderTriangleBudget)
+	{
+		OccluderTriangleBudget = InBudget;
+		OccluderMeshes.Empty();
+	}
+}
 
-		MinZLin = std::min(MinZLin, zLin01);
-		MaxZLin = std::max(MaxZLin, zLin01);
+const FOccluderMesh* FOcclusionCullingManagerCPU::GetOccluderMesh(const UStaticMesh* InMesh)
+{
+	const FStaticMesh* Asset = InMesh ? InMesh->GetStaticMeshAsset() : nullptr;
+	if (!Asset || Asset->Indices.Num() < 3)
+	{
+		return nullptr;
+	}
 
-		used++;
+	if (const FOccluderMesh* Cached = OccluderMeshes.Find(InMesh))
+	{
+		if (Cached->SourceAsset == Asset && Cached->SourceTriangleCount == static_cast<uint32>(Asset->Indices.Num() / 3))
+		{
+			return Cached->GetTriangleCount() > 0 ? Cached : nullptr;
+		}
 	}
 
-	if (used == 0) return false;
-	if (MaxX < 0 || MaxY < 0 || MinX > 1 || MinY > 1) return false;
+	FOccluderMesh Mesh;
+	Mesh.SourceAsset = Asset;
+	Mesh.SourceTriangleCount = static_cast<uint32>(Asset->Indices.Num() / 3);
 
-	Clamp01(MinX); Clamp01(MinY); Clamp01(MaxX); Clamp01(MaxY);
-	Clamp01(MinZLin); Clamp01(MaxZLin);
+	if (static_cast<int32>(Mesh.SourceTriangleCount) <= OccluderTriangleBudget)
+	{
+		Mesh.Positions.SetNum(Asset->Vertices.Num());
+		for (int32 i = 0; i < Asset->Vertices.Num(); ++i)
+		{
+			Mesh.Positions[i] = Asset->Vertices[i].pos;
+		}
+		Mesh.Indices = Asset->Indices;
+	}
+	else
+	{
+		// 예산에 들어갈 때까지 격자를 거칠게 한다. 그래도 넘으면 오클루더로 쓰지 않는다
+		for (int32 GridResolution : { 32, 16, 8, 4 })
+		{
+			SimplifyByClustering(*Asset, GridResolution, Mesh);
+			if (Mesh.GetTriangleCount() <= OccluderTriangleBudget) break;
+		}
+		if (Mesh.GetTriangleCount() > OccluderTriangleBudget)
+		{
+			Mesh.Positions.Empty();
+			Mesh.Indices.Empty();
+		}
+	}
 
-	OutR.MinX = MinX; OutR.MinY = MinY; OutR.MaxX = MaxX; OutR.MaxY = MaxY;
-	OutR.MinZ = MinZLin;   // ★ 선형 깊이
-	OutR.MaxZ = MaxZLin;
-	OutR.ActorIndex = D.ActorIndex;
-	return true;
+	// 노드 기반 맵이라 다른 메시를 추가해도 이번 프레임 작업의 포인터는 유효하다
+	FOccluderMesh& Result = OccluderMeshes[InMesh];
+	Result = std::move(Mesh);
+	return Result.GetTriangleCount() > 0 ? &Result : nullptr;
 }
-void FOcclusionCullingManagerCPU::BuildOccluderDepth(
-	const TArray<FCandidateDrawable>& Occluders, int ViewW, int ViewH)
+
+void FOcclusionCullingManagerCPU::EmitTriangle(FOccluderJob& Job, const FVector4& P0, const FVector4& P1, const FVector4& P2) const
 {
-	Grid.Clear();
+	const float W = static_cast<float>(DepthBuffer.GetWidth());
+	const float H = static_cast<float>(DepthBuffer.GetHeight());
 
-	const int GW = Grid.GetWidth();
-	const int GH = Grid.GetHeight();
+	// 클립 → 화면 픽셀 좌표 (y는 아래로), 깊이는 NDC z
+	float SX[3], SY[3], SZ[3];
+	const FVector4* Clip[3] = { &P0, &P1, &P2 };
+	for (int32 i = 0; i < 3; ++i)
+	{
+		const float InvW = 1.0f / Clip[i]->W;
+		SX[i] = (Clip[i]->X * InvW * 0.5f + 0.5f) * W;
+		SY[i] = (0.5f - Clip[i]->Y * InvW * 0.5f) * H;
+		SZ[i] = Clip[i]->Z * InvW;
+	}
 
-	// --- 튜닝 파라미터 ---
-	const float ErodeScale = 0.5f;     // 0.5배 축소
-	const int   Dilate = 1;        // 경계 1px 팽창
-	const int   MinPxEdge = 8;        // 너무 작은 사각형은 erosion 스킵
-	const float MaxCover = 0.6f;     // 화면의 60% 이상 덮으면 erosion 스킵
+	const float MinSX = std::min({ SX[0], SX[1], SX[2] }), MaxSX = std::max({ SX[0], SX[1], SX[2] });
+	const float MinSY = std::min({ SY[0], SY[1], SY[2] }), MaxSY = std::max({ SY[0], SY[1], SY[2] });
+	if (MaxSX < 0.0f || MaxSY < 0.0f || MinSX > W || MinSY > H)
+	{
+		return;
+	}
 
-	for (const auto& D : Occluders)
+	float Area = (SX[1] - SX[0]) * (SY[2] - SY[0]) - (SX[2] - SX[0]) * (SY[1] - SY[0]);
+	if (std::abs(Area) < 1e-6f)
 	{
-		FOcclusionRect R;
-		if (!ComputeRectAndMinZ(D, ViewW, ViewH, R))
-			continue;
+		return;
+	}
+	// 양면 모두 오클루더로 쓴다 (감김 방향을 맞춰 엣지 함수의 안쪽을 양수로)
+	if (Area < 0.0f)
+	{
+		std::swap(SX[1], SX[2]);
+		std::swap(SY[1], SY[2]);
+		std::swap(SZ[1], SZ[2]);
+		Area = -Area;
+	}
+
+	FOcclusionTriangle Tri;
+	for (int32 i = 0; i < 3; ++i)
+	{
+		const int32 A = i, B = (i + 1) % 3;
+		Tri.EdgeA[i] = -(SY[B] - SY[A]);
+		Tri.EdgeB[i] = SX[B] - SX[A];
+		Tri.EdgeC[i] = -(Tri.EdgeA[i] * SX[A] + Tri.EdgeB[i] * SY[A]);
+	}
 
-		int minPX = (int)std::floor(R.MinX * GW);
-		int minPY = (int)std::floor(R.MinY * GH);
-		int maxPX = (int)std::ceil(R.MaxX * GW) - 1;
-		int maxPY = (int)std::ceil(R.MaxY * GH) - 1;
+	const float InvArea = 1.0f / Area;
+	Tri.ZA = ((SZ[1] - SZ[0]) * (SY[2] - SY[0]) - (SZ[2] - SZ[0]) * (SY[1] - SY[0])) * InvArea;
+	Tri.ZB = ((SZ[2] - SZ[0]) * (SX[1] - SX[0]) - (SZ[1] - SZ[0]) * (SX[2] - SX[0])) * InvArea;
+	// 픽셀 중심 대신 픽셀 안에서 가장 먼 깊이를 쓴다 (오클루더는 멀게 잡아야 보수적)
+	Tri.ZC = SZ[0] - Tri.ZA * SX[0] - Tri.ZB * SY[0] + 0.5f * (std::abs(Tri.ZA) + std::abs(Tri.ZB));
+	Tri.ZMax = std::max({ SZ[0], SZ[1], SZ[2] });
+
+	const int32 PixelW = DepthBuffer.GetWidth(), PixelH = DepthBuffer.GetHeight();
+	Tri.MinX = std::clamp(static_cast<int32>(std::floor(MinSX)), 0, PixelW - 1);
+	Tri.MaxX = std::clamp(static_cast<int32>(std::ceil(MaxSX)), 0, PixelW - 1);
+	Tri.MinY = std::clamp(static_cast<int32>(std::floor(MinSY)), 0, PixelH - 1);
+	Tri.MaxY = std::clamp(static_cast<int32>(std::ceil(MaxSY)), 0, PixelH - 1);
+
+	const int32 TriIndex = Job.Triangles.Num();
+	Job.Triangles.Add(Tri);
+	for (int32 Bin = Tri.MinY >> FOcclusionDepthBuffer::TileShift; Bin <= (Tri.MaxY >> FOcclusionDepthBuffer::TileShift); ++Bin)
+	{
+		Job.BinTriangles[Bin].Add(TriIndex);
+	}
+}
 
-		// --- 화면 사각형 erosion(오클루더 영향 완화) ---
-		int w = std::max(0, maxPX - minPX + 1);
-		int h = std::max(0, maxPY - minPY + 1);
-		const bool bigCover =
-			(w >= int(MaxCover * GW)) || (h >= int(MaxCover * GH));
-		if (ErodeScale < 1.0f && w >= MinPxEdge && h >= MinPxEdge && !bigCover)
+void FOcclusionCullingManagerCPU::SetupOccluder(FOccluderJob& Job) const
+{
+	const FOccluderMesh& Mesh = *Job.Mesh;
+
+	Job.Triangles.Empty();
+	Job.BinTriangles.SetNum(DepthBuffer.GetNumBins());
+	for (TArray<int32>& Bin : Job.BinTriangles)
+	{
+		Bin.Empty();
+	}
+
+	Job.ClipPositions.SetNum(Mesh.Positions.Num());
+	for (int32 i = 0; i < Mesh.Positions.Num(); ++i)
+	{
+		Job.ClipPositions[i] = TransformToClip(Mesh.Positions[i], Job.WorldViewProjection);
+	}
+
+	for (int32 i = 0; i + 2 < Mesh.Indices.Num(); i += 3)
+	{
+		const FVector4& P0 = Job.ClipPositions[Mesh.Indices[i]];
+		const FVector4& P1 = Job.ClipPositions[Mesh.Indices[i + 1]];
+		const FVector4& P2 = Job.ClipPositions[Mesh.Indices[i + 2]];
+
+		// 한 클립 평면 밖에 세 정점이 모두 있으면 버린다
+		if ((P0.X > P0.W && P1.X > P1.W && P2.X > P2.W) || (P0.X < -P0.W && P1.X < -P1.W && P2.X < -P2.W) ||
+			(P0.Y > P0.W && P1.Y > P1.W && P2.Y > P2.W) || (P0.Y < -P0.W && P1.Y < -P1.W && P2.Y < -P2.W))
+		{
+			continue;
+		}
+
+		// 근평면(z >= 0) 클리핑: 0~2개 정점이 밖이면 삼각형 1~2개가 된다
+		const FVector4* In[3] = { &P0, &P1, &P2 };
+		FVector4 Poly[4];
+		int32 NumPoly = 0;
+		for (int32 v = 0; v < 3; ++v)
 		{
-			const float cx = 0.5f * float(minPX + maxPX);
-			const float cy = 0.5f * float(minPY + maxPY);
-			const float hw = 0.5f * float(w) * ErodeScale;
-			const float hh = 0.5f * float(h) * ErodeScale;
+			const FVector4& A = *In[v];
+			const FVector4& B = *In[(v + 1) % 3];
+			const bool bAIn = A.Z >= 0.0f && A.W > MinClipW;
+			const bool bBIn = B.Z >= 0.0f && B.W > MinClipW;
+			if (bAIn)
+			{
+				Poly[NumPoly++] = A;
+			}
+			if (bAIn != bBIn)
+			{
+				const float T = A.Z / (A.Z - B.Z);
+				const FVector4 P = LerpClip(A, B, T);
+				if (P.W > MinClipW && NumPoly < 4)
+				{
+					Poly[NumPoly++] = P;
+				}
+			}
+		}
 
-			minPX = int(std::floor(cx - hw));
-			maxPX = int(std::ceil(cx + hw));
-			minPY = int(std::floor(cy - hh));
-			maxPY = int(std::ceil(cy + hh));
+		for (int32 v = 1; v + 1 < NumPoly; ++v)
+		{
+			EmitTriangle(Job, Poly[0], Poly[v], Poly[v + 1]);
 		}
+	}
+}
 
+bool FOcclusionCullingManagerCPU::IsAABBOccluded(const FAABB& Bound) const
+{
+	// 바운드를 계산하지 않는 컴포넌트(스키닝/천은 빈 AABB를 반환)는 판정하지 않는다
+	if (Bound.Min.X >= Bound.Max.X && Bound.Min.Y >= Bound.Max.Y && Bound.Min.Z >= Bound.Max.Z)
+	{
+		return false;
+	}
 
-		// 화면 경계 클램프
-		minPX = std::max(0, std::min(GW - 1, minPX));
-		minPY = std::max(0, std::min(GH - 1, minPY));
-		maxPX = std::max(0, std::min(GW - 1, maxPX));
-		maxPY = std::max(0, std::min(GH - 1, maxPY));
-		if (minPX > maxPX || minPY > maxPY) continue;
+	const float W = static_cast<float>(DepthBuffer.GetWidth());
+	const float H = static_cast<float>(DepthBuffer.GetHeight());
 
-		Grid.RasterizeRectDepthMin(minPX, minPY, maxPX, maxPY, R.MaxZ);
+	float MinSX = FLT_MAX, MinSY = FLT_MAX, MaxSX = -FLT_MAX, MaxSY = -FLT_MAX;
+	float MinZ = FLT_MAX;
+	for (int32 Corner = 0; Corner < 8; ++Corner)
+	{
+		const FVector P((Corner & 1) ? Bound.Max.X : Bound.Min.X, (Corner & 2) ? Bound.Max.Y : Bound.Min.Y, (Corner & 4) ? Bound.Max.Z : Bound.Min.Z);
+		const FVector4 Clip = TransformToClip(P, CurrentViewProjection);
+
+		// 근평면에 걸치거나 카메라 뒤로 넘어가는 박스는 판정하지 않는다 (보임)
+		if (Clip.W <= MinClipW || Clip.Z < 0.0f)
+		{
+			return false;
+		}
+
+		const float InvW = 1.0f / Clip.W;
+		const float SX = (Clip.X * InvW * 0.5f + 0.5f) * W;
+		const float SY = (0.5f - Clip.Y * InvW * 0.5f) * H;
+		MinSX = std::min(MinSX, SX); MaxSX = std::max(MaxSX, SX);
+		MinSY = std::min(MinSY, SY); MaxSY = std::max(MaxSY, SY);
+		MinZ = std::min(MinZ, Clip.Z * InvW);
+	}
+
+	if (MaxSX < 0.0f || MaxSY < 0.0f || MinSX >= W || MinSY >= H)
+	{
+		return false;
 	}
+
+	// 박스가 닿는 모든 픽셀을 포함하도록 바깥쪽으로 잡는다
+	const int32 X0 = std::clamp(static_cast<int32>(std::floor(MinSX)), 0, DepthBuffer.GetWidth() - 1);
+	const int32 Y0 = std::clamp(static_cast<int32>(std::floor(MinSY)), 0, DepthBuffer.GetHeight() - 1);
+	const int32 X1 = std::clamp(static_cast<int32>(std::floor(MaxSX)), 0, DepthBuffer.GetWidth() - 1);
+	const int32 Y1 = std::clamp(static_cast<int32>(std::floor(MaxSY)), 0, DepthBuffer.GetHeight() - 1);
+	return DepthBuffer.IsRectOccluded(X0, Y0, X1, Y1, MinZ);
 }
 
-// 2) 후보 가시성 판정(HZB 샘플)
-void FOcclusionCullingManagerCPU::TestOcclusion(const TArray<FCandidateDrawable>& Candidates, int ViewW, int ViewH, TArray<uint8_t>& OutVisibleFlags)
+void FOcclusionCullingManagerCPU::CullOccludedComponents(const FMatrix& ViewProjection, const FVector& ViewLocation, float AspectRatio, TArray<UMeshComponent*>& InOutComponents)
 {
-	const float eps = 2e-3f;  // 1차 바이어스
-	const float eps2 = 2 * eps;  // 레벨0 재검증 바이어스(조금 더 큼)
-	// --- 크기 보장 ---
-	uint32_t maxId = 0;
-	for (auto& c : Candidates) maxId = std::max(maxId, c.ActorIndex);
-
-	if (OutVisibleFlags.size() <= maxId) OutVisibleFlags.resize(maxId + 1, 1);
-	if (VisibleStreak.size() <= maxId) VisibleStreak.resize(maxId + 1, 0);
-	if (OccludedStreak.size() <= maxId) OccludedStreak.resize(maxId + 1, 0);
-	if (LastState.size() <= maxId) LastState.resize(maxId + 1, 1); // 초기=보임
+	FOcclusionStats& Stats = FOcclusionStatManager::GetInstance().GetMutableStats();
+	Stats.OccluderCount = 0;
+	Stats.SimplifiedOccluderCount = 0;
+	Stats.OccluderTriangleCount = 0;
+	Stats.RasterizedTriangleCount = 0;
+	Stats.TestedCount = 0;
+	Stats.OccludedCount = 0;
+	Stats.RasterizeTimeMS = 0.0;
+	Stats.TestTimeMS = 0.0;
+
+	if (!bEnabled || bShutdown || InOutComponents.Num() < 2 || MaxOccluders == 0)
+	{
+		return;
+	}
 
-	for (const auto& D : Candidates)
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	// 뷰 비율에 맞춘 저해상도 버퍼 (가로 256픽셀)
+	const int32 BufferWidth = 256;
+	const int32 BufferHeight = std::clamp(static_cast<int32>(BufferWidth / std::max(AspectRatio, 0.1f)), 64, 256);
+	DepthBuffer.Initialize(BufferWidth, BufferHeight);
+	DepthBuffer.Clear();
+	CurrentViewProjection = ViewProjection;
+	Stats.BufferWidth = DepthBuffer.GetWidth();
+	Stats.BufferHeight = DepthBuffer.GetHeight();
+	Stats.WorkerCount = static_cast<uint32>(Workers.Num());
+
+	// 1) 오클루더 선정: 화면에 크게 보이는 스태틱 메시
+	const int32 NumCandidates = InOutComponents.Num();
+	CandidateBounds.SetNum(NumCandidates);
+	TArray<std::pair<float, int32>> OccluderScores;
+	for (int32 i = 0; i < NumCandidates; ++i)
 	{
-		uint32_t id = D.ActorIndex;
+		UMeshComponent* Component = InOutComponents[i];
+		CandidateBounds[i] = Component->GetWorldAABB();
 
-		FOcclusionRect R;
-		if (!ComputeRectAndMinZ(D, ViewW, ViewH, R))
+		UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(Component);
+		if (!StaticMeshComponent || !StaticMeshComponent->GetStaticMesh())
 		{
-			// 화면 밖(또는 w<=0 코너만) → 가려짐으로 처리
-			OutVisibleFlags[id] = 0;
-			// streak 업데이트 (선택): occluded 누적
-			OccludedStreak[id] = std::min<uint8_t>(255, OccludedStreak[id] + 1);
-			VisibleStreak[id] = 0;
-			LastState[id] = 0;
 			continue;
 		}
 
-		const float rw = std::max(0.0f, R.MaxX - R.MinX);
-		const float rh = std::max(0.0f, R.MaxY - R.MinY);
-		const float pxW = rw * GetGrid().GetWidth();
-		const float pxH = rh * GetGrid().GetHeight();
+		const FVector Center = CandidateBounds[i].GetCenter();
+		const float Radius = CandidateBounds[i].GetHalfExtent().Size();
+		const float Distance = std::max((Center - ViewLocation).Size(), 1e-3f);
+		const float ScreenSize = Radius / Distance;
+		if (ScreenSize >= MinOccluderScreenSize)
+		{
+			OccluderScores.Add({ ScreenSize, i });
+		}
+	}
+
+	const int32 NumOccluders = std::min(MaxOccluders, OccluderScores.Num());
+	std::partial_sort(OccluderScores.begin(), OccluderScores.begin() + NumOccluders, OccluderScores.end(),
+		[](const auto& A, const auto& B) { return A.first > B.first; });
 
-		// --- 작은 사각형 가드: 한 변이라도 2px 미만이면 컬링하지 않음 ---
-		if (std::min(pxW, pxH) < 2.0f)
+	OccluderJobs.SetNum(NumOccluders);
+	int32 NumOccluderJobs = 0;
+	for (int32 i = 0; i < NumOccluders; ++i)
+	{
+		UStaticMeshComponent* StaticMeshComponent = static_cast<UStaticMeshComponent*>(InOutComponents[OccluderScores[i].second]);
+		const FOccluderMesh* Mesh = GetOccluderMesh(StaticMeshComponent->GetStaticMesh());
+		if (!Mesh)
 		{
-			OutVisibleFlags[id] = 1;
-			VisibleStreak[id] = std::min<uint8_t>(255, VisibleStreak[id] + 1);
-			OccludedStreak[id] = 0;
-			LastState[id] = 1;
 			continue;
 		}
 
-		// --- 보수적 mip 선택 ---
-		int mip = std::max(0, Grid.ChooseMip(rw, rh) - 1);
-		if (pxW < 48.0f || pxH < 48.0f)
-			mip = std::max(0, mip - 1);
+		FOccluderJob& Job = OccluderJobs[NumOccluderJobs++];
+		Job.Mesh = Mesh;
+		Job.WorldViewProjection = StaticMeshComponent->GetWorldMatrix() * ViewProjection;
 
+		++Stats.OccluderCount;
+		Stats.SimplifiedOccluderCount += Mesh->bSimplified ? 1 : 0;
+		Stats.OccluderTriangleCount += static_cast<uint32>(Mesh->GetTriangleCount());
+	}
 
-		// --- MAX HZB 적응형 샘플 ---
-		const float hzbMax = Grid.SampleMaxRectAdaptive(R.MinX, R.MinY, R.MaxX, R.MaxY, mip);
+	if (NumOccluderJobs == 0)
+	{
+		return;
+	}
 
-		bool occluded = ((hzbMax + eps) <= R.MinZ);
+	if (Workers.IsEmpty())
+	{
+		StartWorkers();
+		Stats.WorkerCount = static_cast<uint32>(Workers.Num());
+	}
 
-		// --- 레벨0 정밀 재검증(occluded일 때만) ---
-		if (occluded)
+	// 2) 셋업/빈 분류 (오클루더 단위) → 래스터 (빈 단위, 빈끼리는 겹치지 않아 잠금 없음) → HZB
+	ParallelFor(NumOccluderJobs, [this](int32 JobIndex) { SetupOccluder(OccluderJobs[JobIndex]); });
+	ParallelFor(DepthBuffer.GetNumBins(), [this, NumOccluderJobs](int32 Bin)
 		{
-			if (!Grid.FullyOccludedAtLevel0(R.MinX, R.MinY, R.MaxX, R.MaxY, R.MinZ, eps2))
-				occluded = false;
+			for (int32 JobIndex = 0; JobIndex < NumOccluderJobs; ++JobIndex)
+			{
+				const FOccluderJob& Job = OccluderJobs[JobIndex];
+				for (int32 TriIndex : Job.BinTriangles[Bin])
+				{
+					DepthBuffer.RasterizeTriangle(Job.Triangles[TriIndex], Bin);
+				}
+			}
+			DepthBuffer.UpdateTileMax(Bin);
+		});
+	DepthBuffer.BuildHZB();
+
+	for (int32 JobIndex = 0; JobIndex < NumOccluderJobs; ++JobIndex)
+	{
+		Stats.RasterizedTriangleCount += static_cast<uint32>(OccluderJobs[JobIndex].Triangles.Num());
+	}
+
+	const uint64 TestStartCycles = FPlatformTime::Cycles64();
+	Stats.RasterizeTimeMS = FPlatformTime::ToMilliseconds(TestStartCycles - StartCycles);
+
+	// 3) 후보 판정 (묶음 단위)
+	CandidateOccluded.SetNum(NumCandidates);
+	const int32 NumTestJobs = (NumCandidates + CandidatesPerJob - 1) / CandidatesPerJob;
+	ParallelFor(NumTestJobs, [this, NumCandidates](int32 JobIndex)
+		{
+			const int32 Begin = JobIndex * CandidatesPerJob;
+			const int32 End = std::min(Begin + CandidatesPerJob, NumCandidates);
+			for (int32 i = Begin; i < End; ++i)
+			{
+				CandidateOccluded[i] = IsAABBOccluded(CandidateBounds[i]) ? 1 : 0;
+			}
+		});
+
+	// 보이는 컴포넌트만 순서를 유지해 앞으로 모은다
+	int32 NumVisible = 0;
+	for (int32 i = 0; i < NumCandidates; ++i)
+	{
+		if (!CandidateOccluded[i])
+		{
+			InOutComponents[NumVisible++] = InOutComponents[i];
 		}
+	}
+	InOutComponents.SetNum(NumVisible);
+
+	Stats.TestedCount = static_cast<uint32>(NumCandidates);
+	Stats.OccludedCount = static_cast<uint32>(NumCandidates - NumVisible);
+	Stats.TestTimeMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - TestStartCycles);
+	Stats.TotalTested += Stats.TestedCount;
+	Stats.TotalOccluded += Stats.OccludedCount;
+}
 
-		// --- 양방향 히스테리시스(2~3프레임 연속일 때만 상태 전환) ---
-		const int thresh = 2; // 2~3 추천
+void FOcclusionCullingManagerCPU::ParallelFor(int32 InNumJobs, const std::function<void(int32)>& InJob)
+{
+	if (InNumJobs <= 0)
+	{
+		return;
+	}
 
-		if (occluded)
+	if (Workers.IsEmpty() || InNumJobs == 1)
+	{
+		for (int32 i = 0; i < InNumJobs; ++i)
 		{
-			OccludedStreak[id] = std::min<uint8_t>(255, OccludedStreak[id] + 1);
-			VisibleStreak[id] = 0;
+			InJob(i);
+		}
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> Lock(WorkerMutex);
+		CurrentJob = &InJob;
+		NumJobs = InNumJobs;
+		NextJob.store(0);
+		bJobsOpen = true;
+		++WorkGeneration;
+	}
+	WorkerCondition.notify_all();
 
-			// 직전이 보임이면, thresh 미만 동안은 보임 유지
-			if (LastState[id] == 1 && OccludedStreak[id] < thresh)
-				occluded = false;
+	// 게임 스레드도 남은 작업을 가져간다
+	RunPendingJobs();
+
+	// 작업을 가져간 워커가 모두 끝날 때까지 기다린 뒤 닫는다 (늦게 깬 워커는 닫힌 작업을 건너뜀)
+	std::unique_lock<std::mutex> Lock(WorkerMutex);
+	DoneCondition.wait(Lock, [this]() { return ActiveWorkers == 0; });
+	bJobsOpen = false;
+	CurrentJob = nullptr;
+}
+
+void FOcclusionCullingManagerCPU::RunPendingJobs()
+{
+	while (true)
+	{
+		const int32 JobIndex = NextJob.fetch_add(1);
+		if (JobIndex >= NumJobs)
+		{
+			return;
 		}
-		else
+		(*CurrentJob)(JobIndex);
+	}
+}
+
+void FOcclusionCullingManagerCPU::StartWorkers()
+{
+	// 게임 스레드가 함께 처리하므로 워커는 적게 둔다
+	const int32 HardwareThreads = static_cast<int32>(std::thread::hardware_concurrency());
+	const int32 NumWorkers = FMath::Clamp(HardwareThreads - 2, 0, 3);
+
+	bStopWorkers = false;
+	for (int32 i = 0; i < NumWorkers; ++i)
+	{
+		Workers.Emplace(&FOcclusionCullingManagerCPU::WorkerLoop, this);
+	}
+}
+
+void FOcclusionCullingManagerCPU::StopWorkers()
+{
+	{
+		std::lock_guard<std::mutex> Lock(WorkerMutex);
+		bStopWorkers = true;
+	}
+	WorkerCondition.notify_all();
+
+	for (std::thread& Worker : Workers)
+	{
+		if (Worker.joinable())
 		{
-			VisibleStreak[id] = std::min<uint8_t>(255, VisibleStreak[id] + 1);
-			OccludedStreak[id] = 0;
+			Worker.join();
+		}
+	}
+	Workers.Empty();
+}
 
-			// 직전이 가려짐이면, thresh 미만 동안은 가려짐 유지
-			if (LastState[id] == 0 && VisibleStreak[id] < thresh)
-				occluded = true;
+void FOcclusionCullingManagerCPU::WorkerLoop()
+{
+	uint64 LastGeneration = 0;
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> Lock(WorkerMutex);
+			WorkerCondition.wait(Lock, [&]() { return bStopWorkers || WorkGeneration != LastGeneration; });
+			if (bStopWorkers)
+			{
+				return;
+			}
+			LastGeneration = WorkGeneration;
+			if (!bJobsOpen)
+			{
+				continue;
+			}
+			++ActiveWorkers;
 		}
 
-		LastState[id] = occluded ? 0 : 1;
-		OutVisibleFlags[id] = occluded ? 0 : 1;
+		RunPendingJobs();
+
+		{
+			std::lock_guard<std::mutex> Lock(WorkerMutex);
+			--ActiveWorkers;
+		}
+		DoneCondition.notify_all();
 	}
-}
\ No newline at end of file
+}
@@ -0,0 +1,71 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+// 메인 뷰 가시성 컬링 통계 (절두체 + CPU 소프트웨어 오클루전)
+struct FOcclusionStats
+{
+	// 깊이 버퍼
+	uint32 BufferWidth = 0;
+	uint32 BufferHeight = 0;
+	uint32 WorkerCount = 0;             // 게임 스레드 제외
+
+	// 절두체 컬링
+	uint32 FrustumTestedCount = 0;
+	uint32 FrustumCulledCount = 0;
+	double FrustumTimeMS = 0.0;
+
+	// 오클루더
+	uint32 OccluderCount = 0;
+	uint32 SimplifiedOccluderCount = 0; // 삼각형 예산 때문에 단순화된 LOD를 쓴 오클루더
+	uint32 OccluderTriangleCount = 0;   // 오클루더 LOD 삼각형 수
+	uint32 RasterizedTriangleCount = 0; // 클리핑/화면 밖 제거 후 실제로 그린 삼각형 수
+
+	// 오클루전 판정
+	uint32 TestedCount = 0;
+	uint32 OccludedCount = 0;
+	double RasterizeTimeMS = 0.0;       // 오클루더 셋업 + 래스터 + HZB
+	double TestTimeMS = 0.0;
+
+	// 누적 통계
+	uint64 TotalTested = 0;
+	uint64 TotalOccluded = 0;
+
+	float GetOccludedPercent() const
+	{
+		if (TestedCount == 0) return 0.0f;
+		return static_cast<float>(OccludedCount) / static_cast<float>(TestedCount) * 100.0f;
+	}
+
+	void Reset()
+	{
+		*this = FOcclusionStats();
+	}
+};
+
+// 오클루전 통계 전역 매니저 (싱글톤)
+// UStatsOverlayD2D에서 접근할 수 있도록 전역 통계 제공
+class FOcclusionStatManager
+{
+public:
+	static FOcclusionStatManager& GetInstance()
+	{
+		static FOcclusionStatManager Instance;
+		return Instance;
+	}
+
+	const FOcclusionStats& GetStats() const { return CurrentStats; }
+	FOcclusionStats& GetMutableStats() { return CurrentStats; }
+
+	void ResetStats()
+	{
+		CurrentStats.Reset();
+	}
+
+private:
+	FOcclusionStatManager() = default;
+	~FOcclusionStatManager() = default;
+	FOcclusionStatManager(const FOcclusionStatManager&) = delete;
+	FOcclusionStatManager& operator=(const FOcclusionStatManager&) = delete;
+
+	FOcclusionStats CurrentStats;
+};
@@ -26,6 +26,9 @@ static const FVector4 LevelColors[8] =
 
 class FOctree
 {
+    // Clear/재구축 때마다 자식 노드를 통째로 만들고 지우므로 풀에서 할당
+    DECLARE_POOLED_ALLOCATION(FOctree, EMemoryTag::Spatial)
+
 public:
     // 생성자/소멸자
     FOctree(const FAABB& InBounds, int InDepth = 0, int InMaxDepth = 5, int InMaxObjects = 15);
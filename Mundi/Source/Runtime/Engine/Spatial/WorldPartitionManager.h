@@ -8,6 +8,7 @@ class UStaticMeshComponent;
 
 class FOctree;
 class FBVHierarchy;
+class FWorldPartitionStreaming;
 
 struct FRay;
 struct FAABB;
@@ -33,6 +34,7 @@ public:
 	void MarkDirty(AActor* Actor);
 	void MarkDirty(UPrimitiveComponent* Smc);
 
+	/** 더티 컴포넌트를 정적 LBVH / 동적 트리에 반영 (컴포넌트 Mobility 기준) */
 	void Update(float DeltaTime, const uint32 BudgetCount = 256);
 
     //void RayQueryOrdered(FRay InRay, OUT TArray<std::pair<AActor*, float>>& Candidates);
@@ -44,6 +46,11 @@ public:
 	/** BVH 게터 */
 	FBVHierarchy* GetBVH() const { return BVH; }
 
+	/** 그리드 스트리밍 매니페스트(.streaming)를 연다. 상주 씬을 로드하고 이후 Update에서 셀을 스트리밍한다. */
+	bool OpenStreaming(UWorld* InWorld, const FWideString& InManifestPath);
+	/** 스트리밍 게터 (매니페스트를 연 적이 없으면 nullptr) */
+	FWorldPartitionStreaming* GetStreaming() const { return Streaming; }
+
 private:
 
 	// 싱글톤 
@@ -55,7 +62,12 @@ private:
 	void ClearBVHierarchy();
 	
 	TQueue<UPrimitiveComponent*> ComponentDirtyQueue; // 추가 혹은 갱신이 필요한 요소의 대기 큐
-	TSet<UPrimitiveComponent*> ComponentDirtySet;     // 더티 큐 중복 추가를 막기 위한 Set
+	TFlatSet<UPrimitiveComponent*> ComponentDirtySet; // 더티 큐 중복 추가를 막기 위한 Set
 	FOctree* SceneOctree = nullptr;
 	FBVHierarchy* BVH = nullptr;
+	FWorldPartitionStreaming* Streaming = nullptr;
+
+	// 더티 큐가 예산보다 길게 유지되어도 정적 LBVH 리빌드가 무한히 밀리지 않도록 강제 플러시 간격을 둔다
+	static constexpr uint32 MaxFramesBetweenStaticFlush = 30;
+	uint32 FramesSinceStaticFlush = 0;
 };
@@ -6,9 +6,12 @@
 #include "PointLightComponent.h"
 #include "D3D11RHI.h"
 #include "World.h"
+#include "SceneView.h"
+#include "ShadowStats.h"
 
 #define NUM_POINT_LIGHT_MAX 256
 #define NUM_SPOT_LIGHT_MAX 256
+#define SHADOW_ATLAS_MIN_TILE_SIZE 128
 FLightManager::~FLightManager()
 {
 	Release();
@@ -30,6 +33,9 @@ void FLightManager::Initialize(D3D11RHI* RHIDevice, uint32 InShadowAtlasSize2D,
 	AtlasSizeCube = InAtlasSizeCube;
 	CubeArrayCount = InCubeArrayCount;
 
+	ShadowAtlasAllocator2D.Initialize(ShadowAtlasSize2D, SHADOW_ATLAS_MIN_TILE_SIZE);
+	AtlasAllocations2D.Empty();
+
 	// --- 1. Structured Buffers (t17, t18) ---
 	if (!PointLightBuffer)
 	{
@@ -276,6 +282,9 @@ void FLightManager::Release()
 		VSMShadowAtlasTexture2D->Release();
 		VSMShadowAtlasTexture2D = nullptr;
 	}
+
+	InvalidateShadowCache();
+	ResetAtlasAllocations();
 }
 
 void FLightManager::UpdateLightBuffer(D3D11RHI* RHIDevice)
@@ -485,6 +494,10 @@ void FLightManager::ClearAllDepthStencilView(D3D11RHI* RHIDevice)
 	
 	// 비워진 리소스를 다시 할당 시키려고
 	bHaveToUpdate = true;
+
+	// 아틀라스가 비워졌으므로 캐시된 섀도우 뷰와 영역 할당도 모두 무효
+	InvalidateShadowCache();
+	ResetAtlasAllocations();
 }
 
 bool FLightManager::GetCachedShadowData(ULightComponent* Light, int32 SubViewIndex, FShadowMapData& OutData) const
@@ -539,48 +552,210 @@ bool FLightManager::GetCachedShadowCubeSliceIndex(ULightComponent* Light, int32&
 }
 
 // 단순한 아틀라스 로직
-void FLightManager::AllocateAtlasRegions2D(TArray<FShadowRenderRequest>& InOutRequests2D)
+void FLightManager::AllocateAtlasRegions2D(TArray<FShadowRenderRequest>& InOutRequests2D, const FSceneView* View)
 {
-	// 요청 정렬 (가장 큰 것부터)
-	InOutRequests2D.Sort(std::greater<FShadowRenderRequest>());
+	if (!ShadowAtlasAllocator2D.IsInitialized() || ShadowAtlasAllocator2D.GetAtlasSize() != ShadowAtlasSize2D)
+	{
+		ShadowAtlasAllocator2D.Initialize(ShadowAtlasSize2D, SHADOW_ATLAS_MIN_TILE_SIZE);
+		AtlasAllocations2D.Empty();
+	}
 
-	// 동적 패킹(Shelf Algorithm)
-	uint32 CurrentAtlasX = 0;
-	uint32 CurrentAtlasY = 0;
-	uint32 CurrentShelfMaxHeight = 0;
+	// 1. 요청별 목표 타일 크기 (LOD): 이 뷰의 LOD와 이번/지난 프레임 다른 뷰들의 LOD 중 가장 큰 값
+	const uint64 CurrentFrame = FMemoryManager::GetFrameNumber();
+	TArray<uint32> DesiredSizes;
+	DesiredSizes.SetNum(InOutRequests2D.Num());
+	for (int32 i = 0; i < InOutRequests2D.Num(); ++i)
+	{
+		const FShadowRenderRequest& Request = InOutRequests2D[i];
+		DesiredSizes[i] = 0;
+		if (Request.Size == 0) continue;
 
-	for (FShadowRenderRequest& Request : InOutRequests2D)
+		TArray<FShadowAtlasAllocation>& Allocations = AtlasAllocations2D[Request.LightOwner];
+		if (Allocations.Num() <= Request.SubViewIndex)
+		{
+			Allocations.SetNum(Request.SubViewIndex + 1);
+		}
+		FShadowAtlasAllocation& Allocation = Allocations[Request.SubViewIndex];
+		if (Allocation.LODFrame != CurrentFrame)
+		{
+			Allocation.PrevFrameLODSize = Allocation.LODFrame + 1 == CurrentFrame ? Allocation.FrameLODSize : 0;
+			Allocation.FrameLODSize = 0;
+			Allocation.LODFrame = CurrentFrame;
+		}
+		Allocation.FrameLODSize = FMath::Max(Allocation.FrameLODSize, ComputeShadowLODSize(Request, View));
+		DesiredSizes[i] = FMath::Max(Allocation.FrameLODSize, Allocation.PrevFrameLODSize);
+	}
+
+	const TArray<uint32> LODSizes = DesiredSizes;
+
+	// 2. 아틀라스 면적을 넘으면 라이트를 버리는 대신 모든 요청의 해상도를 한 단계씩 낮춤
+	ShadowAtlasAllocator2D.FitSizesToAtlasArea(DesiredSizes);
+
+	// 3. 기존 영역 유지 판정
+	uint32 NumReused = 0;
+	uint32 NumDegraded = 0;
+	uint32 NumDropped = 0;
+	TArray<int32> PendingRequests;
+	for (int32 i = 0; i < InOutRequests2D.Num(); ++i)
 	{
-		if (CurrentAtlasX + Request.Size > ShadowAtlasSize2D)
+		const FShadowRenderRequest& Request = InOutRequests2D[i];
+		if (DesiredSizes[i] == 0) continue;
+
+		FShadowAtlasAllocation& Allocation = AtlasAllocations2D[Request.LightOwner][Request.SubViewIndex];
+		Allocation.LastRequestedFrame = CurrentFrame;
+		Allocation.DesiredSize = DesiredSizes[i];
+
+		if (!Allocation.Region.IsValid())
+		{
+			PendingRequests.Add(i);
+		}
+		else if (Allocation.Region.Size == DesiredSizes[i] || Allocation.Region.Size == DesiredSizes[i] * 2)
+		{
+			// 같은 크기(또는 한 단계 큰 크기, LOD 경계에서의 깜빡임 방지)면 이전 프레임 영역을 그대로 사용
+			++NumReused;
+		}
+		else if (Allocation.Region.Size > DesiredSizes[i])
 		{
-			CurrentAtlasY += CurrentShelfMaxHeight;
-			CurrentAtlasX = 0;
-			CurrentShelfMaxHeight = 0;
+			// 축소: 먼저 반납해서 다른 요청이 사용할 수 있게 함
+			ShadowAtlasAllocator2D.Free(Allocation.Region);
+			Allocation.Region = FShadowAtlasRegion();
+			PendingRequests.Add(i);
 		}
-		if (CurrentAtlasY + Request.Size > ShadowAtlasSize2D)
+		else
 		{
-			Request.Size = 0; // 꽉 참 (렌더링 실패)
-			// Only log error for non-preview worlds (preview worlds have shadows disabled intentionally)
-			if (!OwningWorld || !OwningWorld->IsPreviewWorld())
+			// 확대(강등 상태 복구 포함): 새 영역을 얻을 때까지 기존 영역 유지
+			PendingRequests.Add(i);
+		}
+	}
+
+	// 4. 이번/지난 프레임에 어떤 뷰도 요청하지 않은 영역 반납 (꺼진 라이트, 줄어든 캐스케이드 등)
+	//    다른 뷰포트에서만 보이는 라이트의 영역은 이 뷰가 요청하지 않아도 유지한다
+	for (auto& Pair : AtlasAllocations2D)
+	{
+		for (FShadowAtlasAllocation& Allocation : Pair.second)
+		{
+			if (Allocation.LastRequestedFrame + 1 < CurrentFrame && Allocation.Region.IsValid())
 			{
-				UE_LOG("그림자 맵 아틀라스가 가득차서 더 이상 그림자를 추가할 수 없습니다.");
+				ShadowAtlasAllocator2D.Free(Allocation.Region);
+				Allocation.Region = FShadowAtlasRegion();
 			}
+		}
+	}
+
+	// 5. 신규/크기 변경 요청 할당 (큰 것부터), 공간이 없으면 해상도를 낮춰 재시도
+	PendingRequests.Sort([&DesiredSizes](int32 A, int32 B) { return DesiredSizes[A] > DesiredSizes[B]; });
+	for (int32 RequestIndex : PendingRequests)
+	{
+		const FShadowRenderRequest& Request = InOutRequests2D[RequestIndex];
+		FShadowAtlasAllocation& Allocation = AtlasAllocations2D[Request.LightOwner][Request.SubViewIndex];
+		const uint32 CurrentSize = Allocation.Region.IsValid() ? Allocation.Region.Size : 0;
+
+		FShadowAtlasRegion NewRegion;
+		if (ShadowAtlasAllocator2D.AllocateLargestFit(Allocation.DesiredSize, CurrentSize, NewRegion))
+		{
+			ShadowAtlasAllocator2D.Free(Allocation.Region);
+			Allocation.Region = NewRegion;
+		}
+		else if (!Allocation.Region.IsValid())
+		{
+			++NumDropped;
+		}
+	}
+
+	// 6. 결과 기록
+	for (int32 i = 0; i < InOutRequests2D.Num(); ++i)
+	{
+		FShadowRenderRequest& Request = InOutRequests2D[i];
+		const FShadowAtlasAllocation* Allocation = nullptr;
+		if (DesiredSizes[i] > 0)
+		{
+			if (const TArray<FShadowAtlasAllocation>* Allocations = AtlasAllocations2D.Find(Request.LightOwner))
+			{
+				Allocation = &(*Allocations)[Request.SubViewIndex];
+			}
+		}
+
+		if (!Allocation || !Allocation->Region.IsValid())
+		{
+			Request.Size = 0; // 렌더링 실패
 			continue;
 		}
 
-		Request.AtlasViewportOffset = FVector2D((float)CurrentAtlasX, (float)CurrentAtlasY);
+		const FShadowAtlasRegion& Region = Allocation->Region;
+		if (Region.Size < LODSizes[i])
+		{
+			++NumDegraded;
+		}
+
+		Request.Size = Region.Size;
+		Request.AtlasViewportOffset = FVector2D((float)Region.X, (float)Region.Y);
 
 		// Pass 2 데이터 (UV) 저장
 		Request.AtlasScaleOffset = FVector4(
-			Request.Size / (float)ShadowAtlasSize2D,    // ScaleX
-			Request.Size / (float)ShadowAtlasSize2D,    // ScaleY
-			CurrentAtlasX / (float)ShadowAtlasSize2D,   // OffsetX
-			CurrentAtlasY / (float)ShadowAtlasSize2D    // OffsetY
+			Region.Size / (float)ShadowAtlasSize2D,    // ScaleX
+			Region.Size / (float)ShadowAtlasSize2D,    // ScaleY
+			Region.X / (float)ShadowAtlasSize2D,       // OffsetX
+			Region.Y / (float)ShadowAtlasSize2D        // OffsetY
 		);
+	}
+
+	// Only log error for non-preview worlds (preview worlds have shadows disabled intentionally)
+	if (NumDropped > 0 && (!OwningWorld || !OwningWorld->IsPreviewWorld()))
+	{
+		UE_LOG("그림자 맵 아틀라스에 공간이 없어 %u개의 섀도우 뷰를 그리지 못했습니다.", NumDropped);
+	}
+
+	FShadowStatManager::GetInstance().UpdateShadowAtlasStats(
+		ShadowAtlasAllocator2D.GetOccupancy(),
+		ShadowAtlasAllocator2D.GetNumAllocations(),
+		ShadowAtlasAllocator2D.GetNumFreeNodes(),
+		NumReused, NumDegraded, NumDropped);
+}
+
+uint32 FLightManager::ComputeShadowLODSize(const FShadowRenderRequest& Request, const FSceneView* View) const
+{
+	const uint32 BaseSize = ShadowAtlasAllocator2D.QuantizeSize(Request.Size);
+
+	// 캐스케이드는 카메라를 따라다니므로 LOD 대상이 아님
+	if (!View || View->ProjectionMode != ECameraProjectionMode::Perspective || Cast<UDirectionalLightComponent>(Request.LightOwner))
+	{
+		return BaseSize;
+	}
+
+	const float Distance = (Request.WorldLocation - View->ViewLocation).Size();
+	if (Distance <= Request.Radius)
+	{
+		return BaseSize; // 카메라가 라이트 영향 범위 안
+	}
 
-		CurrentAtlasX += Request.Size;
-		CurrentShelfMaxHeight = FMath::Max(CurrentShelfMaxHeight, Request.Size);
+	// 라이트 영향 구가 화면 세로에서 차지하는 비율 (ProjectionMatrix.M[1][1] = 1 / tan(FovY / 2))
+	const float ScreenCoverage = FMath::Clamp(Request.Radius / Distance * View->ProjectionMatrix.M[1][1], 0.0f, 1.0f);
+
+	const uint32 MinTileSize = ShadowAtlasAllocator2D.GetMinTileSize();
+	uint32 LODSize = BaseSize;
+	while (LODSize > MinTileSize && (float)(LODSize >> 1) >= BaseSize * ScreenCoverage)
+	{
+		LODSize >>= 1;
 	}
+	return LODSize;
+}
+
+void FLightManager::ReleaseAtlasAllocations(ULightComponent* Light)
+{
+	if (TArray<FShadowAtlasAllocation>* Allocations = AtlasAllocations2D.Find(Light))
+	{
+		for (const FShadowAtlasAllocation& Allocation : *Allocations)
+		{
+			ShadowAtlasAllocator2D.Free(Allocation.Region);
+		}
+		AtlasAllocations2D.Remove(Light);
+	}
+}
+
+void FLightManager::ResetAtlasAllocations()
+{
+	ShadowAtlasAllocator2D.Reset();
+	AtlasAllocations2D.Empty();
 }
 
 void FLightManager::AllocateAtlasCubeSlices(TArray<FShadowRenderRequest>& InOutRequestsCube)
@@ -650,6 +825,103 @@ void FLightManager::AllocateAtlasCubeSlices(TArray<FShadowRenderRequest>& InOutR
 	}
 }
 
+bool FLightManager::IsShadowViewCached(const FShadowRenderRequest& Request, uint64 CasterSignature, EShadowAATechnique Technique) const
+{
+	// 0은 캐시할 수 없는 뷰 (애니메이션 캐스터 포함)
+	if (CasterSignature == 0)
+	{
+		return false;
+	}
+
+	const TArray<FShadowViewCacheEntry>* Entries = ShadowViewCache.Find(Request.LightOwner);
+	if (!Entries || Request.SubViewIndex < 0 || Request.SubViewIndex >= Entries->Num())
+	{
+		return false;
+	}
+
+	const FShadowViewCacheEntry& Entry = (*Entries)[Request.SubViewIndex];
+	return Entry.bValid
+		&& Entry.Size == Request.Size
+		&& Entry.AssignedSliceIndex == Request.AssignedSliceIndex
+		&& Entry.AtlasViewportOffset == Request.AtlasViewportOffset
+		&& Entry.CasterSignature == CasterSignature
+		&& Entry.ShadowAATechnique == Technique
+		&& Entry.ViewMatrix == Request.ViewMatrix
+		&& Entry.ProjectionMatrix == Request.ProjectionMatrix;
+}
+
+void FLightManager::CacheShadowView(const FShadowRenderRequest& Request, uint64 CasterSignature, EShadowAATechnique Technique)
+{
+	if (!Request.LightOwner || Request.SubViewIndex < 0 || Request.Size == 0)
+	{
+		return;
+	}
+
+	const bool bCube = Request.AssignedSliceIndex >= 0;
+	const float MinX = Request.AtlasViewportOffset.X;
+	const float MinY = Request.AtlasViewportOffset.Y;
+	const float MaxX = MinX + Request.Size;
+	const float MaxY = MinY + Request.Size;
+
+	// 같은 영역을 덮어쓴 다른 뷰의 캐시는 더 이상 유효하지 않음
+	for (auto& Pair : ShadowViewCache)
+	{
+		for (int32 SubViewIndex = 0; SubViewIndex < Pair.second.Num(); ++SubViewIndex)
+		{
+			FShadowViewCacheEntry& Other = Pair.second[SubViewIndex];
+			if (!Other.bValid || (Pair.first == Request.LightOwner && SubViewIndex == Request.SubViewIndex))
+			{
+				continue;
+			}
+
+			bool bOverlaps = false;
+			if (bCube)
+			{
+				bOverlaps = Other.AssignedSliceIndex == Request.AssignedSliceIndex && SubViewIndex == Request.SubViewIndex;
+			}
+			else if (Other.AssignedSliceIndex < 0)
+			{
+				bOverlaps = Other.AtlasViewportOffset.X < MaxX && Other.AtlasViewportOffset.X + Other.Size > MinX
+					&& Other.AtlasViewportOffset.Y < MaxY && Other.AtlasViewportOffset.Y + Other.Size > MinY;
+			}
+
+			if (bOverlaps)
+			{
+				Other.bValid = false;
+			}
+		}
+	}
+
+	// 캐시할 수 없는 뷰는 영역만 덮어썼으므로 자기 항목도 무효화하고 저장하지 않음
+	if (CasterSignature == 0)
+	{
+		if (TArray<FShadowViewCacheEntry>* OwnEntries = ShadowViewCache.Find(Request.LightOwner))
+		{
+			if (Request.SubViewIndex < OwnEntries->Num())
+			{
+				(*OwnEntries)[Request.SubViewIndex].bValid = false;
+			}
+		}
+		return;
+	}
+
+	TArray<FShadowViewCacheEntry>& Entries = ShadowViewCache[Request.LightOwner];
+	if (Entries.Num() <= Request.SubViewIndex)
+	{
+		Entries.SetNum(Request.SubViewIndex + 1);
+	}
+
+	FShadowViewCacheEntry& Entry = Entries[Request.SubViewIndex];
+	Entry.ViewMatrix = Request.ViewMatrix;
+	Entry.ProjectionMatrix = Request.ProjectionMatrix;
+	Entry.AtlasViewportOffset = Request.AtlasViewportOffset;
+	Entry.Size = Request.Size;
+	Entry.AssignedSliceIndex = Request.AssignedSliceIndex;
+	Entry.CasterSignature = CasterSignature;
+	Entry.ShadowAATechnique = Technique;
+	Entry.bValid = true;
+}
+
 void FLightManager::ClearAllLightList()
 {
 	AmbientLightList.clear();
@@ -668,6 +940,8 @@ void FLightManager::ClearAllLightList()
 
 	ShadowDataCache2D.clear();
 	ShadowDataCacheCube.clear();
+	InvalidateShadowCache();
+	ResetAtlasAllocations();
 }
 
 template<typename T>
@@ -752,6 +1026,8 @@ void FLightManager::DeRegisterLight<UDirectionalLightComponent>(UDirectionalLigh
 	bHaveToUpdate = true;
 
 	ShadowDataCache2D.Remove(LightComponent);
+	ShadowViewCache.Remove(LightComponent);
+	ReleaseAtlasAllocations(LightComponent);
 }
 template<>
 void FLightManager::DeRegisterLight<UPointLightComponent>(UPointLightComponent* LightComponent)
@@ -768,6 +1044,7 @@ void FLightManager::DeRegisterLight<UPointLightComponent>(UPointLightComponent*
 	bHaveToUpdate = true;
 
 	ShadowDataCacheCube.Remove(LightComponent);
+	ShadowViewCache.Remove(LightComponent);
 }
 template<>
 void FLightManager::DeRegisterLight<USpotLightComponent>(USpotLightComponent* LightComponent)
@@ -783,6 +1060,8 @@ void FLightManager::DeRegisterLight<USpotLightComponent>(USpotLightComponent* Li
 	bHaveToUpdate = true;
 
 	ShadowDataCache2D.Remove(LightComponent);
+	ShadowViewCache.Remove(LightComponent);
+	ReleaseAtlasAllocations(LightComponent);
 }
 
 
@@ -1,4 +1,5 @@
 ﻿#pragma once
+#include "ShadowAtlasAllocator.h"
 #define CASCADED_MAX 8
 
 class UAmbientLightComponent;
@@ -7,6 +8,7 @@ class UPointLightComponent;
 class USpotLightComponent;
 class ULightComponent;
 class D3D11RHI;
+class FSceneView;
 
 enum class ELightType
 {
@@ -52,6 +54,34 @@ struct FShadowRenderRequest
     }
 };
 
+// 정적 섀도우 캐시 항목
+// 아틀라스 영역(2D) 또는 큐브 슬라이스의 면(Cube)에 마지막으로 그려진 섀도우 뷰를 식별합니다.
+// 라이트 행렬, 할당 영역, 캐스터 시그니처가 모두 같으면 해당 영역의 뎁스를 그대로 재사용합니다.
+struct FShadowViewCacheEntry
+{
+    FMatrix ViewMatrix;
+    FMatrix ProjectionMatrix;
+    FVector2D AtlasViewportOffset;
+    uint32 Size = 0;
+    int32 AssignedSliceIndex = -1; // -1: 2D 아틀라스, 그 외: 큐브 슬라이스
+    uint64 CasterSignature = 0;
+    EShadowAATechnique ShadowAATechnique = EShadowAATechnique::PCF;
+    bool bValid = false;
+};
+
+// 2D 섀도우 뷰의 영구 아틀라스 할당 정보 (라이트, SubViewIndex 단위)
+struct FShadowAtlasAllocation
+{
+    FShadowAtlasRegion Region;
+    uint32 DesiredSize = 0;  // LOD 적용 후 원하는 타일 크기 (Region.Size보다 크면 해상도가 강등된 상태)
+
+    // 해상도는 뷰마다가 아니라 프레임마다 한 번, 모든 뷰 중 가장 큰 LOD로 정한다 (멀티 뷰포트에서 뷰마다 재할당 방지)
+    uint32 FrameLODSize = 0;        // LODFrame 동안 뷰들이 요청한 최대 LOD 크기
+    uint32 PrevFrameLODSize = 0;    // 직전 프레임의 최대 (프레임 첫 뷰가 작은 크기로 되돌리지 않도록)
+    uint64 LODFrame = 0;
+    uint64 LastRequestedFrame = 0;  // 이번/지난 프레임에 어떤 뷰도 요청하지 않은 영역만 해제
+};
+
 // -----------------------------------------------------------------------------
 // 2. Pass 2 (GPU) 셰이더용 구조체
 // -----------------------------------------------------------------------------
@@ -155,9 +185,15 @@ public:
     void ClearAllDepthStencilView(D3D11RHI* RHIDevice);
     ID3D11RenderTargetView* GetVSMShadowAtlasRTV2D() const { return VSMShadowAtlasRTV2D; }
 
-    void AllocateAtlasRegions2D(TArray<FShadowRenderRequest>& InOutRequests2D);
+    // 라이트별 영역을 프레임 간 유지하며 할당합니다. View가 주어지면 거리/화면 점유율로 해상도 LOD를 적용합니다.
+    void AllocateAtlasRegions2D(TArray<FShadowRenderRequest>& InOutRequests2D, const FSceneView* View = nullptr);
     void AllocateAtlasCubeSlices(TArray<FShadowRenderRequest>& InOutRequestsCube);
 
+    // --- 정적 섀도우 캐시 (FSceneRenderer가 사용, CasterSignature 0은 캐시 불가) ---
+    bool IsShadowViewCached(const FShadowRenderRequest& Request, uint64 CasterSignature, EShadowAATechnique Technique) const;
+    void CacheShadowView(const FShadowRenderRequest& Request, uint64 CasterSignature, EShadowAATechnique Technique);
+    void InvalidateShadowCache() { ShadowViewCache.Empty(); }
+
     TArray<UAmbientLightComponent*> GetAmbientLightList() { return AmbientLightList; }
     TArray<UDirectionalLightComponent*> GetDirectionalLightList() { return DIrectionalLightList; }
     TArray<UPointLightComponent*> GetPointLightList() { return PointLightList; }
@@ -209,6 +245,19 @@ private:
     // Key: 라이트, Value: 할당된 큐브맵 슬라이스 인덱스
     TMap<ULightComponent*, int32> ShadowDataCacheCube;
 
+    // --- 정적 섀도우 캐시 (GPU 아틀라스 내용) ---
+    // Key: 라이트, Value: SubViewIndex별 마지막으로 그려진 섀도우 뷰
+    TMap<ULightComponent*, TArray<FShadowViewCacheEntry>> ShadowViewCache;
+
+    // --- 2D 아틀라스 영구 할당 ---
+    uint32 ComputeShadowLODSize(const FShadowRenderRequest& Request, const FSceneView* View) const;
+    void ReleaseAtlasAllocations(ULightComponent* Light);
+    void ResetAtlasAllocations();
+
+    FShadowAtlasAllocator ShadowAtlasAllocator2D;
+    // Key: 라이트, Value: SubViewIndex별 할당 영역
+    TMap<ULightComponent*, TArray<FShadowAtlasAllocation>> AtlasAllocations2D;
+
 
     //structured buffer
     ID3D11Buffer* PointLightBuffer = nullptr;
@@ -99,7 +99,7 @@ UShader* UMaterial::GetShader()
 	return Shader;
 }
 
-const TArray<FShaderMacro> UMaterial::GetShaderMacros() const
+const TArray<FShaderMacro>& UMaterial::GetShaderMacros() const
 {
 	return ShaderMacros;
 }
@@ -482,7 +482,7 @@ const FMaterialInfo& UMaterialInstanceDynamic::GetMaterialInfo() const
 	return CachedMaterialInfo;
 }
 
-const TArray<FShaderMacro> UMaterialInstanceDynamic::GetShaderMacros() const
+const TArray<FShaderMacro>& UMaterialInstanceDynamic::GetShaderMacros() const
 {
 	if (ParentMaterial)
 	{
@@ -7,8 +7,6 @@ class ACameraActor;
 class FViewport;
 class FViewportClient;
 
-struct FCandidateDrawable;
-
 // High-level scene rendering orchestrator extracted from UWorld
 class URenderManager : public UObject
 {
@@ -15,6 +15,7 @@
 #include "Gizmo/GizmoActor.h"
 #include "RenderSettings.h"
 #include "Occlusion.h"
+#include "OcclusionStats.h"
 #include "Frustum.h"
 #include "WorldPartitionManager.h"
 #include "BVHierarchy.h"
@@ -23,10 +24,13 @@
 #include "SkeletalMeshComponent.h"
 #include "DecalStatManager.h"
 #include "SkinningStats.h"
+#include "AnimUpdateRateManager.h"
 #include "BillboardComponent.h"
 #include "TextRenderComponent.h"
 #include "OBB.h"
 #include "BoundingSphere.h"
+#include "Collision.h"
+#include "Hash.h"
 #include "HeightFogComponent.h"
 #include "Gizmo/GizmoArrowComponent.h"
 #include "Gizmo/GizmoRotateComponent.h"
@@ -55,6 +59,9 @@
 #include "SkinnedMeshComponent.h"
 #include "ParticleSystemComponent.h"
 #include "ParticleStats.h"
+#include "ParticleDynamicBuffer.h"
+#include "ParticleSignificanceManager.h"
+#include "ParticleSystemPool.h"
 #include "ParticleEmitterInstance.h"
 #include "ParticleLODLevel.h"
 #include "Modules/ParticleModuleTypeDataMesh.h"
@@ -68,8 +75,6 @@ FSceneRenderer::FSceneRenderer(UWorld* InWorld, FSceneView* InView, URenderer* I
 	, OwnerRenderer(InOwnerRenderer)
 	, RHIDevice(InOwnerRenderer->GetRHIDevice())
 {
-	//OcclusionCPU = std::make_unique<FOcclusionCullingManagerCPU>();
-
 	// 타일 라이트 컬러 초기화
 	TileLightCuller = std::make_unique<FTileLightCuller>();
 	uint32 TileSize = World->GetRenderSettings().GetTileSize();
@@ -108,6 +113,9 @@ void FSceneRenderer::Render()
 	TIME_PROFILE(ShadowMapPass)
 	RenderShadowMaps();
 	TIME_PROFILE_END(ShadowMapPass)
+
+	// 메인 뷰 가시성 (섀도우 캐스터는 자체 절두체로 컬링하므로 Proxies.Meshes는 그대로 둔다)
+	PerformFrustumCulling();
 	
 	// ViewMode에 따라 렌더링 경로 결정
 	if (View->RenderSettings->GetViewMode() == EViewMode::VMI_Lit_Phong ||
@@ -314,18 +322,11 @@ void FSceneRenderer::RenderShadowMaps()
     FLightManager* LightManager = World->GetLightManager();
 	if (!LightManager) return;
 
-	// 2. 그림자 캐스터(Caster) 메시 수집
-	TArray<FMeshBatchElement> ShadowMeshBatches;
-	for (UMeshComponent* MeshComponent : Proxies.Meshes)
-	{
-		if (MeshComponent && MeshComponent->IsCastShadows() && MeshComponent->IsVisible())
-		{
-			MeshComponent->CollectMeshBatches(ShadowMeshBatches, View);
-		}
-	}
+	// 2. 그림자 캐스터(Caster) 후보 수집 (메시 배치는 다시 그려야 하는 섀도우 뷰에서만 지연 수집)
+	GatherShadowCasters();
 
 	// NOTE: 카메라 오버라이드 기능을 항상 활성화 하기 위해서 그림자를 그릴 곳이 없어도 함수 실행
-	//if (ShadowMeshBatches.IsEmpty()) return;
+	//if (ShadowCasters.IsEmpty()) return;
 
 	// 섀도우 맵을 DSV로 사용하기 전에 SRV 슬롯에서 해제
 	ID3D11ShaderResourceView* nullSRVs[2] = { nullptr, nullptr };
@@ -399,8 +400,23 @@ void FSceneRenderer::RenderShadowMaps()
 		return;
 	}
 
+	// 정적 섀도우 캐싱: 캐스터 집합/바운드, 라이트 행렬, 아틀라스 영역이 모두 그대로면 이전 프레임의 깊이를 재사용
+	const bool bShadowCaching = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_ShadowCaching);
+	if (!bShadowCaching)
+	{
+		LightManager->InvalidateShadowCache();
+	}
+	const EShadowAATechnique ShadowAAType = World->GetRenderSettings().GetShadowAATechnique();
+
+	uint32 NumViewsRendered = 0;
+	uint32 NumViewsCached = 0;
+	uint32 NumCasterDraws = 0;
+
+	TArray<int32> ViewCasters;
+	TArray<FMeshBatchElement> ViewBatches;
+
 	// 2D 아틀라스 할당
-	LightManager->AllocateAtlasRegions2D(Requests2D);
+	LightManager->AllocateAtlasRegions2D(Requests2D, View); // 프레임 간 영역 유지 + 거리/화면 점유율 LOD
 	// 2.2. 큐브맵 슬라이스 할당 (Allocate only)
 	LightManager->AllocateAtlasCubeSlices(RequestsCube); // FLightManager가 RequestsCube의 AssignedSliceIndex와 Size 업데이트
 
@@ -416,7 +432,6 @@ void FSceneRenderer::RenderShadowMaps()
 			RHIDevice->GetDeviceContext()->PSSetShaderResources(9, 2, NullSRV);
 			
 			float ClearColor[] = {1.0f, 1.0f, 0.0f, 0.0f};
-			EShadowAATechnique ShadowAAType = World->GetRenderSettings().GetShadowAATechnique();
 			switch (ShadowAAType)
 			{
 			case EShadowAATechnique::PCF:
@@ -425,7 +440,10 @@ void FSceneRenderer::RenderShadowMaps()
 			case EShadowAATechnique::VSM:
 				{
 					RHIDevice->OMSetCustomRenderTargets(1, &VSMAtlasRTV2D, AtlasDSV2D);
-					RHIDevice->GetDeviceContext()->ClearRenderTargetView(VSMAtlasRTV2D, ClearColor);
+					if (!bShadowCaching)
+					{
+						RHIDevice->GetDeviceContext()->ClearRenderTargetView(VSMAtlasRTV2D, ClearColor);
+					}
 					break;
 				}				
 			default:
@@ -433,7 +451,11 @@ void FSceneRenderer::RenderShadowMaps()
 				break;
 			}
 
-			RHIDevice->GetDeviceContext()->ClearDepthStencilView(AtlasDSV2D, D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1, 0);
+			// 캐싱 중에는 아틀라스 전체를 지우지 않고 다시 그릴 영역만 지움
+			if (!bShadowCaching)
+			{
+				RHIDevice->GetDeviceContext()->ClearDepthStencilView(AtlasDSV2D, D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1, 0);
+			}
 
 			RHIDevice->RSSetState(ERasterizerMode::Shadows);
 			RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual);
@@ -442,10 +464,37 @@ void FSceneRenderer::RenderShadowMaps()
 			{
 				// 뷰포트 설정
 				D3D11_VIEWPORT ShadowVP = { Request.AtlasViewportOffset.X, Request.AtlasViewportOffset.Y, static_cast<FLOAT>(Request.Size), static_cast<FLOAT>(Request.Size), 0.0f, 1.0f };
-				RHIDevice->GetDeviceContext()->RSSetViewports(1, &ShadowVP);
 
-				// 뎁스 패스 렌더링
-				RenderShadowDepthPass(Request, ShadowMeshBatches);
+				if (Request.Size > 0)
+				{
+					// 섀도우 뷰 단위 캐스터 컬링
+					CullShadowCasters(CreateFrustumFromViewProjection(Request.ViewMatrix * Request.ProjectionMatrix), nullptr, ViewCasters);
+					const uint64 CasterSignature = ComputeShadowCasterSignature(ViewCasters);
+
+					if (bShadowCaching && LightManager->IsShadowViewCached(Request, CasterSignature, ShadowAAType))
+					{
+						++NumViewsCached;
+					}
+					else
+					{
+						if (bShadowCaching)
+						{
+							ClearShadowAtlasRegion(ShadowVP, ShadowAAType == EShadowAATechnique::VSM);
+						}
+						RHIDevice->GetDeviceContext()->RSSetViewports(1, &ShadowVP);
+
+						// 뎁스 패스 렌더링
+						BuildShadowViewBatches(ViewCasters, ViewBatches);
+						RenderShadowDepthPass(Request, ViewBatches);
+
+						++NumViewsRendered;
+						NumCasterDraws += ViewCasters.Num();
+						if (bShadowCaching)
+						{
+							LightManager->CacheShadowView(Request, CasterSignature, ShadowAAType);
+						}
+					}
+				}
 
 				FShadowMapData Data;
 				if (Request.Size > 0) // 렌더링 성공
@@ -479,6 +528,10 @@ void FSceneRenderer::RenderShadowMaps()
 			D3D11_VIEWPORT ShadowVP = { 0.0f, 0.0f, (float)AtlasSizeCube, (float)AtlasSizeCube, 0.0f, 1.0f };
 			RHIDevice->GetDeviceContext()->RSSetViewports(1, &ShadowVP);
 
+			// 포인트 라이트 반경으로 한 번만 BVH 질의 후, 각 면은 이 후보 안에서만 컬링
+			ULightComponent* CandidateOwner = nullptr;
+			TArray<int32> LightCandidates;
+
 			// 이제 RequestsCube 배열을 직접 순회
 			for (FShadowRenderRequest& Request : RequestsCube) // 레퍼런스 유지
 			{
@@ -495,22 +548,55 @@ void FSceneRenderer::RenderShadowMaps()
 					LightManager->SetShadowCubeMapData(Request.LightOwner, Request.AssignedSliceIndex);
 				}
 
+				if (CandidateOwner != Request.LightOwner)
+				{
+					CandidateOwner = Request.LightOwner;
+					LightCandidates.Empty();
+
+					const FBoundingSphere LightSphere(Request.WorldLocation, Request.Radius);
+					for (int32 CasterIndex = 0; CasterIndex < ShadowCasters.Num(); ++CasterIndex)
+					{
+						if (Collision::Intersects(ShadowCasters[CasterIndex].Bounds, LightSphere))
+						{
+							LightCandidates.Add(CasterIndex);
+						}
+					}
+				}
+
 				// 할당된 슬라이스 인덱스와 원본 면 인덱스 사용
 				int32 SliceIndex = Request.AssignedSliceIndex;   // FLightManager가 할당한 값
 				int32 FaceIndex = Request.SubViewIndex; // 원본 면 인덱스
 
+				CullShadowCasters(CreateFrustumFromViewProjection(Request.ViewMatrix * Request.ProjectionMatrix), &LightCandidates, ViewCasters);
+				const uint64 CasterSignature = ComputeShadowCasterSignature(ViewCasters);
+				if (bShadowCaching && LightManager->IsShadowViewCached(Request, CasterSignature, ShadowAAType))
+				{
+					++NumViewsCached;
+					continue;
+				}
+
 				// 2.3. 면 렌더링 (기존 로직 유지)
 				ID3D11DepthStencilView* FaceDSV = LightManager->GetShadowCubeFaceDSV(SliceIndex, FaceIndex);
 				if (FaceDSV)
 				{
 					RHIDevice->OMSetCustomRenderTargets(0, nullptr, FaceDSV);
 					RHIDevice->GetDeviceContext()->ClearDepthStencilView(FaceDSV, D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1.0f, 0);
-					RenderShadowDepthPass(Request, ShadowMeshBatches);
+					BuildShadowViewBatches(ViewCasters, ViewBatches);
+					RenderShadowDepthPass(Request, ViewBatches);
+
+					++NumViewsRendered;
+					NumCasterDraws += ViewCasters.Num();
+					if (bShadowCaching)
+					{
+						LightManager->CacheShadowView(Request, CasterSignature, ShadowAAType);
+					}
 				}
 			}
 		}
 	}
 
+	FShadowStatManager::GetInstance().UpdateShadowViewStats(NumViewsRendered, NumViewsCached, NumCasterDraws);
+
 	// --- 3. RHI 상태 복구 ---
 	RHIDevice->RSSetState(ERasterizerMode::Solid);
 	ID3D11RenderTargetView* nullRTV = nullptr;
@@ -522,7 +608,7 @@ void FSceneRenderer::RenderShadowMaps()
 	// ViewProjBufferType 복구 (라이트 시점 Override 일 경우 마지막 라이트 시점으로 설정됨)
 	RHIDevice->SetAndUpdateConstantBuffer(ViewProjBufferType(OriginViewProjBuffer));
 
-	// Release GPU skinning bone buffers
+	// Release GPU skinning bone buffers (실제로 수집된 배치만)
 	for (const FMeshBatchElement& Batch : ShadowMeshBatches)
 	{
 		if (Batch.BoneMatricesBuffer)
@@ -530,6 +616,167 @@ void FSceneRenderer::RenderShadowMaps()
 			Batch.BoneMatricesBuffer->Release();
 		}
 	}
+	ShadowMeshBatches.Empty();
+}
+
+void FSceneRenderer::GatherShadowCasters()
+{
+	ShadowCasters.Empty();
+	ShadowCasterIndices.Empty();
+	ShadowMeshBatches.Empty();
+
+	UWorldPartitionManager* Partition = World->GetPartitionManager();
+	const FBVHierarchy* BVH = Partition ? Partition->GetBVH() : nullptr;
+
+	for (UMeshComponent* MeshComponent : Proxies.Meshes)
+	{
+		if (MeshComponent && MeshComponent->IsCastShadows() && MeshComponent->IsVisible())
+		{
+			FShadowCasterProxy Caster;
+			Caster.Component = MeshComponent;
+			Caster.Bounds = MeshComponent->GetWorldAABB();
+			Caster.bAnimated = Cast<USkinnedMeshComponent>(MeshComponent) != nullptr;
+			Caster.bInBVH = BVH && BVH->Contains(MeshComponent);
+
+			// 바운드가 같아도 회전하거나 메시가 바뀌면 그림자가 달라지므로 변환과 메시도 포함
+			const UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(MeshComponent);
+			uint64 StateHash = std::hash<const void*>{}(MeshComponent);
+			StateHash = HashCombine(StateHash, std::hash<const void*>{}(StaticMeshComponent ? StaticMeshComponent->GetStaticMesh() : nullptr));
+			const FMatrix WorldMatrix = MeshComponent->GetWorldMatrix();
+			for (int32 Row = 0; Row < 4; ++Row)
+			{
+				for (int32 Col = 0; Col < 4; ++Col)
+				{
+					StateHash = HashCombine(StateHash, std::hash<float>{}(WorldMatrix.M[Row][Col]));
+				}
+			}
+			const float* BoundValues[6] = { &Caster.Bounds.Min.X, &Caster.Bounds.Min.Y, &Caster.Bounds.Min.Z, &Caster.Bounds.Max.X, &Caster.Bounds.Max.Y, &Caster.Bounds.Max.Z };
+			for (const float* Value : BoundValues)
+			{
+				StateHash = HashCombine(StateHash, std::hash<float>{}(*Value));
+			}
+			Caster.StateHash = StateHash;
+
+			ShadowCasterIndices.Add(MeshComponent, ShadowCasters.Num());
+			ShadowCasters.Add(Caster);
+		}
+	}
+}
+
+void FSceneRenderer::CullShadowCasters(const FFrustum& InShadowFrustum, const TArray<int32>* InCandidates, TArray<int32>& OutCasterIndices)
+{
+	OutCasterIndices.Empty();
+
+	// 선형 검사용 전치 평면 (뷰당 한 번)
+	const FFrustumSIMD ShadowFrustum(InShadowFrustum);
+
+	// 후보가 주어지면(포인트 라이트 면) 후보 안에서만 선형 검사
+	if (InCandidates)
+	{
+		for (int32 CasterIndex : *InCandidates)
+		{
+			if (ShadowFrustum.IsVisible(ShadowCasters[CasterIndex].Bounds))
+			{
+				OutCasterIndices.Add(CasterIndex);
+			}
+		}
+		return;
+	}
+
+	UWorldPartitionManager* Partition = World->GetPartitionManager();
+	const FBVHierarchy* BVH = Partition ? Partition->GetBVH() : nullptr;
+
+	if (BVH)
+	{
+		TArray<UPrimitiveComponent*> Intersected;
+		BVH->QueryFrustumComponents(InShadowFrustum, Intersected);
+		for (UPrimitiveComponent* Component : Intersected)
+		{
+			if (int32* CasterIndex = ShadowCasterIndices.Find(Component))
+			{
+				OutCasterIndices.Add(*CasterIndex);
+			}
+		}
+	}
+
+	// BVH에 없는 캐스터(BVH 미구성, 아직 반영되지 않은 더티 컴포넌트)는 선형 검사
+	for (int32 CasterIndex = 0; CasterIndex < ShadowCasters.Num(); ++CasterIndex)
+	{
+		if (!ShadowCasters[CasterIndex].bInBVH && ShadowFrustum.IsVisible(ShadowCasters[CasterIndex].Bounds))
+		{
+			OutCasterIndices.Add(CasterIndex);
+		}
+	}
+}
+
+uint64 FSceneRenderer::ComputeShadowCasterSignature(const TArray<int32>& InCasterIndices) const
+{
+	// 순서에 무관하도록 캐스터별 해시를 더함
+	uint64 Signature = static_cast<uint64>(InCasterIndices.Num());
+	for (int32 CasterIndex : InCasterIndices)
+	{
+		const FShadowCasterProxy& Caster = ShadowCasters[CasterIndex];
+		if (Caster.bAnimated)
+		{
+			// 애니메이션 메시가 포함된 뷰는 매 프레임 다시 그림
+			return 0;
+		}
+
+		Signature += Caster.StateHash;
+	}
+	// 0은 "캐시 불가"로 예약
+	return Signature == 0 ? 1 : Signature;
+}
+
+void FSceneRenderer::BuildShadowViewBatches(const TArray<int32>& InCasterIndices, TArray<FMeshBatchElement>& OutBatches)
+{
+	OutBatches.Empty();
+	for (int32 CasterIndex : InCasterIndices)
+	{
+		FShadowCasterProxy& Caster = ShadowCasters[CasterIndex];
+		if (Caster.FirstBatch < 0)
+		{
+			Caster.FirstBatch = ShadowMeshBatches.Num();
+			Caster.Component->CollectMeshBatches(ShadowMeshBatches, View);
+			Caster.NumBatches = ShadowMeshBatches.Num() - Caster.FirstBatch;
+		}
+
+		for (int32 BatchIndex = 0; BatchIndex < Caster.NumBatches; ++BatchIndex)
+		{
+			OutBatches.Add(ShadowMeshBatches[Caster.FirstBatch + BatchIndex]);
+		}
+	}
+}
+
+void FSceneRenderer::ClearShadowAtlasRegion(const D3D11_VIEWPORT& InRegion, bool bClearVSMMoments)
+{
+	// ClearDepthStencilView는 영역 지정이 불가하므로 깊이 1.0에 고정된 전체 화면 삼각형으로 해당 영역만 덮어씀
+	UShader* FullScreenTriangleVS = UResourceManager::GetInstance().Load<UShader>(UResourceManager::FullScreenVSPath);
+	UShader* ShadowClearPS = UResourceManager::GetInstance().Load<UShader>("Shaders/Shadows/ShadowClear_PS.hlsl");
+	if (!FullScreenTriangleVS || !FullScreenTriangleVS->GetVertexShader() || !ShadowClearPS || !ShadowClearPS->GetPixelShader())
+	{
+		UE_LOG("ShadowClear용 셰이더 없음!\n");
+		return;
+	}
+
+	RHIDevice->PrepareShader(FullScreenTriangleVS, ShadowClearPS);
+	if (!bClearVSMMoments)
+	{
+		RHIDevice->GetDeviceContext()->PSSetShader(nullptr, nullptr, 0);
+	}
+
+	D3D11_VIEWPORT ClearVP = InRegion;
+	ClearVP.MinDepth = 1.0f;
+	ClearVP.MaxDepth = 1.0f;
+	RHIDevice->GetDeviceContext()->RSSetViewports(1, &ClearVP);
+	RHIDevice->RSSetState(ERasterizerMode::Solid);
+	RHIDevice->OMSetDepthStencilState(EComparisonFunc::GreaterEqual);	// Always는 깊이를 쓰지 않음
+
+	RHIDevice->DrawFullScreenQuad();
+
+	// 섀도우 뎁스 패스 상태로 복구
+	RHIDevice->RSSetState(ERasterizerMode::Shadows);
+	RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual);
 }
 
 void FSceneRenderer::RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest, const TArray<FMeshBatchElement>& InShadowBatches)
@@ -680,6 +927,17 @@ void FSceneRenderer::PrepareView()
 	// 공통 상수 버퍼 설정 (View, Projection 등) - 루프 전에 한 번만
 	FVector CameraPos = View->ViewLocation;
 
+	// 다음 프레임 스켈레탈 메시의 애니메이션 업데이트 레이트 판단 기준
+	FAnimUpdateRateManager::Get().RegisterView(View->ViewLocation, View->FieldOfView,
+		View->ProjectionMode == ECameraProjectionMode::Perspective);
+
+	// 다음 프레임 파티클 시스템의 중요도/예산 판단 기준 (이 뷰가 그리는 월드에만 등록)
+	if (FParticleSignificanceManager* Significance = World->GetParticleSignificanceManager())
+	{
+		Significance->RegisterView(View->ViewLocation, View->FieldOfView,
+			View->ProjectionMode == ECameraProjectionMode::Perspective);
+	}
+
 	FMatrix InvView = View->ViewMatrix.InverseAffine();
 	FMatrix InvProjection;
 	if (View->ProjectionMode == ECameraProjectionMode::Perspective)
@@ -719,10 +977,6 @@ void FSceneRenderer::PrepareView()
 
 void FSceneRenderer::GatherVisibleProxies()
 {
-	// NOTE: 일단 컴포넌트 단위와 데칼 관련 이슈 해결까지 컬링 무시
-	//// 절두체 컬링 수행 -> 결과가 멤버 변수 PotentiallyVisibleActors에 저장됨
-	//PerformFrustumCulling();
-
 	const bool bDrawStaticMeshes = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_StaticMeshes);
 	const bool bDrawSkeletalMeshes = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_SkeletalMeshes);
 	const bool bDrawDecals = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_Decals);
@@ -974,29 +1228,43 @@ void FSceneRenderer::PerformTileLightCulling()
 
 void FSceneRenderer::PerformFrustumCulling()
 {
-	PotentiallyVisibleComponents.clear();	// 할 필요 없는데 명목적으로 초기화
+	FOcclusionStats& Stats = FOcclusionStatManager::GetInstance().GetMutableStats();
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	// FSceneView::ViewFrustum은 채워지지 않으므로 뷰-투영 행렬에서 직접 만든다
+	const FMatrix ViewProjection = View->ViewMatrix * View->ProjectionMatrix;
+	const FFrustumSIMD ViewFrustum(CreateFrustumFromViewProjection(ViewProjection));
 
-	// Todo: 프로스텀 컬링 수행, 추후 프로스텀 컬링이 컴포넌트 단위로 변경되면 적용
+	VisibleMeshes.Empty();
+	VisibleMeshes.Reserve(Proxies.Meshes.Num());
+	for (UMeshComponent* MeshComponent : Proxies.Meshes)
+	{
+		const FAABB Bound = MeshComponent->GetWorldAABB();
 
-	//World->GetPartitionManager()->FrustumQuery(ViewFrustum)
+		// 빈 AABB(바운드 미구현 컴포넌트)는 항상 그린다
+		const bool bHasBounds = Bound.Min.X < Bound.Max.X || Bound.Min.Y < Bound.Max.Y || Bound.Min.Z < Bound.Max.Z;
+		if (!bHasBounds || ViewFrustum.IsVisible(Bound))
+		{
+			VisibleMeshes.Add(MeshComponent);
+		}
+	}
 
-	//for (AActor* Actor : World->GetActors())
-	//{
-	//	if (!Actor || Actor->GetActorHiddenInEditor()) continue;
+	Stats.FrustumTestedCount = static_cast<uint32>(Proxies.Meshes.Num());
+	Stats.FrustumCulledCount = static_cast<uint32>(Proxies.Meshes.Num() - VisibleMeshes.Num());
+	Stats.FrustumTimeMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
 
-	//	// 절두체 컬링을 통과한 액터만 목록에 추가
-	//	if (ViewFrustum.Intersects(Actor->GetBounds()))
-	//	{
-	//		PotentiallyVisibleActors.Add(Actor);
-	//	}
-	//}
+	// 와이어프레임은 가려진 메시도 보여야 하므로 오클루전 컬링을 하지 않는다
+	if (View->RenderSettings->GetViewMode() != EViewMode::VMI_Wireframe)
+	{
+		FOcclusionCullingManagerCPU::GetInstance().CullOccludedComponents(ViewProjection, View->ViewLocation, View->AspectRatio, VisibleMeshes);
+	}
 }
 
 void FSceneRenderer::RenderOpaquePass(EViewMode InRenderViewMode)
 {
 	// --- 1. 수집 (Collect) ---
 	MeshBatchElements.Empty();
-	for (UMeshComponent* MeshComponent : Proxies.Meshes)
+	for (UMeshComponent* MeshComponent : VisibleMeshes)
 	{
 		MeshComponent->CollectMeshBatches(MeshBatchElements, View);
 	}
@@ -1136,10 +1404,28 @@ void FSceneRenderer::RenderParticleSystemPass()
 	FParticleStats Stats;
 	Stats.ParticleSystemCount = static_cast<int32>(Proxies.ParticleSystems.size());
 
+	// 마지막 시뮬레이션 기준 파티클 바운드로 뷰 절두체 컬링
+	// 여기서 걸러진 시스템은 렌더 프레임이 갱신되지 않아 다음 프레임 중요도 판정에서 화면 밖으로 분류된다
+	const FFrustumSIMD ViewFrustum(CreateFrustumFromViewProjection(View->ViewMatrix * View->ProjectionMatrix));
+	TArray<UParticleSystemComponent*> VisibleParticleSystems;
+	VisibleParticleSystems.Reserve(Proxies.ParticleSystems.Num());
+
 	for (UParticleSystemComponent* ParticleSystem : Proxies.ParticleSystems)
 	{
 		if (ParticleSystem && ParticleSystem->IsVisible())
 		{
+			// 빈 AABB(빔/리본, 파티클 없음)는 항상 그린다
+			const FAABB& Bound = ParticleSystem->ParticleBounds;
+			const bool bHasBounds = Bound.Min.X < Bound.Max.X || Bound.Min.Y < Bound.Max.Y || Bound.Min.Z < Bound.Max.Z;
+			if (bHasBounds && !ViewFrustum.IsVisible(Bound))
+			{
+				Stats.CulledSystemCount++;
+			}
+			else
+			{
+				VisibleParticleSystems.Add(ParticleSystem);
+			}
+
 			for (FParticleEmitterInstance* EmitterInst : ParticleSystem->EmitterInstances)
 			{
 				if (EmitterInst)
@@ -1187,9 +1473,33 @@ void FSceneRenderer::RenderParticleSystemPass()
 		}
 	}
 
+	// 이 월드의 예산 사용량 (이번 프레임 틱 결과)
+	Stats.ParticleBudget = FParticleSignificanceManager::GetMaxParticles();
+	Stats.EmitterBudget = FParticleSignificanceManager::GetMaxEmitters();
+	if (const FParticleSignificanceManager* Significance = World->GetParticleSignificanceManager())
+	{
+		const FParticleSignificanceStats& SignificanceStats = Significance->GetStats();
+		Stats.BudgetedParticles = SignificanceStats.BudgetedParticles;
+		Stats.BudgetedEmitters = SignificanceStats.BudgetedEmitters;
+		Stats.SpawnSuppressedSystems = static_cast<int32>(SignificanceStats.SpawnSuppressedSystems);
+		Stats.ThrottledSystems = static_cast<int32>(SignificanceStats.EmitterThrottledSystems);
+		Stats.SimulatedSystems = static_cast<int32>(SignificanceStats.SimulatedSystems);
+		Stats.SkippedTicks = static_cast<int32>(SignificanceStats.SkippedTicks);
+		Stats.CatchUpSteps = static_cast<int32>(SignificanceStats.CatchUpSteps);
+	}
+
+	if (const FParticleSystemPool* Pool = World->GetParticleSystemPool())
+	{
+		const FParticleSystemPoolStats& PoolStats = Pool->GetStats();
+		Stats.PoolHits = PoolStats.Hits;
+		Stats.PoolMisses = PoolStats.Misses;
+		Stats.PoolActiveEffects = PoolStats.ActiveEffects;
+		Stats.PoolFreeComponents = PoolStats.FreeComponents;
+	}
+
 	FParticleStatManager::GetInstance().UpdateStats(Stats);
 
-	if (Proxies.ParticleSystems.empty())
+	if (VisibleParticleSystems.IsEmpty())
 		return;
 
 	// Show flag 체크 - 파티클 시스템 숨김 시 스킵
@@ -1203,16 +1513,19 @@ void FSceneRenderer::RenderParticleSystemPass()
 	const bool bWireframe = View->RenderSettings->GetViewMode() == EViewMode::VMI_Wireframe;
 
 	// 파티클 배치 수집
+	// 정점/인스턴스 데이터는 공유 링 버퍼에 구간만 할당해 두고, EndPass에서 이미터별로 병렬 기록 후 언맵
 	TArray<FMeshBatchElement> AllParticleBatches;
 
-	for (UParticleSystemComponent* ParticleSystem : Proxies.ParticleSystems)
+	FParticleDynamicBufferAllocator& DynamicBufferAllocator = FParticleDynamicBufferAllocator::GetInstance();
+	DynamicBufferAllocator.BeginPass();
+
+	for (UParticleSystemComponent* ParticleSystem : VisibleParticleSystems)
 	{
-		if (ParticleSystem && ParticleSystem->IsVisible())
-		{
-			ParticleSystem->CollectMeshBatches(AllParticleBatches, View);
-		}
+		ParticleSystem->CollectMeshBatches(AllParticleBatches, View);
 	}
 
+	DynamicBufferAllocator.EndPass();
+
 	if (AllParticleBatches.Num() == 0)
 		return;
 
@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "Frustum.h"
+#include "AABB.h"
 
 // TODO : Post Processing 떼어내기, 전방선언으로라든지...
 #include "PostProcessing/FadeInOutPass.h"
@@ -33,8 +34,6 @@ class ULineComponent;
 class UTriangleMeshComponent;
 class UParticleSystemComponent;
 
-struct FCandidateDrawable;
-
 // 렌더링할 대상들의 집합을 담는 구조체
 struct FVisibleRenderProxySet
 {
@@ -70,6 +69,18 @@ struct FSceneGlobals
 	TArray<UDOFComponent*> DOFs;
 };
 
+// 섀도우 캐스터 후보
+struct FShadowCasterProxy
+{
+	UMeshComponent* Component = nullptr;
+	FAABB Bounds;
+	int32 FirstBatch = -1;	// ShadowMeshBatches 내 시작 인덱스 (-1이면 아직 수집 전)
+	int32 NumBatches = 0;
+	uint64 StateHash = 0;	// 컴포넌트/메시/월드 변환/바운드 해시 (섀도우 뷰 캐시 서명용)
+	bool bAnimated = false;	// 스키닝 메시는 포즈가 매 프레임 바뀌므로 캐시하지 않음
+	bool bInBVH = false;	// 월드 BVH에 아직 반영되지 않은 캐스터는 선형으로 검사
+};
+
 /**
  * @class FSceneRenderer
  * @brief 한 프레임의 특정 뷰(View)에 대한 씬 렌더링을 총괄하는 임시(transient) 클래스.
@@ -92,13 +103,28 @@ private:
 	void RenderShadowMaps();
 	void RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest, const TArray<FMeshBatchElement>& InShadowBatches);
 
+	/** @brief 그림자를 드리우는 메시를 캐스터 후보로 수집합니다. (메시 배치 수집은 실제로 그릴 때까지 지연) */
+	void GatherShadowCasters();
+
+	/** @brief 섀도우 뷰 절두체와 겹치는 캐스터만 골라냅니다. InCandidates가 없으면 월드 BVH로 질의합니다. */
+	void CullShadowCasters(const FFrustum& InShadowFrustum, const TArray<int32>* InCandidates, TArray<int32>& OutCasterIndices);
+
+	/** @brief 캐스터 집합과 각 캐스터의 월드 바운드로 정적 섀도우 캐시 시그니처를 만듭니다. */
+	uint64 ComputeShadowCasterSignature(const TArray<int32>& InCasterIndices) const;
+
+	/** @brief 컬링된 캐스터의 메시 배치를 모읍니다. 캐스터별 배치는 프레임당 한 번만 수집됩니다. */
+	void BuildShadowViewBatches(const TArray<int32>& InCasterIndices, TArray<FMeshBatchElement>& OutBatches);
+
+	/** @brief 2D 아틀라스의 한 영역만 초기화합니다. (캐시된 다른 영역은 보존) */
+	void ClearShadowAtlasRegion(const D3D11_VIEWPORT& InRegion, bool bClearVSMMoments);
+
 	/** @brief 렌더링에 필요한 포인터들이 유효한지 확인합니다. */
 	bool IsValid() const;
 
 	/** @brief 렌더링에 필요한 뷰 행렬, 절두체 등 프레임 데이터를 준비합니다. */
 	void PrepareView();
 
-	/** @brief 월드의 모든 액터를 대상으로 절두체 컬링을 수행합니다. */
+	/** @brief 수집된 메시를 뷰 절두체와 CPU 오클루전 버퍼로 컬링해 VisibleMeshes를 채웁니다. */
 	void PerformFrustumCulling();
 
 	/** @brief 씬을 순회하며 컬링을 통과한 모든 렌더링 대상을 수집합니다. */
@@ -151,12 +177,17 @@ private:
 	// 씬 전역 설정
 	FSceneGlobals SceneGlobals;
 
-	// 컬링을 거친 가시성 목록, NOTE: 추후 컴포넌트 단위로 수정
-	TArray<UPrimitiveComponent*> PotentiallyVisibleComponents;
+	// 절두체/오클루전 컬링을 통과한 메시 (불투명 패스가 그린다)
+	TArray<UMeshComponent*> VisibleMeshes;
 
 	// 각 패스에서 수집된 드로우 콜 정보 리스트
 	TArray<FMeshBatchElement> MeshBatchElements;
 
+	// 섀도우 캐스터 후보와 지연 수집된 섀도우 메시 배치
+	TArray<FShadowCasterProxy> ShadowCasters;
+	TMap<UPrimitiveComponent*, int32> ShadowCasterIndices;
+	TArray<FMeshBatchElement> ShadowMeshBatches;
+
 	// 타일 기반 라이트 컬링 시스템 (매 프레임 생성되고 소멸되어서 스마트 포인터로 설정)
 	std::unique_ptr<FTileLightCuller> TileLightCuller;
 
@@ -1,92 +1,99 @@
 ﻿#include "pch.h"
 #include "Shader.h"
 #include "Hash.h"
+#include "ShaderCompileManager.h"
 
 IMPLEMENT_CLASS(UShader)
 
-// 컴파일 로직을 처리하는 비공개 헬퍼 함수
+bool UShader::bAsyncCompileEnabled = true;
+
+// 파일 이름 접미사로 컴파일할 스테이지를 결정 (_VS.hlsl / _PS.hlsl / 둘 다)
+static void GetShaderStages(const FString& InShaderPath, bool& bOutCompileVS, bool& bOutCompilePS)
+{
+	auto EndsWith = [](const FString& str, const FString& suffix)
+		{
+			if (str.size() < suffix.size()) return false;
+			return std::equal(suffix.rbegin(), suffix.rend(), str.rbegin(),
+				[](char a, char b) { return static_cast<char>(::tolower(a)) == static_cast<char>(::tolower(b)); });
+		};
+
+	bOutCompileVS = !EndsWith(InShaderPath, "_PS.hlsl");
+	bOutCompilePS = !EndsWith(InShaderPath, "_VS.hlsl");
+}
+
+static TArray<TPair<FString, FString>> ConvertMacrosToStrings(const TArray<FShaderMacro>& InMacros)
+{
+	TArray<TPair<FString, FString>> MacroStrings;
+	MacroStrings.reserve(InMacros.Num());
+	for (const FShaderMacro& Macro : InMacros)
+	{
+		MacroStrings.emplace_back(Macro.Name.ToString(), Macro.Definition.ToString());
+	}
+	return MacroStrings;
+}
+
+// 컴파일 로직을 처리하는 비공개 헬퍼 함수 (디스크 캐시는 FShaderCompileManager::CompileStage가 처리)
 static bool CompileShaderInternal(
-	const FWideString& InFilePath,
+	const FString& InFilePath,
 	const char* InEntryPoint,
 	const char* InTarget,
-	UINT InCompileFlags,
-	const D3D_SHADER_MACRO* InDefines,
+	const TArray<TPair<FString, FString>>& InMacroStrings,
+	uint64 InSourceHash,
 	ID3DBlob** OutBlob
 )
 {
-	ID3DBlob* ErrorBlob = nullptr;
-	HRESULT Hr = D3DCompileFromFile(
-		InFilePath.c_str(),
-		InDefines,
-		D3D_COMPILE_STANDARD_FILE_INCLUDE,
-		InEntryPoint,
-		InTarget,
-		InCompileFlags,
-		0,
-		OutBlob,
-		&ErrorBlob
-	);
-
-	if (FAILED(Hr))
-	{
-		if (ErrorBlob)
+	FString ErrorMessage;
+	if (!FShaderCompileManager::CompileStage(InFilePath, InEntryPoint, InTarget, InMacroStrings, InSourceHash, OutBlob, &ErrorMessage))
+	{
+		if (!ErrorMessage.empty())
 		{
-			char* Msg = (char*)ErrorBlob->GetBufferPointer();
-
-			// wstring을 UTF-8로 안전하게 변환 (한글 경로 지원)
-			FString NarrowPath = WideToUTF8(InFilePath);
-
-			UE_LOG("[error] Shader '%s' compile error: %s", NarrowPath.c_str(), Msg);
-			ErrorBlob->Release();
+			UE_LOG("[error] Shader '%s' compile error: %s", InFilePath.c_str(), ErrorMessage.c_str());
 		}
-		if (*OutBlob) { (*OutBlob)->Release(); }
 		return false;
 	}
-
-	if (ErrorBlob) { ErrorBlob->Release(); }
 	return true;
 }
 
 UShader::~UShader()
 {
+	FShaderCompileManager::GetInstance().CancelJobs(this);
 	ReleaseResources();
 }
 
-uint64 UShader::GenerateShaderKey(const TArray<FShaderMacro>& InMacros)
+uint64 UShader::GenerateShaderKey(TConstArrayView<FShaderMacro> InMacros)
 {
-	// 1. TMap을 사용해 중복 제거
-	TMap<FName, FName> UniqueMacroMap;
-	for (const FShaderMacro& Macro : InMacros)
-	{
-		UniqueMacroMap.Add(Macro.Name, Macro.Definition);
-	}
-
-	// 2. 안정적인(Stable) 해시를 위해 키를 정렬
-	TArray<FName> SortedNames;
-	SortedNames = UniqueMacroMap.GetKeys();
-	SortedNames.Sort([](const FName& A, const FName& B)
+	// 매 배치마다 호출되므로 힙 할당 없이 처리한다 (매크로는 보통 수 개)
+	// 1. 안정적인(Stable) 해시를 위해 이름으로 정렬 (stable_sort라 같은 이름은 입력 순서 유지)
+	TInlineArray<FShaderMacro, 16> SortedMacros;
+	SortedMacros.assign(InMacros.begin(), InMacros.end());
+	std::stable_sort(SortedMacros.begin(), SortedMacros.end(), [](const FShaderMacro& A, const FShaderMacro& B)
 		{
-			return A.ComparisonIndex < B.ComparisonIndex;
+			return A.Name.ComparisonIndex < B.Name.ComparisonIndex;
 		});
 
-	// 3. FName의 해시를 조합하여 최종 키 해시 생성
+	// 2. FName의 해시를 조합하여 최종 키 해시 생성
+	// 같은 이름이 여러 번 있으면 마지막 정의만 사용 (나중에 추가된 매크로가 덮어씀)
 	// (FName의 GetTypeHash()는 내부적으로 정수 인덱스를 사용하므로 매우 빠릅니다.)
 	uint64 KeyHash = 0;
-	for (const FName& Name : SortedNames)
+	for (int32 Index = 0; Index < SortedMacros.Num(); ++Index)
 	{
-		const FName& Definition = UniqueMacroMap[Name];
+		const FShaderMacro& Macro = SortedMacros[Index];
+		if (Index + 1 < SortedMacros.Num() && SortedMacros[Index + 1].Name == Macro.Name)
+		{
+			continue;
+		}
 
-		KeyHash = HashCombine(KeyHash, GetTypeHash(Name));
-		KeyHash = HashCombine(KeyHash, GetTypeHash(Definition));
+		KeyHash = HashCombine(KeyHash, GetTypeHash(Macro.Name));
+		KeyHash = HashCombine(KeyHash, GetTypeHash(Macro.Definition));
 	}
 
 	return KeyHash;
 }
 
-FString UShader::GenerateMacrosToString(const TArray<FShaderMacro>& InMacros)
+FString UShader::GenerateMacrosToString(TConstArrayView<FShaderMacro> InMacros)
 {
 	// 매크로 순서가 달라도 동일한 키를 생성하기 위해 정렬합니다.
-	TArray<FShaderMacro> SortedMacros = InMacros;
+	TArray<FShaderMacro> SortedMacros = InMacros.ToArray();
 	SortedMacros.Sort([](const FShaderMacro& A, const FShaderMacro& B)
 		{
 			return A.Name.ComparisonIndex < B.Name.ComparisonIndex;
@@ -129,6 +136,10 @@ void UShader::Load(const FString& InShaderPath, ID3D11Device* InDevice, const TA
 		}
 		// Include 파일 파싱 (최초 1회)
 		ParseIncludeFiles(FilePath);
+
+		TArray<FString> SourceFiles = IncludedFiles;
+		SourceFiles.Add(FilePath);
+		SourceHash = FShaderCompileManager::HashFileContents(SourceFiles);
 	}
 
 	// 2. 실제 컴파일/가져오기 로직은 GetOrCompileShaderVariant에 위임
@@ -146,7 +157,7 @@ void UShader::Load(const FString& InShaderPath, ID3D11Device* InDevice, const TA
  * @param InMacros 컴파일(또는 검색)할 매크로 배열
  * @return FShaderVariant 포인터 (성공 시) 또는 nullptr (실패 시)
  */
-FShaderVariant* UShader::GetOrCompileShaderVariant(const TArray<FShaderMacro>& InMacros)
+FShaderVariant* UShader::GetOrCompileShaderVariant(TConstArrayView<FShaderMacro> InMacros)
 {
 	ID3D11Device* InDevice = GEngine.GetRHIDevice()->GetDevice();
 
@@ -168,7 +179,7 @@ FShaderVariant* UShader::GetOrCompileShaderVariant(const TArray<FShaderMacro>& I
 
 	// 3. 맵에 없음 -> 새로 컴파일
 	FShaderVariant NewShaderVariant;
-	bool bSuccess = CompileVariantInternal(InDevice, FilePath, InMacros, NewShaderVariant);
+	bool bSuccess = CompileVariantInternal(InDevice, FilePath, InMacros.ToArray(), NewShaderVariant);
 
 	if (bSuccess)
 	{
@@ -189,6 +200,121 @@ FShaderVariant* UShader::GetOrCompileShaderVariant(const TArray<FShaderMacro>& I
 	return nullptr;
 }
 
+/**
+ * @brief GetOrCompileShaderVariant의 비동기 버전. 메시 배치 수집처럼 매 프레임 호출되는 곳에서 사용합니다.
+ * 요청한 Variant가 아직 없으면 백그라운드 컴파일을 요청하고, 완료될 때까지 Fallback Variant(보통 뷰 기본 매크로)를 반환합니다.
+ * 새 머티리얼 조합이나 군중 스폰으로 처음 보는 퍼뮤테이션이 생겨도 게임 스레드가 컴파일로 멈추지 않습니다.
+ */
+FShaderVariant* UShader::GetOrCompileShaderVariantAsync(TConstArrayView<FShaderMacro> InMacros, TConstArrayView<FShaderMacro> InFallbackMacros)
+{
+	const uint64 Key = GenerateShaderKey(InMacros);
+	if (FShaderVariant* Found = ShaderVariantMap.Find(Key))
+	{
+		return Found;
+	}
+
+	const uint64 FallbackKey = GenerateShaderKey(InFallbackMacros);
+	if (!bAsyncCompileEnabled || FilePath.empty() || FallbackKey == Key)
+	{
+		return GetOrCompileShaderVariant(InMacros);
+	}
+
+	RequestShaderVariantAsync(InMacros);
+
+	// Fallback은 한 번만 동기 컴파일 (실패해도 nullptr을 반환해 해당 배치를 건너뜀)
+	if (FShaderVariant* Fallback = ShaderVariantMap.Find(FallbackKey))
+	{
+		return Fallback;
+	}
+	if (FailedVariantKeys.Contains(FallbackKey))
+	{
+		return nullptr;
+	}
+
+	FShaderVariant* Fallback = GetOrCompileShaderVariant(InFallbackMacros);
+	if (!Fallback)
+	{
+		FailedVariantKeys.Add(FallbackKey);
+	}
+	return Fallback;
+}
+
+bool UShader::RequestShaderVariantAsync(TConstArrayView<FShaderMacro> InMacros)
+{
+	if (FilePath.empty())
+	{
+		return false;
+	}
+
+	const uint64 Key = GenerateShaderKey(InMacros);
+	if (ShaderVariantMap.Contains(Key) || PendingVariantKeys.Contains(Key) || FailedVariantKeys.Contains(Key))
+	{
+		return false;
+	}
+
+	PendingVariantKeys.Add(Key);
+	FShaderCompileManager::GetInstance().Enqueue(CreateCompileJob(Key, InMacros));
+	return true;
+}
+
+FShaderCompileJob* UShader::CreateCompileJob(uint64 InKey, TConstArrayView<FShaderMacro> InMacros) const
+{
+	FShaderCompileJob* Job = new FShaderCompileJob();
+	Job->Shader = const_cast<UShader*>(this);
+	Job->VariantKey = InKey;
+	Job->SourceHash = SourceHash;
+	Job->ShaderPath = FilePath;
+	Job->Macros = InMacros.ToArray();
+	Job->MacroStrings = ConvertMacrosToStrings(Job->Macros);
+	GetShaderStages(FilePath, Job->bCompileVS, Job->bCompilePS);
+	return Job;
+}
+
+void UShader::FinishAsyncCompile(FShaderCompileJob& InJob)
+{
+	PendingVariantKeys.Remove(InJob.VariantKey);
+
+	// 컴파일 도중 소스가 바뀌었거나(핫 리로드) 이미 동기 경로로 만들어졌으면 결과를 버림
+	if (InJob.SourceHash != SourceHash || ShaderVariantMap.Contains(InJob.VariantKey))
+	{
+		return;
+	}
+
+	const bool bVSFailed = InJob.bCompileVS && !InJob.VSBlob;
+	const bool bPSFailed = InJob.bCompilePS && !InJob.PSBlob;
+	if (bVSFailed || bPSFailed)
+	{
+		UE_LOG("[error] Shader '%s' async compile error (%s): %s", FilePath.c_str(), GenerateMacrosToString(InJob.Macros).c_str(), InJob.ErrorMessage.c_str());
+		FailedVariantKeys.Add(InJob.VariantKey);
+		return;
+	}
+
+	ID3D11Device* Device = GEngine.GetRHIDevice()->GetDevice();
+
+	// Blob 소유권을 Variant로 이전
+	FShaderVariant NewVariant;
+	NewVariant.VSBlob = InJob.VSBlob;
+	NewVariant.PSBlob = InJob.PSBlob;
+	InJob.VSBlob = nullptr;
+	InJob.PSBlob = nullptr;
+
+	HRESULT Hr;
+	if (NewVariant.VSBlob)
+	{
+		Hr = Device->CreateVertexShader(NewVariant.VSBlob->GetBufferPointer(), NewVariant.VSBlob->GetBufferSize(), nullptr, &NewVariant.VertexShader);
+		assert(SUCCEEDED(Hr));
+		CreateInputLayout(Device, FilePath, InJob.Macros, NewVariant);
+	}
+	if (NewVariant.PSBlob)
+	{
+		Hr = Device->CreatePixelShader(NewVariant.PSBlob->GetBufferPointer(), NewVariant.PSBlob->GetBufferSize(), nullptr, &NewVariant.PixelShader);
+		assert(SUCCEEDED(Hr));
+	}
+	NewVariant.SourceMacros = InJob.Macros;
+
+	ShaderVariantMap.Add(InJob.VariantKey, NewVariant);
+}
+
 /**
  * @brief [신규] 실제 컴파일 로직을 수행하는 private 헬퍼 함수입니다.
  * @param InDevice D3D 디바이스
@@ -199,40 +325,21 @@ FShaderVariant* UShader::GetOrCompileShaderVariant(const TArray<FShaderMacro>& I
  */
 bool UShader::CompileVariantInternal(ID3D11Device* InDevice, const FString& InShaderPath, const TArray<FShaderMacro>& InMacros, FShaderVariant& OutVariant)
 {
-	FWideString WFilePath = UTF8ToWide(InShaderPath);
-
-	// --- 1. D3D_SHADER_MACRO* 형태로 변환 ---
-	TArray<D3D_SHADER_MACRO> Defines;
-	TArray<TPair<FString, FString>> MacroStrings; // 포인터 유효성 유지를 위한 저장소
-	MacroStrings.reserve(InMacros.Num());
-	for (const FShaderMacro& Macro : InMacros)
-	{
-		MacroStrings.emplace_back(Macro.Name.ToString(), Macro.Definition.ToString());
-		Defines.push_back({ MacroStrings.back().first.c_str(), MacroStrings.back().second.c_str() });
-	}
-	Defines.push_back({ NULL, NULL }); // 배열의 끝을 알리는 NULL 터미네이터
+	// --- 1. 워커 스레드와 같은 경로를 쓰도록 매크로를 문자열로 변환 ---
+	const TArray<TPair<FString, FString>> MacroStrings = ConvertMacrosToStrings(InMacros);
 
-	// --- 2. 컴파일 플래그 설정 ---
-	UINT CompileFlags = 0;
-#if defined(DEBUG) || defined(_DEBUG)
-	CompileFlags = D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION;
-#endif
-
-	auto EndsWith = [](const FString& str, const FString& suffix)
-		{
-			if (str.size() < suffix.size()) return false;
-			return std::equal(suffix.rbegin(), suffix.rend(), str.rbegin(),
-				[](char a, char b) { return static_cast<char>(::tolower(a)) == static_cast<char>(::tolower(b)); });
-		};
+	bool bCompileVS = false;
+	bool bCompilePS = false;
+	GetShaderStages(InShaderPath, bCompileVS, bCompilePS);
 
 	HRESULT Hr;
 	bool bVsCompiled = false;
 	bool bPsCompiled = false;
 
-	// --- 3. 컴파일 결과를 OutVariant에 저장 ---
-	if (EndsWith(InShaderPath, "_VS.hlsl"))
+	// --- 2. 컴파일 결과를 OutVariant에 저장 ---
+	if (bCompileVS)
 	{
-		bVsCompiled = CompileShaderInternal(WFilePath, "mainVS", "vs_5_0", CompileFlags, Defines.data(), &OutVariant.VSBlob);
+		bVsCompiled = CompileShaderInternal(InShaderPath, "mainVS", "vs_5_0", MacroStrings, SourceHash, &OutVariant.VSBlob);
 		if (bVsCompiled)
 		{
 			Hr = InDevice->CreateVertexShader(OutVariant.VSBlob->GetBufferPointer(), OutVariant.VSBlob->GetBufferSize(), nullptr, &OutVariant.VertexShader);
@@ -240,37 +347,20 @@ bool UShader::CompileVariantInternal(ID3D11Device* InDevice, const FString& InSh
 			CreateInputLayout(InDevice, InShaderPath, InMacros, OutVariant); // InMacros 전달
 		}
 	}
-	else if (EndsWith(InShaderPath, "_PS.hlsl"))
+	if (bCompilePS)
 	{
-		bPsCompiled = CompileShaderInternal(WFilePath, "mainPS", "ps_5_0", CompileFlags, Defines.data(), &OutVariant.PSBlob);
+		bPsCompiled = CompileShaderInternal(InShaderPath, "mainPS", "ps_5_0", MacroStrings, SourceHash, &OutVariant.PSBlob);
 		if (bPsCompiled)
 		{
 			Hr = InDevice->CreatePixelShader(OutVariant.PSBlob->GetBufferPointer(), OutVariant.PSBlob->GetBufferSize(), nullptr, &OutVariant.PixelShader);
 			assert(SUCCEEDED(Hr));
 		}
 	}
-	else // (VS + PS)
-	{
-		bVsCompiled = CompileShaderInternal(WFilePath, "mainVS", "vs_5_0", CompileFlags, Defines.data(), &OutVariant.VSBlob);
-		bPsCompiled = CompileShaderInternal(WFilePath, "mainPS", "ps_5_0", CompileFlags, Defines.data(), &OutVariant.PSBlob);
 
-		if (bVsCompiled)
-		{
-			Hr = InDevice->CreateVertexShader(OutVariant.VSBlob->GetBufferPointer(), OutVariant.VSBlob->GetBufferSize(), nullptr, &OutVariant.VertexShader);
-			assert(SUCCEEDED(Hr));
-			CreateInputLayout(InDevice, InShaderPath, InMacros, OutVariant);
-		}
-		if (bPsCompiled)
-		{
-			Hr = InDevice->CreatePixelShader(OutVariant.PSBlob->GetBufferPointer(), OutVariant.PSBlob->GetBufferSize(), nullptr, &OutVariant.PixelShader);
-			assert(SUCCEEDED(Hr));
-		}
-	}
-
-	// 4. 핫 리로드용 매크로 저장
+	// 3. 핫 리로드용 매크로 저장
 	OutVariant.SourceMacros = InMacros;
 
-	// 5. 컴파일 성공 여부 반환 (VS 또는 PS 둘 중 하나라도 성공 시)
+	// 4. 컴파일 성공 여부 반환 (VS 또는 PS 둘 중 하나라도 성공 시)
 	return bVsCompiled || bPsCompiled;
 }
 
@@ -447,6 +537,15 @@ bool UShader::Reload(ID3D11Device* InDevice)
 
 	UE_LOG("Hot Reloading Shader File: %s (%d variants)", FilePath.c_str(), ShaderVariantMap.Num());
 
+	// 이전 소스로 진행 중인 비동기 컴파일은 버리고, 실패했던 Variant도 다시 시도할 수 있게 함
+	FShaderCompileManager::GetInstance().CancelJobs(this);
+	PendingVariantKeys.Empty();
+	FailedVariantKeys.Empty();
+
+	TArray<FString> SourceFiles = IncludedFiles;
+	SourceFiles.Add(FilePath);
+	SourceHash = FShaderCompileManager::HashFileContents(SourceFiles);
+
 	// 2. [백업] 현재 맵을 Old 맵으로 이동시킵니다.
 	// (ShaderVariantMap은 이제 비어있습니다)
 	TMap<uint64, FShaderVariant> OldShaderVariantMap = std::move(ShaderVariantMap);
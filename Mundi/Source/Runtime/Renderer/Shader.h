@@ -37,17 +37,32 @@ struct FShaderVariant
 	}
 };
 
+struct FShaderCompileJob;
+
 class UShader : public UResourceBase
 {
 public:
 	DECLARE_CLASS(UShader, UResourceBase)
 
-	static uint64 GenerateShaderKey(const TArray<FShaderMacro>& InMacros);
-	static FString GenerateMacrosToString(const TArray<FShaderMacro>& InMacros);	// UI 출력 or 디버깅용
+	// 매크로는 뷰로 받는다 (인라인 배열 등 할당자가 다른 배열도 복사 없이 전달)
+	static uint64 GenerateShaderKey(TConstArrayView<FShaderMacro> InMacros);
+	static FString GenerateMacrosToString(TConstArrayView<FShaderMacro> InMacros);	// UI 출력 or 디버깅용
 
 	void Load(const FString& ShaderPath, ID3D11Device* InDevice, const TArray<FShaderMacro>& InMacros = TArray<FShaderMacro>());
 
-	FShaderVariant* GetOrCompileShaderVariant(const TArray<FShaderMacro>& InMacros = TArray<FShaderMacro>());
+	FShaderVariant* GetOrCompileShaderVariant(TConstArrayView<FShaderMacro> InMacros = TConstArrayView<FShaderMacro>());
+
+	// Variant가 없으면 백그라운드 컴파일을 요청하고, 완료 전까지는 InFallbackMacros의 Variant를 반환합니다.
+	// (Fallback도 없으면 한 번만 동기 컴파일)
+	FShaderVariant* GetOrCompileShaderVariantAsync(TConstArrayView<FShaderMacro> InMacros, TConstArrayView<FShaderMacro> InFallbackMacros = TConstArrayView<FShaderMacro>());
+	// 프리웜용: 새로 컴파일을 요청했으면 true
+	bool RequestShaderVariantAsync(TConstArrayView<FShaderMacro> InMacros);
+	// FShaderCompileManager가 게임 스레드에서 호출
+	void FinishAsyncCompile(FShaderCompileJob& InJob);
+
+	static void SetAsyncCompileEnabled(bool bEnabled) { bAsyncCompileEnabled = bEnabled; }
+	static bool IsAsyncCompileEnabled() { return bAsyncCompileEnabled; }
+
 	bool CompileVariantInternal(ID3D11Device* InDevice, const FString& InShaderPath, const TArray<FShaderMacro>& InMacros, FShaderVariant& OutVariant);
 	//FShaderVariant* GetShaderVariant(const TArray<FShaderMacro>& InMacros = TArray<FShaderMacro>());
 	ID3D11InputLayout* GetInputLayout(const TArray<FShaderMacro>& InMacros = TArray<FShaderMacro>());
@@ -65,6 +80,15 @@ protected:
 private:
 	TMap<uint64, FShaderVariant> ShaderVariantMap;
 
+	// 비동기 컴파일 중이거나 실패한 Variant 키 (실패한 키는 핫 리로드 전까지 다시 요청하지 않음)
+	TSet<uint64> PendingVariantKeys;
+	TSet<uint64> FailedVariantKeys;
+
+	// 소스 + include 파일 내용 해시 (디스크 캐시 키, 오래된 비동기 결과 판별용)
+	uint64 SourceHash = 0;
+
+	static bool bAsyncCompileEnabled;
+
 	// Store included files (e.g., "Shaders/Common/LightingCommon.hlsl")
 	// Used for hot reload - if any included file changes, reload this shader
 	TArray<FString> IncludedFiles;
@@ -73,6 +97,8 @@ private:
 	void CreateInputLayout(ID3D11Device* Device, const FString& InShaderPath, const TArray<FShaderMacro>& InMacros, FShaderVariant& InOutVariant);
 	void ReleaseResources();
 
+	FShaderCompileJob* CreateCompileJob(uint64 InKey, TConstArrayView<FShaderMacro> InMacros) const;
+
 	// Include 파일 파싱 및 추적
 	void ParseIncludeFiles(const FString& ShaderPath);
 	void UpdateIncludeTimestamps();
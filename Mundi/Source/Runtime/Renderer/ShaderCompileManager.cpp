@@ -0,0 +1,409 @@
+﻿#include "pch.h"
+#include "ShaderCompileManager.h"
+#include "Hash.h"
+#include "Material.h"
+#include "MeshComponent.h"
+#include "SkinnedMeshComponent.h"
+#include "RenderSettings.h"
+#include <cstdio>
+
+namespace
+{
+	// FNV-1a (실행마다 값이 같아야 하므로 std::hash 대신 사용)
+	uint64 HashBytes(const void* InData, size_t InSize, uint64 InSeed = 0xcbf29ce484222325ull)
+	{
+		const uint8* Bytes = static_cast<const uint8*>(InData);
+		uint64 Hash = InSeed;
+		for (size_t i = 0; i < InSize; ++i)
+		{
+			Hash ^= Bytes[i];
+			Hash *= 0x100000001b3ull;
+		}
+		return Hash;
+	}
+
+	uint64 HashString(const FString& InString, uint64 InSeed = 0xcbf29ce484222325ull)
+	{
+		return HashBytes(InString.data(), InString.size(), InSeed);
+	}
+
+	// 매크로 순서와 무관한 안정적인 해시 (FName 인덱스는 실행마다 달라질 수 있어 문자열로 계산)
+	uint64 HashMacroStrings(const TArray<TPair<FString, FString>>& InMacroStrings)
+	{
+		TArray<TPair<FString, FString>> Sorted = InMacroStrings;
+		Sorted.Sort([](const TPair<FString, FString>& A, const TPair<FString, FString>& B)
+			{
+				return A.first < B.first;
+			});
+
+		uint64 Hash = 0xcbf29ce484222325ull;
+		for (const TPair<FString, FString>& Macro : Sorted)
+		{
+			Hash = HashString(Macro.first, Hash);
+			Hash = HashString("=", Hash);
+			Hash = HashString(Macro.second, Hash);
+			Hash = HashString(";", Hash);
+		}
+		return Hash;
+	}
+}
+
+FShaderCompileManager::~FShaderCompileManager()
+{
+	Shutdown();
+}
+
+void FShaderCompileManager::Enqueue(FShaderCompileJob* InJob)
+{
+	if (!InJob)
+	{
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		if (bStopping)
+		{
+			delete InJob;
+			return;
+		}
+		PendingJobs.Enqueue(InJob);
+		++NumOutstandingJobs;
+	}
+	AllJobs.Add(InJob);
+
+	if (Workers.IsEmpty())
+	{
+		StartWorkers();
+	}
+	WorkAvailable.notify_one();
+}
+
+void FShaderCompileManager::ProcessCompletedJobs()
+{
+	TArray<FShaderCompileJob*> Completed;
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		if (CompletedJobs.IsEmpty())
+		{
+			return;
+		}
+		Completed = std::move(CompletedJobs);
+		CompletedJobs.Empty();
+		NumOutstandingJobs -= Completed.Num();
+	}
+
+	for (FShaderCompileJob* Job : Completed)
+	{
+		if (!Job->bCanceled && Job->Shader)
+		{
+			Job->Shader->FinishAsyncCompile(*Job);
+		}
+		Job->ReleaseBlobs();
+		AllJobs.Remove(Job);
+		delete Job;
+	}
+}
+
+void FShaderCompileManager::CancelJobs(UShader* InShader)
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+
+	// 아직 시작하지 않은 작업은 큐에서 제거
+	TQueue<FShaderCompileJob*> Remaining;
+	FShaderCompileJob* Job = nullptr;
+	while (PendingJobs.Dequeue(Job))
+	{
+		if (Job->Shader == InShader)
+		{
+			AllJobs.Remove(Job);
+			delete Job;
+			--NumOutstandingJobs;
+		}
+		else
+		{
+			Remaining.Enqueue(Job);
+		}
+	}
+	PendingJobs = std::move(Remaining);
+
+	// 컴파일 중이거나 완료 대기 중인 작업은 결과를 버리도록 표시
+	for (FShaderCompileJob* ActiveJob : AllJobs)
+	{
+		if (ActiveJob->Shader == InShader)
+		{
+			ActiveJob->bCanceled = true;
+		}
+	}
+}
+
+void FShaderCompileManager::Shutdown()
+{
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		bStopping = true;
+	}
+	WorkAvailable.notify_all();
+
+	for (std::thread& Worker : Workers)
+	{
+		if (Worker.joinable())
+		{
+			Worker.join();
+		}
+	}
+	Workers.Empty();
+
+	FShaderCompileJob* Job = nullptr;
+	while (PendingJobs.Dequeue(Job))
+	{
+		delete Job;
+	}
+	for (FShaderCompileJob* CompletedJob : CompletedJobs)
+	{
+		CompletedJob->ReleaseBlobs();
+		delete CompletedJob;
+	}
+	CompletedJobs.Empty();
+	AllJobs.Empty();
+	NumOutstandingJobs = 0;
+}
+
+int32 FShaderCompileManager::GetNumOutstandingJobs() const
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+	return NumOutstandingJobs;
+}
+
+uint32 FShaderCompileManager::PrewarmWorld(UWorld* InWorld)
+{
+	if (!InWorld)
+	{
+		return 0;
+	}
+
+	// FSceneView::CreateViewShaderMacros와 같은 조합: 라이팅 뷰 모드 x 현재 그림자 AA 설정
+	const TArray<TArray<FShaderMacro>> ViewModeMacros = {
+		{ FShaderMacro{ "LIGHTING_MODEL_PHONG", "1" } },
+		{ FShaderMacro{ "LIGHTING_MODEL_GOURAUD", "1" } },
+		{ FShaderMacro{ "LIGHTING_MODEL_LAMBERT", "1" } },
+		{},	// Unlit
+		{ FShaderMacro{ "VIEWMODE_WORLD_NORMAL", "1" } },
+	};
+
+	FShaderMacro ShadowAAMacro{ "SHADOW_AA_TECHNIQUE", "0" };
+	const URenderSettings& RenderSettings = InWorld->GetRenderSettings();
+	if (RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_ShadowAntiAliasing))
+	{
+		ShadowAAMacro.Definition = RenderSettings.GetShadowAATechnique() == EShadowAATechnique::VSM ? FName("2") : FName("1");
+	}
+
+	const bool bGPUSkinning = URenderSettings::GetGlobalSkinningMode() == ESkinningMode::ForceGPU;
+
+	uint32 NumRequested = 0;
+	for (AActor* Actor : InWorld->GetActors())
+	{
+		if (!Actor || Actor->IsPendingDestroy())
+		{
+			continue;
+		}
+
+		for (UActorComponent* Component : Actor->GetOwnedComponents())
+		{
+			UMeshComponent* MeshComponent = Cast<UMeshComponent>(Component);
+			if (!MeshComponent)
+			{
+				continue;
+			}
+			const bool bSkinned = bGPUSkinning && Cast<USkinnedMeshComponent>(MeshComponent) != nullptr;
+
+			for (UMaterialInterface* Material : MeshComponent->GetMaterialSlots())
+			{
+				UShader* Shader = Material ? Material->GetShader() : nullptr;
+				if (!Shader)
+				{
+					continue;
+				}
+
+				for (const TArray<FShaderMacro>& ViewMacros : ViewModeMacros)
+				{
+					TArray<FShaderMacro> Macros = ViewMacros;
+					Macros.Add(ShadowAAMacro);
+					Macros.Append(Material->GetShaderMacros());
+					if (bSkinned)
+					{
+						Macros.Add(FShaderMacro{ "GPU_SKINNING", "1" });
+					}
+
+					if (Shader->RequestShaderVariantAsync(Macros))
+					{
+						++NumRequested;
+					}
+				}
+			}
+		}
+	}
+	return NumRequested;
+}
+
+bool FShaderCompileManager::CompileStage(
+	const FString& InShaderPath,
+	const char* InEntryPoint,
+	const char* InTarget,
+	const TArray<TPair<FString, FString>>& InMacroStrings,
+	uint64 InSourceHash,
+	ID3DBlob** OutBlob,
+	FString* OutErrorMessage)
+{
+	*OutBlob = nullptr;
+
+	UINT CompileFlags = 0;
+#if defined(DEBUG) || defined(_DEBUG)
+	CompileFlags = D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION;
+#endif
+
+	// 1. 디스크 캐시 확인 (소스 해시를 모르면 캐시하지 않음)
+	FString CachePath;
+	if (InSourceHash != 0)
+	{
+		uint64 CacheKey = HashCombine(InSourceHash, HashMacroStrings(InMacroStrings));
+		CacheKey = HashCombine(CacheKey, HashString(InEntryPoint));
+		CacheKey = HashCombine(CacheKey, HashString(InTarget));
+		CacheKey = HashCombine(CacheKey, CompileFlags);
+		CachePath = GetCachePath(InShaderPath, CacheKey, InTarget);
+
+		if (SUCCEEDED(D3DReadFileToBlob(UTF8ToWide(CachePath).c_str(), OutBlob)))
+		{
+			return true;
+		}
+		*OutBlob = nullptr;
+	}
+
+	// 2. 컴파일
+	TArray<D3D_SHADER_MACRO> Defines;
+	Defines.reserve(InMacroStrings.Num() + 1);
+	for (const TPair<FString, FString>& Macro : InMacroStrings)
+	{
+		Defines.push_back({ Macro.first.c_str(), Macro.second.c_str() });
+	}
+	Defines.push_back({ NULL, NULL });
+
+	ID3DBlob* ErrorBlob = nullptr;
+	HRESULT Hr = D3DCompileFromFile(
+		UTF8ToWide(InShaderPath).c_str(),
+		Defines.data(),
+		D3D_COMPILE_STANDARD_FILE_INCLUDE,
+		InEntryPoint,
+		InTarget,
+		CompileFlags,
+		0,
+		OutBlob,
+		&ErrorBlob
+	);
+
+	if (FAILED(Hr))
+	{
+		if (ErrorBlob && OutErrorMessage)
+		{
+			*OutErrorMessage = static_cast<const char*>(ErrorBlob->GetBufferPointer());
+		}
+		if (ErrorBlob) { ErrorBlob->Release(); }
+		if (*OutBlob) { (*OutBlob)->Release(); *OutBlob = nullptr; }
+		return false;
+	}
+	if (ErrorBlob) { ErrorBlob->Release(); }
+
+	// 3. 캐시에 기록 (임시 파일에 쓴 뒤 교체해서 다른 스레드가 덜 쓴 파일을 읽지 않도록 함)
+	if (!CachePath.empty())
+	{
+		try
+		{
+			std::filesystem::path FinalPath(UTF8ToWide(CachePath));
+			std::filesystem::create_directories(FinalPath.parent_path());
+
+			std::filesystem::path TempPath = FinalPath;
+			TempPath += L"." + std::to_wstring(std::hash<std::thread::id>{}(std::this_thread::get_id())) + L".tmp";
+			if (SUCCEEDED(D3DWriteBlobToFile(*OutBlob, TempPath.c_str(), TRUE)))
+			{
+				std::error_code Error;
+				std::filesystem::rename(TempPath, FinalPath, Error);
+				if (Error)
+				{
+					std::filesystem::remove(TempPath, Error);
+				}
+			}
+		}
+		catch (...)
+		{
+			// 캐시 기록 실패는 무시 (다음 실행에서 다시 컴파일)
+		}
+	}
+
+	return true;
+}
+
+uint64 FShaderCompileManager::HashFileContents(const TArray<FString>& InFilePaths)
+{
+	uint64 Hash = 0xcbf29ce484222325ull;
+	for (const FString& FilePath : InFilePaths)
+	{
+		std::ifstream File(UTF8ToWide(FilePath), std::ios::binary);
+		if (!File.is_open())
+		{
+			continue;
+		}
+
+		const FString Contents((std::istreambuf_iterator<char>(File)), std::istreambuf_iterator<char>());
+		Hash = HashString(Contents, Hash);
+	}
+	return Hash;
+}
+
+FString FShaderCompileManager::GetCachePath(const FString& InShaderPath, uint64 InCacheKey, const char* InTarget)
+{
+	// 예: Shaders/Materials/UberLit.hlsl -> DerivedDataCache/Shaders/UberLit_ps_5_0_0123456789abcdef.cso
+	const FString Stem = WideToUTF8(std::filesystem::path(UTF8ToWide(InShaderPath)).stem().wstring());
+
+	char KeyBuffer[17];
+	sprintf_s(KeyBuffer, "%016llx", static_cast<unsigned long long>(InCacheKey));
+
+	return GCacheDir + "/Shaders/" + Stem + "_" + InTarget + "_" + KeyBuffer + ".cso";
+}
+
+void FShaderCompileManager::StartWorkers()
+{
+	const int32 NumWorkers = std::clamp(static_cast<int32>(std::thread::hardware_concurrency()) - 2, 1, 4);
+	for (int32 i = 0; i < NumWorkers; ++i)
+	{
+		Workers.emplace_back(&FShaderCompileManager::WorkerLoop, this);
+	}
+}
+
+void FShaderCompileManager::WorkerLoop()
+{
+	while (true)
+	{
+		FShaderCompileJob* Job = nullptr;
+		{
+			std::unique_lock<std::mutex> Lock(Mutex);
+			WorkAvailable.wait(Lock, [this]() { return bStopping || !PendingJobs.IsEmpty(); });
+			if (bStopping)
+			{
+				return;
+			}
+			PendingJobs.Dequeue(Job);
+		}
+
+		if (Job->bCompileVS)
+		{
+			CompileStage(Job->ShaderPath, "mainVS", "vs_5_0", Job->MacroStrings, Job->SourceHash, &Job->VSBlob, &Job->ErrorMessage);
+		}
+		if (Job->bCompilePS)
+		{
+			CompileStage(Job->ShaderPath, "mainPS", "ps_5_0", Job->MacroStrings, Job->SourceHash, &Job->PSBlob, &Job->ErrorMessage);
+		}
+
+		std::lock_guard<std::mutex> Lock(Mutex);
+		CompletedJobs.Add(Job);
+	}
+}
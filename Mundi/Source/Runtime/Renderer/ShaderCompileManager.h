@@ -0,0 +1,100 @@
+﻿#pragma once
+#include "Shader.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+class UWorld;
+
+// 백그라운드 셰이더 Variant 컴파일 작업
+// 워커 스레드는 입력 필드를 읽고 결과(Blob/에러)만 채우며, 셰이더 객체 생성은 게임 스레드에서 처리합니다.
+struct FShaderCompileJob
+{
+	// 프리웜/새 머티리얼 조합마다 대량으로 생성/삭제되므로 풀에서 할당
+	DECLARE_POOLED_ALLOCATION(FShaderCompileJob, EMemoryTag::Rendering)
+
+	UShader* Shader = nullptr;
+	uint64 VariantKey = 0;
+	uint64 SourceHash = 0;                         // 작업 생성 시점의 소스(+include) 해시
+	FString ShaderPath;
+	TArray<FShaderMacro> Macros;                   // 완료 후 Variant에 기록 (게임 스레드 전용)
+	TArray<TPair<FString, FString>> MacroStrings;  // 워커 스레드용 매크로 (FName 테이블 접근 방지)
+	bool bCompileVS = false;
+	bool bCompilePS = false;
+
+	// 결과
+	ID3DBlob* VSBlob = nullptr;
+	ID3DBlob* PSBlob = nullptr;
+	FString ErrorMessage;
+	bool bCanceled = false;                        // 셰이더가 해제/핫 리로드되어 결과를 버려야 함 (게임 스레드 전용)
+
+	void ReleaseBlobs()
+	{
+		if (VSBlob) { VSBlob->Release(); VSBlob = nullptr; }
+		if (PSBlob) { PSBlob->Release(); PSBlob = nullptr; }
+	}
+};
+
+// 셰이더 Variant 비동기 컴파일 + 디스크 바이트코드 캐시(DerivedDataCache/Shaders)
+// 캐시 키: (소스와 include 파일 내용 해시, 매크로 문자열, 엔트리, 타깃, 컴파일 플래그)
+class FShaderCompileManager
+{
+public:
+	static FShaderCompileManager& GetInstance()
+	{
+		static FShaderCompileManager Instance;
+		return Instance;
+	}
+
+	// 작업 소유권을 넘겨받아 워커 스레드에 배분
+	void Enqueue(FShaderCompileJob* InJob);
+
+	// 완료된 작업을 해당 UShader에 반영 (게임 스레드, 매 프레임)
+	void ProcessCompletedJobs();
+
+	// 셰이더 해제/핫 리로드 시 대기 중인 작업 취소
+	void CancelJobs(UShader* InShader);
+
+	// 남은 작업을 버리고 워커 스레드 종료 (리소스 해제 전에 호출)
+	void Shutdown();
+
+	int32 GetNumOutstandingJobs() const;
+
+	// 월드의 머티리얼이 참조하는 셰이더 퍼뮤테이션(뷰 모드 x 머티리얼 매크로)을 미리 컴파일 요청
+	// @return 새로 요청된 Variant 수
+	uint32 PrewarmWorld(UWorld* InWorld);
+
+	// 단일 스테이지 컴파일 (디스크 캐시 우선, 스레드 안전)
+	static bool CompileStage(
+		const FString& InShaderPath,
+		const char* InEntryPoint,
+		const char* InTarget,
+		const TArray<TPair<FString, FString>>& InMacroStrings,
+		uint64 InSourceHash,
+		ID3DBlob** OutBlob,
+		FString* OutErrorMessage);
+
+	// 파일 내용 해시 (FNV-1a), 없는 파일은 건너뜀
+	static uint64 HashFileContents(const TArray<FString>& InFilePaths);
+
+private:
+	FShaderCompileManager() = default;
+	~FShaderCompileManager();
+	FShaderCompileManager(const FShaderCompileManager&) = delete;
+	FShaderCompileManager& operator=(const FShaderCompileManager&) = delete;
+
+	void StartWorkers();
+	void WorkerLoop();
+
+	static FString GetCachePath(const FString& InShaderPath, uint64 InCacheKey, const char* InTarget);
+
+	TArray<std::thread> Workers;
+	mutable std::mutex Mutex;
+	std::condition_variable WorkAvailable;
+
+	TQueue<FShaderCompileJob*> PendingJobs;
+	TArray<FShaderCompileJob*> CompletedJobs;
+	TArray<FShaderCompileJob*> AllJobs;     // 취소 표시용 (게임 스레드 전용)
+	int32 NumOutstandingJobs = 0;
+	bool bStopping = false;
+};
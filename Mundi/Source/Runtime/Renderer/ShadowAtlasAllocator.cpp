@@ -0,0 +1,457 @@
+﻿#include "pch.h"
+#include "ShadowAtlasAllocator.h"
+
+void FShadowAtlasAllocator::Initialize(uint32 InAtlasSize, uint32 InMinTileSize)
+{
+	AtlasSize = InAtlasSize;
+	MinTileSize = FMath::Max(1u, FMath::Min(InMinTileSize, InAtlasSize));
+
+	// 타일 크기가 MinTileSize 이상인 레벨까지만 생성
+	int32 NumLevels = 1;
+	while ((AtlasSize >> NumLevels) >= MinTileSize && NumLevels < 16)
+	{
+		++NumLevels;
+	}
+
+	Levels.SetNum(NumLevels);
+	FreeNodeCounts.SetNum(NumLevels);
+	for (int32 Level = 0; Level < NumLevels; ++Level)
+	{
+		const uint32 Dimension = GetLevelDimension(Level);
+		Levels[Level].SetNum(Dimension * Dimension);
+	}
+
+	Reset();
+}
+
+void FShadowAtlasAllocator::Reset()
+{
+	for (int32 Level = 0; Level < Levels.Num(); ++Level)
+	{
+		std::fill(Levels[Level].begin(), Levels[Level].end(), ENodeState::Unavailable);
+		FreeNodeCounts[Level] = 0;
+	}
+
+	if (!Levels.IsEmpty())
+	{
+		Levels[0][0] = ENodeState::Free;
+		FreeNodeCounts[0] = 1;
+	}
+
+	NumAllocations = 0;
+	AllocatedArea = 0;
+}
+
+uint32 FShadowAtlasAllocator::QuantizeSize(uint32 InSize) const
+{
+	uint32 TileSize = MinTileSize;
+	while (TileSize < InSize && TileSize < AtlasSize)
+	{
+		TileSize <<= 1;
+	}
+	return FMath::Min(TileSize, AtlasSize);
+}
+
+bool FShadowAtlasAllocator::Allocate(uint32 InSize, FShadowAtlasRegion& OutRegion)
+{
+	OutRegion = FShadowAtlasRegion();
+	if (!IsInitialized() || InSize == 0)
+	{
+		return false;
+	}
+
+	// 타일 크기 -> 레벨
+	const uint32 TileSize = QuantizeSize(InSize);
+	int32 Level = 0;
+	while (GetTileSize(Level) > TileSize && Level + 1 < Levels.Num())
+	{
+		++Level;
+	}
+
+	const int32 NodeIndex = FindOrSplitFreeNode(Level);
+	if (NodeIndex < 0)
+	{
+		return false;
+	}
+
+	SetNodeState(Level, NodeIndex, ENodeState::Allocated);
+
+	const uint32 Dimension = GetLevelDimension(Level);
+	OutRegion.Size = GetTileSize(Level);
+	OutRegion.X = (NodeIndex % Dimension) * OutRegion.Size;
+	OutRegion.Y = (NodeIndex / Dimension) * OutRegion.Size;
+	OutRegion.Level = Level;
+	OutRegion.NodeIndex = NodeIndex;
+
+	++NumAllocations;
+	AllocatedArea += (uint64)OutRegion.Size * OutRegion.Size;
+	return true;
+}
+
+void FShadowAtlasAllocator::Free(const FShadowAtlasRegion& InRegion)
+{
+	if (!InRegion.IsValid() || InRegion.Level >= Levels.Num())
+	{
+		return;
+	}
+	if (Levels[InRegion.Level][InRegion.NodeIndex] != ENodeState::Allocated)
+	{
+		return;
+	}
+
+	--NumAllocations;
+	AllocatedArea -= (uint64)InRegion.Size * InRegion.Size;
+
+	int32 Level = InRegion.Level;
+	int32 NodeIndex = InRegion.NodeIndex;
+	SetNodeState(Level, NodeIndex, ENodeState::Free);
+
+	// 형제 4개가 모두 비어 있으면 부모로 병합
+	while (Level > 0)
+	{
+		const uint32 Dimension = GetLevelDimension(Level);
+		const uint32 ParentDimension = Dimension >> 1;
+		const int32 ParentIndex = (int32)(((NodeIndex / Dimension) >> 1) * ParentDimension + ((NodeIndex % Dimension) >> 1));
+
+		int32 Siblings[4];
+		GetChildNodes(Level - 1, ParentIndex, Siblings);
+		for (int32 Sibling : Siblings)
+		{
+			if (Levels[Level][Sibling] != ENodeState::Free)
+			{
+				return;
+			}
+		}
+
+		for (int32 Sibling : Siblings)
+		{
+			SetNodeState(Level, Sibling, ENodeState::Unavailable);
+		}
+		--Level;
+		NodeIndex = ParentIndex;
+		SetNodeState(Level, NodeIndex, ENodeState::Free);
+	}
+}
+
+bool FShadowAtlasAllocator::AllocateLargestFit(uint32 InDesiredSize, uint32 InExclusiveFloorSize, FShadowAtlasRegion& OutRegion)
+{
+	OutRegion = FShadowAtlasRegion();
+	for (uint32 TrySize = InDesiredSize; TrySize >= MinTileSize && TrySize > InExclusiveFloorSize; TrySize >>= 1)
+	{
+		if (Allocate(TrySize, OutRegion))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+uint32 FShadowAtlasAllocator::FitSizesToAtlasArea(TArray<uint32>& InOutSizes) const
+{
+	const uint64 AtlasArea = (uint64)AtlasSize * AtlasSize;
+	uint64 TotalArea = 0;
+	for (uint32 Size : InOutSizes)
+	{
+		TotalArea += (uint64)Size * Size;
+	}
+
+	uint32 DegradeShift = 0;
+	while (TotalArea > AtlasArea)
+	{
+		++DegradeShift;
+		bool bCanShrink = false;
+		TotalArea = 0;
+		for (uint32 Size : InOutSizes)
+		{
+			if (Size == 0) continue;
+			const uint32 Shrunk = FMath::Max(MinTileSize, Size >> DegradeShift);
+			bCanShrink |= Shrunk > MinTileSize;
+			TotalArea += (uint64)Shrunk * Shrunk;
+		}
+		if (!bCanShrink) break;
+	}
+
+	if (DegradeShift > 0)
+	{
+		for (uint32& Size : InOutSizes)
+		{
+			if (Size > 0) Size = FMath::Max(MinTileSize, Size >> DegradeShift);
+		}
+	}
+	return DegradeShift;
+}
+
+float FShadowAtlasAllocator::GetOccupancy() const
+{
+	if (AtlasSize == 0)
+	{
+		return 0.0f;
+	}
+	return (float)((double)AllocatedArea / ((double)AtlasSize * AtlasSize));
+}
+
+uint32 FShadowAtlasAllocator::GetNumFreeNodes() const
+{
+	uint32 Total = 0;
+	for (uint32 Count : FreeNodeCounts)
+	{
+		Total += Count;
+	}
+	return Total;
+}
+
+void FShadowAtlasAllocator::SetNodeState(int32 Level, int32 NodeIndex, ENodeState NewState)
+{
+	ENodeState& State = Levels[Level][NodeIndex];
+	if (State == ENodeState::Free)
+	{
+		--FreeNodeCounts[Level];
+	}
+	if (NewState == ENodeState::Free)
+	{
+		++FreeNodeCounts[Level];
+	}
+	State = NewState;
+}
+
+int32 FShadowAtlasAllocator::FindOrSplitFreeNode(int32 Level)
+{
+	// 같은 크기의 빈 노드가 있으면 우선 사용 (큰 노드를 불필요하게 쪼개지 않음)
+	if (FreeNodeCounts[Level] > 0)
+	{
+		const TArray<ENodeState>& Nodes = Levels[Level];
+		for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); ++NodeIndex)
+		{
+			if (Nodes[NodeIndex] == ENodeState::Free)
+			{
+				return NodeIndex;
+			}
+		}
+	}
+
+	if (Level == 0)
+	{
+		return -1;
+	}
+
+	const int32 ParentIndex = FindOrSplitFreeNode(Level - 1);
+	if (ParentIndex < 0)
+	{
+		return -1;
+	}
+
+	SetNodeState(Level - 1, ParentIndex, ENodeState::Split);
+
+	int32 Children[4];
+	GetChildNodes(Level - 1, ParentIndex, Children);
+	for (int32 Child : Children)
+	{
+		SetNodeState(Level, Child, ENodeState::Free);
+	}
+	return Children[0];
+}
+
+void FShadowAtlasAllocator::GetChildNodes(int32 Level, int32 NodeIndex, int32 OutChildren[4]) const
+{
+	const uint32 Dimension = GetLevelDimension(Level);
+	const uint32 ChildDimension = Dimension << 1;
+	const uint32 ChildX = (NodeIndex % Dimension) << 1;
+	const uint32 ChildY = (NodeIndex / Dimension) << 1;
+
+	OutChildren[0] = (int32)(ChildY * ChildDimension + ChildX);
+	OutChildren[1] = (int32)(ChildY * ChildDimension + ChildX + 1);
+	OutChildren[2] = (int32)((ChildY + 1) * ChildDimension + ChildX);
+	OutChildren[3] = (int32)((ChildY + 1) * ChildDimension + ChildX + 1);
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// Self test
+// ────────────────────────────────────────────────────────────────────────────
+
+int32 RunShadowAtlasAllocatorSelfTest(TArray<FString>& OutFailures)
+{
+	int32 NumChecks = 0;
+	auto Check = [&](bool bCondition, const char* Description)
+	{
+		++NumChecks;
+		if (!bCondition)
+		{
+			OutFailures.Add(Description);
+		}
+	};
+
+	auto Overlaps = [](const FShadowAtlasRegion& A, const FShadowAtlasRegion& B)
+	{
+		return A.X < B.X + B.Size && B.X < A.X + A.Size && A.Y < B.Y + B.Size && B.Y < A.Y + A.Size;
+	};
+
+	// 1024 아틀라스, 최소 128 타일 -> 레벨 4개 (1024/512/256/128)
+	FShadowAtlasAllocator Allocator;
+	Allocator.Initialize(1024, 128);
+	Check(Allocator.GetNumFreeNodes() == 1 && Allocator.GetOccupancy() == 0.0f, "init: single free root");
+	Check(Allocator.QuantizeSize(100) == 128 && Allocator.QuantizeSize(300) == 512 && Allocator.QuantizeSize(4096) == 1024, "quantize: power of two clamped to [min, atlas]");
+
+	// 최소 타일 하나를 할당하면 레벨마다 형제 3개가 빈 노드로 남고, 해제하면 루트까지 병합된다
+	{
+		FShadowAtlasRegion Region;
+		Check(Allocator.Allocate(128, Region) && Region.Size == 128 && Region.Level == 3, "split: min tile allocated at deepest level");
+		Check(Allocator.GetNumFreeNodes() == 9, "split: three free siblings per split level");
+
+		Allocator.Free(Region);
+		Check(Allocator.GetNumFreeNodes() == 1 && Allocator.GetNumAllocations() == 0, "merge: free collapses back to root");
+
+		FShadowAtlasRegion Whole;
+		Check(Allocator.Allocate(1024, Whole) && Whole.X == 0 && Whole.Y == 0 && Whole.Level == 0, "merge: whole atlas allocatable after merge");
+		Allocator.Free(Whole);
+
+		// 같은 영역 이중 해제는 무시
+		Allocator.Free(Whole);
+		Check(Allocator.GetNumFreeNodes() == 1 && Allocator.GetNumAllocations() == 0, "free: double free ignored");
+	}
+
+	// 사분면 4개로 가득 채우면 더 이상 할당되지 않고, 하나를 비우면 그 안에서만 할당된다
+	{
+		FShadowAtlasRegion Quads[4];
+		bool bAllQuads = true;
+		for (FShadowAtlasRegion& Quad : Quads)
+		{
+			bAllQuads &= Allocator.Allocate(512, Quad);
+		}
+		Check(bAllQuads && Allocator.GetOccupancy() == 1.0f, "full: four quadrants fill the atlas");
+
+		FShadowAtlasRegion Extra;
+		Check(!Allocator.Allocate(128, Extra) && !Extra.IsValid(), "full: allocation fails when atlas is full");
+
+		Allocator.Free(Quads[2]);
+		Check(Allocator.Allocate(128, Extra) && Overlaps(Extra, Quads[2]), "reuse: freed quadrant is reused");
+		Allocator.Free(Extra);
+
+		for (const FShadowAtlasRegion& Quad : { Quads[0], Quads[1], Quads[3] })
+		{
+			Allocator.Free(Quad);
+		}
+		Check(Allocator.GetNumFreeNodes() == 1 && Allocator.GetOccupancy() == 0.0f, "merge: all quadrants merge to root");
+	}
+
+	// 공간이 부족하면 절반씩 줄여 들어가는 가장 큰 타일을 받는다 (LOD 강등)
+	{
+		FShadowAtlasRegion Held[3];
+		for (FShadowAtlasRegion& Region : Held)
+		{
+			Allocator.Allocate(512, Region);
+		}
+
+		FShadowAtlasRegion Fallback;
+		Check(Allocator.AllocateLargestFit(1024, 0, Fallback) && Fallback.Size == 512, "lod: 1024 request falls back to remaining 512");
+
+		FShadowAtlasRegion None;
+		Check(!Allocator.AllocateLargestFit(512, 0, None) && !None.IsValid(), "lod: no fallback when atlas is full");
+
+		// 확대 시도는 기존 크기 이하로 내려가지 않는다
+		Allocator.Free(Fallback);
+		Allocator.Allocate(256, Fallback);
+		FShadowAtlasRegion Upgrade;
+		Check(!Allocator.AllocateLargestFit(1024, 256, Upgrade) && Allocator.GetNumAllocations() == 4, "lod: upgrade never settles for current size");
+
+		Allocator.Free(Fallback);
+		for (const FShadowAtlasRegion& Region : Held)
+		{
+			Allocator.Free(Region);
+		}
+		Check(Allocator.GetNumFreeNodes() == 1, "lod: atlas empty after releasing fallback test");
+	}
+
+	// 요청 면적 합이 아틀라스를 넘으면 모든 요청을 같은 단계만큼 줄인다
+	{
+		TArray<uint32> Sizes = { 1024, 1024, 512, 0 };
+		const uint32 Shift = Allocator.FitSizesToAtlasArea(Sizes);
+		Check(Shift == 1 && Sizes[0] == 512 && Sizes[1] == 512 && Sizes[2] == 256 && Sizes[3] == 0, "fit: oversubscribed requests shrink one step");
+
+		bool bAllFit = true;
+		TArray<FShadowAtlasRegion> Regions;
+		for (uint32 Size : Sizes)
+		{
+			if (Size == 0) continue;
+			FShadowAtlasRegion Region;
+			bAllFit &= Allocator.Allocate(Size, Region);
+			Regions.Add(Region);
+		}
+		Check(bAllFit, "fit: shrunk requests all allocate");
+		for (const FShadowAtlasRegion& Region : Regions)
+		{
+			Allocator.Free(Region);
+		}
+
+		TArray<uint32> Fitting = { 512, 256 };
+		Check(Allocator.FitSizesToAtlasArea(Fitting) == 0 && Fitting[0] == 512 && Fitting[1] == 256, "fit: fitting requests untouched");
+
+		// 최소 타일보다 작게 줄이지는 않는다
+		TArray<uint32> Crowded(100, 256u);
+		Allocator.FitSizesToAtlasArea(Crowded);
+		bool bClamped = true;
+		for (uint32 Size : Crowded)
+		{
+			bClamped &= Size == 128;
+		}
+		Check(bClamped, "fit: shrink stops at min tile size");
+	}
+
+	// 프레임 간 유지: 할당/해제가 섞여도 살아 있는 영역은 그대로이고 서로 겹치지 않는다
+	{
+		TArray<FShadowAtlasRegion> Live;
+		uint32 Seed = 12345u;
+		auto NextRandom = [&Seed]()
+		{
+			Seed = Seed * 1664525u + 1013904223u;
+			return Seed >> 16;
+		};
+
+		bool bNoOverlap = true;
+		bool bStatsMatch = true;
+		for (int32 Frame = 0; Frame < 64; ++Frame)
+		{
+			// 일부 해제
+			for (int32 i = Live.Num() - 1; i >= 0; --i)
+			{
+				if (NextRandom() % 4 == 0)
+				{
+					Allocator.Free(Live[i]);
+					Live.RemoveAt(i);
+				}
+			}
+
+			// 새 요청 (128~512)
+			const int32 NumNew = (int32)(NextRandom() % 4);
+			for (int32 i = 0; i < NumNew; ++i)
+			{
+				FShadowAtlasRegion Region;
+				if (Allocator.AllocateLargestFit(128u << (NextRandom() % 3), 0, Region))
+				{
+					Live.Add(Region);
+				}
+			}
+
+			uint64 LiveArea = 0;
+			for (int32 i = 0; i < Live.Num(); ++i)
+			{
+				LiveArea += (uint64)Live[i].Size * Live[i].Size;
+				for (int32 j = i + 1; j < Live.Num(); ++j)
+				{
+					bNoOverlap &= !Overlaps(Live[i], Live[j]);
+				}
+			}
+			bStatsMatch &= Allocator.GetNumAllocations() == (uint32)Live.Num();
+			bStatsMatch &= Allocator.GetOccupancy() == (float)((double)LiveArea / (1024.0 * 1024.0));
+		}
+		Check(bNoOverlap, "persist: live regions never overlap across frames");
+		Check(bStatsMatch, "persist: allocation count and occupancy track live regions");
+
+		for (const FShadowAtlasRegion& Region : Live)
+		{
+			Allocator.Free(Region);
+		}
+		Check(Allocator.GetNumFreeNodes() == 1 && Allocator.GetNumAllocations() == 0, "persist: churn leaves no fragmentation after release");
+	}
+
+	return NumChecks;
+}
@@ -0,0 +1,78 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+// 2D 섀도우 아틀라스 안의 정사각형 영역 (쿼드트리 노드 하나에 대응)
+struct FShadowAtlasRegion
+{
+	uint32 X = 0;
+	uint32 Y = 0;
+	uint32 Size = 0;
+	int32 Level = -1;      // 쿼드트리 레벨 (0: 아틀라스 전체, -1: 할당 안 됨)
+	int32 NodeIndex = -1;  // 레벨 내 노드 인덱스 (행 우선)
+
+	bool IsValid() const { return Level >= 0; }
+};
+
+// 2D 섀도우 아틀라스용 쿼드트리(버디) 할당기
+// 영역을 2의 거듭제곱 타일로 나누어 관리하며, 해제된 형제 노드 4개가 모두 비면 부모로 병합하여 단편화를 줄입니다.
+// 할당이 프레임 간에 유지되므로 같은 라이트가 같은 영역을 계속 사용할 수 있습니다.
+class FShadowAtlasAllocator
+{
+public:
+	void Initialize(uint32 InAtlasSize, uint32 InMinTileSize = 128);
+	void Reset();
+
+	bool IsInitialized() const { return !Levels.IsEmpty(); }
+
+	// 요청 크기 이상인 가장 작은 2의 거듭제곱 타일 크기 ([MinTileSize, AtlasSize]로 클램프)
+	uint32 QuantizeSize(uint32 InSize) const;
+
+	// QuantizeSize(InSize) 크기의 빈 타일을 할당 (필요하면 큰 노드를 분할)
+	bool Allocate(uint32 InSize, FShadowAtlasRegion& OutRegion);
+	void Free(const FShadowAtlasRegion& InRegion);
+
+	// 공간이 없으면 크기를 절반씩 줄여 재시도 (InExclusiveFloorSize 이하로는 내려가지 않음, 확대 시 기존 크기 전달)
+	bool AllocateLargestFit(uint32 InDesiredSize, uint32 InExclusiveFloorSize, FShadowAtlasRegion& OutRegion);
+
+	// 요청 면적 합이 아틀라스를 넘으면 모든 요청을 같은 단계만큼 줄입니다 (0은 요청 없음). 줄인 단계 수를 반환
+	uint32 FitSizesToAtlasArea(TArray<uint32>& InOutSizes) const;
+
+	uint32 GetAtlasSize() const { return AtlasSize; }
+	uint32 GetMinTileSize() const { return MinTileSize; }
+
+	// --- 통계 ---
+	uint32 GetNumAllocations() const { return NumAllocations; }
+	float GetOccupancy() const;
+	// 병합되지 못하고 흩어져 있는 빈 노드 수 (단편화 지표)
+	uint32 GetNumFreeNodes() const;
+
+private:
+	enum class ENodeState : uint8
+	{
+		Unavailable,	// 조상 노드가 통째로 관리 중 (분할되지 않음)
+		Free,
+		Split,
+		Allocated,
+	};
+
+	uint32 GetLevelDimension(int32 Level) const { return 1u << Level; }
+	uint32 GetTileSize(int32 Level) const { return AtlasSize >> Level; }
+
+	void SetNodeState(int32 Level, int32 NodeIndex, ENodeState NewState);
+	// Level에서 빈 노드를 찾고, 없으면 상위 레벨의 빈 노드를 분할하여 만듭니다.
+	int32 FindOrSplitFreeNode(int32 Level);
+	void GetChildNodes(int32 Level, int32 NodeIndex, int32 OutChildren[4]) const;
+
+	uint32 AtlasSize = 0;
+	uint32 MinTileSize = 0;
+
+	// Levels[L]: 2^L x 2^L 노드 상태 (행 우선)
+	TArray<TArray<ENodeState>> Levels;
+	TArray<uint32> FreeNodeCounts;
+
+	uint32 NumAllocations = 0;
+	uint64 AllocatedArea = 0;
+};
+
+/** 할당/해제/병합, 공간 부족 시 해상도 강등, 프레임 간 영역 유지를 점검 (콘솔 SHADOW ATLAS SELFTEST). 검사 수를 반환 */
+int32 RunShadowAtlasAllocatorSelfTest(TArray<FString>& OutFailures);
@@ -21,6 +21,19 @@ struct FShadowStats
 	float ShadowAtlasCubeMemoryMB = 0.0f;
 	float TotalShadowMemoryMB = 0.0f;
 
+	// 섀도우 뷰 (Spot/CSM 캐스케이드/Point 큐브 면 단위)
+	uint32 ShadowViewsRendered = 0;       // 이번 프레임에 다시 그린 섀도우 뷰
+	uint32 ShadowViewsCached = 0;         // 캐시를 재사용하여 건너뛴 섀도우 뷰
+	uint32 ShadowCasterDraws = 0;         // 뷰별 컬링을 통과해 그려진 캐스터 배치 수
+
+	// 2D 아틀라스 할당 (영구 쿼드트리 할당기)
+	float ShadowAtlasOccupancy = 0.0f;    // 할당된 면적 비율 (0~1)
+	uint32 ShadowAtlasRegions = 0;        // 할당된 영역 수
+	uint32 ShadowAtlasFreeNodes = 0;      // 병합되지 못한 빈 노드 수 (단편화 지표)
+	uint32 ShadowAtlasReused = 0;         // 이전 프레임 영역을 그대로 사용한 뷰
+	uint32 ShadowAtlasDegraded = 0;       // 공간 부족으로 해상도가 낮아진 뷰
+	uint32 ShadowAtlasDropped = 0;        // 최소 타일도 얻지 못한 뷰
+
 	// 모든 통계를 0으로 리셋
 	void Reset()
 	{
@@ -34,6 +47,15 @@ struct FShadowStats
 		ShadowAtlas2DMemoryMB = 0.0f;
 		ShadowAtlasCubeMemoryMB = 0.0f;
 		TotalShadowMemoryMB = 0.0f;
+		ShadowViewsRendered = 0;
+		ShadowViewsCached = 0;
+		ShadowCasterDraws = 0;
+		ShadowAtlasOccupancy = 0.0f;
+		ShadowAtlasRegions = 0;
+		ShadowAtlasFreeNodes = 0;
+		ShadowAtlasReused = 0;
+		ShadowAtlasDegraded = 0;
+		ShadowAtlasDropped = 0;
 	}
 
 	// 전체 섀도우 캐스팅 라이트 수 계산
@@ -84,6 +106,25 @@ public:
 		CurrentStats = InStats;
 	}
 
+	// 섀도우 패스 결과 갱신 (라이트/아틀라스 통계는 유지)
+	void UpdateShadowViewStats(uint32 InRendered, uint32 InCached, uint32 InCasterDraws)
+	{
+		CurrentStats.ShadowViewsRendered = InRendered;
+		CurrentStats.ShadowViewsCached = InCached;
+		CurrentStats.ShadowCasterDraws = InCasterDraws;
+	}
+
+	// 2D 아틀라스 할당 결과 갱신
+	void UpdateShadowAtlasStats(float InOccupancy, uint32 InRegions, uint32 InFreeNodes, uint32 InReused, uint32 InDegraded, uint32 InDropped)
+	{
+		CurrentStats.ShadowAtlasOccupancy = InOccupancy;
+		CurrentStats.ShadowAtlasRegions = InRegions;
+		CurrentStats.ShadowAtlasFreeNodes = InFreeNodes;
+		CurrentStats.ShadowAtlasReused = InReused;
+		CurrentStats.ShadowAtlasDegraded = InDegraded;
+		CurrentStats.ShadowAtlasDropped = InDropped;
+	}
+
 	// 통계 조회
 	const FShadowStats& GetStats() const
 	{
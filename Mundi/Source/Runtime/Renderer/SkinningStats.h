@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <atomic>
 
 // 전방 선언
 class FGPUTimer;
@@ -28,6 +29,10 @@ struct FSkinningStats
 	// 메모리 사용량 (바이트)
 	uint64_t BufferMemory = 0;              // 버퍼 메모리 (CPU: 버텍스 버퍼, GPU: 본 버퍼)
 
+	// 애니메이션 포즈 평가 (FAnimPoseArena)
+	uint32_t PoseBuffersAcquired = 0;       // 그래프 평가 중 빌린 임시 포즈 버퍼 수
+	uint32_t PoseAllocations = 0;           // 그중 힙 할당이 일어난 횟수 (예열 후 0이어야 함)
+
 	/**
 	 * 모든 통계를 0으로 리셋
 	 */
@@ -42,6 +47,8 @@ struct FSkinningStats
 		TotalBones = 0;
 		BufferUpdateCount = 0;
 		BufferMemory = 0;
+		PoseBuffersAcquired = 0;
+		PoseAllocations = 0;
 	}
 
 	/**
@@ -83,6 +90,10 @@ public:
 	void ResetFrameStats()
 	{
 		CurrentStats.Reset();
+
+		// 애니메이션 평가는 렌더링 전(월드 틱)에 끝나므로, 그동안 쌓인 값을 이번 프레임 통계로 옮긴다
+		CurrentStats.PoseBuffersAcquired = PendingPoseBuffersAcquired.exchange(0, std::memory_order_relaxed);
+		CurrentStats.PoseAllocations = PendingPoseAllocations.exchange(0, std::memory_order_relaxed);
 	}
 
 	/**
@@ -132,6 +143,15 @@ public:
 		CurrentStats.DrawTimeMS += TimeMS;
 	}
 
+	/**
+	 * 포즈 아레나 카운터 추가 (애니메이션 평가 스레드에서 호출될 수 있음)
+	 */
+	void AddPoseArenaCounters(uint32_t Acquires, uint32_t Allocations)
+	{
+		PendingPoseBuffersAcquired.fetch_add(Acquires, std::memory_order_relaxed);
+		PendingPoseAllocations.fetch_add(Allocations, std::memory_order_relaxed);
+	}
+
 	// === GPU 타이머 관리 ===
 
 	/**
@@ -163,6 +183,10 @@ private:
 
 	FSkinningStats CurrentStats;
 
+	// 다음 ResetFrameStats에서 CurrentStats로 옮겨질 포즈 아레나 카운터
+	std::atomic<uint32_t> PendingPoseBuffersAcquired{ 0 };
+	std::atomic<uint32_t> PendingPoseAllocations{ 0 };
+
 	// GPU 타이머 (전역에서 지속)
 	FGPUTimer* GPUDrawTimer = nullptr;
 	double LastGPUDrawTimeMS = 0.0;
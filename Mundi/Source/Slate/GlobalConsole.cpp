@@ -13,11 +13,13 @@ void UGlobalConsole::Initialize()
 void UGlobalConsole::Shutdown()
 {
     ConsoleWidget = nullptr;
+    FLogManager::GetInstance().SetConsoleSinkEnabled(false);
 }
 
 void UGlobalConsole::SetConsoleWidget(UConsoleWidget* InConsoleWidget)
 {
     ConsoleWidget = InConsoleWidget;
+    FLogManager::GetInstance().SetConsoleSinkEnabled(InConsoleWidget != nullptr);
     if (InConsoleWidget)
     {
         UE_LOG("GlobalConsole: ConsoleWidget set successfully\n");
@@ -35,31 +37,39 @@ UConsoleWidget* UGlobalConsole::GetConsoleWidget()
 
 void UGlobalConsole::Log(const char* fmt, ...)
 {
-#ifdef _EDITOR
     va_list args;
     va_start(args, fmt);
     LogV(fmt, args);
     va_end(args);
-#endif
 }
 
 void UGlobalConsole::LogV(const char* fmt, va_list args)
 {
-#ifdef _EDITOR
-    if (ConsoleWidget)
+    // 호출 스레드에서는 링 버퍼에 포맷팅만 하고 반환 (파일/콘솔 출력은 드레인 스레드와 게임 스레드가 처리)
+    const ELogVerbosity::Type Verbosity = GetVerbosityFromTag(fmt);
+    if (Verbosity > LOG_COMPILED_MIN_VERBOSITY || LogTemp.IsSuppressed(Verbosity))
     {
-        ConsoleWidget->VAddLog(fmt, args);
+        return;
     }
-    else
+    FLogManager::GetInstance().LogV(LogTemp, Verbosity, fmt, args);
+}
+
+ELogVerbosity::Type UGlobalConsole::GetVerbosityFromTag(const char* fmt)
+{
+    // 태그는 포맷 문자열 리터럴에 있으므로 포맷팅 전에 판정
+    if (strstr(fmt, "[error]"))
+    {
+        return ELogVerbosity::Error;
+    }
+    if (strstr(fmt, "[warning]"))
+    {
+        return ELogVerbosity::Warning;
+    }
+    if (strstr(fmt, "[info]"))
     {
-        // Fallback to OutputDebugString if console widget not available
-        char tmp[1024];
-        vsnprintf_s(tmp, _countof(tmp), fmt, args);
-        OutputDebugStringA("[No Console] ");
-        OutputDebugStringA(tmp);
-        OutputDebugStringA("\n");
+        return ELogVerbosity::Display;
     }
-#endif
+    return ELogVerbosity::Log;
 }
 
 // Global C functions for compatibility
@@ -2,12 +2,14 @@
 #include <cstdarg>
 #include <iostream>
 #include "Object.h"
+#include "Logging.h"
 
 class UConsoleWidget;
 
 /**
  * @brief Global Console Manager - replaces ImGuiConsole completely
- * Routes all console logging to our new ConsoleWidget
+ * Routes UE_LOG to the async log backend (FLogManager) under LogTemp.
+ * The backend drains to the log file and, while a widget is set, to the ConsoleWidget.
  */
 class UGlobalConsole : public UObject
 {
@@ -25,6 +27,9 @@ public:
     static void Log(const char* fmt, ...);
     static void LogV(const char* fmt, va_list args);
 
+    // 기존 로그의 "[error]" / "[warning]" 태그를 상세도로 변환
+    static ELogVerbosity::Type GetVerbosityFromTag(const char* fmt);
+
 private:
     static UConsoleWidget* ConsoleWidget;
 };
@@ -658,8 +658,8 @@ void USlateManager::Update(float DeltaSeconds)
         }
     }
 
-    // ConsoleWindow 업데이트
-    if (ConsoleWindow && ConsoleAnimationProgress > 0.0f)
+    // ConsoleWindow 업데이트 (닫혀 있어도 로그를 받아 두어야 에러 시 자동으로 열 수 있다)
+    if (ConsoleWindow)
     {
         ConsoleWindow->Update();
     }
@@ -13,9 +13,19 @@
 #include "TileCullingStats.h"
 #include "LightStats.h"
 #include "ShadowStats.h"
+#include "OcclusionStats.h"
 #include "SkinningStats.h"
 #include "SkinnedMeshComponent.h"
 #include "ParticleStats.h"
+#include "ParticleDynamicBuffer.h"
+#include "PhysicsStats.h"
+#include "Source/Runtime/Engine/Cloth/ClothStats.h"
+#include "WorldPartitionManager.h"
+#include "BVHierarchy.h"
+#include "WorldPartitionStreaming.h"
+#include "LuaManager.h"
+#include "AnimSharingManager.h"
+#include "AnimUpdateRateManager.h"
 
 #pragma comment(lib, "d2d1")
 #pragma comment(lib, "dwrite")
@@ -175,7 +185,7 @@ static void DrawTextBlock(
 
 void UStatsOverlayD2D::Draw()
 {
-	if (!bInitialized || (!bShowFPS && !bShowMemory && !bShowPicking && !bShowDecal && !bShowTileCulling && !bShowLights && !bShowShadow && !bShowSkinning) || !SwapChain)
+	if (!bInitialized || (!bShowFPS && !bShowMemory && !bShowPicking && !bShowDecal && !bShowTileCulling && !bShowLights && !bShowShadow && !bShowOcclusion && !bShowSkinning && !bShowParticles && !bShowPhysics && !bShowCloth && !bShowPartition && !bShowStreaming && !bShowLua) || !SwapChain)
 	{
 		return;
 	}
@@ -249,10 +259,10 @@ void UStatsOverlayD2D::Draw()
 
 	if (bShowMemory)
 	{
-		double Mb = static_cast<double>(FMemoryManager::TotalAllocationBytes) / (1024.0 * 1024.0);
+		double Mb = static_cast<double>(FMemoryManager::GetTotalAllocationBytes()) / (1024.0 * 1024.0);
 
 		wchar_t Buf[128];
-		swprintf_s(Buf, L"Memory: %.1f MB\nAllocs: %u", Mb, FMemoryManager::TotalAllocationCount);
+		swprintf_s(Buf, L"Memory: %.1f MB\nAllocs: %llu", Mb, static_cast<unsigned long long>(FMemoryManager::GetTotalAllocationCount()));
 
 		D2D1_RECT_F Rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + PanelHeight);
 		DrawTextBlock(D2DContext, TextFormat, Buf, Rc, BrushBlack, BrushLightGreen);
@@ -337,7 +347,7 @@ void UStatsOverlayD2D::Draw()
 		const FShadowStats& ShadowStats = FShadowStatManager::GetInstance().GetStats();
 
 		wchar_t Buf[512];
-		swprintf_s(Buf, L"[Shadow Stats]\nShadow Lights: %u\n  Point: %u\n  Spot: %u\n  Directional: %u\n\nAtlas 2D: %u x %u (%.1f MB)\nAtlas Cube: %u x %u x %u (%.1f MB)\n\nTotal Memory: %.1f MB",
+		swprintf_s(Buf, L"[Shadow Stats]\nShadow Lights: %u\n  Point: %u\n  Spot: %u\n  Directional: %u\n\nAtlas 2D: %u x %u (%.1f MB)\nAtlas Cube: %u x %u x %u (%.1f MB)\n\nTotal Memory: %.1f MB\nViews: %u rendered / %u cached (%u caster draws)\nAtlas Use: %.1f%% (%u regions, %u free nodes)\n  Reused: %u  Degraded: %u  Dropped: %u",
 			ShadowStats.TotalShadowCastingLights,
 			ShadowStats.ShadowCastingPointLights,
 			ShadowStats.ShadowCastingSpotLights,
@@ -349,9 +359,18 @@ void UStatsOverlayD2D::Draw()
 			ShadowStats.ShadowAtlasCubeSize,
 			ShadowStats.ShadowCubeArrayCount,
 			ShadowStats.ShadowAtlasCubeMemoryMB,
-			ShadowStats.TotalShadowMemoryMB);
-
-		const float shadowPanelHeight = 260.0f;
+			ShadowStats.TotalShadowMemoryMB,
+			ShadowStats.ShadowViewsRendered,
+			ShadowStats.ShadowViewsCached,
+			ShadowStats.ShadowCasterDraws,
+			ShadowStats.ShadowAtlasOccupancy * 100.0f,
+			ShadowStats.ShadowAtlasRegions,
+			ShadowStats.ShadowAtlasFreeNodes,
+			ShadowStats.ShadowAtlasReused,
+			ShadowStats.ShadowAtlasDegraded,
+			ShadowStats.ShadowAtlasDropped);
+
+		const float shadowPanelHeight = 320.0f;
 		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + shadowPanelHeight);
 		DrawTextBlock(D2DContext, TextFormat, Buf, rc, BrushBlack, BrushDeepPink);
 
@@ -363,10 +382,54 @@ void UStatsOverlayD2D::Draw()
 		NextY += shadowPanelHeight + Space;
 	}
 
+	if (bShowOcclusion)
+	{
+		const FOcclusionStats& Stats = FOcclusionStatManager::GetInstance().GetStats();
+
+		wchar_t OcclusionBuf[512];
+		swprintf_s(OcclusionBuf,
+			L"[Occlusion]\n"
+			L"Frustum Culled: %u / %u (%.3f ms)\n"
+			L"Occluded: %u / %u (%.1f%%)\n"
+			L"Occluders: %u (%u simplified)\n"
+			L"Occluder Tris: %u (%u rasterized)\n"
+			L"Depth Buffer: %u x %u\n"
+			L"Workers: %u + game thread\n"
+			L"Rasterize: %.3f ms\n"
+			L"Test: %.3f ms\n"
+			L"Total Occluded: %llu / %llu",
+			Stats.FrustumCulledCount,
+			Stats.FrustumTestedCount,
+			Stats.FrustumTimeMS,
+			Stats.OccludedCount,
+			Stats.TestedCount,
+			Stats.GetOccludedPercent(),
+			Stats.OccluderCount,
+			Stats.SimplifiedOccluderCount,
+			Stats.OccluderTriangleCount,
+			Stats.RasterizedTriangleCount,
+			Stats.BufferWidth,
+			Stats.BufferHeight,
+			Stats.WorkerCount,
+			Stats.RasterizeTimeMS,
+			Stats.TestTimeMS,
+			Stats.TotalOccluded,
+			Stats.TotalTested);
+
+		const float occlusionPanelHeight = 210.0f;
+		D2D1_RECT_F occlusionRc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + occlusionPanelHeight);
+		DrawTextBlock(D2DContext, TextFormat, OcclusionBuf, occlusionRc, BrushBlack, BrushSkyBlue);
+
+		NextY += occlusionPanelHeight + Space;
+	}
+
 	if (bShowSkinning)
 	{
 		// 스키닝 통계 매니저에서 데이터 가져오기
 		const FSkinningStats& Stats = FSkinningStatManager::GetInstance().GetStats();
+		const FAnimSharingStats& SharingStats = FAnimSharingManager::Get().GetStats();
+		const FAnimUpdateRateStats& UpdateRateStats = FAnimUpdateRateManager::Get().GetStats();
+		const uint32* LODCounts = UpdateRateStats.ComponentsPerLOD;
 
 		// 전역 스키닝 모드 확인
 		UWorld* World = GEngine.GetDefaultWorld();
@@ -402,7 +465,11 @@ void UStatsOverlayD2D::Draw()
 				L"\n"
 				L"Vertices: %d | Bones: %d\n"
 				L"Bone Buffer: %.2f KB\n"
-				L"Buffer Updates: %d",
+				L"Buffer Updates: %d\n"
+				L"Pose Buffers: %u | Pose Allocs: %u\n"
+				L"Anim Evals: %u unique / %u shared\n"
+				L"Anim LOD: %u near / %u mid / %u far / %u off / %u hidden\n"
+				L"Anim Updates: %u eval / %u interp / %u skip",
 				Stats.BoneMatrixCalcTimeMS,
 				Stats.VertexSkinningTimeMS, // GPU 모드에서는 0
 				Stats.BufferUploadTimeMS,   // 본 버퍼 업로드 시간
@@ -411,7 +478,15 @@ void UStatsOverlayD2D::Draw()
 				Stats.TotalVertices,
 				Stats.TotalBones,
 				Stats.BufferMemory / 1024.0, // 본 버퍼 메모리
-				Stats.BufferUpdateCount);
+				Stats.BufferUpdateCount,
+				Stats.PoseBuffersAcquired,
+				Stats.PoseAllocations,
+				SharingStats.UniqueEvaluations,
+				SharingStats.Instances,
+				LODCounts[0], LODCounts[1], LODCounts[2], LODCounts[3], LODCounts[4],
+				UpdateRateStats.Evaluations,
+				UpdateRateStats.Interpolations,
+				UpdateRateStats.SkippedEvaluations);
 		}
 		else
 		{
@@ -427,7 +502,11 @@ void UStatsOverlayD2D::Draw()
 				L"\n"
 				L"Vertices: %d | Bones: %d\n"
 				L"Vertex Buffer: %.2f KB\n"
-				L"Buffer Updates: %d",
+				L"Buffer Updates: %d\n"
+				L"Pose Buffers: %u | Pose Allocs: %u\n"
+				L"Anim Evals: %u unique / %u shared\n"
+				L"Anim LOD: %u near / %u mid / %u far / %u off / %u hidden\n"
+				L"Anim Updates: %u eval / %u interp / %u skip",
 				Stats.BoneMatrixCalcTimeMS,
 				Stats.VertexSkinningTimeMS, // CPU 모드에서만 값이 있음
 				Stats.BufferUploadTimeMS,   // 버텍스 버퍼 업로드 시간
@@ -436,10 +515,18 @@ void UStatsOverlayD2D::Draw()
 				Stats.TotalVertices,
 				Stats.TotalBones,
 				Stats.BufferMemory / 1024.0, // 버텍스 버퍼 메모리
-				Stats.BufferUpdateCount);
+				Stats.BufferUpdateCount,
+				Stats.PoseBuffersAcquired,
+				Stats.PoseAllocations,
+				SharingStats.UniqueEvaluations,
+				SharingStats.Instances,
+				LODCounts[0], LODCounts[1], LODCounts[2], LODCounts[3], LODCounts[4],
+				UpdateRateStats.Evaluations,
+				UpdateRateStats.Interpolations,
+				UpdateRateStats.SkippedEvaluations);
 		}
 
-		const float skinningPanelHeight = 250.0f;
+		const float skinningPanelHeight = 316.0f;
 		D2D1_RECT_F skinningRc = D2D1::RectF(Margin, NextY, Margin + SkinningPanelWidth, NextY + skinningPanelHeight);
 
 		DrawTextBlock(D2DContext, TextFormat, SkinningBuf, skinningRc, BrushBlack, BrushDeepPink);
@@ -449,6 +536,7 @@ void UStatsOverlayD2D::Draw()
 	{
 		const FParticleStats& Stats = FParticleStatManager::GetInstance().GetStats();
 		const FParticleStatManager& Mgr = FParticleStatManager::GetInstance();
+		const FParticleBufferStats& BufferStats = FParticleDynamicBufferAllocator::GetInstance().GetStats();
 
 		// 메모리를 KB 또는 MB로 표시
 		wchar_t MemoryStr[64];
@@ -461,7 +549,7 @@ void UStatsOverlayD2D::Draw()
 			swprintf_s(MemoryStr, L"%.2f KB", Stats.MemoryBytes / 1024.0);
 		}
 
-		wchar_t ParticleBuf[768];
+		wchar_t ParticleBuf[1024];
 		swprintf_s(ParticleBuf,
 			L"[Particles]\n"
 			L"Systems: %d\n"
@@ -474,7 +562,16 @@ void UStatsOverlayD2D::Draw()
 			L"Max/Min: (%d/%d)\n"
 			L"Avg: %.1f\n"
 			L"Spawned/Killed: %d/%d\n"
-			L"Memory: %s",
+			L"Memory: %s\n"
+			L"Dyn VB: %.1f / %.0f KB\n"
+			L"Dyn IB: %.1f / %.0f KB\n"
+			L"Maps/Allocs: %u/%u (Wrap %u, Grow %u)\n"
+			L"Fill Tasks: %u (%u threads)\n"
+			L"Culled: %d, Sim/Skip: %d/%d\n"
+			L"Budget P: %d / %d\n"
+			L"Budget E: %d / %d\n"
+			L"Suppress/Throttle: %d/%d (CatchUp %d)\n"
+			L"Pool Hit/Miss: %u/%u (Active %d, Free %d)",
 			Stats.ParticleSystemCount,
 			Stats.EmitterCount,
 			Stats.SpriteParticleCount,
@@ -487,9 +584,33 @@ void UStatsOverlayD2D::Draw()
 			Mgr.GetAvgParticles(),
 			Stats.SpawnedThisFrame,
 			Stats.KilledThisFrame,
-			MemoryStr);
-
-		const float particlePanelHeight = 260.0f;
+			MemoryStr,
+			BufferStats.VertexBytes / 1024.0,
+			BufferStats.VertexCapacity / 1024.0,
+			BufferStats.IndexBytes / 1024.0,
+			BufferStats.IndexCapacity / 1024.0,
+			BufferStats.Maps,
+			BufferStats.Allocations,
+			BufferStats.Wraps,
+			BufferStats.Grows,
+			BufferStats.FillTasks,
+			BufferStats.FillThreads,
+			Stats.CulledSystemCount,
+			Stats.SimulatedSystems,
+			Stats.SkippedTicks,
+			Stats.BudgetedParticles,
+			Stats.ParticleBudget,
+			Stats.BudgetedEmitters,
+			Stats.EmitterBudget,
+			Stats.SpawnSuppressedSystems,
+			Stats.ThrottledSystems,
+			Stats.CatchUpSteps,
+			Stats.PoolHits,
+			Stats.PoolMisses,
+			Stats.PoolActiveEffects,
+			Stats.PoolFreeComponents);
+
+		const float particlePanelHeight = 440.0f;
 		D2D1_RECT_F particleRc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + particlePanelHeight);
 		DrawTextBlock(D2DContext, TextFormat, ParticleBuf, particleRc, BrushBlack, BrushCyan);
 
@@ -497,6 +618,204 @@ void UStatsOverlayD2D::Draw()
 		NextY += particlePanelHeight + Space;
 	}
 
+	if (bShowPhysics)
+	{
+		const FPhysicsStats& Stats = FPhysicsStatManager::GetInstance().GetStats();
+
+		wchar_t PhysicsBuf[512];
+		swprintf_s(PhysicsBuf,
+			L"[Physics]\n"
+			L"Fixed Step: %.2f ms\n"
+			L"Substeps: %d / %d\n"
+			L"Avg Substeps: %.2f\n"
+			L"Interp Alpha: %.2f\n"
+			L"Interp Bodies: %u\n"
+			L"Simulate Wait: %.3f ms\n"
+			L"Clamped Frames: %u\n"
+			L"Dropped Time: %.1f ms",
+			Stats.FixedTimeStepMS,
+			Stats.SubStepsThisFrame,
+			Stats.MaxSubSteps,
+			Stats.GetAverageSubSteps(),
+			Stats.InterpolationAlpha,
+			Stats.InterpolatedBodyCount,
+			Stats.SimulateTimeMS,
+			Stats.ClampedFrames,
+			Stats.DroppedTimeMS);
+
+		const float physicsPanelHeight = 190.0f;
+		D2D1_RECT_F physicsRc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + physicsPanelHeight);
+		DrawTextBlock(D2DContext, TextFormat, PhysicsBuf, physicsRc, BrushBlack, BrushLightGreen);
+
+		NextY += physicsPanelHeight + Space;
+	}
+
+	if (bShowCloth)
+	{
+		const FClothStats& Stats = FClothStatManager::GetInstance().GetStats();
+
+		// 가장 비싼 천 (지난 시뮬레이션 기준)
+		const FClothInstanceStats* SlowestCloth = nullptr;
+		for (const FClothInstanceStats& Instance : Stats.Instances)
+		{
+			if (!SlowestCloth || Instance.SimulateTimeMS > SlowestCloth->SimulateTimeMS)
+			{
+				SlowestCloth = &Instance;
+			}
+		}
+
+		wchar_t ClothBuf[512];
+		swprintf_s(ClothBuf,
+			L"[Cloth]\n"
+			L"Cloths: %u (Simulated: %u)\n"
+			L"Workers: %u\n"
+			L"LOD Full/Half/Quarter: %u / %u / %u\n"
+			L"Frozen: %u\n"
+			L"Wall Time: %.3f ms\n"
+			L"Chunk Total: %.3f ms (Max %.3f)\n"
+			L"Game Thread Wait: %.3f ms\n"
+			L"Slowest Cloth: %.3f ms (%u particles)",
+			static_cast<uint32>(Stats.Instances.Num()),
+			Stats.SimulatedChunkCount,
+			Stats.WorkerCount,
+			Stats.LODCounts[static_cast<int>(EClothLOD::Full)],
+			Stats.LODCounts[static_cast<int>(EClothLOD::Half)],
+			Stats.LODCounts[static_cast<int>(EClothLOD::Quarter)],
+			Stats.LODCounts[static_cast<int>(EClothLOD::Frozen)],
+			Stats.SimulationWallTimeMS,
+			Stats.TotalChunkTimeMS,
+			Stats.MaxChunkTimeMS,
+			Stats.WaitTimeMS,
+			SlowestCloth ? SlowestCloth->SimulateTimeMS : 0.0,
+			SlowestCloth ? SlowestCloth->ParticleCount : 0u);
+
+		const float clothPanelHeight = 190.0f;
+		D2D1_RECT_F clothRc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + clothPanelHeight);
+		DrawTextBlock(D2DContext, TextFormat, ClothBuf, clothRc, BrushBlack, BrushViolet);
+
+		NextY += clothPanelHeight + Space;
+	}
+
+	UWorldPartitionManager* Partition = GWorld ? GWorld->GetPartitionManager() : nullptr;
+	if (bShowPartition && Partition && Partition->GetBVH())
+	{
+		const FBVHStats& Stats = Partition->GetBVH()->GetStats();
+
+		wchar_t PartitionBuf[512];
+		swprintf_s(PartitionBuf,
+			L"[World Partition]\n"
+			L"Static: %d (Rebuilds: %llu, Last %.3f ms)\n"
+			L"Dynamic: %d (Height: %d)\n"
+			L"Dyn Insert/Remove: %llu / %llu\n"
+			L"Dyn Reinsert: %llu\n"
+			L"Dyn In Fat Bounds: %llu\n"
+			L"Dyn Rotations: %llu\n"
+			L"Promoted/Demoted Static: %llu / %llu",
+			Stats.StaticCount,
+			Stats.StaticRebuildCount,
+			Stats.LastStaticRebuildMS,
+			Stats.DynamicCount,
+			Stats.DynamicTreeHeight,
+			Stats.DynamicInsertCount,
+			Stats.DynamicRemoveCount,
+			Stats.DynamicReinsertCount,
+			Stats.DynamicFatHitCount,
+			Stats.DynamicRotationCount,
+			Stats.PromotedToDynamicCount,
+			Stats.DemotedToStaticCount);
+
+		const float partitionPanelHeight = 170.0f;
+		D2D1_RECT_F partitionRc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + partitionPanelHeight);
+		DrawTextBlock(D2DContext, TextFormat, PartitionBuf, partitionRc, BrushBlack, BrushOrange);
+
+		NextY += partitionPanelHeight + Space;
+	}
+
+	FWorldPartitionStreaming* Streaming = Partition ? Partition->GetStreaming() : nullptr;
+	if (bShowStreaming && Streaming && Streaming->IsActive())
+	{
+		const FWorldStreamingStats& Stats = Streaming->GetStats();
+
+		wchar_t StreamingBuf[512];
+		swprintf_s(StreamingBuf,
+			L"[World Streaming]\n"
+			L"Cells: %d / %d Loaded\n"
+			L"Loading: %d, Activating: %d\n"
+			L"Streamed Actors: %d\n"
+			L"Activated: %d (%.3f ms)\n"
+			L"Max Frame: %.3f ms\n"
+			L"Hitches: %u\n"
+			L"Loads/Unloads: %llu / %llu\n"
+			L"Canceled: %llu",
+			Stats.LoadedCells,
+			Stats.CellCount,
+			Stats.LoadingCells,
+			Stats.ActivatingCells,
+			Stats.StreamedActors,
+			Stats.ActorsActivatedThisFrame,
+			Stats.GameThreadTimeMS,
+			Stats.MaxGameThreadTimeMS,
+			Stats.HitchFrames,
+			Stats.TotalCellLoads,
+			Stats.TotalCellUnloads,
+			Stats.CanceledLoads);
+
+		const float streamingPanelHeight = 190.0f;
+		D2D1_RECT_F streamingRc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + streamingPanelHeight);
+		DrawTextBlock(D2DContext, TextFormat, StreamingBuf, streamingRc, BrushBlack, BrushLightGreen);
+
+		NextY += streamingPanelHeight + Space;
+	}
+
+	FLuaManager* LuaManager = GWorld ? GWorld->GetLuaManager() : nullptr;
+	if (bShowLua && LuaManager)
+	{
+		const FLuaTickStats& Stats = LuaManager->GetTickManager().GetStats();
+		const FLuaCoroutineStats& CoroStats = LuaManager->GetScheduler().GetStats();
+
+		// 이번 프레임 Tick 시간이 큰 스크립트 파일 순
+		TArray<FLuaScriptTickStats> ScriptStats;
+		LuaManager->GetTickManager().GetScriptStats(ScriptStats);
+		std::sort(ScriptStats.begin(), ScriptStats.end(),
+			[](const FLuaScriptTickStats& A, const FLuaScriptTickStats& B) { return A.TimeMS > B.TimeMS; });
+
+		wchar_t LuaBuf[1024];
+		int Written = swprintf_s(LuaBuf,
+			L"[Lua Tick]\n"
+			L"Scripts: %d, Ticks: %d\n"
+			L"Dispatch: %.3f ms (%d files)\n"
+			L"Errors: %llu\n"
+			L"Coroutines: %d (timer %d, pred %d, event %d)\n"
+			L"Resumes: %d, %.3f ms\n",
+			Stats.RegisteredScripts,
+			Stats.TicksThisFrame,
+			Stats.DispatchMS,
+			Stats.DispatchedGroups,
+			Stats.TotalErrors,
+			CoroStats.LiveTasks,
+			CoroStats.TimerWaits,
+			CoroStats.PredicateWaits,
+			CoroStats.EventWaits,
+			CoroStats.ResumesThisFrame,
+			CoroStats.ProcessMS);
+
+		const int32 MaxFiles = 5;
+		const int32 NumFiles = std::min(static_cast<int32>(ScriptStats.Num()), MaxFiles);
+		for (int32 Index = 0; Index < NumFiles && Written > 0; ++Index)
+		{
+			const FLuaScriptTickStats& Script = ScriptStats[Index];
+			const FString FileName = std::filesystem::path(Script.ScriptPath).filename().string();
+			Written += swprintf_s(LuaBuf + Written, _countof(LuaBuf) - Written,
+				L"%hs x%d: %.3f ms\n", FileName.c_str(), Script.NumInstances, Script.TimeMS);
+		}
+
+		const float luaPanelHeight = 126.0f + 18.0f * NumFiles;
+		D2D1_RECT_F luaRc = D2D1::RectF(Margin, NextY, Margin + SkinningPanelWidth, NextY + luaPanelHeight);
+		DrawTextBlock(D2DContext, TextFormat, LuaBuf, luaRc, BrushBlack, BrushCyan);
+
+		NextY += luaPanelHeight + Space;
+	}
+
 	D2DContext->EndDraw();
 	D2DContext->SetTarget(nullptr);
 
@@ -18,8 +18,14 @@ public:
     void SetShowTileCulling(bool b)  { bShowTileCulling = b; }
     void SetShowLights(bool b) { bShowLights = b; }
     void SetShowShadow(bool b) { bShowShadow = b; }
+    void SetShowOcclusion(bool b) { bShowOcclusion = b; }
     void SetShowSkinning(bool b) { bShowSkinning = b; }
     void SetShowParticles(bool b) { bShowParticles = b; }
+    void SetShowPhysics(bool b) { bShowPhysics = b; }
+    void SetShowCloth(bool b) { bShowCloth = b; }
+    void SetShowPartition(bool b) { bShowPartition = b; }
+    void SetShowStreaming(bool b) { bShowStreaming = b; }
+    void SetShowLua(bool b) { bShowLua = b; }
     void ToggleFPS() { bShowFPS = !bShowFPS; }
     void ToggleMemory() { bShowMemory = !bShowMemory; }
     void TogglePicking() { bShowPicking = !bShowPicking; }
@@ -27,8 +33,14 @@ public:
     void ToggleTileCulling() { bShowTileCulling = !bShowTileCulling; }
     void ToggleLights() { bShowLights = !bShowLights; }
     void ToggleShadow() { bShowShadow = !bShowShadow; }
+    void ToggleOcclusion() { bShowOcclusion = !bShowOcclusion; }
     void ToggleSkinning() { bShowSkinning = !bShowSkinning; }
     void ToggleParticles() { bShowParticles = !bShowParticles; }
+    void TogglePhysics() { bShowPhysics = !bShowPhysics; }
+    void ToggleCloth() { bShowCloth = !bShowCloth; }
+    void TogglePartition() { bShowPartition = !bShowPartition; }
+    void ToggleStreaming() { bShowStreaming = !bShowStreaming; }
+    void ToggleLua() { bShowLua = !bShowLua; }
     bool IsFPSVisible() const { return bShowFPS; }
     bool IsMemoryVisible() const { return bShowMemory; }
     bool IsPickingVisible() const { return bShowPicking; }
@@ -36,8 +48,14 @@ public:
     bool IsTileCullingVisible() const { return bShowTileCulling; }
     bool IsLightsVisible() const { return bShowLights; }
     bool IsShadowVisible() const { return bShowShadow; }
+    bool IsOcclusionVisible() const { return bShowOcclusion; }
     bool IsSkinningVisible() const { return bShowSkinning; }
     bool IsParticlesVisible() const { return bShowParticles; }
+    bool IsPhysicsVisible() const { return bShowPhysics; }
+    bool IsClothVisible() const { return bShowCloth; }
+    bool IsPartitionVisible() const { return bShowPartition; }
+    bool IsStreamingVisible() const { return bShowStreaming; }
+    bool IsLuaVisible() const { return bShowLua; }
 
 private:
     UStatsOverlayD2D() = default;
@@ -56,9 +74,15 @@ private:
     bool bShowDecal = false;
     bool bShowTileCulling = false;
     bool bShowShadow = false;
+    bool bShowOcclusion = false;
     bool bShowLights = false;
     bool bShowSkinning = false;
     bool bShowParticles = false;
+    bool bShowPhysics = false;
+    bool bShowCloth = false;
+    bool bShowPartition = false;
+    bool bShowStreaming = false;
+    bool bShowLua = false;
 
     ID3D11Device* D3DDevice = nullptr;
     ID3D11DeviceContext* D3DContext = nullptr;
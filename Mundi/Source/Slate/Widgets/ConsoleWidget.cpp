@@ -6,6 +6,21 @@
 #include "SlateManager.h"
 #include "SkinnedMeshComponent.h"
 #include "PlatformCrashHandler.h"
+#include "ShaderCompileManager.h"
+#include "ShadowAtlasAllocator.h"
+#include "PhysScene.h"
+#include "WorldPartitionManager.h"
+#include "WorldPartitionStreaming.h"
+#include "LuaManager.h"
+#include "LuaChunkCache.h"
+#include "AnimSharingManager.h"
+#include "AnimUpdateRateManager.h"
+#include "ParticleSignificanceManager.h"
+#include "ParticleSystemPool.h"
+#include "VectorBatch.h"
+#include "Frustum.h"
+#include "Occlusion.h"
+#include "OcclusionStats.h"
 #include <windows.h>
 #include <cstdarg>
 #include <cctype>
@@ -46,19 +61,61 @@ void UConsoleWidget::Initialize()
 	HelpCommandList.Add("HISTORY");
 	HelpCommandList.Add("CLEAR");
 	HelpCommandList.Add("CLASSIFY");
+	HelpCommandList.Add("LOG LIST");
+	HelpCommandList.Add("LOG <category> <verbosity>");
 	HelpCommandList.Add("STAT");
 	HelpCommandList.Add("STAT FPS");
 	HelpCommandList.Add("STAT MEMORY");
+	HelpCommandList.Add("MEMREPORT");
 	HelpCommandList.Add("STAT PICKING");
 	HelpCommandList.Add("STAT DECAL");
 	HelpCommandList.Add("STAT SKINNING");
 	HelpCommandList.Add("SKINNING GPU");
 	HelpCommandList.Add("SKINNING CPU");
+	HelpCommandList.Add("ANIMSHARE ON|OFF");
+	HelpCommandList.Add("ANIMSHARE RATE <hz>");
+	HelpCommandList.Add("ANIMSHARE BUCKETS <count>");
+	HelpCommandList.Add("ANIMURO ON|OFF");
+	HelpCommandList.Add("ANIMURO RATE <near|mid|far|offscreen> <frames>");
+	HelpCommandList.Add("ANIMURO SIZE <mid> <far>");
+	HelpCommandList.Add("PARTICLESIG ON|OFF");
+	HelpCommandList.Add("PARTICLESIG BUDGET <particles> <emitters>");
+	HelpCommandList.Add("PARTICLESIG RATE <near|mid|far|offscreen> <frames>");
+	HelpCommandList.Add("PARTICLESIG SIZE <mid> <far>");
+	HelpCommandList.Add("PARTICLESIG CATCHUP <seconds>");
+	HelpCommandList.Add("PARTICLEPOOL [TRIM|RESET|MAX <count>]");
+	HelpCommandList.Add("PARTICLEPOOL SELFTEST");
+	HelpCommandList.Add("CONTAINER BENCH [keys]");
+	HelpCommandList.Add("CONTAINER SELFTEST");
+	HelpCommandList.Add("MATH BENCH [count]");
+	HelpCommandList.Add("MATH SELFTEST");
+	HelpCommandList.Add("CULL BENCH [count]");
+	HelpCommandList.Add("OCCLUSION ON|OFF");
+	HelpCommandList.Add("OCCLUSION OCCLUDERS <count>");
+	HelpCommandList.Add("OCCLUSION TRIS <budget>");
+	HelpCommandList.Add("SHADER PREWARM");
+	HelpCommandList.Add("SHADER STATUS");
+	HelpCommandList.Add("PHYSICS STEP <hz>");
+	HelpCommandList.Add("PHYSICS SUBSTEPS <count>");
+	HelpCommandList.Add("STREAMING COOK <scene> <cellsize>");
+	HelpCommandList.Add("STREAMING OPEN <manifest>");
+	HelpCommandList.Add("STREAMING TEST [speed]");
+	HelpCommandList.Add("LUA CACHE");
+	HelpCommandList.Add("LUA RELOAD");
+	HelpCommandList.Add("LUA COOK [dir]");
+	HelpCommandList.Add("LUA COROBENCH [count] [frames]");
 	HelpCommandList.Add("STAT ALL");
 	HelpCommandList.Add("STAT NONE");
 	HelpCommandList.Add("STAT LIGHT");
 	HelpCommandList.Add("STAT SHADOW");
+	HelpCommandList.Add("SHADOW ATLAS SELFTEST");
+	HelpCommandList.Add("STAT OCCLUSION");
 	HelpCommandList.Add("STAT PARTICLES");
+	HelpCommandList.Add("STAT PHYSICS");
+	HelpCommandList.Add("STAT CLOTH");
+	HelpCommandList.Add("STAT PARTITION");
+	HelpCommandList.Add("STAT STREAMING");
+	HelpCommandList.Add("STAT LUA");
 	HelpCommandList.Add("MINIDUMP");
 	HelpCommandList.Add("CAUSECRASH");
 	HelpCommandList.Add("CRASHIN <seconds>");
@@ -77,7 +134,13 @@ void UConsoleWidget::Initialize()
 
 void UConsoleWidget::Update()
 {
-	// Console doesn't need per-frame updates
+	// 로그 백엔드의 드레인 스레드가 넘겨준 줄을 가져온다 (게임 스레드)
+	TArray<FConsoleLogLine> NewLines;
+	FLogManager::GetInstance().PullConsoleLines(NewLines);
+	for (FConsoleLogLine& Line : NewLines)
+	{
+		AddItem(std::move(Line));
+	}
 }
 
 void UConsoleWidget::RenderWidget()
@@ -121,9 +184,9 @@ void UConsoleWidget::RenderToolbar()
 	{
 		// 모든 로그 아이템을 하나의 문자열로 결합
 		FString combined_text;
-		for (const FString& item : Items)
+		for (const FConsoleLogLine& item : Items)
 		{
-			combined_text += item;
+			combined_text += item.Text;
 			combined_text += "\n";
 		}
 
@@ -215,26 +278,26 @@ void UConsoleWidget::RenderLogOutput()
 
 		ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(4, 1)); // Tighten spacing
 
-		for (const FString& item : Items)
+		for (const FConsoleLogLine& item : Items)
 		{
-			if (!Filter.PassFilter(item.c_str()))
+			if (!Filter.PassFilter(item.Text.c_str()))
 				continue;
 
-			// Color coding for different log levels
+			// Color coding for different log levels (상세도는 로그 시점에 판정됨)
 			ImVec4 color;
 			bool has_color = false;
 
-			if (item.find("[error]") != std::string::npos)
+			if (item.Verbosity == ELogVerbosity::Error)
 			{
 				color = ImVec4(1.0f, 0.4f, 0.4f, 1.0f);
 				has_color = true;
 			}
-			else if (item.find("[warning]") != std::string::npos)
+			else if (item.Verbosity == ELogVerbosity::Warning)
 			{
 				color = ImVec4(1.0f, 0.8f, 0.0f, 1.0f);
 				has_color = true;
 			}
-			else if (item.find("[info]") != std::string::npos)
+			else if (item.Verbosity == ELogVerbosity::Display)
 			{
 				color = ImVec4(0.0f, 0.8f, 1.0f, 1.0f);
 				has_color = true;
@@ -242,7 +305,7 @@ void UConsoleWidget::RenderLogOutput()
 
 			if (has_color)
 				ImGui::PushStyleColor(ImGuiCol_Text, color);
-			ImGui::TextUnformatted(item.c_str());
+			ImGui::TextUnformatted(item.Text.c_str());
 			if (has_color)
 				ImGui::PopStyleColor();
 		}
@@ -291,13 +354,10 @@ void UConsoleWidget::AddLog(const char* fmt, ...)
 	buf[sizeof(buf) - 1] = 0;
 	va_end(args);
 
-	if (strstr(buf, "[error]") != nullptr)
-	{
-		USlateManager::GetInstance().ForceOpenConsole();
-	}
-
-	Items.Add(FString(buf));
-	ScrollToBottom = true;
+	FConsoleLogLine Line;
+	Line.Text = buf;
+	Line.Verbosity = UGlobalConsole::GetVerbosityFromTag(buf);
+	AddItem(std::move(Line));
 }
 
 void UConsoleWidget::VAddLog(const char* fmt, va_list args)
@@ -306,15 +366,33 @@ void UConsoleWidget::VAddLog(const char* fmt, va_list args)
 	vsnprintf_s(buf, sizeof(buf), fmt, args);
 	buf[sizeof(buf) - 1] = 0;
 
-	if (strstr(buf, "[error]") != nullptr)
+	FConsoleLogLine Line;
+	Line.Text = buf;
+	Line.Verbosity = UGlobalConsole::GetVerbosityFromTag(buf);
+	AddItem(std::move(Line));
+}
+
+void UConsoleWidget::AddItem(FConsoleLogLine&& InLine)
+{
+	if (InLine.Verbosity == ELogVerbosity::Error)
 	{
 		USlateManager::GetInstance().ForceOpenConsole();
 	}
 
-	Items.Add(FString(buf));
+	Items.Add(std::move(InLine));
+	TrimItems();
 	ScrollToBottom = true;
 }
 
+void UConsoleWidget::TrimItems()
+{
+	// 한 줄씩 지우면 매번 배열 전체가 밀리므로 한도를 넘으면 1/4을 한 번에 버린다
+	if (Items.Num() > MaxItems)
+	{
+		Items.erase(Items.begin(), Items.begin() + MaxItems / 4);
+	}
+}
+
 void UConsoleWidget::ClearLog()
 {
 	Items.Empty();
@@ -357,6 +435,42 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 	{
 		AddLog("This is a classification test command.");
 	}
+	else if (Stricmp(command_line, "LOG LIST") == 0)
+	{
+		const FLogStats Stats = FLogManager::GetInstance().GetStats();
+		AddLog("Log categories (written %llu, dropped %llu, console dropped %llu):", Stats.Written, Stats.Dropped, Stats.ConsoleDropped);
+		for (const FLogCategoryBase* Category : FLogCategoryBase::GetRegisteredCategories())
+		{
+			AddLog("- %s: %s", Category->GetName(), ELogVerbosity::ToString(Category->GetVerbosity()));
+		}
+	}
+	else if (Strnicmp(command_line, "LOG ", 4) == 0)
+	{
+		// 런타임 상세도 변경: LOG LogPicking Verbose
+		char CategoryName[64] = {};
+		char VerbosityName[32] = {};
+		ELogVerbosity::Type Verbosity;
+		if (sscanf_s(command_line + 4, "%63s %31s", CategoryName, (unsigned)_countof(CategoryName), VerbosityName, (unsigned)_countof(VerbosityName)) != 2)
+		{
+			AddLog("Usage: LOG <category> <verbosity>");
+		}
+		else if (FLogCategoryBase* Category = FLogCategoryBase::FindCategory(CategoryName))
+		{
+			if (ELogVerbosity::FromString(VerbosityName, Verbosity))
+			{
+				Category->SetVerbosity(Verbosity);
+				AddLog("%s verbosity: %s", Category->GetName(), ELogVerbosity::ToString(Verbosity));
+			}
+			else
+			{
+				AddLog("[error] Unknown verbosity: %s", VerbosityName);
+			}
+		}
+		else
+		{
+			AddLog("[error] Unknown log category: %s", CategoryName);
+		}
+	}
 	else if (Stricmp(command_line, "STAT") == 0)
 	{
 		AddLog("STAT commands:");
@@ -367,7 +481,13 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		AddLog("- STAT SKINNING");
 		AddLog("- STAT LIGHT");
 		AddLog("- STAT SHADOW");
+		AddLog("- STAT OCCLUSION");
 		AddLog("- STAT PARTICLES");
+		AddLog("- STAT PHYSICS");
+		AddLog("- STAT CLOTH");
+		AddLog("- STAT PARTITION");
+		AddLog("- STAT STREAMING");
+		AddLog("- STAT LUA");
 		AddLog("- STAT ALL");
 		AddLog("- STAT NONE");
 	}
@@ -405,7 +525,13 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().SetShowTileCulling(true);
 		UStatsOverlayD2D::Get().SetShowSkinning(true);
 		UStatsOverlayD2D::Get().SetShowShadow(true);
+		UStatsOverlayD2D::Get().SetShowOcclusion(true);
 		UStatsOverlayD2D::Get().SetShowParticles(true);
+		UStatsOverlayD2D::Get().SetShowPhysics(true);
+		UStatsOverlayD2D::Get().SetShowCloth(true);
+		UStatsOverlayD2D::Get().SetShowPartition(true);
+		UStatsOverlayD2D::Get().SetShowStreaming(true);
+		UStatsOverlayD2D::Get().SetShowLua(true);
 		AddLog("STAT: ON");
 	}
 	else if (Stricmp(command_line, "STAT SKINNING") == 0)
@@ -418,11 +544,52 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().ToggleShadow();
 		AddLog("STAT SHADOW TOGGLED");
 	}
+	else if (Strnicmp(command_line, "SHADOW ATLAS SELFTEST", 21) == 0)
+	{
+		// 쿼드트리 할당/해제/병합, 공간 부족 시 LOD 강등, 프레임 간 영역 유지 점검
+		TArray<FString> Failures;
+		const int32 NumChecks = RunShadowAtlasAllocatorSelfTest(Failures);
+		for (const FString& Failure : Failures)
+		{
+			AddLog("[error] Shadow atlas self test failed: %s", Failure.c_str());
+		}
+		AddLog("Shadow atlas self test: %d/%d passed", NumChecks - Failures.Num(), NumChecks);
+	}
+	else if (Stricmp(command_line, "STAT OCCLUSION") == 0)
+	{
+		UStatsOverlayD2D::Get().ToggleOcclusion();
+		AddLog("STAT OCCLUSION TOGGLED");
+	}
 	else if (Stricmp(command_line, "STAT PARTICLES") == 0)
 	{
 		UStatsOverlayD2D::Get().ToggleParticles();
 		AddLog("STAT PARTICLES TOGGLED");
 	}
+	else if (Stricmp(command_line, "STAT PHYSICS") == 0)
+	{
+		UStatsOverlayD2D::Get().TogglePhysics();
+		AddLog("STAT PHYSICS TOGGLED");
+	}
+	else if (Stricmp(command_line, "STAT CLOTH") == 0)
+	{
+		UStatsOverlayD2D::Get().ToggleCloth();
+		AddLog("STAT CLOTH TOGGLED");
+	}
+	else if (Stricmp(command_line, "STAT PARTITION") == 0)
+	{
+		UStatsOverlayD2D::Get().TogglePartition();
+		AddLog("STAT PARTITION TOGGLED");
+	}
+	else if (Stricmp(command_line, "STAT STREAMING") == 0)
+	{
+		UStatsOverlayD2D::Get().ToggleStreaming();
+		AddLog("STAT STREAMING TOGGLED");
+	}
+	else if (Stricmp(command_line, "STAT LUA") == 0)
+	{
+		UStatsOverlayD2D::Get().ToggleLua();
+		AddLog("STAT LUA TOGGLED");
+	}
 	else if (Stricmp(command_line, "STAT NONE") == 0)
 	{
 		UStatsOverlayD2D::Get().SetShowFPS(false);
@@ -432,7 +599,13 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().SetShowTileCulling(false);
 		UStatsOverlayD2D::Get().SetShowSkinning(false);
 		UStatsOverlayD2D::Get().SetShowShadow(false);
+		UStatsOverlayD2D::Get().SetShowOcclusion(false);
 		UStatsOverlayD2D::Get().SetShowParticles(false);
+		UStatsOverlayD2D::Get().SetShowPhysics(false);
+		UStatsOverlayD2D::Get().SetShowCloth(false);
+		UStatsOverlayD2D::Get().SetShowPartition(false);
+		UStatsOverlayD2D::Get().SetShowStreaming(false);
+		UStatsOverlayD2D::Get().SetShowLua(false);
 		AddLog("STAT: OFF");
 	}
 	else if (Strnicmp(command_line, "SKINNING GPU", 12) == 0)
@@ -471,6 +644,467 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 
 		AddLog("CPU Skinning enabled globally (all worlds)");
 	}
+	else if (Stricmp(command_line, "SHADER PREWARM") == 0)
+	{
+		// 현재 월드의 머티리얼 x 뷰 모드 퍼뮤테이션을 백그라운드에서 미리 컴파일 (캐시에 있으면 디스크에서 로드)
+		const TArray<FWorldContext>& WorldContexts = GEngine.GetWorldContexts();
+		UWorld* ActiveWorld = WorldContexts.empty() ? nullptr : WorldContexts.back().World;
+		if (ActiveWorld)
+		{
+			uint32 NumRequested = FShaderCompileManager::GetInstance().PrewarmWorld(ActiveWorld);
+			AddLog("Shader prewarm: %u variants requested", NumRequested);
+		}
+		else
+		{
+			AddLog("Shader prewarm: no active world");
+		}
+	}
+	else if (Stricmp(command_line, "SHADER STATUS") == 0)
+	{
+		AddLog("Shader compile jobs outstanding: %d", FShaderCompileManager::GetInstance().GetNumOutstandingJobs());
+	}
+	else if (Strnicmp(command_line, "ANIMSHARE", 9) == 0)
+	{
+		// 같은 시퀀스를 재생하는 군중의 포즈 평가 공유
+		FAnimSharingManager& Sharing = FAnimSharingManager::Get();
+		const char* Args = command_line + 9;
+		while (*Args == ' ') ++Args;
+
+		float Rate = 0.0f;
+		int Buckets = 0;
+		if (Stricmp(Args, "ON") == 0)
+		{
+			Sharing.SetEnabled(true);
+		}
+		else if (Stricmp(Args, "OFF") == 0)
+		{
+			Sharing.SetEnabled(false);
+		}
+		else if (Strnicmp(Args, "RATE", 4) == 0 && sscanf_s(Args + 4, "%f", &Rate) == 1)
+		{
+			Sharing.SetSampleRate(Rate);
+		}
+		else if (Strnicmp(Args, "BUCKETS", 7) == 0 && sscanf_s(Args + 7, "%d", &Buckets) == 1)
+		{
+			Sharing.SetNumTimeBuckets(Buckets);
+		}
+
+		const FAnimSharingStats& Stats = Sharing.GetStats();
+		AddLog("Anim sharing: %s, rate %.1f Hz, %d time bucket(s)", Sharing.IsEnabled() ? "ON" : "OFF", Sharing.GetSampleRate(), Sharing.GetNumTimeBuckets());
+		AddLog("  Last frame: %u unique evaluations for %u instances (%u cached groups)", Stats.UniqueEvaluations, Stats.Instances, Stats.CachedGroups);
+	}
+	else if (Strnicmp(command_line, "CONTAINER BENCH", 15) == 0)
+	{
+		// TMap(std::unordered_map) 대비 TFlatMap(오픈 어드레싱) 비교
+		int NumKeys = 10000;
+		sscanf_s(command_line + 15, "%d", &NumKeys);
+		NumKeys = std::clamp(NumKeys, 16, 4000000);
+
+		const FFlatHashBenchmarkResult Result = RunFlatHashBenchmark(NumKeys);
+		AddLog("Container bench (%d pointer keys, ms)          TMap      TFlatMap", Result.NumKeys);
+		AddLog("  Insert                                  %9.3f  %9.3f", Result.StdInsertMS, Result.FlatInsertMS);
+		AddLog("  Find (hit)                              %9.3f  %9.3f", Result.StdFindHitMS, Result.FlatFindHitMS);
+		AddLog("  Find (miss)                             %9.3f  %9.3f", Result.StdFindMissMS, Result.FlatFindMissMS);
+		AddLog("  Iterate                                 %9.3f  %9.3f", Result.StdIterateMS, Result.FlatIterateMS);
+		AddLog("  Remove half                             %9.3f  %9.3f", Result.StdRemoveMS, Result.FlatRemoveMS);
+	}
+	else if (Stricmp(command_line, "MEMREPORT") == 0)
+	{
+		// 태그별 사용량, 풀, 스레드별 프레임 할당자 현황
+		TArray<FString> Lines;
+		FMemoryManager::BuildReport(Lines);
+		for (const FString& Line : Lines)
+		{
+			AddLog("%s", Line.c_str());
+		}
+	}
+	else if (Strnicmp(command_line, "CONTAINER SELFTEST", 18) == 0)
+	{
+		// 인라인/프레임 스택 할당자 점검 (성장, 복사/이동, 축소, 마크 회수)
+		TArray<FString> Failures;
+		const int32 NumChecks = RunContainerAllocatorSelfTest(Failures);
+		for (const FString& Failure : Failures)
+		{
+			AddLog("[error] Container self test failed: %s", Failure.c_str());
+		}
+		AddLog("Container self test: %d/%d passed", NumChecks - Failures.Num(), NumChecks);
+	}
+	else if (Strnicmp(command_line, "MATH BENCH", 10) == 0)
+	{
+		// 스칼라 구현 대비 SIMD 쿼터니언/트랜스폼 연산과 배열 커널 비교
+		int Count = 100000;
+		sscanf_s(command_line + 10, "%d", &Count);
+		Count = std::clamp(Count, 16, 4000000);
+
+		const FVectorMathBenchmarkResult Result = RunVectorMathBenchmark(Count);
+		AddLog("Math bench (%d elements, ms)               Scalar      SIMD", Result.Count);
+		AddLog("  Quat multiply                           %9.3f  %9.3f", Result.ScalarQuatMultiplyMS, Result.SimdQuatMultiplyMS);
+		AddLog("  Quat rotate vector                      %9.3f  %9.3f", Result.ScalarRotateVectorMS, Result.SimdRotateVectorMS);
+		AddLog("  Quat slerp                              %9.3f  %9.3f", Result.ScalarSlerpMS, Result.SimdSlerpMS);
+		AddLog("  Transform compose (batch)               %9.3f  %9.3f", Result.ScalarComposeMS, Result.SimdComposeMS);
+		AddLog("  Transform inverse                       %9.3f  %9.3f", Result.ScalarInverseMS, Result.SimdInverseMS);
+		AddLog("  Transform to matrix (batch)             %9.3f  %9.3f", Result.ScalarToMatrixMS, Result.SimdToMatrixMS);
+		AddLog("  Transform positions (batch)             %9.3f  %9.3f", Result.ScalarTransformPositionsMS, Result.SimdTransformPositionsMS);
+	}
+	else if (Strnicmp(command_line, "MATH SELFTEST", 13) == 0)
+	{
+		// SIMD 경로를 스칼라 기준 구현과 비교 (정밀도, 경계 조건, in-place 배열 커널)
+		TArray<FString> Failures;
+		const int32 NumChecks = RunVectorMathSelfTest(Failures);
+		for (const FString& Failure : Failures)
+		{
+			AddLog("[error] Math self test failed: %s", Failure.c_str());
+		}
+		AddLog("Math self test: %d/%d passed", NumChecks - Failures.Num(), NumChecks);
+	}
+	else if (Strnicmp(command_line, "CULL BENCH", 10) == 0)
+	{
+		// 스칼라 IsAABBVisible 대비 전치 평면/SoA 배치 절두체 컬링 비교
+		int Count = 100000;
+		sscanf_s(command_line + 10, "%d", &Count);
+		Count = std::clamp(Count, 16, 4000000);
+
+		const FFrustumCullBenchmarkResult Result = RunFrustumCullBenchmark(Count);
+		AddLog("Cull bench (%d boxes, %d visible, ms)", Result.NumBoxes, Result.NumVisible);
+		AddLog("  Scalar IsAABBVisible                    %9.3f", Result.ScalarMS);
+		AddLog("  SIMD single box                         %9.3f", Result.SingleBoxSIMDMS);
+		AddLog("  SIMD batch (SoA, 1 thread)              %9.3f", Result.BatchMS);
+		AddLog("  SIMD batch (SoA, up to %2d threads)      %9.3f", Result.NumThreads, Result.ParallelMS);
+		if (Result.NumMismatches > 0)
+		{
+			AddLog("[error] Cull bench: %d boxes differ from scalar result", Result.NumMismatches);
+		}
+	}
+	else if (Strnicmp(command_line, "OCCLUSION", 9) == 0)
+	{
+		// 메인 뷰 CPU 소프트웨어 오클루전 컬링
+		FOcclusionCullingManagerCPU& Occlusion = FOcclusionCullingManagerCPU::GetInstance();
+		const char* Args = command_line + 9;
+		while (*Args == ' ') ++Args;
+
+		int Value = 0;
+		if (Stricmp(Args, "ON") == 0)
+		{
+			Occlusion.SetEnabled(true);
+		}
+		else if (Stricmp(Args, "OFF") == 0)
+		{
+			Occlusion.SetEnabled(false);
+		}
+		else if (Strnicmp(Args, "OCCLUDERS", 9) == 0 && sscanf_s(Args + 9, "%d", &Value) == 1)
+		{
+			Occlusion.SetMaxOccluders(Value);
+		}
+		else if (Strnicmp(Args, "TRIS", 4) == 0 && sscanf_s(Args + 4, "%d", &Value) == 1)
+		{
+			Occlusion.SetOccluderTriangleBudget(Value);
+		}
+
+		const FOcclusionStats& Stats = FOcclusionStatManager::GetInstance().GetStats();
+		AddLog("Occlusion: %s, %d occluder(s), %d tri budget, %ux%u buffer", Occlusion.IsEnabled() ? "ON" : "OFF", Occlusion.GetMaxOccluders(), Occlusion.GetOccluderTriangleBudget(), Stats.BufferWidth, Stats.BufferHeight);
+		AddLog("  Last frame: %u / %u meshes occluded (%u frustum culled)", Stats.OccludedCount, Stats.TestedCount, Stats.FrustumCulledCount);
+	}
+	else if (Strnicmp(command_line, "ANIMURO", 7) == 0)
+	{
+		// 화면 크기/가시성에 따른 스켈레탈 메시 애니메이션 업데이트 레이트
+		FAnimUpdateRateManager& UpdateRate = FAnimUpdateRateManager::Get();
+		const char* Args = command_line + 7;
+		while (*Args == ' ') ++Args;
+
+		char LODName[16] = {};
+		int Frames = 0;
+		float MidSize = 0.0f, FarSize = 0.0f;
+		if (Stricmp(Args, "ON") == 0)
+		{
+			UpdateRate.SetEnabled(true);
+		}
+		else if (Stricmp(Args, "OFF") == 0)
+		{
+			UpdateRate.SetEnabled(false);
+		}
+		else if (Strnicmp(Args, "RATE", 4) == 0 && sscanf_s(Args + 4, "%15s %d", LODName, (unsigned)_countof(LODName), &Frames) == 2)
+		{
+			bool bFound = false;
+			for (int32 i = 0; i < static_cast<int32>(EAnimUpdateLOD::Invisible); ++i)
+			{
+				const EAnimUpdateLOD LOD = static_cast<EAnimUpdateLOD>(i);
+				if (Stricmp(LODName, FAnimUpdateRateManager::GetLODName(LOD)) == 0)
+				{
+					UpdateRate.SetUpdateRate(LOD, Frames);
+					bFound = true;
+				}
+			}
+			if (!bFound)
+			{
+				AddLog("Unknown anim LOD '%s' (near, mid, far, offscreen)", LODName);
+			}
+		}
+		else if (Strnicmp(Args, "SIZE", 4) == 0 && sscanf_s(Args + 4, "%f %f", &MidSize, &FarSize) == 2)
+		{
+			UpdateRate.SetScreenSizeThresholds(MidSize, FarSize);
+		}
+
+		const FAnimUpdateRateStats& Stats = UpdateRate.GetStats();
+		AddLog("Anim update rate: %s, screen size mid %.2f / far %.2f", UpdateRate.IsEnabled() ? "ON" : "OFF",
+			UpdateRate.GetMidScreenSize(), UpdateRate.GetFarScreenSize());
+		for (int32 i = 0; i < static_cast<int32>(EAnimUpdateLOD::Count); ++i)
+		{
+			const EAnimUpdateLOD LOD = static_cast<EAnimUpdateLOD>(i);
+			AddLog("  %-9s every %d frame(s): %u component(s)", FAnimUpdateRateManager::GetLODName(LOD),
+				UpdateRate.GetUpdateRate(LOD), Stats.ComponentsPerLOD[i]);
+		}
+		AddLog("  Last frame: %u evaluated, %u interpolated, %u skipped", Stats.Evaluations, Stats.Interpolations, Stats.SkippedEvaluations);
+	}
+	else if (Strnicmp(command_line, "PARTICLESIG", 11) == 0)
+	{
+		// 파티클 시스템 중요도 판정과 파티클/이미터 예산 (설정은 모든 월드 공유, 통계는 활성 월드)
+		const char* Args = command_line + 11;
+		while (*Args == ' ') ++Args;
+
+		char BucketName[16] = {};
+		int MaxParticles = 0, MaxEmitters = 0, Frames = 0;
+		float MidSize = 0.0f, FarSize = 0.0f, CatchUpTime = 0.0f;
+		if (Stricmp(Args, "ON") == 0)
+		{
+			FParticleSignificanceManager::SetEnabled(true);
+		}
+		else if (Stricmp(Args, "OFF") == 0)
+		{
+			FParticleSignificanceManager::SetEnabled(false);
+		}
+		else if (Strnicmp(Args, "BUDGET", 6) == 0 && sscanf_s(Args + 6, "%d %d", &MaxParticles, &MaxEmitters) == 2)
+		{
+			FParticleSignificanceManager::SetBudget(MaxParticles, MaxEmitters);
+		}
+		else if (Strnicmp(Args, "RATE", 4) == 0 && sscanf_s(Args + 4, "%15s %d", BucketName, (unsigned)_countof(BucketName), &Frames) == 2)
+		{
+			bool bFound = false;
+			for (int32 i = 0; i < static_cast<int32>(EParticleFParticleSignificanceManager::Hidden); ++i)
+			{
+				const EParticleSignificance Bucket = static_cast<EParticleSignificance>(i);
+				if (Stricmp(BucketName, FParticleSignificanceManager::GetBucketName(Bucket)) == 0)
+				{
+					FParticleSignificanceManager::SetUpdateRate(Bucket, Frames);
+					bFound = true;
+				}
+			}
+			if (!bFound)
+			{
+				AddLog("Unknown significance bucket '%s' (near, mid, far, offscreen)", BucketName);
+			}
+		}
+		else if (Strnicmp(Args, "SIZE", 4) == 0 && sscanf_s(Args + 4, "%f %f", &MidSize, &FarSize) == 2)
+		{
+			FParticleSignificanceManager::SetScreenSizeThresholds(MidSize, FarSize);
+		}
+		else if (Strnicmp(Args, "CATCHUP", 7) == 0 && sscanf_s(Args + 7, "%f", &CatchUpTime) == 1)
+		{
+			FParticleSignificanceManager::SetMaxCatchUpTime(CatchUpTime);
+		}
+
+		const TArray<FWorldContext>& WorldContexts = GEngine.GetWorldContexts();
+		UWorld* ActiveWorld = WorldContexts.empty() ? nullptr : WorldContexts.back().World;
+		const FParticleSignificanceManager* WorldSignificance = ActiveWorld ? ActiveWorld->GetParticleSignificanceManager() : nullptr;
+		const FParticleSignificanceStats Stats = WorldSignificance ? WorldSignificance->GetStats() : FParticleSignificanceStats();
+		AddLog("Particle significance: %s, budget %d particles / %d emitters (0 = unlimited), screen size mid %.2f / far %.2f, catch-up %.2fs",
+			FParticleSignificanceManager::IsEnabled() ? "ON" : "OFF", FParticleSignificanceManager::GetMaxParticles(), FParticleSignificanceManager::GetMaxEmitters(),
+			FParticleSignificanceManager::GetMidScreenSize(), FParticleSignificanceManager::GetFarScreenSize(), FParticleSignificanceManager::GetMaxCatchUpTime());
+		for (int32 i = 0; i < static_cast<int32>(EParticleFParticleSignificanceManager::Count); ++i)
+		{
+			const EParticleSignificance Bucket = static_cast<EParticleSignificance>(i);
+			AddLog("  %-9s every %d frame(s): %u system(s)", FParticleSignificanceManager::GetBucketName(Bucket),
+				FParticleSignificanceManager::GetUpdateRate(Bucket), Stats.SystemsPerBucket[i]);
+		}
+		AddLog("  Last frame: %d particles / %d emitters budgeted, %u spawn-suppressed, %u throttled",
+			Stats.BudgetedParticles, Stats.BudgetedEmitters, Stats.SpawnSuppressedSystems, Stats.EmitterThrottledSystems);
+		AddLog("  Ticks: %u simulated, %u skipped, %u catch-up step(s), %u fast-forward(s)",
+			Stats.SimulatedSystems, Stats.SkippedTicks, Stats.CatchUpSteps, Stats.FastForwards);
+	}
+	else if (Strnicmp(command_line, "PARTICLEPOOL", 12) == 0)
+	{
+		// 일회성 파티클 이펙트 풀 (활성 월드)
+		const TArray<FWorldContext>& WorldContexts = GEngine.GetWorldContexts();
+		UWorld* ActiveWorld = WorldContexts.empty() ? nullptr : WorldContexts.back().World;
+		FParticleSystemPool* Pool = ActiveWorld ? ActiveWorld->GetParticleSystemPool() : nullptr;
+		if (!Pool)
+		{
+			AddLog("ParticlePool: no active world");
+		}
+		else
+		{
+			const char* Args = command_line + 12;
+			while (*Args == ' ') ++Args;
+
+			int MaxFree = 0;
+			if (Stricmp(Args, "SELFTEST") == 0)
+			{
+				// 유한 버스트 이펙트가 방출 종료 후 남은 파티클까지 소멸하면 풀로 돌아와 재사용되는지 점검
+				TArray<FString> Failures;
+				const int32 NumChecks = RunParticleSystemPoolSelfTest(ActiveWorld, Failures);
+				for (const FString& Failure : Failures)
+				{
+					AddLog("[error] Particle pool self test failed: %s", Failure.c_str());
+				}
+				AddLog("Particle pool self test: %d/%d passed", NumChecks - Failures.Num(), NumChecks);
+			}
+			else if (Stricmp(Args, "TRIM") == 0)
+			{
+				Pool->TrimFreeComponents();
+			}
+			else if (Stricmp(Args, "RESET") == 0)
+			{
+				Pool->ResetStats();
+			}
+			else if (Strnicmp(Args, "MAX", 3) == 0 && sscanf_s(Args + 3, "%d", &MaxFree) == 1)
+			{
+				Pool->SetMaxFreePerTemplate(MaxFree);
+			}
+
+			const FParticleSystemPoolStats& Stats = Pool->GetStats();
+			AddLog("Particle pool: %d active, %d free (max %d per template)",
+				Stats.ActiveEffects, Stats.FreeComponents, Pool->GetMaxFreePerTemplate());
+			AddLog("  Hits %u / Misses %u (hit rate %.1f%%), %u returned, %u evicted",
+				Stats.Hits, Stats.Misses, Stats.GetHitRate() * 100.0f, Stats.Returns, Stats.Evictions);
+		}
+	}
+	else if (Strnicmp(command_line, "PHYSICS STEP", 12) == 0 || Strnicmp(command_line, "PHYSICS SUBSTEPS", 16) == 0)
+	{
+		const TArray<FWorldContext>& WorldContexts = GEngine.GetWorldContexts();
+		UWorld* ActiveWorld = WorldContexts.empty() ? nullptr : WorldContexts.back().World;
+		FPhysScene* PhysScene = ActiveWorld ? ActiveWorld->GetPhysicsScene() : nullptr;
+		if (!PhysScene)
+		{
+			AddLog("Physics: no physics scene in active world");
+		}
+		else if (Strnicmp(command_line, "PHYSICS SUBSTEPS", 16) == 0)
+		{
+			int MaxSubSteps = 0;
+			if (sscanf_s(command_line + 16, "%d", &MaxSubSteps) == 1)
+			{
+				PhysScene->SetMaxSubSteps(MaxSubSteps);
+			}
+			AddLog("Physics max substeps: %d", PhysScene->GetMaxSubSteps());
+		}
+		else
+		{
+			float StepHz = 0.0f;
+			if (sscanf_s(command_line + 12, "%f", &StepHz) == 1 && StepHz > 0.0f)
+			{
+				PhysScene->SetFixedTimeStep(1.0f / StepHz);
+			}
+			AddLog("Physics fixed step: %.2f ms (%.1f Hz)", PhysScene->GetFixedTimeStep() * 1000.0f, 1.0f / PhysScene->GetFixedTimeStep());
+		}
+	}
+	else if (Strnicmp(command_line, "STREAMING COOK", 14) == 0)
+	{
+		// .scene을 셀 파일 + 상주 씬 + 매니페스트(.streaming)로 굽는다
+		char ScenePath[512] = {};
+		float CellSize = 50.0f;
+		if (sscanf_s(command_line + 14, "%511s %f", ScenePath, (unsigned)_countof(ScenePath), &CellSize) < 1)
+		{
+			AddLog("Usage: STREAMING COOK <scene> <cellsize>");
+		}
+		else
+		{
+			FString Message;
+			FWorldPartitionStreaming::CookScene(UTF8ToWide(ScenePath), CellSize, Message);
+			AddLog("Streaming: %s", Message.c_str());
+		}
+	}
+	else if (Strnicmp(command_line, "STREAMING OPEN", 14) == 0 || Strnicmp(command_line, "STREAMING TEST", 14) == 0)
+	{
+		const TArray<FWorldContext>& WorldContexts = GEngine.GetWorldContexts();
+		UWorld* ActiveWorld = WorldContexts.empty() ? nullptr : WorldContexts.back().World;
+		UWorldPartitionManager* Partition = ActiveWorld ? ActiveWorld->GetPartitionManager() : nullptr;
+		if (!Partition)
+		{
+			AddLog("Streaming: no world partition in active world");
+		}
+		else if (Strnicmp(command_line, "STREAMING OPEN", 14) == 0)
+		{
+			char ManifestPath[512] = {};
+			if (sscanf_s(command_line + 14, "%511s", ManifestPath, (unsigned)_countof(ManifestPath)) != 1)
+			{
+				AddLog("Usage: STREAMING OPEN <manifest>");
+			}
+			else if (!Partition->OpenStreaming(ActiveWorld, UTF8ToWide(ManifestPath)))
+			{
+				AddLog("Streaming: failed to open %s", ManifestPath);
+			}
+		}
+		else
+		{
+			// 렌더링 없이 셀 그리드를 따라 비행하며 스트리밍 히치를 측정 (60Hz 프레임 간격)
+			FWorldPartitionStreaming* Streaming = Partition->GetStreaming();
+			float Speed = 20.0f;
+			sscanf_s(command_line + 14, "%f", &Speed);
+			if (!Streaming || !Streaming->IsActive())
+			{
+				AddLog("Streaming: open a manifest first (STREAMING OPEN)");
+			}
+			else
+			{
+				const FStreamingFlythroughResult Result = Streaming->RunFlythrough(Streaming->MakeDefaultFlythroughPath(), Speed, 1.0f / 60.0f);
+				AddLog("Streaming test: %d frames, avg %.3f ms, max %.3f ms", Result.Frames, Result.AvgFrameMS, Result.MaxFrameMS);
+				AddLog("  Hitch frames (> %.1f ms): %d, late cell frames: %d", Streaming->HitchThresholdMS, Result.HitchFrames, Result.LateCellFrames);
+				AddLog("  Cell loads: %llu, unloads: %llu", Result.CellLoads, Result.CellUnloads);
+			}
+		}
+	}
+	else if (Stricmp(command_line, "LUA CACHE") == 0)
+	{
+		const FLuaChunkCacheStats& Stats = FLuaChunkCache::GetInstance().GetStats();
+		AddLog("Lua chunk cache: %u files", Stats.CachedFiles);
+		AddLog("  Hits: %llu, compiles: %llu (%.2f ms), .luac loads: %llu (rejected %llu), invalidations: %llu",
+			Stats.Hits, Stats.Compiles, Stats.TotalCompileMS, Stats.BytecodeFileLoads, Stats.BytecodeFileRejects, Stats.Invalidations);
+	}
+	else if (Stricmp(command_line, "LUA RELOAD") == 0)
+	{
+		// 수정된 스크립트만 버린다 (다음 BeginPlay부터 새 코드로 인스턴스 생성)
+		const int32 Invalidated = FLuaChunkCache::GetInstance().InvalidateChangedFiles();
+		AddLog("Lua: %d changed script(s) invalidated", Invalidated);
+	}
+	else if (Strnicmp(command_line, "LUA COOK", 8) == 0)
+	{
+		// 스크립트 옆에 미리 컴파일한 바이트코드(.luac)를 생성
+		char Directory[512] = "Data/Scripts";
+		sscanf_s(command_line + 8, "%511s", Directory, (unsigned)_countof(Directory));
+
+		const TArray<FWorldContext>& WorldContexts = GEngine.GetWorldContexts();
+		UWorld* ActiveWorld = WorldContexts.empty() ? nullptr : WorldContexts.back().World;
+		FLuaManager* LuaManager = ActiveWorld ? ActiveWorld->GetLuaManager() : nullptr;
+		if (!LuaManager)
+		{
+			AddLog("Lua: no Lua manager in active world");
+		}
+		else
+		{
+			FString Message;
+			FLuaChunkCache::GetInstance().CookDirectory(LuaManager->GetState(), Directory, Message);
+			AddLog("Lua cook %s: %s", Directory, Message.c_str());
+		}
+	}
+	else if (Strnicmp(command_line, "LUA COROBENCH", 13) == 0)
+	{
+		// 잠든 코루틴 다수를 별도 스케줄러에 올려 프레임당 스케줄링 비용을 측정
+		int Count = 10000;
+		int Frames = 600;
+		sscanf_s(command_line + 13, "%d %d", &Count, &Frames);
+
+		const TArray<FWorldContext>& WorldContexts = GEngine.GetWorldContexts();
+		UWorld* ActiveWorld = WorldContexts.empty() ? nullptr : WorldContexts.back().World;
+		FLuaManager* LuaManager = ActiveWorld ? ActiveWorld->GetLuaManager() : nullptr;
+		if (!LuaManager)
+		{
+			AddLog("Lua: no Lua manager in active world");
+		}
+		else
+		{
+			const FLuaCoroBenchmarkResult Result = FLuaCoroutineScheduler::RunBenchmark(LuaManager->GetState(), std::max(Count, 1), std::max(Frames, 1));
+			AddLog("Coroutine bench: %d coroutines, %d frames (register %.2f ms)", Result.NumCoroutines, Result.Frames, Result.RegisterMS);
+			AddLog("  Tick avg %.4f ms, max %.4f ms, resumes %llu", Result.AvgTickMS, Result.MaxTickMS, Result.Resumes);
+		}
+	}
 	else if (Stricmp(command_line, "MINIDUMP") == 0)
 	{
 		AddLog("Generating MiniDump...");
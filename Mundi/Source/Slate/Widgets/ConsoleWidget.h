@@ -2,6 +2,7 @@
 #include "Widget.h"
 #include "Vector.h"
 #include "ImGui/imgui.h"
+#include "Logging.h"
 
 /**
  * @brief Console Widget for displaying log messages and executing commands
@@ -31,7 +32,7 @@ public:
 private:
 	// Console data
 	char InputBuf[256];
-	TArray<FString> Items;           // Log items
+	TArray<FConsoleLogLine> Items;   // Log items (최대 MaxItems, 넘으면 오래된 줄부터 버림)
 	TArray<FString> HelpCommandList;        // Available commands
 	TArray<FString> History;         // Command history
 	int32 HistoryPos;                // -1: new line, 0..History.Size-1 browsing history
@@ -43,7 +44,11 @@ private:
 
 	bool bIsWindowPinned;    // 콘솔 창 고정(핀) 상태
 
+	static constexpr int32 MaxItems = 8192;
+
 	// Helper methods
+	void AddItem(FConsoleLogLine&& InLine);
+	void TrimItems();
 	static int TextEditCallbackStub(ImGuiInputTextCallbackData* data);
 	int TextEditCallback(ImGuiInputTextCallbackData* data);
 
@@ -32,7 +32,8 @@ USceneManagerWidget::USceneManagerWidget()
 
 USceneManagerWidget::~USceneManagerWidget()
 {
-	ClearActorTree();
+	UnbindFromWorld();
+	ClearNodes();
 }
 
 void USceneManagerWidget::Initialize()
@@ -47,71 +48,20 @@ void USceneManagerWidget::LoadIcons()
 
 void USceneManagerWidget::Update()
 {
-	// 지연된 새로고침 처리 (렌더링 중 iterator invalidation 방지)
-	if (bNeedRefreshNextFrame)
-	{
-		RefreshActorTree();
-		bNeedRefreshNextFrame = false;
-		return; // 이번 프레임은 새로고침만 하고 끝
-	}
-
-	// 액터 수 변화 감지만 수행 (최소한의 검사)
-	static size_t LastActorCount = 0;
-
 	UWorld* World = GWorld;
-	static ULevel* LastLevel = nullptr; // 레벨이 새로 로드됐는지 감지하기 위함.
-
-	if (World)
+	if (World != BoundWorld.Get())
 	{
-		size_t CurrentActorCount = World->GetActors().size();
-		ULevel* CurrentLevel = World->GetLevel();
-		if (CurrentActorCount != LastActorCount || CurrentLevel != LastLevel)
-		{
-			RefreshActorTree();
-			LastActorCount = CurrentActorCount;
-			LastLevel = CurrentLevel;
-			return; // 새로고침 후 이번 프레임은 더 이상 처리하지 않음
-		}
-
-		// 비용이 많이 드는 유효성 검사를 5초마다만 수행
-		static int32 ValidationCounter = 0;
-		ValidationCounter++;
-		if (ValidationCounter % 300 == 0) // 5초마다 (60FPS 기준)
-		{
-			// 느린 유효성 검사 - 몇 개만 샘플링
-			bool bNeedRefresh = false;
-			const TArray<AActor*>& WorldActors = World->GetActors();
-
-			// 전체 검사 대신 몇 개만 샘플링
-			int32 CheckCount = 0;
-			for (auto* RootNode : RootNodes)
-			{
-				if (++CheckCount > 10) break; // 최대 10개만 검사
-
-				if (RootNode && RootNode->IsActor())
-				{
-					if (!RootNode->Actor ||
-						std::find(WorldActors.begin(), WorldActors.end(), RootNode->Actor) == WorldActors.end())
-					{
-						bNeedRefresh = true;
-						break;
-					}
-				}
-			}
-
-			if (bNeedRefresh)
-			{
-				RequestDelayedRefresh();
-				return;
-			}
-		}
+		BindToWorld(World);
 	}
-	else if (LastActorCount != 0)
+
+	if (!World)
 	{
-		RefreshActorTree();
-		LastActorCount = 0;
+		return;
 	}
 
+	// 이벤트로 쌓인 변경분을 한 번에 반영 (렌더링 중 컨테이너 변경 방지)
+	FlushPendingChanges();
+
 	// Sync selection from viewport
 	SyncSelectionFromViewport();
 
@@ -191,36 +141,67 @@ void USceneManagerWidget::RenderWidget()
 		return;
 	}
 
-	// Actor tree view
+	// Search filter
+	ImGui::SetNextItemWidth(-1.0f);
+	if (ImGui::InputTextWithHint("##OutlinerSearch", "Search...", SearchBuffer, sizeof(SearchBuffer)))
+	{
+		FString NewFilter = SearchBuffer;
+		std::transform(NewFilter.begin(), NewFilter.end(), NewFilter.begin(),
+			[](unsigned char C) { return static_cast<char>(std::tolower(C)); });
+		if (NewFilter != SearchFilterLower)
+		{
+			SearchFilterLower = NewFilter;
+			RebuildVisibleRows();
+		}
+	}
+
+	// Actor list view
 	// 사용 가능한 영역에서 하단 상태 표시줄을 위한 공간을 제외하고 모두 사용
 	float availableHeight = ImGui::GetContentRegionAvail().y - 30.0f; // 하단 액터 카운트 공간 확보
 	ImGui::BeginChild("ActorTreeView", ImVec2(0, availableHeight), true);
 
-	// 유효성 검사는 Update()에서 처리했으므로 여기서는 바로 렌더링
-	if (bNeedRefreshNextFrame)
+	// 아직 Update에서 새 월드/레벨을 반영하지 않았다면 이전 노드를 그리지 않는다
+	if (bNeedFullRebuild || World != BoundWorld.Get())
 	{
 		ImGui::Text("로딩 중...");
 	}
 	else
 	{
-		// 빠른 렌더링 - 중복 검사 없이 바로 출력
-		for (auto* RootNode : RootNodes)
+		// 화면에 보이는 행만 위젯을 생성 (행 높이는 첫 행으로 측정)
+		ImGuiListClipper Clipper;
+		Clipper.Begin(static_cast<int>(VisibleRows.Num()));
+		while (Clipper.Step())
 		{
-			if (RootNode)
+			for (int Row = Clipper.DisplayStart; Row < Clipper.DisplayEnd; ++Row)
 			{
-				// Categories are always shown, individual actors are filtered
-				if (RootNode->IsCategory() || ShouldShowActor(RootNode->Actor))
+				FOutlinerNode& Node = Nodes[VisibleRows[Row]];
+				if (Node.Actor)
 				{
-					RenderActorNode(RootNode);
+					RenderActorRow(Node);
+				}
+				else
+				{
+					// 이번 프레임에 제거된 행 - 자리만 유지하고 다음 Update에서 정리
+					ImGui::TextDisabled("-");
 				}
 			}
 		}
+		Clipper.End();
 	}
 
+	RenderRenamePopup();
+
 	ImGui::EndChild();
 
 	ImGui::Dummy(ImVec2(0, 1.0f));
-	ImGui::Text("%zu개 액터", World->GetActors().size());
+	if (SearchFilterLower.empty())
+	{
+		ImGui::Text("%zu개 액터", World->GetActors().size());
+	}
+	else
+	{
+		ImGui::Text("%d / %zu개 액터", static_cast<int32>(VisibleRows.Num()), World->GetActors().size());
+	}
 
 	// Status bar
 	ImGui::SameLine();
@@ -252,62 +233,245 @@ void USceneManagerWidget::RenderWidget()
 	}
 }
 
-void USceneManagerWidget::RefreshActorTree()
+void USceneManagerWidget::BindToWorld(UWorld* World)
 {
-	UWorld* World = GWorld;
+	UnbindFromWorld();
+	ClearNodes();
+
+	BoundWorld = World;
 	if (!World)
 	{
-		ClearActorTree();
+		bNeedFullRebuild = false;
 		return;
 	}
 
-	// Clear existing tree
-	ClearActorTree();
+	ActorAddedHandle = World->OnActorAdded.AddDynamic(this, &USceneManagerWidget::HandleActorAdded);
+	ActorRemovedHandle = World->OnActorRemoved.AddDynamic(this, &USceneManagerWidget::HandleActorRemoved);
+	ActorRenamedHandle = World->OnActorRenamed.AddDynamic(this, &USceneManagerWidget::HandleActorRenamed);
+	LevelChangedHandle = World->OnLevelChanged.AddDynamic(this, &USceneManagerWidget::HandleLevelChanged);
+	bNeedFullRebuild = true;
+}
 
-	// Build new hierarchy
-	BuildActorHierarchy();
+void USceneManagerWidget::UnbindFromWorld()
+{
+	// 이미 파괴된 월드라면 델리게이트도 함께 사라졌으므로 해제할 필요가 없다
+	if (UWorld* World = BoundWorld.Get())
+	{
+		World->OnActorAdded.Remove(ActorAddedHandle);
+		World->OnActorRemoved.Remove(ActorRemovedHandle);
+		World->OnActorRenamed.Remove(ActorRenamedHandle);
+		World->OnLevelChanged.Remove(LevelChangedHandle);
+	}
+	BoundWorld = nullptr;
+	ActorAddedHandle = ActorRemovedHandle = ActorRenamedHandle = LevelChangedHandle = 0;
 }
 
-void USceneManagerWidget::BuildActorHierarchy()
+void USceneManagerWidget::HandleActorAdded(AActor* Actor)
 {
-	UWorld* World = GWorld;
+	// 스폰 직후에는 이름/아웃라이너 숨김 설정이 끝나지 않았을 수 있으므로 다음 Update에서 노드를 만든다
+	if (Actor && !bNeedFullRebuild)
+	{
+		PendingAdds.Add(Actor);
+	}
+}
+
+void USceneManagerWidget::HandleActorRemoved(AActor* Actor)
+{
+	auto It = std::find(PendingAdds.begin(), PendingAdds.end(), Actor);
+	if (It != PendingAdds.end())
+	{
+		PendingAdds.erase(It);
+	}
+
+	if (int32* NodeIndex = ActorToNode.Find(Actor))
+	{
+		const int32 Index = *NodeIndex;
+		ActorToNode.Remove(Actor);
+		// 슬롯은 행 정리 후 재사용되도록 Actor만 비워둔다 (렌더링 중 제거되어도 안전)
+		Nodes[Index].Actor = nullptr;
+		bHasRemovedNodes = true;
+	}
+
+	if (DragSource == Actor) DragSource = nullptr;
+	if (DropTarget == Actor) DropTarget = nullptr;
+}
+
+void USceneManagerWidget::HandleActorRenamed(AActor* Actor)
+{
+	if (int32* NodeIndex = ActorToNode.Find(Actor))
+	{
+		UpdateNodeName(Nodes[*NodeIndex]);
+		if (!SearchFilterLower.empty())
+		{
+			bNeedRefilter = true;
+		}
+	}
+}
+
+void USceneManagerWidget::HandleLevelChanged()
+{
+	// 이전 레벨의 액터는 이미 해제되었으므로 포인터를 역참조하지 않고 버린다
+	ClearNodes();
+	bNeedFullRebuild = true;
+}
+
+void USceneManagerWidget::ClearNodes()
+{
+	Nodes.Empty();
+	FirstFreeNode = -1;
+	ActorToNode.clear();
+	NodeOrder.Empty();
+	VisibleRows.Empty();
+	PendingAdds.Empty();
+	bHasRemovedNodes = false;
+	bNeedRefilter = false;
+	DragSource = nullptr;
+	DropTarget = nullptr;
+}
+
+void USceneManagerWidget::RebuildAllNodes()
+{
+	ClearNodes();
+	bNeedFullRebuild = false;
+
+	UWorld* World = BoundWorld.Get();
 	if (!World)
 		return;
 
-	// Build categorized hierarchy instead of flat
-	BuildCategorizedHierarchy();
+	const TArray<AActor*>& Actors = World->GetActors();
+	Nodes.Reserve(Actors.Num());
+	NodeOrder.Reserve(Actors.Num());
+	ActorToNode.reserve(Actors.Num());
+
+	for (AActor* Actor : Actors)
+	{
+		if (Actor && !Actor->IsPendingDestroy())
+		{
+			AddNode(Actor);
+		}
+	}
+
+	RebuildVisibleRows();
 }
 
-void USceneManagerWidget::RenderActorNode(FActorTreeNode* Node, int32 Depth)
+int32 USceneManagerWidget::AddNode(AActor* Actor)
 {
-	if (!Node)
-		return;
+	if (ActorToNode.Contains(Actor))
+		return ActorToNode[Actor];
 
-	// Handle category nodes
-	if (Node->IsCategory())
+	int32 Index;
+	if (FirstFreeNode != -1)
 	{
-		RenderCategoryNode(Node, Depth);
-		return;
+		Index = FirstFreeNode;
+		FirstFreeNode = Nodes[Index].NextFree;
 	}
+	else
+	{
+		Index = static_cast<int32>(Nodes.Num());
+		Nodes.Add(FOutlinerNode());
+	}
+
+	FOutlinerNode& Node = Nodes[Index];
+	Node.Actor = Actor;
+	Node.NextFree = -1;
+	UpdateNodeName(Node);
 
-	// Handle actor nodes
-	if (!Node->Actor)
-		return; // 이미 사전 검사에서 걸러졌어야 하지만 방어 코드
+	ActorToNode.Add(Actor, Index);
+	NodeOrder.Add(Index);
+	return Index;
+}
 
-	AActor* Actor = Node->Actor;
+void USceneManagerWidget::FreeNode(int32 NodeIndex)
+{
+	FOutlinerNode& Node = Nodes[NodeIndex];
+	Node.Actor = nullptr;
+	Node.DisplayName.clear();
+	Node.NameLower.clear();
+	Node.NextFree = FirstFreeNode;
+	FirstFreeNode = NodeIndex;
+}
 
-	// 중요: 액터가 이미 삭제되었는지 확인 (IsPendingDestroy 체크)
-	if (Actor->IsPendingDestroy())
+void USceneManagerWidget::UpdateNodeName(FOutlinerNode& Node)
+{
+	Node.DisplayName = Node.Actor->GetName();
+	Node.NameLower = Node.DisplayName;
+	std::transform(Node.NameLower.begin(), Node.NameLower.end(), Node.NameLower.begin(),
+		[](unsigned char C) { return static_cast<char>(std::tolower(C)); });
+}
+
+void USceneManagerWidget::FlushPendingChanges()
+{
+	if (bNeedFullRebuild)
 	{
-		RequestDelayedRefresh(); // 다음 프레임에 트리 새로고침 요청
+		RebuildAllNodes();
 		return;
 	}
 
-	// Skip if doesn't pass filters
-	if (!ShouldShowActor(Actor))
+	// 1) 제거된 노드: 행 목록에서 빼고 슬롯을 프리 리스트로 반환 (추가보다 먼저 처리해야 슬롯 재사용이 안전)
+	if (bHasRemovedNodes)
+	{
+		auto IsRemoved = [this](int32 Index) { return Nodes[Index].Actor == nullptr; };
+		VisibleRows.erase(std::remove_if(VisibleRows.begin(), VisibleRows.end(), IsRemoved), VisibleRows.end());
+
+		auto NewEnd = std::remove_if(NodeOrder.begin(), NodeOrder.end(), IsRemoved);
+		for (auto It = NewEnd; It != NodeOrder.end(); ++It)
+		{
+			FreeNode(*It);
+		}
+		NodeOrder.erase(NewEnd, NodeOrder.end());
+		bHasRemovedNodes = false;
+	}
+
+	// 2) 추가된 액터: 필터를 통과하면 행 끝에 붙인다
+	if (!PendingAdds.IsEmpty())
+	{
+		for (AActor* Actor : PendingAdds)
+		{
+			if (!Actor || ActorToNode.Contains(Actor))
+				continue;
+
+			const int32 Index = AddNode(Actor);
+			if (!bNeedRefilter && ShouldShowNode(Nodes[Index]))
+			{
+				VisibleRows.Add(Index);
+			}
+		}
+		PendingAdds.Empty();
+	}
+
+	// 3) 필터 결과가 바뀔 수 있는 변경 (필터 중 이름 변경)
+	if (bNeedRefilter)
+	{
+		RebuildVisibleRows();
+	}
+}
+
+void USceneManagerWidget::RebuildVisibleRows()
+{
+	VisibleRows.Empty();
+	VisibleRows.Reserve(NodeOrder.Num());
+	for (int32 Index : NodeOrder)
+	{
+		if (ShouldShowNode(Nodes[Index]))
+		{
+			VisibleRows.Add(Index);
+		}
+	}
+	bNeedRefilter = false;
+}
+
+void USceneManagerWidget::RenderActorRow(FOutlinerNode& Node)
+{
+	AActor* Actor = Node.Actor;
+
+	// 파괴 예약된 액터는 실제 제거 이벤트가 올 때까지 그리지 않는다
+	if (Actor->IsPendingDestroy())
+	{
+		ImGui::TextDisabled("%s", Node.DisplayName.c_str());
 		return;
+	}
 
-	ImGuiTreeNodeFlags NodeFlags = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_SpanAvailWidth;
+	ImGuiTreeNodeFlags NodeFlags = ImGuiTreeNodeFlags_SpanAvailWidth | ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen;
 
 	// Check if selected
 	bool bIsSelected = false;
@@ -320,20 +484,12 @@ void USceneManagerWidget::RenderActorNode(FActorTreeNode* Node, int32 Depth)
 		NodeFlags |= ImGuiTreeNodeFlags_Selected;
 	}
 
-	// Leaf node if no children
-	if (Node->Children.empty())
-	{
-		NodeFlags |= ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen;
-	}
-
 	// Create unique ID for ImGui
 	ImGui::PushID(Actor);
 
-	// Sync node visibility with actual actor state each frame
-	Node->bIsVisible = Actor->IsActorVisible();
-
-	// Visibility toggle button (only for actors)
-	UTexture* CurrentIcon = Node->bIsVisible ? IconVisible : IconHidden;
+	// Visibility toggle button
+	const bool bIsVisible = Actor->IsActorVisible();
+	UTexture* CurrentIcon = bIsVisible ? IconVisible : IconHidden;
 	if (CurrentIcon && CurrentIcon->GetShaderResourceView())
 	{
 		ImGui::PushStyleColor(ImGuiCol_Button, ImVec4(0, 0, 0, 0));
@@ -351,7 +507,7 @@ void USceneManagerWidget::RenderActorNode(FActorTreeNode* Node, int32 Depth)
 	{
 		// Fallback to text if icon not loaded
 		ImGui::PushStyleColor(ImGuiCol_Button, ImVec4(0, 0, 0, 0));
-		const char* VisibilityIcon = Node->bIsVisible ? "O" : "X";
+		const char* VisibilityIcon = bIsVisible ? "O" : "X";
 		if (ImGui::SmallButton(VisibilityIcon))
 		{
 			HandleActorVisibilityToggle(Actor);
@@ -361,8 +517,8 @@ void USceneManagerWidget::RenderActorNode(FActorTreeNode* Node, int32 Depth)
 
 	ImGui::SameLine(0, 1.0f);
 
-	// Actor name and tree node
-	bool bNodeOpen = ImGui::TreeNodeEx(Actor->GetName().c_str(), NodeFlags);
+	// Actor name
+	ImGui::TreeNodeEx(Node.DisplayName.c_str(), NodeFlags);
 
 	// Handle selection
 	if (ImGui::IsItemClicked())
@@ -395,7 +551,7 @@ void USceneManagerWidget::RenderActorNode(FActorTreeNode* Node, int32 Depth)
 	if (ImGui::BeginDragDropSource())
 	{
 		ImGui::SetDragDropPayload("ACTOR_DRAG", &Actor, sizeof(AActor*));
-		ImGui::Text("Move %s", Actor->GetName().c_str());
+		ImGui::Text("Move %s", Node.DisplayName.c_str());
 		DragSource = Actor;
 		ImGui::EndDragDropSource();
 	}
@@ -415,34 +571,20 @@ void USceneManagerWidget::RenderActorNode(FActorTreeNode* Node, int32 Depth)
 		ImGui::EndDragDropTarget();
 	}
 
-	// Render children if node is open
-	if (bNodeOpen && !Node->Children.empty())
-	{
-		for (FActorTreeNode* Child : Node->Children)
-		{
-			RenderActorNode(Child, Depth + 1);
-		}
-	}
-
-	if (bNodeOpen && !Node->Children.empty())
-	{
-		ImGui::TreePop();
-	}
-
 	ImGui::PopID();
 }
 
-bool USceneManagerWidget::ShouldShowActor(AActor* Actor) const
+bool USceneManagerWidget::ShouldShowNode(const FOutlinerNode& Node) const
 {
-	if (!Actor)
+	if (!Node.Actor)
 		return false;
 
 	// 시스템 액터는 아웃라이너에서 숨김
-	if (Actor->IsHiddenInOutliner())
+	if (Node.Actor->IsHiddenInOutliner())
 		return false;
 
-	// Filter by selection
-	if (bShowOnlySelectedObjects && !SelectionManager->IsActorSelected(Actor))
+	// Filter by name (미리 만들어 둔 소문자 이름으로 검색)
+	if (!SearchFilterLower.empty() && Node.NameLower.find(SearchFilterLower) == FString::npos)
 		return false;
 
 	return true;
@@ -473,20 +615,62 @@ void USceneManagerWidget::HandleActorVisibilityToggle(AActor* Actor)
 	bool bNewVisible = Actor->GetActorHiddenInEditor(); // If hidden, make visible
 	Actor->SetActorHiddenInEditor(!bNewVisible);
 
-	// Update the node to match the actor's state
-	FActorTreeNode* Node = FindNodeByActor(Actor);
-	if (Node)
-	{
-		Node->bIsVisible = Actor->IsActorVisible();
-		UE_LOG("SceneManager: Toggled visibility for %s: %s",
-			Actor->GetName().c_str(), Node->bIsVisible ? "Visible" : "Hidden");
-	}
+	UE_LOG("SceneManager: Toggled visibility for %s: %s",
+		Actor->GetName().c_str(), Actor->IsActorVisible() ? "Visible" : "Hidden");
 }
 
 void USceneManagerWidget::HandleActorRename(AActor* Actor)
 {
-	// TODO: Implement inline renaming
-	UE_LOG("SceneManager: Rename not implemented yet");
+	if (!Actor)
+		return;
+
+	// 컨텍스트 메뉴 안에서는 팝업을 열 수 없으므로 다음 렌더링에서 연다
+	RenameTarget = Actor;
+	strncpy_s(RenameBuffer, Actor->GetName().c_str(), _TRUNCATE);
+	bOpenRenamePopup = true;
+}
+
+void USceneManagerWidget::RenderRenamePopup()
+{
+	if (bOpenRenamePopup)
+	{
+		ImGui::OpenPopup("RenameActorPopup");
+		bOpenRenamePopup = false;
+	}
+
+	if (!ImGui::BeginPopup("RenameActorPopup"))
+		return;
+
+	AActor* Target = RenameTarget.Get();
+	if (!Target || Target->IsPendingDestroy())
+	{
+		ImGui::CloseCurrentPopup();
+		ImGui::EndPopup();
+		return;
+	}
+
+	ImGui::Text("Rename %s", Target->GetName().c_str());
+	if (ImGui::IsWindowAppearing())
+	{
+		ImGui::SetKeyboardFocusHere();
+	}
+	if (ImGui::InputText("##RenameActor", RenameBuffer, sizeof(RenameBuffer), ImGuiInputTextFlags_EnterReturnsTrue | ImGuiInputTextFlags_AutoSelectAll))
+	{
+		if (RenameBuffer[0] != '\0')
+		{
+			if (UWorld* World = Target->GetWorld())
+			{
+				World->RenameActor(Target, FName(FString(RenameBuffer)));
+			}
+		}
+		ImGui::CloseCurrentPopup();
+	}
+	if (ImGui::IsKeyPressed(ImGuiKey_Escape))
+	{
+		ImGui::CloseCurrentPopup();
+	}
+
+	ImGui::EndPopup();
 }
 
 void USceneManagerWidget::HandleActorDelete(AActor* Actor)
@@ -570,44 +754,6 @@ void USceneManagerWidget::RenderToolbar()
 {
 }
 
-void USceneManagerWidget::ClearActorTree()
-{
-	for (auto* Node : RootNodes)
-	{
-		delete Node;
-	}
-	RootNodes.clear();
-}
-
-USceneManagerWidget::FActorTreeNode* USceneManagerWidget::FindNodeByActor(AActor* Actor)
-{
-	if (!Actor)
-		return nullptr;
-
-	// Search through categories and their children
-	for (FActorTreeNode* RootNode : RootNodes)
-	{
-		if (!RootNode)
-			continue;
-
-		// Check if this root node is the actor (for backward compatibility)
-		if (RootNode->IsActor() && RootNode->Actor == Actor)
-			return RootNode;
-
-		// Search within category children
-		if (RootNode->IsCategory())
-		{
-			for (FActorTreeNode* Child : RootNode->Children)
-			{
-				if (Child && Child->IsActor() && Child->Actor == Actor)
-					return Child;
-			}
-		}
-	}
-
-	return nullptr;
-}
-
 void USceneManagerWidget::SyncSelectionFromViewport()
 {
 	// SelectionManager에서 null 액터들을 정리
@@ -630,227 +776,3 @@ void USceneManagerWidget::SyncSelectionFromViewport()
 void USceneManagerWidget::SyncSelectionToViewport(AActor* Actor)
 {
 }
-
-// Category Management Implementation
-FString USceneManagerWidget::GetActorCategory(AActor* Actor) const
-{
-	if (!Actor)
-		return "Unknown";
-
-	FString ActorName = Actor->GetName();
-
-	// Extract category from actor name (assumes format: "Type_Number")
-	size_t UnderscorePos = ActorName.find('_');
-	if (UnderscorePos != std::string::npos)
-	{
-		return ActorName.substr(0, UnderscorePos);
-	}
-
-	// Fallback: use the full name as category if no underscore found
-	return ActorName;
-}
-
-USceneManagerWidget::FActorTreeNode* USceneManagerWidget::FindOrCreateCategoryNode(const FString& CategoryName)
-{
-	// Look for existing category node in root nodes
-	for (FActorTreeNode* Node : RootNodes)
-	{
-		if (Node && Node->IsCategory() && Node->CategoryName == CategoryName)
-		{
-			return Node;
-		}
-	}
-
-	// Create new category node if not found
-	FActorTreeNode* CategoryNode = new FActorTreeNode(CategoryName);
-	RootNodes.push_back(CategoryNode);
-	return CategoryNode;
-}
-
-void USceneManagerWidget::BuildCategorizedHierarchy()
-{
-	UWorld* World = GWorld;
-	if (!World)
-		return;
-
-	const TArray<AActor*>& Actors = World->GetActors();
-
-	// Group actors by category
-	for (AActor* Actor : Actors)
-	{
-		if (!Actor)
-			continue;
-
-		// Create actor node and add to category
-		FActorTreeNode* ActorNode = new FActorTreeNode(Actor);
-		ActorNode->Parent = nullptr;
-		// Initialize node visibility from actor's actual visibility state
-		ActorNode->bIsVisible = Actor->IsActorVisible();
-		RootNodes.Add(ActorNode);
-	}
-
-	// Initialize category visibility based on child actors
-	for (FActorTreeNode* CategoryNode : RootNodes)
-	{
-		if (CategoryNode && CategoryNode->IsCategory())
-		{
-			// Category is visible if any child is visible
-			bool bAnyCategoryChildVisible = false;
-			for (FActorTreeNode* Child : CategoryNode->Children)
-			{
-				if (Child && Child->bIsVisible)
-				{
-					bAnyCategoryChildVisible = true;
-					break;
-				}
-			}
-			CategoryNode->bIsVisible = bAnyCategoryChildVisible;
-		}
-	}
-}
-
-void USceneManagerWidget::HandleCategorySelection(FActorTreeNode* CategoryNode)
-{
-	if (!CategoryNode || !CategoryNode->IsCategory())
-		return;
-
-	// Toggle category expansion
-	CategoryNode->bIsExpanded = !CategoryNode->bIsExpanded;
-
-	UE_LOG("SceneManager: Toggled category %s: %s",
-		CategoryNode->CategoryName.c_str(),
-		CategoryNode->bIsExpanded ? "Expanded" : "Collapsed");
-}
-
-void USceneManagerWidget::HandleCategoryVisibilityToggle(FActorTreeNode* CategoryNode)
-{
-	if (!CategoryNode || !CategoryNode->IsCategory())
-		return;
-
-	// Toggle category visibility
-	CategoryNode->bIsVisible = !CategoryNode->bIsVisible;
-
-	// Apply visibility to all child actors
-	for (FActorTreeNode* Child : CategoryNode->Children)
-	{
-		if (Child && Child->IsActor() && Child->Actor)
-		{
-			Child->Actor->SetActorHiddenInEditor(!CategoryNode->bIsVisible);
-			Child->bIsVisible = CategoryNode->bIsVisible;
-		}
-	}
-
-	UE_LOG("SceneManager: Toggled category visibility %s: %s",
-		CategoryNode->CategoryName.c_str(),
-		CategoryNode->bIsVisible ? "Visible" : "Hidden");
-}
-
-void USceneManagerWidget::RenderCategoryNode(FActorTreeNode* CategoryNode, int32 Depth)
-{
-	if (!CategoryNode || !CategoryNode->IsCategory())
-		return;
-
-	ImGuiTreeNodeFlags NodeFlags = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_SpanAvailWidth;
-
-	// Categories are always expandable
-	if (!CategoryNode->Children.empty())
-	{
-		if (CategoryNode->bIsExpanded)
-		{
-			NodeFlags |= ImGuiTreeNodeFlags_DefaultOpen;
-		}
-	}
-	else
-	{
-		// Empty category - show as leaf
-		NodeFlags |= ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen;
-	}
-
-	// Create unique ID for ImGui using category name
-	ImGui::PushID(CategoryNode->CategoryName.c_str());
-
-	// Category visibility toggle button
-	UTexture* CurrentIcon = CategoryNode->bIsVisible ? IconVisible : IconHidden;
-	if (CurrentIcon && CurrentIcon->GetShaderResourceView())
-	{
-		ImGui::PushStyleColor(ImGuiCol_Button, ImVec4(0, 0, 0, 0));
-		ImGui::PushStyleColor(ImGuiCol_ButtonHovered, ImVec4(0.2f, 0.2f, 0.2f, 0.5f));
-		ImGui::PushStyleColor(ImGuiCol_ButtonActive, ImVec4(0.3f, 0.3f, 0.3f, 0.7f));
-
-		if (ImGui::ImageButton("##CategoryVisibilityBtn", (void*)CurrentIcon->GetShaderResourceView(), ImVec2(IconSize, IconSize)))
-		{
-			HandleCategoryVisibilityToggle(CategoryNode);
-		}
-
-		ImGui::PopStyleColor(3);
-	}
-	else
-	{
-		// Fallback to text if icon not loaded
-		ImGui::PushStyleColor(ImGuiCol_Button, ImVec4(0, 0, 0, 0));
-		const char* VisibilityIcon = CategoryNode->bIsVisible ? "O" : "X";
-		if (ImGui::SmallButton(VisibilityIcon))
-		{
-			HandleCategoryVisibilityToggle(CategoryNode);
-		}
-		ImGui::PopStyleColor();
-	}
-
-	ImGui::SameLine(0, 2.0f); // 간격 2픽셀로 설정
-
-	// Category name with object count
-	FString DisplayText = CategoryNode->CategoryName + " (" + std::to_string(CategoryNode->Children.size()) + ")";
-	bool bNodeOpen = ImGui::TreeNodeEx(DisplayText.c_str(), NodeFlags);
-
-	// Handle category click
-	if (ImGui::IsItemClicked())
-	{
-		HandleCategorySelection(CategoryNode);
-	}
-
-	// Update expansion state based on ImGui tree state
-	CategoryNode->bIsExpanded = bNodeOpen;
-
-	// Render child actors if category is expanded
-	if (bNodeOpen && !CategoryNode->Children.empty())
-	{
-		for (FActorTreeNode* Child : CategoryNode->Children)
-		{
-			RenderActorNode(Child, Depth + 1);
-		}
-		ImGui::TreePop();
-	}
-
-	ImGui::PopID();
-}
-
-void USceneManagerWidget::ExpandAllCategories()
-{
-	for (FActorTreeNode* RootNode : RootNodes)
-	{
-		if (RootNode && RootNode->IsCategory())
-		{
-			RootNode->bIsExpanded = true;
-		}
-	}
-	UE_LOG("SceneManager: Expanded all categories");
-}
-
-void USceneManagerWidget::CollapseAllCategories()
-{
-	for (FActorTreeNode* RootNode : RootNodes)
-	{
-		if (RootNode && RootNode->IsCategory())
-		{
-			RootNode->bIsExpanded = false;
-		}
-	}
-	UE_LOG("SceneManager: Collapsed all categories");
-}
-
-FString USceneManagerWidget::FActorTreeNode::GetDisplayName() const
-{
-	if (IsCategory()) return CategoryName;
-	if (IsActor() && Actor) return Actor->GetName();
-	return "Unknown";
-}
@@ -2,6 +2,7 @@
 #include "Widget.h"
 #include "Vector.h"
 #include "UEContainer.h"
+#include "Delegates.h"
 
 class UUIManager;
 class UWorld;
@@ -11,10 +12,11 @@ class UTexture;
 
 /**
  * SceneManagerWidget
- * - Unreal Engine style hierarchical object browser
- * - Shows all actors in the world in a tree view
- * - Supports selection, visibility toggle, hierarchy management
+ * - Unreal Engine style object browser (outliner)
+ * - Shows all actors in the world as a flat list
+ * - Supports selection, visibility toggle, rename, name filter
  * - Syncs with 3D viewport selection
+ * - 월드의 액터 추가/제거/이름 변경 이벤트로 증분 갱신하고, 보이는 행만 위젯을 생성한다 (ImGuiListClipper)
  */
 class USceneManagerWidget : public UWidget
 {
@@ -30,64 +32,69 @@ public:
     ~USceneManagerWidget() override;
 
     // Public API for external refresh requests
-    void RequestImmediateRefresh() { RefreshActorTree(); }
-    void RequestDelayedRefreshPublic() { bNeedRefreshNextFrame = true; }
+    void RequestImmediateRefresh() { RebuildAllNodes(); }
+    void RequestDelayedRefreshPublic() { bNeedFullRebuild = true; }
 
 private:
     UUIManager* UIManager = nullptr;
     USelectionManager* SelectionManager = nullptr;
     
     // UI State
-    bool bShowOnlySelectedObjects = false;
-    bool bShowHiddenObjects = true;
-    FString SearchFilter = "";
-    
-    // Node types for tree hierarchy
-    enum class ETreeNodeType
-    {
-        Category,
-        Actor
-    };
-    
-    // Actor Management
-    struct FActorTreeNode
+    char SearchBuffer[128] = {};
+    FString SearchFilterLower = "";     // 검색어 (소문자)
+
+    /**
+     * 아웃라이너 노드 (풀에 평탄하게 저장, 해제된 슬롯은 프리 리스트로 재사용)
+     * 이름은 추가/이름 변경 시에만 갱신해 두어 필터링과 행 렌더링에서 액터 문자열을 다시 만들지 않는다.
+     */
+    struct FOutlinerNode
     {
-        ETreeNodeType NodeType = ETreeNodeType::Actor;
-        AActor* Actor = nullptr;
-        FString CategoryName = "";
-        TArray<FActorTreeNode*> Children;
-        FActorTreeNode* Parent = nullptr;
-        bool bIsExpanded = true;
-        bool bIsVisible = true;
-        
-        // Constructor for Actor node
-        FActorTreeNode(AActor* InActor) : NodeType(ETreeNodeType::Actor), Actor(InActor) {}
-        
-        // Constructor for Category node
-        FActorTreeNode(const FString& InCategoryName) : NodeType(ETreeNodeType::Category), CategoryName(InCategoryName) {}
-        
-        ~FActorTreeNode() 
-        {
-            for (auto* Child : Children)
-            {
-                delete Child;
-            }
-        }
-        
-        // Helper methods
-        bool IsCategory() const { return NodeType == ETreeNodeType::Category; }
-        bool IsActor() const { return NodeType == ETreeNodeType::Actor; }
-        FString GetDisplayName() const;
+        AActor* Actor = nullptr;        // nullptr이면 빈 슬롯
+        FString DisplayName;
+        FString NameLower;              // 필터 검색용 소문자 이름
+        int32 NextFree = -1;
     };
-    
-    TArray<FActorTreeNode*> RootNodes;
-    
+
+    TArray<FOutlinerNode> Nodes;
+    int32 FirstFreeNode = -1;
+    TMap<AActor*, int32> ActorToNode;
+
+    TArray<int32> NodeOrder;            // 살아있는 노드 (추가 순서)
+    TArray<int32> VisibleRows;          // 필터를 통과한 노드 (렌더링 대상)
+    TArray<AActor*> PendingAdds;        // 다음 Update에서 노드로 만들 액터
+
+    bool bNeedFullRebuild = true;       // 월드/레벨 교체 → 전체 재구축
+    bool bHasRemovedNodes = false;      // 빈 슬롯을 가리키는 행 정리 필요
+    bool bNeedRefilter = false;         // 필터 변경 → VisibleRows 재계산
+
+    // World event binding
+    TWeakObjectPtr<UWorld> BoundWorld;
+    FDelegateHandle ActorAddedHandle = 0;
+    FDelegateHandle ActorRemovedHandle = 0;
+    FDelegateHandle ActorRenamedHandle = 0;
+    FDelegateHandle LevelChangedHandle = 0;
+
+    void BindToWorld(UWorld* World);
+    void UnbindFromWorld();
+
+    // World events
+    void HandleActorAdded(AActor* Actor);
+    void HandleActorRemoved(AActor* Actor);
+    void HandleActorRenamed(AActor* Actor);
+    void HandleLevelChanged();
+
+    // Node store
+    void ClearNodes();
+    void RebuildAllNodes();
+    int32 AddNode(AActor* Actor);
+    void FreeNode(int32 NodeIndex);
+    void UpdateNodeName(FOutlinerNode& Node);
+    void FlushPendingChanges();
+    void RebuildVisibleRows();
+
     // Helper Methods
-    void RefreshActorTree();
-    void BuildActorHierarchy();
-    void RenderActorNode(FActorTreeNode* Node, int32 Depth = 0);
-    void RenderCategoryNode(FActorTreeNode* CategoryNode, int32 Depth = 0);
-    bool ShouldShowActor(AActor* Actor) const;
+    void RenderActorRow(FOutlinerNode& Node);
+    bool ShouldShowNode(const FOutlinerNode& Node) const;
     void HandleActorSelection(AActor* Actor);
     void HandleActorVisibilityToggle(AActor* Actor);
     void HandleActorRename(AActor* Actor);
@@ -99,6 +106,12 @@ private:
     
     // Context Menu
     void RenderContextMenu(AActor* TargetActor);
+
+    // Inline rename
+    TWeakObjectPtr<AActor> RenameTarget;
+    char RenameBuffer[256] = {};
+    bool bOpenRenamePopup = false;
+    void RenderRenamePopup();
     
     // Drag & Drop (for hierarchy management)
     AActor* DragSource = nullptr;
@@ -109,27 +122,9 @@ private:
     // Toolbar
     void RenderToolbar();
     
-    // Tree management
-    void ClearActorTree();
-    FActorTreeNode* FindNodeByActor(AActor* Actor);
-    void ExpandParentsOfSelected();
-    
-    // Category management
-    FActorTreeNode* FindOrCreateCategoryNode(const FString& CategoryName);
-    FString GetActorCategory(AActor* Actor) const;
-    void BuildCategorizedHierarchy();
-    void HandleCategorySelection(FActorTreeNode* CategoryNode);
-    void HandleCategoryVisibilityToggle(FActorTreeNode* CategoryNode);
-    void ExpandAllCategories();
-    void CollapseAllCategories();
-    
     // Selection synchronization
     void SyncSelectionFromViewport();
     void SyncSelectionToViewport(AActor* Actor);
-    
-    // Delayed refresh (to avoid iterator invalidation during rendering)
-    bool bNeedRefreshNextFrame = false;
-    void RequestDelayedRefresh() { bNeedRefreshNextFrame = true; }
 
     // Visibility icons
     UTexture* IconVisible = nullptr;
@@ -1787,6 +1787,24 @@ void SViewportWindow::RenderShowFlagDropdownMenu()
 			ImGui::SetTooltip("그림자를 표시합니다.");
 		}
 
+		// 그림자 캐싱
+		bool bShadowCaching = RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_ShadowCaching);
+		if (ImGui::Checkbox("##ShadowCaching", &bShadowCaching))
+		{
+			RenderSettings.ToggleShowFlag(EEngineShowFlags::SF_ShadowCaching);
+		}
+		ImGui::SameLine();
+		if (IconShadow && IconShadow->GetShaderResourceView())
+		{
+			ImGui::Image((void*)IconShadow->GetShaderResourceView(), IconSize);
+			ImGui::SameLine(0, 4);
+		}
+		ImGui::Text(" 그림자 캐싱");
+		if (ImGui::IsItemHovered())
+		{
+			ImGui::SetTooltip("라이트와 캐스터가 움직이지 않은 섀도우 뷰는 다시 그리지 않고 재사용합니다.");
+		}
+
 		// --- 섹션: 그래픽스 기능 ---
 		ImGui::TextColored(ImVec4(0.6f, 0.6f, 0.6f, 1.0f), "그래픽스 기능");
 		ImGui::Separator();
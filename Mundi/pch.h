@@ -52,6 +52,8 @@
 #include "ResourceData.h"
 #include "VertexData.h"
 #include "UEContainer.h"
+#include "FlatHashMap.h"
+#include "ContainerAllocators.h"
 #include "Name.h"
 #include "PathUtils.h"
 #include "Object.h"